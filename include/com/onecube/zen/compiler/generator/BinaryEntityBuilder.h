@@ -25,6 +25,7 @@
 #include <com/onecube/zen/compiler/generator/DataChannel.h>
 
 #include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/StackMapTableAttribute.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolEntry.h>
 
 /*******************************************************************************
@@ -250,6 +251,14 @@ void zen_BinaryEntityBuilder_writeInstructionAttributeHeader(zen_BinaryEntityBui
 
 void zen_BinaryEntityBuilder_writeExceptionTableHeader(zen_BinaryEntityBuilder_t* builder, uint16_t size);
 
+// Stack Map Table Attribute
+
+/**
+ * @memberof BinaryEntityBuilder
+ */
+void zen_BinaryEntityBuilder_writeStackMapTableAttribute(zen_BinaryEntityBuilder_t* builder,
+    zen_StackMapTableAttribute_t* attribute);
+
 // Instructions
 
 /* NOP */
@@ -1311,6 +1320,36 @@ void zen_BinaryEntityBuilder_emitSubtractDouble(zen_BinaryEntityBuilder_t* build
  */
 void zen_BinaryEntityBuilder_emitSwap(zen_BinaryEntityBuilder_t* builder);
 
+/* Switch */
+
+/**
+ * Emits a `switch_table` instruction. The specified array contains
+ * `high - low + 1` offsets.
+ *
+ * @memberof BinaryEntityBuilder
+ */
+void zen_BinaryEntityBuilder_emitSwitchTable(zen_BinaryEntityBuilder_t* builder,
+    int32_t defaultOffset, int32_t low, int32_t high, const int32_t* offsets);
+
+/**
+ * Emits a `switch_search` instruction. The specified keys should be sorted in
+ * ascending order, without duplicates.
+ *
+ * @memberof BinaryEntityBuilder
+ */
+void zen_BinaryEntityBuilder_emitSwitchSearch(zen_BinaryEntityBuilder_t* builder,
+    int32_t defaultOffset, int32_t count, const int32_t* keys, const int32_t* offsets);
+
+/**
+ * Emits either a `switch_table` or a `switch_search` instruction, depending on
+ * the density of the specified keys. The keys may appear in any order, but
+ * should not contain duplicates.
+ *
+ * @memberof BinaryEntityBuilder
+ */
+void zen_BinaryEntityBuilder_emitSwitch(zen_BinaryEntityBuilder_t* builder,
+    int32_t defaultOffset, int32_t count, const int32_t* keys, const int32_t* offsets);
+
 /* Throw */
 
 /**
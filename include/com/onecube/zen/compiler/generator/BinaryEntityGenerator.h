@@ -30,6 +30,7 @@
 #include <com/onecube/zen/compiler/ast/ASTNode.h>
 #include <com/onecube/zen/compiler/ast/ASTAnnotations.h>
 #include <com/onecube/zen/compiler/generator/ConstantPoolBuilder.h>
+#include <com/onecube/zen/compiler/generator/StackMapBuilder.h>
 #include <com/onecube/zen/compiler/symbol-table/SymbolTable.h>
 
 #include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
@@ -97,6 +98,13 @@ struct zen_BinaryEntityGenerator_t {
      * a variable is declared within a function scope.
      */
     int32_t m_localVariableCount;
+
+    /**
+     * The stack map builder generates the stack map table attribute of every
+     * function, which allows the garbage collector to find the references in
+     * the stack frames of the function precisely.
+     */
+    zen_StackMapBuilder_t* m_stackMapBuilder;
 };
 
 /**
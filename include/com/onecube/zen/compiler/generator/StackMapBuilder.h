@@ -0,0 +1,86 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_COMPILER_GENERATOR_STACK_MAP_BUILDER_H
+#define COM_ONECUBE_ZEN_COMPILER_GENERATOR_STACK_MAP_BUILDER_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/StackMapTableAttribute.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPool.h>
+
+/*******************************************************************************
+ * StackMapBuilder                                                             *
+ *******************************************************************************/
+
+/**
+ * The stack map builder simulates the types of the local variables and the
+ * operands along every path through the instructions of a function. It
+ * records the slots which hold references before every reachable
+ * instruction in a stack map table attribute.
+ *
+ * A slot which holds a reference along one path and a primitive value along
+ * another path cannot be used as a reference, until it is assigned again.
+ * Therefore, such slots are not recorded as references.
+ *
+ * @class StackMapBuilder
+ * @ingroup zen_compiler_generator
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_StackMapBuilder_t {
+};
+
+/**
+ * @memberof StackMapBuilder
+ */
+typedef struct zen_StackMapBuilder_t zen_StackMapBuilder_t;
+
+// Constructor
+
+/**
+ * @memberof StackMapBuilder
+ */
+zen_StackMapBuilder_t* zen_StackMapBuilder_new();
+
+// Destructor
+
+/**
+ * @memberof StackMapBuilder
+ */
+void zen_StackMapBuilder_delete(zen_StackMapBuilder_t* builder);
+
+// Build
+
+/**
+ * Builds the stack map table for the instructions of the specified attribute.
+ * The types of the parameters are read from the specified function
+ * descriptor. The receiver of an instance function occupies the first local
+ * variable.
+ *
+ * Returns null if the instructions are malformed, or the depths of the operand
+ * stack disagree where the paths meet. The stack frames of such functions are
+ * scanned conservatively.
+ *
+ * @memberof StackMapBuilder
+ */
+zen_StackMapTableAttribute_t* zen_StackMapBuilder_build(zen_StackMapBuilder_t* builder,
+    zen_InstructionAttribute_t* instructionAttribute, zen_ConstantPool_t* constantPool,
+    const uint8_t* descriptor, int32_t descriptorSize, bool instance, uint16_t nameIndex);
+
+#endif /* COM_ONECUBE_ZEN_COMPILER_GENERATOR_STACK_MAP_BUILDER_H */
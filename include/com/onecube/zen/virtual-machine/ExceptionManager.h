@@ -58,4 +58,19 @@ zen_ExceptionManager_t* zen_ExceptionManager_new(zen_VirtualMachine_t* virtualMa
  */
 void zen_ExceptionManager_delete(zen_ExceptionManager_t* manager);
 
+/* Clear */
+
+/**
+ * @memberof ExceptionManager
+ */
+bool zen_ExceptionManager_isClear(zen_ExceptionManager_t* exceptionManager);
+
+/* Raise Exception */
+
+/**
+ * @memberof ExceptionManager
+ */
+void zen_ExceptionManager_raiseException(zen_ExceptionManager_t* exceptionManager,
+    zen_Object_t* exception);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_EXCEPTION_MANAGER_H */
\ No newline at end of file
@@ -24,13 +24,17 @@
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/ExceptionManager.h>
 #include <com/onecube/zen/virtual-machine/VirtualMachineConfiguration.h>
+#include <com/onecube/zen/virtual-machine/jit/TemplateCompiler.h>
+#include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
 #include <com/onecube/zen/virtual-machine/object/Function.h>
 #include <com/onecube/zen/virtual-machine/object/NativeFunction.h>
 #include <com/onecube/zen/virtual-machine/object/ObjectArray.h>
+#include <com/onecube/zen/virtual-machine/object/StringTable.h>
 #include <com/onecube/zen/virtual-machine/loader/EntityLoader.h>
 #include <com/onecube/zen/virtual-machine/loader/ClassLoader.h>
 #include <com/onecube/zen/virtual-machine/processor/Interpreter.h>
+#include <com/onecube/zen/virtual-machine/processor/ProcessorThread.h>
 
 /*******************************************************************************
  * VirtualMachine                                                              *
@@ -46,8 +50,23 @@ struct zen_VirtualMachine_t {
     zen_VirtualMachineConfiguration_t* m_configuration;
     zen_EntityLoader_t* m_entityLoader;
     zen_ClassLoader_t* m_classLoader;
+    zen_MemoryManager_t* m_memoryManager;
+    zen_ProcessorThread_t* m_mainThread;
     zen_Interpreter_t* m_interpreter;
     jtk_HashMap_t* m_nativeFunctions;
+
+    /**
+     * The template compiler which translates the hot functions to machine
+     * code. It is null if the compiler is disabled, or the code cache could
+     * not be reserved.
+     */
+    zen_TemplateCompiler_t* m_compiler;
+
+    /**
+     * Interns the string constants of every class loaded by the virtual
+     * machine.
+     */
+    zen_StringTable_t* m_stringTable;
 };
 
 /**
@@ -100,7 +119,7 @@ zen_ObjectArray_t* zen_VirtualMachine_newObjectArray(zen_VirtualMachine_t* conte
 
 /* Static Function */
 
-zen_Function_t* zen_VirtualMachine_getStaticFunction(zen_VirtualMachine_t* context, zen_Class_t* handle, const uint8_t* identifier, const uint8_t* signature);
+zen_Function_t* zen_VirtualMachine_getStaticFunction(zen_VirtualMachine_t* context, zen_Class_t* handle, jtk_String_t* identifier, jtk_String_t* signature);
 void zen_VirtualMachine_invokeStaticFunction(zen_VirtualMachine_t* context, zen_Function_t* function, ...);
 
 /* String */
@@ -124,4 +143,30 @@ zen_Object_t* zen_VirtualMachine_newObject(zen_VirtualMachine_t* virtualMachine,
 void zen_VirtualMachine_raiseFunctionNotFoundException(zen_VirtualMachine_t* virtualMachine,
     const uint8_t* identifier,  const uint8_t* reason);
 
+void zen_VirtualMachine_raiseClassNotFoundException(zen_VirtualMachine_t* virtualMachine,
+    const uint8_t* reason);
+
+/* Native Function */
+
+zen_NativeFunction_t* zen_VirtualMachine_getNativeFunction(
+    zen_VirtualMachine_t* virtualMachine, jtk_CString_t* name,
+    jtk_CString_t* descriptor);
+
+/* Library */
+
+void zen_VirtualMachine_loadDefaultLibraries(zen_VirtualMachine_t* virtualMachine);
+void zen_VirtualMachine_unloadLibraries(zen_VirtualMachine_t* virtualMachine);
+
+/* Start */
+
+void zen_VirtualMachine_start(zen_VirtualMachine_t* virtualMachine,
+    zen_Function_t* function, ...);
+
+/* Shutdown */
+
+void zen_VirtualMachine_shutDown(zen_VirtualMachine_t* virtualMachine);
+void zen_VirtualMachine_waitForThreads(zen_VirtualMachine_t* virtualMachine);
+void zen_VirtualMachine_notifyShutDown(zen_VirtualMachine_t* virtualMachine);
+void zen_VirtualMachine_tearDown(zen_VirtualMachine_t* virtualMachine);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_VIRTUAL_MACHINE_H */
\ No newline at end of file
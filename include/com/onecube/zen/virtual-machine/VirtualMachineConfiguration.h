@@ -58,4 +58,25 @@ zen_VirtualMachineConfiguration_t* zen_VirtualMachineConfiguration_new();
  */
 void zen_VirtualMachineConfiguration_delete(zen_VirtualMachineConfiguration_t* configuration);
 
+/* Entity Directory */
+
+/**
+ * @memberof VirtualMachineConfiguration
+ */
+void zen_VirtualMachineConfiguration_addEntityDirectory(
+    zen_VirtualMachineConfiguration_t* virtualMachine, const uint8_t* directory);
+
+/* Variable */
+
+/**
+ * Returns the value of the specified variable as an integer. If the variable
+ * is not defined, or its value is not a valid integer, the specified default
+ * value is returned.
+ *
+ * @memberof VirtualMachineConfiguration
+ */
+int32_t zen_VirtualMachineConfiguration_getIntegerVariable(
+    zen_VirtualMachineConfiguration_t* configuration, const uint8_t* name,
+    int32_t defaultValue);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_VIRTUAL_MACHINE_CONFIGURATION_H */
\ No newline at end of file
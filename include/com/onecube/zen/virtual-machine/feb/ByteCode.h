@@ -5520,10 +5520,70 @@ enum zen_ByteCode_t {
 
     /* Switch */
 
-    // TODO: These instructions are reserved as of version 1.0. Their behavior
-    // will be updated in the later versions of this specification.
-
+    /**
+     * Jump to the offset which corresponds to `key` in a table of contiguous
+     * keys.
+     *
+     * Zero to three bytes of padding follow the byte code, so that the
+     * arguments begin at an offset which is a multiple of four, measured from
+     * the first instruction of the function. Each argument is a signed 32-bit
+     * integer in big-endian order. The `high` argument should be greater than
+     * or equal to the `low` argument. The table contains `high - low + 1`
+     * offsets.
+     *
+     * If `key` lies between `low` and `high`, both inclusive, the control is
+     * transferred to the offset at index `key - low` in the table. Otherwise,
+     * the control is transferred to the default offset. The offsets are
+     * relative to the byte code of this instruction.
+     *
+     * [Format]
+     * switch_table padding default low high offset...
+     *
+     * [Operand Stack]
+     * Before
+     *     ..., key
+     * After
+     *     ...
+     *
+     * [Operands]
+     * key
+     *     A 32-bit integer value. It is popped off the operand stack.
+     * result
+     *     This instruction generates no result.
+     */
     ZEN_BYTE_CODE_SWITCH_TABLE,
+
+    /**
+     * Jump to the offset which corresponds to `key` in a sorted array of
+     * sparse keys.
+     *
+     * Zero to three bytes of padding follow the byte code, so that the
+     * arguments begin at an offset which is a multiple of four, measured from
+     * the first instruction of the function. Each argument is a signed 32-bit
+     * integer in big-endian order. The `count` keys are sorted in ascending
+     * order, without duplicates. They are followed by `count` offsets, in the
+     * same order as the keys.
+     *
+     * The keys are searched with a binary search. If `key` is found, the
+     * control is transferred to the corresponding offset. Otherwise, the
+     * control is transferred to the default offset. The offsets are relative
+     * to the byte code of this instruction.
+     *
+     * [Format]
+     * switch_search padding default count key... offset...
+     *
+     * [Operand Stack]
+     * Before
+     *     ..., key
+     * After
+     *     ...
+     *
+     * [Operands]
+     * key
+     *     A 32-bit integer value. It is popped off the operand stack.
+     * result
+     *     This instruction generates no result.
+     */
     ZEN_BYTE_CODE_SWITCH_SEARCH,
 
     /* Throw */
@@ -13,32 +13,24 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_CLASS_ENTITY_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_CLASS_ENTITY_H
 
-// Friday, August 31, 2018
-
-#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_OBJECT_H
-#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_OBJECT_H
-
-#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/Entity.h>
 
 /*******************************************************************************
- * Object                                                                      *
+ * ClassEntity                                                                 *
  *******************************************************************************/
 
 /**
- * @class Object
- * @ingroup zen_heap
+ * A class entity shares the layout of a generic entity, whose type byte is
+ * {@code ZEN_ENTITY_TYPE_CLASS}.
+ *
+ * @class ClassEntity
+ * @ingroup zen_vm_feb
  * @author Samuel Rowe
  * @since zen 1.0
  */
-struct zen_Object_t {
-    int32_t m_flags;
-    int32_t m_size;
-};
-
-/**
- * @memberof Object
- */
-typedef struct zen_Object_t zen_Object_t;
+typedef zen_Entity_t zen_ClassEntity_t;
 
-#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_OBJECT_H */
\ No newline at end of file
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_CLASS_ENTITY_H */
@@ -23,6 +23,7 @@
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPool.h>
 #include <com/onecube/zen/virtual-machine/feb/Entity.h>
 #include <com/onecube/zen/virtual-machine/feb/FebVersion.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/Arena.h>
 
 /*******************************************************************************
  * EntityFile                                                                  *
@@ -84,6 +85,13 @@ struct zen_EntityFile_t {
      * interface, annotation, or enumeration. It is known as the primary entity.
      */
     zen_Entity_t m_entity;
+
+    /**
+     * The arena where the entity file, and all the metadata derived from it,
+     * is allocated. The metadata is freed as a unit when the entity file is
+     * unloaded.
+     */
+    zen_Arena_t* m_arena;
 };
 
 /**
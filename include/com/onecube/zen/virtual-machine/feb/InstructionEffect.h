@@ -0,0 +1,90 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_INSTRUCTION_EFFECT_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_INSTRUCTION_EFFECT_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+
+/*******************************************************************************
+ * InstructionEffect                                                           *
+ *******************************************************************************/
+
+/* The instruction transfers control to the offset specified by its argument. */
+#define ZEN_INSTRUCTION_EFFECT_FLAG_BRANCH (1 << 0)
+
+/* The instruction never falls through to the next instruction. */
+#define ZEN_INSTRUCTION_EFFECT_FLAG_TERMINAL (1 << 1)
+
+/* The stack effect of the instruction depends on its arguments. */
+#define ZEN_INSTRUCTION_EFFECT_FLAG_VARIABLE (1 << 2)
+
+/* The instruction transfers control to one of the offsets in its table. The
+ * length of the instruction depends on its arguments.
+ */
+#define ZEN_INSTRUCTION_EFFECT_FLAG_SWITCH (1 << 3)
+
+/* The instruction pushes a reference on the operand stack, or stores a
+ * reference in a local variable. The instructions whose result type depends
+ * on their arguments, such as `load_cpr` and the invocations, do not carry
+ * this flag.
+ */
+#define ZEN_INSTRUCTION_EFFECT_FLAG_REFERENCE (1 << 4)
+
+/* The local variable index is an argument of the instruction. */
+#define ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT -2
+
+/* The instruction does not access the local variable array. */
+#define ZEN_INSTRUCTION_EFFECT_LOCAL_NONE -1
+
+/**
+ * Describes the number of argument bytes that follow an instruction, and the
+ * number of operands it pops and pushes. Each operand occupies exactly one slot.
+ *
+ * The effects are shared by the verifier, which simulates the depth of the
+ * operand stack, and the stack map builder of the compiler, which simulates
+ * the types of the slots.
+ *
+ * @class InstructionEffect
+ * @ingroup zen_vm_feb
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InstructionEffect_t {
+    int8_t m_argumentLength;
+    int8_t m_popCount;
+    int8_t m_pushCount;
+    int8_t m_local;
+    uint8_t m_flags;
+};
+
+/**
+ * @memberof InstructionEffect
+ */
+typedef struct zen_InstructionEffect_t zen_InstructionEffect_t;
+
+/**
+ * The effects of the instructions, indexed by their byte codes. The byte codes
+ * beyond `wide` are not described.
+ *
+ * @memberof InstructionEffect
+ */
+extern const zen_InstructionEffect_t zen_InstructionEffect_table[ZEN_BYTE_CODE_WIDE + 1];
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_INSTRUCTION_EFFECT_H */
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_SWITCH_INSTRUCTION_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_SWITCH_INSTRUCTION_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+
+/*******************************************************************************
+ * SwitchInstruction                                                           *
+ *******************************************************************************/
+
+/**
+ * The arguments of the `switch_table` and `switch_search` instructions begin
+ * at the first offset after the byte code which is a multiple of four. The
+ * padding is measured from the first instruction of the function. Each
+ * argument is a signed 32-bit integer in big-endian order. Every offset is
+ * relative to the byte code of the switch instruction.
+ *
+ * A `switch_table` instruction has the following arguments.
+ *     default, low, high, offset[high - low + 1]
+ *
+ * A `switch_search` instruction has the following arguments. The keys are
+ * sorted in ascending order without duplicates.
+ *     default, count, key[count], offset[count]
+ *
+ * @class SwitchInstruction
+ * @ingroup zen_vm_feb
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+
+/**
+ * The alignment of the arguments of a switch instruction.
+ */
+#define ZEN_SWITCH_INSTRUCTION_ALIGNMENT 4
+
+/**
+ * The number of bytes occupied by the `default`, `low` and `high` arguments
+ * of a `switch_table` instruction.
+ */
+#define ZEN_SWITCH_INSTRUCTION_TABLE_HEADER_SIZE 12
+
+/**
+ * The number of bytes occupied by the `default` and `count` arguments of a
+ * `switch_search` instruction.
+ */
+#define ZEN_SWITCH_INSTRUCTION_SEARCH_HEADER_SIZE 8
+
+/* Argument */
+
+/**
+ * Returns the offset of the first argument of the switch instruction whose
+ * byte code is at the specified offset.
+ *
+ * @memberof SwitchInstruction
+ */
+static inline int32_t zen_SwitchInstruction_getArgumentIndex(int32_t ip) {
+    return (ip + ZEN_SWITCH_INSTRUCTION_ALIGNMENT) & ~(ZEN_SWITCH_INSTRUCTION_ALIGNMENT - 1);
+}
+
+/**
+ * @memberof SwitchInstruction
+ */
+static inline int32_t zen_SwitchInstruction_readInteger(const uint8_t* bytes) {
+    return (int32_t)(((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) |
+        ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3]);
+}
+
+/* Length */
+
+/**
+ * Returns the number of bytes occupied by the switch instruction whose byte
+ * code is at the specified offset, including the byte code and the padding.
+ * Returns -1 if the arguments are malformed or extend beyond the specified
+ * length.
+ *
+ * @memberof SwitchInstruction
+ */
+static inline int32_t zen_SwitchInstruction_getLength(const uint8_t* instructions,
+    int32_t ip, int32_t length) {
+    int32_t index = zen_SwitchInstruction_getArgumentIndex(ip);
+    int64_t end;
+    if (instructions[ip] == ZEN_BYTE_CODE_SWITCH_TABLE) {
+        if ((index + ZEN_SWITCH_INSTRUCTION_TABLE_HEADER_SIZE) > length) {
+            return -1;
+        }
+        int32_t low = zen_SwitchInstruction_readInteger(instructions + index + 4);
+        int32_t high = zen_SwitchInstruction_readInteger(instructions + index + 8);
+        if (low > high) {
+            return -1;
+        }
+        end = index + ZEN_SWITCH_INSTRUCTION_TABLE_HEADER_SIZE +
+            (((int64_t)high - low + 1) * 4);
+    }
+    else {
+        if ((index + ZEN_SWITCH_INSTRUCTION_SEARCH_HEADER_SIZE) > length) {
+            return -1;
+        }
+        int32_t count = zen_SwitchInstruction_readInteger(instructions + index + 4);
+        if (count < 0) {
+            return -1;
+        }
+        end = index + ZEN_SWITCH_INSTRUCTION_SEARCH_HEADER_SIZE + ((int64_t)count * 8);
+    }
+
+    return (end <= length)? (int32_t)(end - ip) : -1;
+}
+
+/* Search */
+
+/**
+ * Searches the sorted keys of a `switch_search` instruction for the specified
+ * key. Returns the index of the key, or -1 if it was not found.
+ *
+ * The number of iterations depends only on the number of keys. The comparison
+ * within the loop selects the next base without a branch, which allows the
+ * compiler to emit a conditional move. Therefore, the search does not suffer
+ * from the misprediction of data dependent branches.
+ *
+ * @memberof SwitchInstruction
+ */
+static inline int32_t zen_SwitchInstruction_search(const uint8_t* keys, int32_t count,
+    int32_t key) {
+    if (count == 0) {
+        return -1;
+    }
+
+    int32_t base = 0;
+    int32_t remaining = count;
+    while (remaining > 1) {
+        int32_t half = remaining >> 1;
+        int32_t probe = zen_SwitchInstruction_readInteger(keys + ((base + half) * 4));
+        base = (probe <= key)? (base + half) : base;
+        remaining -= half;
+    }
+
+    return (zen_SwitchInstruction_readInteger(keys + (base * 4)) == key)? base : -1;
+}
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_SWITCH_INSTRUCTION_H */
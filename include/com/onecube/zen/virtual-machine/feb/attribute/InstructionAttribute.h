@@ -22,6 +22,7 @@
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/ExceptionTable.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/AttributeTable.h>
+#include <com/onecube/zen/virtual-machine/processor/DecodedInstruction.h>
 
 /*******************************************************************************
  * InstructionAttribute                                                        *
@@ -47,6 +48,13 @@ struct zen_InstructionAttribute_t {
     uint32_t m_instructionLength;
     uint8_t* m_instructions;
     zen_ExceptionTable_t m_exceptionTable;
+
+    /**
+     * The decoded form of the instructions, which is built when the function
+     * is loaded. It is not part of the binary entity format. If the
+     * instructions are not decoded, it is null.
+     */
+    zen_DecodedInstruction_t* m_decodedInstructions;
 };
 
 /**
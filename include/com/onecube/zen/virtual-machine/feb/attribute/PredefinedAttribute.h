@@ -33,6 +33,7 @@
 #define ZEN_PREDEFINED_ATTRIBUTE_INSTRUCTION_SIZE 22
 
 #define ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE "vm/primary/StackMapTable"
+#define ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE_SIZE 24
 #define ZEN_PREDEFINED_ATTRIBUTE_EXCEPTION_LIST "vm/primary/ExceptionList"
 
 /* Level 1 */
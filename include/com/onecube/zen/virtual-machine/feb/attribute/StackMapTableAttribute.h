@@ -0,0 +1,156 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_ATTRIBUTE_STACK_MAP_TABLE_ATTRIBUTE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_ATTRIBUTE_STACK_MAP_TABLE_ATTRIBUTE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * StackMapEntry                                                               *
+ *******************************************************************************/
+
+/**
+ * Describes the slots of a stack frame which hold references, immediately
+ * before the instruction at the specified offset is executed. The local
+ * variables are described first, followed by the operands. The slot at index
+ * `i` holds a reference if the bit `i % 8` of the byte `i / 8` is set.
+ *
+ * @class StackMapEntry
+ * @ingroup zen_vm_feb
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_StackMapEntry_t {
+    uint16_t m_offset;
+    uint16_t m_operandCount;
+    uint8_t* m_bitmap;
+};
+
+/**
+ * @memberof StackMapEntry
+ */
+typedef struct zen_StackMapEntry_t zen_StackMapEntry_t;
+
+/* Reference */
+
+/**
+ * Determines whether the specified slot holds a reference. The local variables
+ * occupy the first slots.
+ *
+ * @memberof StackMapEntry
+ */
+static inline bool zen_StackMapEntry_isReference(zen_StackMapEntry_t* entry, int32_t slot) {
+    return (entry->m_bitmap[slot >> 3] & (1 << (slot & 7))) != 0;
+}
+
+/*******************************************************************************
+ * StackMapTableAttribute                                                      *
+ *******************************************************************************/
+
+/**
+ * The stack map table attribute is a primary attribute with variable-length.
+ * It accompanies the instruction attribute of a function, and records which
+ * local variables and operands hold references at every instruction. It is
+ * generated by the compiler, which simulates the types of the slots.
+ *
+ * The garbage collector uses the stack maps to visit the references in the
+ * stack frames precisely. Therefore, the objects referenced by a stack frame
+ * can be moved. The slots of a function without a stack map table are
+ * visited conservatively.
+ *
+ * The format of the attribute is shown below. The entries are sorted by
+ * their offsets. An unreachable instruction has no entry.
+ *
+ * stackMapTable
+ * :    nameIndex:u2 length:u4 localVariableCount:u2 size:u2 entry[size]
+ * ;
+ *
+ * entry
+ * :    offset:u2 operandCount:u2 bitmap:u1[(localVariableCount + operandCount + 7) / 8]
+ * ;
+ *
+ * @class StackMapTableAttribute
+ * @ingroup zen_vm_feb
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_StackMapTableAttribute_t {
+    uint16_t m_nameIndex;
+    uint32_t m_length;
+    uint16_t m_localVariableCount;
+    uint16_t m_size;
+    zen_StackMapEntry_t* m_entries;
+
+    /**
+     * The bitmaps of all the entries, which are stored contiguously.
+     */
+    uint8_t* m_bitmaps;
+};
+
+/**
+ * @memberof StackMapTableAttribute
+ */
+typedef struct zen_StackMapTableAttribute_t zen_StackMapTableAttribute_t;
+
+// Constructor
+
+/**
+ * Creates a stack map table with the specified number of entries. The entries
+ * share the specified number of bytes for their bitmaps, which are cleared.
+ *
+ * @memberof StackMapTableAttribute
+ */
+zen_StackMapTableAttribute_t* zen_StackMapTableAttribute_new(uint16_t nameIndex,
+    uint16_t localVariableCount, uint16_t size, int32_t bitmapsSize);
+
+// Destructor
+
+/**
+ * @memberof StackMapTableAttribute
+ */
+void zen_StackMapTableAttribute_delete(zen_StackMapTableAttribute_t* attribute);
+
+// Bitmap
+
+/**
+ * Returns the number of bytes occupied by the bitmap of an entry with the
+ * specified number of operands.
+ *
+ * @memberof StackMapTableAttribute
+ */
+static inline int32_t zen_StackMapTableAttribute_getBitmapSize(
+    int32_t localVariableCount, int32_t operandCount) {
+    return (localVariableCount + operandCount + 7) / 8;
+}
+
+// Find
+
+/**
+ * Returns the entry of the instruction which contains the byte before the
+ * specified offset, or null if there is no such entry. The interpreter saves
+ * the instruction pointer after it reads the arguments of an instruction.
+ * Therefore, the saved instruction pointer of a suspended stack frame lies
+ * beyond the instruction which is being executed.
+ *
+ * @memberof StackMapTableAttribute
+ */
+zen_StackMapEntry_t* zen_StackMapTableAttribute_find(zen_StackMapTableAttribute_t* attribute,
+    int32_t ip);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_ATTRIBUTE_STACK_MAP_TABLE_ATTRIBUTE_H */
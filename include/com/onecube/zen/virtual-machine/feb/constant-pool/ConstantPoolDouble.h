@@ -44,4 +44,11 @@ struct zen_ConstantPoolDouble_t {
 
 typedef struct zen_ConstantPoolDouble_t zen_ConstantPoolDouble_t;
 
+/* Value */
+
+/**
+ * @memberof ConstantPoolDouble
+ */
+double zen_ConstantPoolDouble_getValue(zen_ConstantPoolDouble_t* constantPoolDouble);
+
 #endif /* ZEN_FEB_CONSTANT_POOL_DOUBLE_CONSTANT_POOL_H */
\ No newline at end of file
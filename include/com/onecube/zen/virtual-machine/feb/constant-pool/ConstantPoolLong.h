@@ -51,4 +51,11 @@ struct zen_ConstantPoolLong_t {
 
 typedef struct zen_ConstantPoolLong_t zen_ConstantPoolLong_t;
 
+/* Value */
+
+/**
+ * @memberof ConstantPoolLong
+ */
+int64_t zen_ConstantPoolLong_getValue(zen_ConstantPoolLong_t* constantPoolLong);
+
 #endif /* ZEN_FEB_CONSTANT_POOL_LONG_CONSTANT_POOL_H */
\ No newline at end of file
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_JIT_CODE_CACHE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_JIT_CODE_CACHE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * CodeCache                                                                   *
+ *******************************************************************************/
+
+/**
+ * The default number of bytes reserved for machine code.
+ */
+#define ZEN_CODE_CACHE_DEFAULT_CAPACITY (16 * 1024 * 1024)
+
+/**
+ * A code cache is a region of memory, mapped once, where the machine code
+ * generated by the compiler lives. Memory is allocated by bumping a pointer.
+ * It is never released, until the code cache is destroyed.
+ *
+ * The pages of the code cache are never writable and executable at the same
+ * time. Every allocation begins on a page of its own, and is rounded up to a
+ * page boundary. Its pages are made writable, and made executable once the
+ * code is committed. Therefore, the pages of committed code are never made
+ * writable again.
+ *
+ * A code cache is not synchronized. It is used only by the template compiler,
+ * under the mutex of the compiler.
+ *
+ * @class CodeCache
+ * @ingroup zen_vm_jit
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_CodeCache_t {
+    uint8_t* m_base;
+    size_t m_capacity;
+    size_t m_size;
+    size_t m_pageSize;
+};
+
+/**
+ * @memberof CodeCache
+ */
+typedef struct zen_CodeCache_t zen_CodeCache_t;
+
+/* Constructor */
+
+/**
+ * Returns null if the memory could not be mapped.
+ *
+ * @memberof CodeCache
+ */
+zen_CodeCache_t* zen_CodeCache_new(size_t capacity);
+
+/* Destructor */
+
+/**
+ * @memberof CodeCache
+ */
+void zen_CodeCache_delete(zen_CodeCache_t* codeCache);
+
+/* Allocate */
+
+/**
+ * Allocates writable memory for the specified number of bytes of machine
+ * code. The memory begins at a page boundary. Returns null if the code cache
+ * is exhausted.
+ *
+ * @memberof CodeCache
+ */
+uint8_t* zen_CodeCache_allocate(zen_CodeCache_t* codeCache, size_t size);
+
+/* Commit */
+
+/**
+ * Makes the specified machine code, previously allocated in the code cache,
+ * executable.
+ *
+ * @memberof CodeCache
+ */
+void zen_CodeCache_commit(zen_CodeCache_t* codeCache, uint8_t* code, size_t size);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_JIT_CODE_CACHE_H */
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_JIT_COMPILED_CODE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_JIT_COMPILED_CODE_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/processor/Slot.h>
+
+/*******************************************************************************
+ * CompiledCode                                                                *
+ *******************************************************************************/
+
+/**
+ * The signature of the machine code generated for a function. The machine
+ * code begins executing at the specified target, which is the address of one
+ * of its instructions. The operand stack and the local variable array of the
+ * current stack frame are shared with the interpreter. When the machine code
+ * exits, the updated top of the operand stack is stored and the offset of the
+ * instruction where the interpreter should resume is returned.
+ */
+typedef int32_t (*zen_CompiledCodeEntry_t)(zen_Slot_t* locals, zen_Slot_t** stackTop,
+    const uint8_t* target);
+
+/**
+ * The machine code generated for a function by the template compiler.
+ *
+ * Since the compiled code and the interpreter share the same stack frame,
+ * the execution transfers between them at any instruction boundary. The
+ * interpreter enters the compiled code when a function is invoked, when a
+ * branch jumps backwards, and when a function returns to its caller. The
+ * compiled code exits to the interpreter at every instruction that it does
+ * not implement, such as invocations, allocations and returns.
+ *
+ * @class CompiledCode
+ * @ingroup zen_vm_jit
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_CompiledCode_t {
+
+    /**
+     * The machine code lives in the code cache. It begins with the prologue,
+     * which jumps to the target.
+     */
+    uint8_t* m_code;
+    int32_t m_size;
+
+    /**
+     * The address of the machine code for each instruction, indexed by the
+     * offset of the instruction. The entry is null if the offset does not
+     * begin an instruction, or the instruction is executed by the interpreter.
+     */
+    uint8_t** m_entries;
+    int32_t m_instructionLength;
+};
+
+/**
+ * @memberof CompiledCode
+ */
+typedef struct zen_CompiledCode_t zen_CompiledCode_t;
+
+/* Constructor */
+
+/**
+ * @memberof CompiledCode
+ */
+zen_CompiledCode_t* zen_CompiledCode_new(uint8_t* code, int32_t size, int32_t instructionLength);
+
+/* Destructor */
+
+/**
+ * The machine code is not released. It is owned by the code cache.
+ *
+ * @memberof CompiledCode
+ */
+void zen_CompiledCode_delete(zen_CompiledCode_t* compiledCode);
+
+/* Run */
+
+/**
+ * Executes the compiled code from the instruction at the specified offset.
+ * Returns the offset of the instruction where the interpreter should resume.
+ * If the instruction at the specified offset is not compiled, the offset is
+ * returned immediately.
+ *
+ * @memberof CompiledCode
+ */
+static inline int32_t zen_CompiledCode_run(zen_CompiledCode_t* compiledCode,
+    zen_Slot_t* locals, zen_Slot_t** stackTop, int32_t ip) {
+    if ((ip < compiledCode->m_instructionLength) && (compiledCode->m_entries[ip] != NULL)) {
+        zen_CompiledCodeEntry_t entry = (zen_CompiledCodeEntry_t)compiledCode->m_code;
+        ip = entry(locals, stackTop, compiledCode->m_entries[ip]);
+    }
+    return ip;
+}
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_JIT_COMPILED_CODE_H */
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_JIT_TEMPLATE_COMPILER_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_JIT_TEMPLATE_COMPILER_H
+
+#include <jtk/concurrent/lock/Mutex.h>
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
+#include <com/onecube/zen/virtual-machine/jit/CodeCache.h>
+#include <com/onecube/zen/virtual-machine/jit/CompiledCode.h>
+#include <com/onecube/zen/virtual-machine/loader/BinaryEntityVerifier.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/Safepoint.h>
+
+/* The template compiler generates machine code for x86-64 processors, and
+ * relies on POSIX to map the code cache.
+ */
+#if defined(ZEN_JIT) && !(defined(__x86_64__) && defined(__unix__))
+    #warning "The template compiler supports only x86-64 Unix-like systems. Falling back to the interpreter."
+    #undef ZEN_JIT
+#endif
+
+/**
+ * A function is compiled once it is invoked as many times.
+ */
+#define ZEN_JIT_INVOCATION_THRESHOLD 1000
+
+/**
+ * A function is compiled once its branches jump backwards as many times.
+ */
+#define ZEN_JIT_BACK_EDGE_THRESHOLD 10000
+
+/*******************************************************************************
+ * TemplateCompiler                                                            *
+ *******************************************************************************/
+
+/**
+ * A template compiler translates the instructions of a function to x86-64
+ * machine code in a single pass. Each instruction is translated to a fixed
+ * sequence of machine instructions, known as a template. No optimizations are
+ * performed across instructions.
+ *
+ * The templates operate directly on the operand stack and the local variable
+ * array of the stack frame, which are shared with the interpreter. The base of
+ * the local variable array is held in the rbx register, and the top of the
+ * operand stack is held in the r12 register.
+ *
+ * Instructions without a template exit to the interpreter. A backward branch
+ * polls the safepoint, and exits to the interpreter at the target of the
+ * branch when a safepoint is requested. The interpreter blocks on behalf of
+ * the compiled code.
+ *
+ * @class TemplateCompiler
+ * @ingroup zen_vm_jit
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_TemplateCompiler_t {
+    zen_CodeCache_t* m_codeCache;
+
+    /**
+     * The verifier is used to determine the boundaries of the instructions.
+     */
+    zen_BinaryEntityVerifier_t* m_verifier;
+
+    /**
+     * The safepoint polled by the compiled code. The address of its flag is
+     * embedded in the machine code.
+     */
+    zen_Safepoint_t* m_safepoint;
+
+    /* The state of the current compilation. */
+
+    uint8_t* m_buffer;
+    int32_t m_size;
+    int32_t* m_fixupLocations;
+    int32_t* m_fixupTargets;
+    int32_t m_fixupCount;
+    int32_t m_exitOffset;
+
+    /**
+     * The processor threads compile the functions which become hot on them.
+     * The compilations, and the code cache, are serialized by this mutex.
+     */
+    jtk_Mutex_t* m_mutex;
+};
+
+/**
+ * @memberof TemplateCompiler
+ */
+typedef struct zen_TemplateCompiler_t zen_TemplateCompiler_t;
+
+/* Constructor */
+
+/**
+ * Returns null if the code cache could not be created.
+ *
+ * @memberof TemplateCompiler
+ */
+zen_TemplateCompiler_t* zen_TemplateCompiler_new(zen_Safepoint_t* safepoint);
+
+/* Destructor */
+
+/**
+ * The machine code generated by the compiler is released, too.
+ *
+ * @memberof TemplateCompiler
+ */
+void zen_TemplateCompiler_delete(zen_TemplateCompiler_t* compiler);
+
+/* Compile */
+
+/**
+ * Translates the instructions of the specified attribute to machine code.
+ * Returns null if the code cache is exhausted. It may be invoked by many
+ * threads at once.
+ *
+ * @memberof TemplateCompiler
+ */
+zen_CompiledCode_t* zen_TemplateCompiler_compile(zen_TemplateCompiler_t* compiler,
+    zen_InstructionAttribute_t* instructionAttribute);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_JIT_TEMPLATE_COMPILER_H */
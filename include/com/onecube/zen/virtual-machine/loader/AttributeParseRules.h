@@ -58,6 +58,10 @@ zen_AttributeParseRules_t* zen_AttributeParseRules_new();
 
 void zen_AttributeParseRules_delete(zen_AttributeParseRules_t* rules);
 
+// Initialize
+
+void zen_AttributeParseRules_initialize(zen_AttributeParseRules_t* rules);
+
 // Rule
 
 zen_AttributeParseRuleFunction_t zen_AttributeParseRules_getRuleEx(
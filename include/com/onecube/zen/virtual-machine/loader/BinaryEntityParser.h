@@ -36,6 +36,7 @@
 #include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/ExceptionTable.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/SourceFileAttribute.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/StackMapTableAttribute.h>
 
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolClass.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolDouble.h>
@@ -49,6 +50,9 @@
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolUtf8.h>
 
 #include <com/onecube/zen/virtual-machine/loader/AttributeParseRules.h>
+#include <com/onecube/zen/virtual-machine/loader/BinaryEntityVerifier.h>
+#include <com/onecube/zen/virtual-machine/loader/InstructionDecoder.h>
+#include <com/onecube/zen/virtual-machine/loader/SuperinstructionRewriter.h>
 #include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
 
 /*******************************************************************************
@@ -59,8 +63,15 @@ struct zen_BinaryEntityParser_t {
     jtk_Tape_t* m_tape;
     zen_AttributeParseRules_t* m_attributeParseRules;
     zen_MemoryManager_t* m_memoryManager;
+
+    /**
+     * The arena where the entity file and its components are allocated.
+     */
+    zen_Arena_t* m_arena;
     jtk_Logger_t* m_logger;
     zen_EntityFile_t* m_entityFile;
+    zen_BinaryEntityVerifier_t* m_verifier;
+    zen_SuperinstructionRewriter_t* m_rewriter;
 };
 
 typedef struct zen_BinaryEntityParser_t zen_BinaryEntityParser_t;
@@ -69,7 +80,7 @@ typedef struct zen_BinaryEntityParser_t zen_BinaryEntityParser_t;
 
 // zen_BinaryEntityParser_t* zen_BinaryEntityParser_new(zen_MemoryManager_t* memoryManager, zen_AttributeParseRules_t* AttributeParseRules, uint8_t* bytes, int32_t size);
 
-zen_BinaryEntityParser_t* zen_BinaryEntityParser_new(zen_AttributeParseRules_t* AttributeParseRules, uint8_t* bytes, int32_t size);
+zen_BinaryEntityParser_t* zen_BinaryEntityParser_new(zen_AttributeParseRules_t* AttributeParseRules, zen_Arena_t* arena, uint8_t* bytes, int32_t size);
 
 /* Destructor */
 
@@ -101,6 +112,11 @@ void zen_BinaryEntityParser_parseAttributeTable(zen_BinaryEntityParser_t* parser
 zen_InstructionAttribute_t* zen_BinaryEntityParser_parseInstructionAttribute(
     zen_BinaryEntityParser_t* parser, uint16_t nameIndex, uint32_t length);
     
+/* Parse Stack Map Table Attribute */
+
+zen_StackMapTableAttribute_t* zen_BinaryEntityParser_parseStackMapTableAttribute(
+    zen_BinaryEntityParser_t* parser, uint16_t nameIndex, uint32_t length);
+
 /* Parse Exception Table */
 
 void zen_BinaryEntityParser_parseExceptionTable(zen_BinaryEntityParser_t* parser,
@@ -20,6 +20,9 @@
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_LOADER_BINARY_ENTITY_VERIFIER_H
 
 #include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/FebVersion.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPool.h>
 
 /*******************************************************************************
  * BinaryEntityVerifier                                                        *
@@ -37,5 +40,41 @@ zen_BinaryEntityVerifier_t* zen_BinaryEntityVerifier_new();
 /* Destructor */
 
 void zen_BinaryEntityVerifier_delete(zen_BinaryEntityVerifier_t* verifier);
- 
+
+/* Verify Magic Number */
+
+bool zen_BinaryEntityVerifier_verifyMagicNumber(zen_BinaryEntityVerifier_t* verifier,
+    uint32_t magicNumber);
+
+/* Verify Version */
+
+bool zen_BinaryEntityVerifier_verifyVersion(zen_BinaryEntityVerifier_t* verifier,
+    zen_FebVersion_t* fileVersion);
+
+/* Get Instruction Length */
+
+/**
+ * Returns the number of bytes occupied by the instruction at the specified
+ * offset, including the `wide` prefix and the arguments. Returns -1 if the
+ * instruction is unknown, truncated, or its length depends on its arguments.
+ */
+int32_t zen_BinaryEntityVerifier_getInstructionLength(zen_BinaryEntityVerifier_t* verifier,
+    const uint8_t* instructions, int32_t ip, int32_t length);
+
+/* Verify Instruction Attribute */
+
+/**
+ * Simulates the depth of the operand stack along every path through the
+ * instructions of the specified attribute. The maximum depth of the operand
+ * stack and the number of local variables are recorded in the attribute,
+ * unless the values declared by the compiler are larger.
+ *
+ * Every value occupies exactly one slot, irrespective of its type.
+ *
+ * Returns false if the instructions are malformed, in which case the
+ * declared values are retained.
+ */
+bool zen_BinaryEntityVerifier_verifyInstructionAttribute(zen_BinaryEntityVerifier_t* verifier,
+    zen_InstructionAttribute_t* instructionAttribute, zen_ConstantPool_t* constantPool);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_LOADER_BINARY_ENTITY_VERIFIER_H */
\ No newline at end of file
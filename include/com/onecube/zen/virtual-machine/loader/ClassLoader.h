@@ -73,5 +73,16 @@ zen_Class_t* zen_ClassLoader_findClass(zen_ClassLoader_t* classLoader,
  */
 zen_Class_t* zen_ClassLoader_loadFromEntityFile(zen_ClassLoader_t* classLoader,
     jtk_String_t* descriptor, zen_EntityFile_t* entityFile);
+
+// Roots
+
+/**
+ * Visits the static fields of every class loaded by the specified class
+ * loader which hold references.
+ *
+ * @memberof ClassLoader
+ */
+void zen_ClassLoader_visitRoots(zen_ClassLoader_t* classLoader,
+    zen_RootVisitor_t* visitor);
     
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_LOADER_CLASS_LOADER_H */
\ No newline at end of file
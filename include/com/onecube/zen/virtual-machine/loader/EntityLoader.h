@@ -29,6 +29,7 @@
 #include <com/onecube/zen/virtual-machine/feb/EntityFile.h>
 #include <com/onecube/zen/virtual-machine/loader/BinaryEntityParser.h>
 #include <com/onecube/zen/virtual-machine/loader/AttributeParseRules.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/ImmortalGeneration.h>
 
 #define ZEN_ENTITY_LOADER_FLAG_PRIORITIZE_DIRECTORIES (1 << 0)
 #define ZEN_ENTITY_LOADER_FLAG_IGNORE_CORRUPT_ENTITY (1 << 1)
@@ -46,6 +47,13 @@
  */
 #define ZEN_ENTITY_LOADER_BUFFER_SIZE (3 * 1024)
 
+/* The metadata derived from an entity file, including the class, functions
+ * and fields, occupies a few times the size of the entity file. The first
+ * chunk of the arena is sized accordingly, so that the metadata is usually
+ * contiguous.
+ */
+#define ZEN_ENTITY_LOADER_ARENA_SIZE_FACTOR 4
+
 /**
  * @class EntityLoader
  * @ingroup zen_virtual_machine_loader
@@ -73,6 +81,12 @@ struct zen_EntityLoader_t {
     jtk_HashMap_t* m_entities;
     
     zen_AttributeParseRules_t* m_attributeParseRules;
+
+    /**
+     * The immortal generation where the arenas of the entity files are
+     * created.
+     */
+    zen_ImmortalGeneration_t* m_immortalGeneration;
 };
 
 /**
@@ -82,8 +96,9 @@ typedef struct zen_EntityLoader_t zen_EntityLoader_t;
 
 /* Constructor */
 
-zen_EntityLoader_t* zen_EntityLoader_new();
-zen_EntityLoader_t* zen_EntityLoader_newWithEntityDirectories(jtk_Iterator_t* iterator);
+zen_EntityLoader_t* zen_EntityLoader_new(zen_ImmortalGeneration_t* immortalGeneration);
+zen_EntityLoader_t* zen_EntityLoader_newWithEntityDirectories(jtk_Iterator_t* iterator,
+    zen_ImmortalGeneration_t* immortalGeneration);
 
 /* Destructor */
 
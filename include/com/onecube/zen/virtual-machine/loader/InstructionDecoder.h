@@ -0,0 +1,56 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_LOADER_INSTRUCTION_DECODER_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_LOADER_INSTRUCTION_DECODER_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPool.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
+#include <com/onecube/zen/virtual-machine/processor/DecodedInstruction.h>
+
+/*******************************************************************************
+ * InstructionDecoder                                                          *
+ *******************************************************************************/
+
+/**
+ * Translates the instructions of a function into decoded instructions, once
+ * the function is loaded. The binary entity format is not affected.
+ *
+ * @class InstructionDecoder
+ * @ingroup zen_vm_loader
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+
+/* Decode */
+
+/**
+ * Decodes the instructions of the specified instruction attribute and stores
+ * the records in it. The superinstructions, if any, must be formed before the
+ * instructions are decoded.
+ *
+ * The instruction at every offset is decoded independently. Hence, the records
+ * are consistent with the instructions even if they were not verified.
+ *
+ * @memberof InstructionDecoder
+ */
+zen_DecodedInstruction_t* zen_InstructionDecoder_decode(
+    zen_InstructionAttribute_t* instructionAttribute, zen_ConstantPool_t* constantPool);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_LOADER_INSTRUCTION_DECODER_H */
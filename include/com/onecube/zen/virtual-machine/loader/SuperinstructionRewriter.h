@@ -0,0 +1,89 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_LOADER_SUPERINSTRUCTION_REWRITER_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_LOADER_SUPERINSTRUCTION_REWRITER_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
+#include <com/onecube/zen/virtual-machine/loader/BinaryEntityVerifier.h>
+
+/*******************************************************************************
+ * SuperinstructionRewriter                                                    *
+ *******************************************************************************/
+
+/**
+ * Replaces frequent sequences of instructions with superinstructions, once
+ * the instructions of a function are loaded and verified. The binary entity
+ * format is not affected.
+ *
+ * The sequences were selected with the help of the instruction profiler,
+ * which is enabled with ZEN_INTERPRETER_PROFILE.
+ *
+ * @class SuperinstructionRewriter
+ * @ingroup zen_vm_loader
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_SuperinstructionRewriter_t {
+
+    /**
+     * The verifier is used to determine the boundaries of the instructions.
+     * It is not owned by the rewriter.
+     */
+    zen_BinaryEntityVerifier_t* m_verifier;
+};
+
+/**
+ * @memberof SuperinstructionRewriter
+ */
+typedef struct zen_SuperinstructionRewriter_t zen_SuperinstructionRewriter_t;
+
+/* Constructor */
+
+/**
+ * @memberof SuperinstructionRewriter
+ */
+zen_SuperinstructionRewriter_t* zen_SuperinstructionRewriter_new(
+    zen_BinaryEntityVerifier_t* verifier);
+
+/* Destructor */
+
+/**
+ * @memberof SuperinstructionRewriter
+ */
+void zen_SuperinstructionRewriter_delete(zen_SuperinstructionRewriter_t* rewriter);
+
+/* Rewrite */
+
+/**
+ * Rewrites the instructions of the specified attribute in place. The
+ * instructions are scanned from the beginning. At every instruction, the
+ * longest matching sequence is replaced. Sequences do not overlap. The scan
+ * stops at the first instruction whose length cannot be determined.
+ *
+ * The instructions should be verified before they are rewritten.
+ *
+ * Returns the number of sequences that were replaced.
+ *
+ * @memberof SuperinstructionRewriter
+ */
+int32_t zen_SuperinstructionRewriter_rewrite(zen_SuperinstructionRewriter_t* rewriter,
+    zen_InstructionAttribute_t* instructionAttribute);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_LOADER_SUPERINSTRUCTION_REWRITER_H */
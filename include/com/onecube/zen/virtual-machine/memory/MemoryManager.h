@@ -21,15 +21,22 @@
 
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/memory/allocator/Allocator.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/AllocationBuffer.h>
 #include <com/onecube/zen/virtual-machine/memory/allocator/AllocationFlag.h>
 #include <com/onecube/zen/virtual-machine/memory/allocator/AlignmentConstraint.h>
 #include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionType.h>
 #include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionReason.h>
 #include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionListener.h>
 #include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionFlag.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/ConcurrentMarker.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/CopyingGarbageCollector.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/MarkCompactGarbageCollector.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/RootVisitor.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/Safepoint.h>
 #include <com/onecube/zen/virtual-machine/memory/heap/NewGeneration.h>
 #include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
 #include <com/onecube/zen/virtual-machine/memory/heap/ImmortalGeneration.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/ReservedSpace.h>
 
 /*******************************************************************************
  * MemoryManager                                                               *
@@ -39,12 +46,28 @@
  * Each heap generation receives its own system allocator, private allocator
  * and a garbage collector.
  *
+ * When the references are compressed, the generations are carved from a
+ * single reserved space, which is the base of every compressed reference.
+ * Therefore, only one memory manager can exist at a time.
+ *
  * @class MemoryManager
  * @ingroup zen_mms
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_MemoryManager_t {
+
+    /**
+     * The range which holds the whole heap, when the references are
+     * compressed. Otherwise, it is null, and each region is allocated by
+     * itself.
+     */
+    zen_ReservedSpace_t* m_reservedSpace;
+
+    /**
+     * Holds the objects which are never collected, such as the interned
+     * strings.
+     */
     zen_ImmortalGeneration_t* m_immortalGeneration;
 
     zen_NewGeneration_t* m_newGeneration;
@@ -58,9 +81,40 @@ struct zen_MemoryManager_t {
 
 
     zen_MarkSweepGarbageCollector_t* m_markSweepGarbageCollector;
+    */
+
+    /**
+     * Collects the old generation.
+     */
     zen_MarkCompactGarbageCollector_t* m_markCompactGarbageCollector;
+
+    /**
+     * Collects the new generation.
+     */
     zen_CopyingGarbageCollector_t* m_copyingGarbageCollector;
-    */
+
+    /**
+     * Marks the old generation concurrently, when enabled. The marked old
+     * generation is compacted by `m_markCompactGarbageCollector`.
+     */
+    zen_ConcurrentMarker_t* m_concurrentMarker;
+
+    /**
+     * Stops the processor threads attached to it, while the heap is
+     * collected.
+     */
+    zen_Safepoint_t* m_safepoint;
+
+    /**
+     * The function which enumerates the roots held outside the heap. The
+     * heap is not collected, unless it is registered.
+     */
+    zen_RootVisitor_EnumerateRootsFunction_t m_enumerateRoots;
+
+    /**
+     * The context passed to `m_enumerateRoots`.
+     */
+    void* m_rootContext;
 };
 
 /**
@@ -95,9 +149,99 @@ uint8_t* zen_MemoryManager_allocate(zen_MemoryManager_t* manager, uint32_t size)
 uint8_t* zen_MemoryManager_allocateEx(zen_MemoryManager_t* manager, uint32_t size,
     zen_AlignmentConstraint_t alignmentConstraint, int32_t flags);
 
+/**
+ * The slow path of allocation from the allocation buffer of a thread. The size
+ * should be a multiple of `ZEN_ALLOCATION_BUFFER_ALIGNMENT`.
+ *
+ * @memberof MemoryManager
+ */
+uint8_t* zen_MemoryManager_allocateFromBuffer(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer, int32_t size);
+
+/**
+ * Allocates an object in the large object space, where it is never copied.
+ * The header is initialized with the specified size and flags, and a null
+ * class. The rest of the object is cleared. An array of references may be
+ * allocated here; the minor collector scans it on every collection.
+ * Returns null if the space is exhausted even after a major collection.
+ *
+ * @memberof MemoryManager
+ */
+uint8_t* zen_MemoryManager_allocateLargeObject(zen_MemoryManager_t* manager,
+    int32_t size, int32_t flags);
+
+/* Large Object */
+
+/**
+ * Determines whether an object of the specified size should be allocated in
+ * the large object space.
+ *
+ * @memberof MemoryManager
+ */
+static inline bool zen_MemoryManager_isLargeObjectSize(zen_MemoryManager_t* manager,
+    int64_t size) {
+    return size >= manager->m_oldGeneration->m_largeObjectSpace->m_threshold;
+}
+
+/**
+ * Sets the size of the smallest object allocated in the large object space.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_setLargeObjectThreshold(zen_MemoryManager_t* manager,
+    int32_t largeObjectThreshold);
+
+/* Allocation Buffer */
+
+/**
+ * Creates the allocation buffer of a new thread.
+ *
+ * @memberof MemoryManager
+ */
+zen_AllocationBuffer_t* zen_MemoryManager_makeAllocationBuffer(zen_MemoryManager_t* manager);
+
+/**
+ * Destroys the allocation buffer of a terminating thread.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_mergeAllocationBuffer(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer);
+
+/* SATB Buffer */
+
+/**
+ * Creates the buffer where a new thread logs the references overwritten
+ * while the old generation is marked concurrently.
+ *
+ * @memberof MemoryManager
+ */
+zen_SatbBuffer_t* zen_MemoryManager_makeSatbBuffer(zen_MemoryManager_t* manager);
+
+/**
+ * Destroys the buffer of a terminating thread.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_mergeSatbBuffer(zen_MemoryManager_t* manager, zen_SatbBuffer_t* buffer);
+
 /* Collect */
 
 /**
+ * Collects the specified generation. The other threads attached to the
+ * safepoint of the memory manager are stopped for the duration of the
+ * collection. The calling thread should either be running, that is, attached
+ * and outside a safe region, or detached.
+ *
+ * A major collection collects the old generation, and then the new
+ * generation. A minor collection is escalated to a major collection, if the
+ * old generation cannot absorb the objects promoted from the new generation.
+ *
+ * When concurrent marking is enabled, a minor collection which leaves the
+ * white region occupied beyond the initiating occupancy begins a marking
+ * cycle. A major collection requested during the cycle completes the marking,
+ * instead of marking the old generation from scratch.
+ *
  * @memberof MemoryManager
  */
 void zen_MemoryManager_collect(zen_MemoryManager_t* manager,
@@ -110,6 +254,26 @@ void zen_MemoryManager_collectEx(zen_MemoryManager_t* manager,
     zen_GarbageCollectionType_t type, zen_GarbageCollectionReason_t reason,
     zen_GarbageCollectionListener_t* listener, int32_t flags);
 
+/* Concurrent Marking */
+
+/**
+ * Enables or disables the concurrent marking of the old generation. A
+ * marking cycle which is in progress is not interrupted.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_setConcurrentMarkingEnabled(zen_MemoryManager_t* manager,
+    bool enabled);
+
+/**
+ * Sets the percentage of the white region which should be occupied before a
+ * concurrent marking cycle begins. It should be between 0 and 100.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_setInitiatingOccupancy(zen_MemoryManager_t* manager,
+    int32_t initiatingOccupancy);
+
 /* Deallocate */
 
 /**
@@ -117,4 +281,38 @@ void zen_MemoryManager_collectEx(zen_MemoryManager_t* manager,
  */
 void zen_MemoryManager_deallocate(zen_MemoryManager_t* manager, uint8_t* pointer);
 
+/* Root Enumerator */
+
+/**
+ * Registers the function which enumerates the roots held outside the heap.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_setRootEnumerator(zen_MemoryManager_t* manager,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context);
+
+/* Tenuring Threshold */
+
+/**
+ * Sets the number of minor collections that an object survives before it is
+ * promoted to the old generation. It should be between 0 and
+ * `ZEN_OBJECT_MAXIMUM_AGE`.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_setTenuringThreshold(zen_MemoryManager_t* manager,
+    int32_t tenuringThreshold);
+
+/* Marking Worker Count */
+
+/**
+ * Sets the number of threads which mark the old generation in parallel. It
+ * should be between 1 and
+ * `ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_MAXIMUM_WORKER_COUNT`.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_setMarkingWorkerCount(zen_MemoryManager_t* manager,
+    int32_t markingWorkerCount);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_MEMORY_MANAGER_H */
\ No newline at end of file
@@ -20,18 +20,119 @@
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_ALLOCATION_BUFFER_H
 
 #include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/Chunk.h>
 
 /*******************************************************************************
  * AllocationBuffer                                                            *
  *******************************************************************************/
 
 /**
+ * The alignment of the chunks claimed by the buffers. The sizes of the objects
+ * allocated from the buffers should be multiples of it.
+ */
+#define ZEN_ALLOCATION_BUFFER_ALIGNMENT 8
+
+/**
+ * The size of the first buffer handed to a thread.
+ */
+#define ZEN_ALLOCATION_BUFFER_INITIAL_SIZE (16 * 1024)
+
+/**
+ * The smallest size that a buffer adapts to.
+ */
+#define ZEN_ALLOCATION_BUFFER_MINIMUM_SIZE (2 * 1024)
+
+/**
+ * The largest size that a buffer adapts to.
+ */
+#define ZEN_ALLOCATION_BUFFER_MAXIMUM_SIZE (1024 * 1024)
+
+/**
+ * The number of refills that a thread should ideally perform between two
+ * collections.
+ */
+#define ZEN_ALLOCATION_BUFFER_TARGET_REFILLS 50
+
+/**
+ * When an allocation does not fit in the buffer, the buffer is retired only if
+ * the free space left in it is less than the size of the buffer divided by
+ * this factor. Otherwise, the object is allocated outside the buffer, so that
+ * the free space is not wasted.
+ */
+#define ZEN_ALLOCATION_BUFFER_WASTE_FACTOR 64
+
+/**
+ * A thread local allocation buffer (TLAB) is a chunk of the new generation
+ * which is owned by a single thread. The thread allocates objects from its
+ * buffer by bumping a pointer, without any synchronization. When the buffer is
+ * exhausted, the thread claims a new chunk from the shared sequential
+ * allocator with a single atomic compare-and-swap.
+ *
+ * The size of the chunk claimed at each refill adapts to the allocation rate
+ * of the thread. A thread which refills its buffer more often than
+ * `ZEN_ALLOCATION_BUFFER_TARGET_REFILLS` times between two collections
+ * receives larger chunks. A thread which allocates rarely receives smaller
+ * chunks, which reduces the space wasted at the end of its buffer.
+ *
+ * The buffer records every chunk that it claims, along with the objects that
+ * it allocates outside the buffer. The collector uses these records to find
+ * the objects that are referenced ambiguously, without scanning the whole new
+ * generation.
+ *
  * @class AllocationBuffer
  * @ingroup zen_mms_allocator
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_AllocationBuffer_t {
+
+    /**
+     * The start of the chunk currently owned by the buffer.
+     */
+    uint8_t* m_start;
+
+    /**
+     * The bump pointer. The next object is allocated here.
+     */
+    uint8_t* m_free;
+
+    /**
+     * The end of the chunk currently owned by the buffer.
+     */
+    uint8_t* m_limit;
+
+    /**
+     * The number of bytes claimed at the next refill.
+     */
+    int32_t m_size;
+
+    /**
+     * The number of refills since the size was last adapted.
+     */
+    int32_t m_refillCount;
+
+    /**
+     * The number of bytes claimed by the buffer since the size was last
+     * adapted, including the objects allocated outside the buffer.
+     */
+    int64_t m_allocatedBytes;
+
+    /**
+     * The chunks claimed by the buffer since the last collection. The end of
+     * the current chunk is recorded when the buffer is retired.
+     */
+    zen_ChunkArray_t* m_chunks;
+
+    /**
+     * The index of the current chunk in `m_chunks`, or -1 if the buffer is
+     * retired.
+     */
+    int32_t m_currentChunk;
+
+    /**
+     * The next buffer registered with the same sequential allocator.
+     */
+    struct zen_AllocationBuffer_t* m_next;
 };
 
 /**
@@ -39,17 +140,60 @@ struct zen_AllocationBuffer_t {
  */
 typedef struct zen_AllocationBuffer_t zen_AllocationBuffer_t;
 
-#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_ALLOCATION_BUFFER_H */
+/* Constructor */
+
+/**
+ * Creates an empty buffer. The first allocation refills it.
+ *
+ * @memberof AllocationBuffer
+ */
+zen_AllocationBuffer_t* zen_AllocationBuffer_new();
+
+/* Destructor */
+
+/**
+ * @memberof AllocationBuffer
+ */
+void zen_AllocationBuffer_delete(zen_AllocationBuffer_t* buffer);
+
+/* Adapt */
+
+/**
+ * Recomputes the size of the buffer from the number of bytes it claimed since
+ * the size was last adapted. It is invoked at the end of every collection,
+ * when the world is stopped.
+ *
+ * @memberof AllocationBuffer
+ */
+void zen_AllocationBuffer_adapt(zen_AllocationBuffer_t* buffer);
 
-zen_Object_t* zen_AllocationBuffer_allocate(zen_AllocationBuffer_t* buffer,
-    int32_t headerSize, int32_t bodySize) {
-    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+/* Allocate */
 
-    int8_t* result = NULL;
-    int8_t* newFree = allocator->m_free + (headerSize + bodySize);
-    if (newFree <= buffer->m_limit) {
-        result = allocator->m_free;
-        buffer->m_free = newFree;
+/**
+ * Allocates the specified number of bytes by bumping the free pointer. The
+ * size should be a multiple of the object alignment. Returns null if the
+ * buffer is exhausted, in which case the caller should take the slow path.
+ *
+ * @memberof AllocationBuffer
+ */
+static inline uint8_t* zen_AllocationBuffer_allocate(zen_AllocationBuffer_t* buffer,
+    int32_t size) {
+    uint8_t* result = buffer->m_free;
+    if ((buffer->m_limit - result) >= size) {
+        buffer->m_free = result + size;
+        return result;
     }
-    return result;
-}
\ No newline at end of file
+    return NULL;
+}
+
+/* Retire */
+
+/**
+ * Abandons the free space left in the buffer and records the end of its
+ * current chunk. The next allocation refills it.
+ *
+ * @memberof AllocationBuffer
+ */
+void zen_AllocationBuffer_retire(zen_AllocationBuffer_t* buffer);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_ALLOCATION_BUFFER_H */
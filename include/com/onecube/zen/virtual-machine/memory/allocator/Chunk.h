@@ -0,0 +1,134 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_CHUNK_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_CHUNK_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * Chunk                                                                       *
+ *******************************************************************************/
+
+/**
+ * A contiguous range of memory which is filled with objects from its start
+ * to its end, without any gaps. Therefore, the objects in a chunk can be
+ * enumerated by walking their headers.
+ *
+ * @class Chunk
+ * @ingroup zen_mms_allocator
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_Chunk_t {
+    uint8_t* m_start;
+    uint8_t* m_end;
+};
+
+/**
+ * @memberof Chunk
+ */
+typedef struct zen_Chunk_t zen_Chunk_t;
+
+/*******************************************************************************
+ * ChunkArray                                                                  *
+ *******************************************************************************/
+
+/**
+ * The number of chunks an array can hold before it grows for the first time.
+ */
+#define ZEN_CHUNK_ARRAY_DEFAULT_CAPACITY 16
+
+/**
+ * A growable array of chunks. Once sorted, the chunk which contains an address
+ * is found with a binary search.
+ *
+ * @class ChunkArray
+ * @ingroup zen_mms_allocator
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_ChunkArray_t {
+    zen_Chunk_t* m_chunks;
+    int32_t m_size;
+    int32_t m_capacity;
+};
+
+/**
+ * @memberof ChunkArray
+ */
+typedef struct zen_ChunkArray_t zen_ChunkArray_t;
+
+/* Constructor */
+
+/**
+ * @memberof ChunkArray
+ */
+zen_ChunkArray_t* zen_ChunkArray_new();
+
+/* Destructor */
+
+/**
+ * @memberof ChunkArray
+ */
+void zen_ChunkArray_delete(zen_ChunkArray_t* array);
+
+/* Add */
+
+/**
+ * Appends a chunk and returns its index. The pointers to the chunks of the
+ * array are invalidated, if the array grows.
+ *
+ * @memberof ChunkArray
+ */
+int32_t zen_ChunkArray_add(zen_ChunkArray_t* array, uint8_t* start, uint8_t* end);
+
+/**
+ * Appends all the chunks of the specified source array.
+ *
+ * @memberof ChunkArray
+ */
+void zen_ChunkArray_addAll(zen_ChunkArray_t* array, zen_ChunkArray_t* source);
+
+/* Clear */
+
+/**
+ * @memberof ChunkArray
+ */
+void zen_ChunkArray_clear(zen_ChunkArray_t* array);
+
+/* Find */
+
+/**
+ * Returns the chunk which contains the specified address, or null if no such
+ * chunk exists. The array should be sorted.
+ *
+ * @memberof ChunkArray
+ */
+zen_Chunk_t* zen_ChunkArray_find(zen_ChunkArray_t* array, uint8_t* address);
+
+/* Sort */
+
+/**
+ * Sorts the chunks by their start addresses.
+ *
+ * @memberof ChunkArray
+ */
+void zen_ChunkArray_sort(zen_ChunkArray_t* array);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_CHUNK_H */
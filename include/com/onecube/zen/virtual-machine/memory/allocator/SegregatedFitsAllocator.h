@@ -1,139 +1,225 @@
-/*
- * Copyright 2018-2019 OneCube
- * 
- * Licensed under the Apache License, Version 2.0 (the "License");
- * you may not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- * 
- *     http://www.apache.org/licenses/LICENSE-2.0
- * 
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
-// Sunday, September 02, 2018
-
-#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEGREGATED_FITS_ALLOCATOR_H
-#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEGREGATED_FITS_ALLOCATOR_H
-
-#include <jtk/memory/VirtualMemory.h>
-
-#include <com/onecube/zen/Configuration.h>
-#include <com/onecube/zen/virtual-machine/memory/allocator/Allocator.h>
-#include <com/onecube/zen/virtual-machine/memory/allocator/SegregatedFitsAllocatorMode.h>
-#include <com/onecube/zen/virtual-machine/memory/allocator/SizeClass.h>
-
-/*******************************************************************************
- * SegregatedFitsAllocator                                                     *
- *******************************************************************************/
-
-/**
- * The segregated-fits allocator uses multiple free-list allocators for
- * allocating memory. This helps in reducing fragmentation and decreases the
- * time taken to allocate memory. The free-lists are assigned memory chunks
- * divided from a single chunk.
- *
- * Initially, an allocator has few large cells of contiguous free memory.
- * As the program allocates and deallocates memory cells, it produces a large
- * number of smaller cells. This is known as fragmentation.
- *
- * Fragmentation has the following disadvantages:
- *    - It causes memory allocation failure albeit the memory chunk having
- *      enough free memory in total. This happens when no particular cell size
- *      satisfies the request. Which goes to say, it triggers garbage collection
- *      sooner than necessary.
- *
- * A basic free-list allocator spends most of its time searching for a free
- * cell of an appropriate size. The allocator can avoid this using multiple
- * free-lists, each associated with a *size class*. This can improve allocation
- * speed drastically.
- *
- * A segregated-fits allocator has a number of size classes known as
- * *balance factor*. For an allocator with a balance factor of `k`, the size
- * classes are of the form `sizeClass[0] < sizeClass[1] < ... < sizeClass[k - 1]`.
- * Each allocator may have a different balance factor. It is fixed, that is,
- * does not change after creation.
- *
- * A segregated-fits allocator with a balance factor of `k` has `k + 1`
- * free-lists. The last free-list is used to allocate large objects which
- * do not fit in any of the size classes.
- *
- * The size of a free cell, represented as `cellSize`, is limited
- * to `sizeClass[i - 1] < cellSize <= sizeClass[i]`. We assume that
- * `sizeClass[-1] = 0` and `sizeClass[k] = JTK_INTEGER_MAX`. The allocator
- * tries to *round up* a given request size, represented as `requestSize`,
- * to the nearest size class, represented as `sizeClass[i]`, such that
- * `cellSize <= sizeClass[i]`. Although this does not apply to cell sizes
- * larger than `sizeClass[k - 1]`, in which case the last free list is used.
- *
- * The last free list, represented as `freeList[k]`, may use a free-list
- * algorithm such as first-fit, next-fit, and best-fit. As of version 1.0,
- * it uses a first-fit allocator backed by a cartesian tree. Usually, large
- * objects are less frequently allocated. Even if that's not the case,
- * segregated-fits allocator should be more efficient than normal free-list
- * allocators.
- *
- * The size classes are evenly distributed. The user may provide only the
- * balance factor, but not class sizes. An arbitrary class size, represented as
- * `sizeClass[i]`, is calculated with the formula `sizeClass[i] = sizeClass[0] + c * i`,
- * where `c > 0`. We assume, `sizeClass[0] = 8` and `c = 8` and `k = 16`.
- * This gives us size classes as multiples of eight, from `8` to `128`.
- * The first-fit allocator is used for request sizes greater than `128`.
- *
- * Please refer "The Garbage Collection Handbook" by Richard Jones, Antony
- * Hosking and Eliot Moss for more information. The algorithm described above
- * was extracted from Chapter 7, section 4.
- *
- * @class SegregatedFitsAllocator
- * @ingroup zen_memory_allocator
- * @author Samuel Rowe
- * @since zen 1.0
- */
-struct zen_SegregatedFitsAllocator_t {
-
-    /**
-     * It is in the range [8, 32]. For example, for an allocator with a balance
-     * factor of 8, there are 8 size classes. By default, the implementation uses
-     * a balance factor of 16. Which gives us the 16 size classes ranging from
-     * 8 to 128.
-     *
-     *  8 + (8 * 0) = 8
-     *  8 + (8 * 1) = 16
-     *  8 + (8 * 2) = 24
-     *  8 + (8 * 3) = 32
-     *  8 + (8 * 4) = 40
-     *  8 + (8 * 5) = 48
-     *  8 + (8 * 6) = 56
-     *  8 + (8 * 7) = 64
-     *  8 + (8 * 8) = 72
-     *  8 + (8 * 9) = 80
-     *  8 + (8 * 10) = 88
-     *  8 + (8 * 11) = 96
-     *  8 + (8 * 12) = 104
-     *  8 + (8 * 13) = 112
-     *  8 + (8 * 14) = 120
-     *  8 + (8 * 15) = 128
-     *
-     * Large balance factors may result in adverse effects. However, I have
-     * made no efforts to verify this statement.
-     */
-    int8_t m_balanceFactor;
-
-    int32_t* m_sizeClasses;
-
-    void** m_freeListAllocators;
-
-    zen_Allocator_t* m_allocator;
-
-    zen_SegregatedFitsAllocatorMode_t m_mode;
-};
-
-/**
- * @memberof SegregatedFitsAllocator
- */
-typedef struct zen_SegregatedFitsAllocator_t zen_SegregatedFitsAllocator_t;
-
-#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEGREGATED_FITS_ALLOCATOR_H */
\ No newline at end of file
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, September 02, 2018
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEGREGATED_FITS_ALLOCATOR_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEGREGATED_FITS_ALLOCATOR_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+/*******************************************************************************
+ * FreeCell                                                                    *
+ *******************************************************************************/
+
+/**
+ * A free cell is a filler object which is linked into a free list. The link
+ * is stored in the body of the filler, therefore, the free lists need no
+ * memory of their own.
+ *
+ * @class FreeCell
+ * @ingroup zen_memory_allocator
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_FreeCell_t {
+    zen_Object_t m_header;
+    struct zen_FreeCell_t* m_next;
+};
+
+/**
+ * @memberof FreeCell
+ */
+typedef struct zen_FreeCell_t zen_FreeCell_t;
+
+/*******************************************************************************
+ * SegregatedFitsAllocator                                                     *
+ *******************************************************************************/
+
+/**
+ * The sizes of the cells are multiples of the granule, which is equal to the
+ * alignment of the old generation.
+ */
+#define ZEN_SEGREGATED_FITS_ALLOCATOR_GRANULE_SHIFT 4
+
+#define ZEN_SEGREGATED_FITS_ALLOCATOR_GRANULE_SIZE (1 << ZEN_SEGREGATED_FITS_ALLOCATOR_GRANULE_SHIFT)
+
+/**
+ * The size of the smallest cell which can hold the link of a free list. A
+ * smaller cell remains a filler until it is coalesced with its neighbours.
+ */
+#define ZEN_SEGREGATED_FITS_ALLOCATOR_MINIMUM_CELL_SIZE \
+    ((sizeof (zen_FreeCell_t) + (ZEN_SEGREGATED_FITS_ALLOCATOR_GRANULE_SIZE - 1)) & \
+    ~(ZEN_SEGREGATED_FITS_ALLOCATOR_GRANULE_SIZE - 1))
+
+/**
+ * The size of the largest cell which belongs to a size class. The larger
+ * cells are binned by powers of two.
+ */
+#define ZEN_SEGREGATED_FITS_ALLOCATOR_MAXIMUM_SMALL_SIZE 128
+
+/**
+ * The number of size classes. The class `i` holds the cells of exactly
+ * `i * ZEN_SEGREGATED_FITS_ALLOCATOR_GRANULE_SIZE` bytes. The classes below
+ * the minimum cell size remain empty.
+ */
+#define ZEN_SEGREGATED_FITS_ALLOCATOR_SIZE_CLASS_COUNT \
+    ((ZEN_SEGREGATED_FITS_ALLOCATOR_MAXIMUM_SMALL_SIZE >> ZEN_SEGREGATED_FITS_ALLOCATOR_GRANULE_SHIFT) + 1)
+
+/**
+ * The number of large bins. The bin `i` holds the cells whose sizes lie in
+ * `[2^i, 2^(i + 1))`.
+ */
+#define ZEN_SEGREGATED_FITS_ALLOCATOR_LARGE_BIN_COUNT 32
+
+/**
+ * The segregated-fits allocator reuses the free cells scattered between the
+ * objects of a region. The cells are found by sweeping the region. A run of
+ * adjacent fillers is coalesced into a single cell, which is linked into a
+ * free list according to its size. The cells remain walkable, because every
+ * cell is a filler object.
+ *
+ * A basic free-list allocator spends most of its time searching for a free
+ * cell of an appropriate size. The allocator avoids this using multiple
+ * free lists, each associated with a *size class*. The size classes are the
+ * multiples of the granule, up to 128 bytes. A request is rounded up to the
+ * granule, therefore, every cell in its size class fits exactly.
+ *
+ * A bitmap records the size classes whose free lists are not empty. The
+ * smallest class that can satisfy a request is found by masking the classes
+ * smaller than the request, and counting the trailing zeros of the remaining
+ * bits. Therefore, a request is satisfied in constant time, no matter how
+ * many size classes are empty. The large cells are binned by powers of two,
+ * with a bitmap of their own. A request larger than 128 bytes is satisfied
+ * from the first non-empty bin whose every cell fits, or, failing that, by
+ * searching the bin of the request for the first cell that fits.
+ *
+ * A cell larger than the request is split. The object is carved from the end
+ * of the cell, so that the remainder keeps the header at the start of the
+ * cell. The remainder is linked into the free list of its new size.
+ *
+ * Please refer "The Garbage Collection Handbook" by Richard Jones, Antony
+ * Hosking and Eliot Moss for more information. The algorithm described above
+ * was extracted from Chapter 7, section 4.
+ *
+ * @class SegregatedFitsAllocator
+ * @ingroup zen_memory_allocator
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_SegregatedFitsAllocator_t {
+
+    /**
+     * The free lists of the size classes.
+     */
+    zen_FreeCell_t* m_sizeClasses[ZEN_SEGREGATED_FITS_ALLOCATOR_SIZE_CLASS_COUNT];
+
+    /**
+     * The free lists of the large bins.
+     */
+    zen_FreeCell_t* m_largeBins[ZEN_SEGREGATED_FITS_ALLOCATOR_LARGE_BIN_COUNT];
+
+    /**
+     * The bit `i` is set if the free list of the size class `i` is not empty.
+     */
+    uint32_t m_sizeClassMap;
+
+    /**
+     * The bit `i` is set if the free list of the large bin `i` is not empty.
+     */
+    uint32_t m_largeBinMap;
+
+    /**
+     * The number of bytes in the free lists.
+     */
+    intptr_t m_freeSize;
+};
+
+/**
+ * @memberof SegregatedFitsAllocator
+ */
+typedef struct zen_SegregatedFitsAllocator_t zen_SegregatedFitsAllocator_t;
+
+/* Constructor */
+
+/**
+ * @memberof SegregatedFitsAllocator
+ */
+zen_SegregatedFitsAllocator_t* zen_SegregatedFitsAllocator_new();
+
+/* Destructor */
+
+/**
+ * @memberof SegregatedFitsAllocator
+ */
+void zen_SegregatedFitsAllocator_delete(zen_SegregatedFitsAllocator_t* allocator);
+
+/* Allocate */
+
+/**
+ * Allocates a cell of the specified size, which should be a multiple of the
+ * granule. The memory is not cleared. Returns null if no free cell is large
+ * enough.
+ *
+ * @memberof SegregatedFitsAllocator
+ */
+uint8_t* zen_SegregatedFitsAllocator_allocate(zen_SegregatedFitsAllocator_t* allocator,
+    int32_t size);
+
+/* Clear */
+
+/**
+ * Forgets every free cell. The cells remain fillers.
+ *
+ * @memberof SegregatedFitsAllocator
+ */
+void zen_SegregatedFitsAllocator_clear(zen_SegregatedFitsAllocator_t* allocator);
+
+/* Empty */
+
+/**
+ * @memberof SegregatedFitsAllocator
+ */
+static inline bool zen_SegregatedFitsAllocator_isEmpty(zen_SegregatedFitsAllocator_t* allocator) {
+    return (allocator->m_sizeClassMap | allocator->m_largeBinMap) == 0;
+}
+
+/* Free */
+
+/**
+ * Covers the specified memory with a filler, and links it into the free list
+ * of its size, if it is large enough to hold the link.
+ *
+ * @memberof SegregatedFitsAllocator
+ */
+void zen_SegregatedFitsAllocator_free(zen_SegregatedFitsAllocator_t* allocator,
+    uint8_t* cell, int32_t size);
+
+/* Sweep */
+
+/**
+ * Rebuilds the free lists from the fillers between the specified addresses.
+ * The adjacent fillers are coalesced. The run of fillers which ends at `end`
+ * is not linked; instead, its start is returned, so that the caller can
+ * reclaim it otherwise. Returns `end` if the last object is not a filler.
+ *
+ * @memberof SegregatedFitsAllocator
+ */
+uint8_t* zen_SegregatedFitsAllocator_sweep(zen_SegregatedFitsAllocator_t* allocator,
+    uint8_t* start, uint8_t* end);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEGREGATED_FITS_ALLOCATOR_H */
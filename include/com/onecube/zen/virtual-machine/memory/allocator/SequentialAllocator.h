@@ -20,10 +20,10 @@
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEQUENTIAL_ALLOCATOR_H
 
 #include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/AllocationBuffer.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/Chunk.h>
 
-#include <jtk/collection/list/SinglyLinkedList.h>
 #include <jtk/concurrent/lock/Mutex.h>
-#include <jtk/system/Allocator.h>
 
 /*******************************************************************************
  * SequentialAllocator                                                         *
@@ -41,6 +41,17 @@
  *
  * The sequence of allocation addresses is linear for a given chunk.
  *
+ * The allocator is shared by all the threads. The free pointer is bumped with
+ * an atomic compare-and-swap, therefore, allocation never acquires a lock.
+ * Usually, the threads do not allocate objects directly from this allocator.
+ * Instead, each thread claims a large chunk, known as the thread local
+ * allocation buffer, and allocates objects from it without synchronization.
+ * Please refer the documentation of `zen_AllocationBuffer_t` for more details.
+ *
+ * A collector may leave objects behind in the chunk, when it cannot move them.
+ * Such objects are recorded as holes. The allocator claims memory around the
+ * holes.
+ *
  * The advantages of this allocator is as follows:
  * - It is simple.
  * - It is efficient.
@@ -91,8 +102,31 @@ struct zen_SequentialAllocator_t {
      * this allocator.
      */
     uint8_t* m_free;
-    
-    jtk_SinglyLinkedList_t* m_allocationBuffers;
+
+    /**
+     * The allocation buffers which claim their chunks from this allocator.
+     * The buffers are linked through their `m_next` fields. The list is
+     * modified only when a thread starts or terminates.
+     */
+    zen_AllocationBuffer_t* m_allocationBuffers;
+
+    /**
+     * The buffer which records the objects allocated directly from the shared
+     * chunk. It also inherits the chunks of the buffers which were merged.
+     * It is guarded by `m_allocationBuffersMutex`.
+     */
+    zen_AllocationBuffer_t* m_sharedAllocationBuffer;
+
+    /**
+     * The objects left behind by the last collection, sorted by their
+     * addresses. The allocator never claims memory which overlaps them.
+     */
+    zen_ChunkArray_t* m_holes;
+
+    /**
+     * Guards the list of allocation buffers. It is never acquired during
+     * allocation.
+     */
     jtk_Mutex_t* m_allocationBuffersMutex;
 };
 
@@ -106,34 +140,86 @@ typedef struct zen_SequentialAllocator_t zen_SequentialAllocator_t;
 /**
  * @memberof SequentialAllocator
  */
-zen_SequentialAllocator_t* zen_SequentialAllocator_new(jtk_Allocator_t* allocator, uint8_t* start,
-    uint8_t* end);
+zen_SequentialAllocator_t* zen_SequentialAllocator_new(uint8_t* start, uint8_t* limit);
 
 /* Destructor */
 
 /**
  * @memberof SequentialAllocator
  */
-void zen_SequentialAllocator_delete(jtk_Allocator_t* allocator,
-    zen_SequentialAllocator_t* sequentialAllocator);
+void zen_SequentialAllocator_delete(zen_SequentialAllocator_t* allocator);
 
 /* Allocator */
 
 /**
+ * Allocates an object on behalf of a caller which does not own an allocation
+ * buffer. The allocations are serialized by a mutex, and are served from the
+ * shared allocation buffer. Returns null if the chunk is exhausted.
+ *
+ * @memberof SequentialAllocator
+ */
+uint8_t* zen_SequentialAllocator_allocate(zen_SequentialAllocator_t* allocator,
+    int32_t headerSize, int32_t bodySize);
+
+/**
+ * The slow path of allocation from a buffer. It is invoked when an object of
+ * the specified size does not fit in the specified buffer. Depending on the
+ * free space left in the buffer, either the buffer is refilled, or the object
+ * is allocated directly from the shared chunk. The memory is cleared. Returns
+ * null if the chunk is exhausted.
+ *
  * @memberof SequentialAllocator
  */
-int8_t* zen_SequentialAllocator_allocate(zen_SequentialAllocator_t* allocator, int32_t headerSize, int32_t bodySize);
+uint8_t* zen_SequentialAllocator_allocateFromBuffer(zen_SequentialAllocator_t* allocator,
+    zen_AllocationBuffer_t* buffer, int32_t size);
 
 /* Allocation Buffer */
 
 /**
+ * Creates an allocation buffer for a new thread.
+ *
  * @memberof SequentialAllocator
  */
 zen_AllocationBuffer_t* zen_SequentialAllocator_makeAllocationBuffer(zen_SequentialAllocator_t* allocator);
 
 /**
+ * Destroys the allocation buffer of a terminating thread. The objects that
+ * were allocated in the buffer remain in the chunk.
+ *
  * @memberof SequentialAllocator
  */
 void zen_SequentialAllocator_mergeAllocationBuffer(zen_SequentialAllocator_t* allocator, zen_AllocationBuffer_t* buffer);
 
-#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEQUENTIAL_ALLOCATOR_H */
\ No newline at end of file
+/* Chunks */
+
+/**
+ * Appends the chunks claimed by all the allocation buffers, along with the
+ * holes, to the specified array. The buffers should be retired beforehand.
+ *
+ * @memberof SequentialAllocator
+ */
+void zen_SequentialAllocator_getChunks(zen_SequentialAllocator_t* allocator,
+    zen_ChunkArray_t* chunks);
+
+/* Reset */
+
+/**
+ * Rewinds the free pointer to the start of the chunk. The sizes of the
+ * allocation buffers are adapted, and their records of chunks and the holes
+ * are cleared. It should be invoked only when the world is stopped.
+ *
+ * @memberof SequentialAllocator
+ */
+void zen_SequentialAllocator_reset(zen_SequentialAllocator_t* allocator);
+
+/* Retire */
+
+/**
+ * Retires all the allocation buffers. It should be invoked only when the world
+ * is stopped.
+ *
+ * @memberof SequentialAllocator
+ */
+void zen_SequentialAllocator_retireAllocationBuffers(zen_SequentialAllocator_t* allocator);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEQUENTIAL_ALLOCATOR_H */
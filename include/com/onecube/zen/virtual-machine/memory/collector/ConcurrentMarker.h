@@ -0,0 +1,294 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_CONCURRENT_MARKER_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_CONCURRENT_MARKER_H
+
+#include <pthread.h>
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/Chunk.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/RootVisitor.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/SatbQueue.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/NewGeneration.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
+
+/*******************************************************************************
+ * ConcurrentMarkerState                                                       *
+ *******************************************************************************/
+
+/**
+ * @class ConcurrentMarkerState
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+enum zen_ConcurrentMarkerState_t {
+    /**
+     * No marking cycle is in progress.
+     */
+    ZEN_CONCURRENT_MARKER_STATE_IDLE,
+
+    /**
+     * The marker traces the old generation, while the threads run.
+     */
+    ZEN_CONCURRENT_MARKER_STATE_MARKING,
+
+    /**
+     * The marker ran out of objects to trace. The cycle is waiting for the
+     * remark pause.
+     */
+    ZEN_CONCURRENT_MARKER_STATE_COMPLETED
+};
+
+/**
+ * @memberof ConcurrentMarkerState
+ */
+typedef enum zen_ConcurrentMarkerState_t zen_ConcurrentMarkerState_t;
+
+/*******************************************************************************
+ * ConcurrentMarker                                                            *
+ *******************************************************************************/
+
+/**
+ * The percentage of the white region which should be occupied before a
+ * marking cycle begins, unless configured otherwise.
+ */
+#define ZEN_CONCURRENT_MARKER_DEFAULT_INITIATING_OCCUPANCY 45
+
+/**
+ * The number of objects the marker scans before it checks whether a pause was
+ * requested.
+ */
+#define ZEN_CONCURRENT_MARKER_BATCH_SIZE 256
+
+/**
+ * The initial capacity of the mark stack.
+ */
+#define ZEN_CONCURRENT_MARKER_DEFAULT_MARK_STACK_CAPACITY 1024
+
+/**
+ * The concurrent marker marks the old generation on a background thread,
+ * while the other threads continue to run. A marking cycle works in three
+ * phases.
+ *
+ * 1. The initial mark pause marks the objects referenced by the roots and the
+ *    new generation. It piggybacks on the minor collection which found the
+ *    white region occupied beyond the initiating occupancy.
+ * 2. The marker traces the old generation concurrently. The objects whose
+ *    references are overwritten meanwhile are logged by the snapshot-at-the-
+ *    beginning barrier, and traced as well. The objects promoted during the
+ *    cycle are marked on arrival.
+ * 3. The remark pause marks the objects referenced by the roots and the new
+ *    generation once again, along with the logged objects which remain, and
+ *    pins the objects referenced ambiguously. The old generation is then
+ *    compacted by the mark-compact collector, without marking it again.
+ *
+ * The pauses are proportional to the size of the roots, the new generation and
+ * the barrier logs, rather than the size of the old generation. The marker is
+ * paused during the minor collections. If the old generation is exhausted
+ * before the cycle completes, the remaining marking is finished in the pause
+ * of the major collection.
+ *
+ * @class ConcurrentMarker
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_ConcurrentMarker_t {
+    zen_NewGeneration_t* m_newGeneration;
+    zen_OldGeneration_t* m_oldGeneration;
+
+    /**
+     * The queue of the references logged by the pre-write barrier.
+     */
+    zen_SatbQueue_t* m_satbQueue;
+
+    /**
+     * Marks the objects referenced by the roots, and pins the objects
+     * referenced ambiguously.
+     */
+    zen_RootVisitor_t m_markingVisitor;
+
+    /**
+     * The chunks of the new generation, whose objects are treated as roots.
+     */
+    zen_ChunkArray_t* m_youngChunks;
+
+    /**
+     * The marked objects whose fields are yet to be scanned.
+     */
+    zen_Object_t** m_markStack;
+    int32_t m_markStackSize;
+    int32_t m_markStackCapacity;
+
+    /**
+     * The state of the current marking cycle.
+     */
+    zen_ConcurrentMarkerState_t m_state;
+
+    /**
+     * Determines whether the marking cycles are initiated.
+     */
+    bool m_enabled;
+
+    /**
+     * The percentage of the white region which should be occupied before a
+     * marking cycle begins.
+     */
+    int32_t m_initiatingOccupancy;
+
+    /**
+     * The background thread, which is started with the first marking cycle.
+     */
+    pthread_t m_thread;
+    bool m_threadStarted;
+
+    /**
+     * Determines whether the background thread should exit.
+     */
+    bool m_terminated;
+
+    /**
+     * The marker holds the mutex while it scans the objects. The collector
+     * holds it while the marker is paused.
+     */
+    pthread_mutex_t m_mutex;
+    pthread_cond_t m_condition;
+
+    /**
+     * The number of pending requests to pause the marker.
+     */
+    int32_t m_pauseRequestCount;
+
+    /**
+     * The number of marking cycles initiated.
+     */
+    int64_t m_cycleCount;
+
+    /**
+     * The duration of the last initial mark pause, in nanoseconds.
+     */
+    uint64_t m_initialMarkDuration;
+
+    /**
+     * The time the marker spent tracing concurrently in the last cycle, in
+     * nanoseconds.
+     */
+    uint64_t m_concurrentDuration;
+
+    /**
+     * The duration of the last remark pause, in nanoseconds.
+     */
+    uint64_t m_remarkDuration;
+};
+
+/**
+ * @memberof ConcurrentMarker
+ */
+typedef struct zen_ConcurrentMarker_t zen_ConcurrentMarker_t;
+
+/* Constructor */
+
+/**
+ * @memberof ConcurrentMarker
+ */
+zen_ConcurrentMarker_t* zen_ConcurrentMarker_new(zen_NewGeneration_t* newGeneration,
+    zen_OldGeneration_t* oldGeneration);
+
+/* Destructor */
+
+/**
+ * @memberof ConcurrentMarker
+ */
+void zen_ConcurrentMarker_delete(zen_ConcurrentMarker_t* marker);
+
+/* Completed */
+
+/**
+ * Determines whether the marker is waiting for the remark pause.
+ *
+ * @memberof ConcurrentMarker
+ */
+static inline bool zen_ConcurrentMarker_isCompleted(zen_ConcurrentMarker_t* marker) {
+    return __atomic_load_n(&marker->m_state, __ATOMIC_ACQUIRE) ==
+        ZEN_CONCURRENT_MARKER_STATE_COMPLETED;
+}
+
+/* Marking */
+
+/**
+ * Determines whether a marking cycle is in progress. It should be invoked only
+ * when the world is stopped.
+ *
+ * @memberof ConcurrentMarker
+ */
+static inline bool zen_ConcurrentMarker_isMarking(zen_ConcurrentMarker_t* marker) {
+    return __atomic_load_n(&marker->m_state, __ATOMIC_ACQUIRE) !=
+        ZEN_CONCURRENT_MARKER_STATE_IDLE;
+}
+
+/* Pause */
+
+/**
+ * Pauses the marker, until `zen_ConcurrentMarker_resume()` is invoked. The
+ * marker is paused only between the batches of objects it scans.
+ *
+ * @memberof ConcurrentMarker
+ */
+void zen_ConcurrentMarker_pause(zen_ConcurrentMarker_t* marker);
+
+/* Remark */
+
+/**
+ * Completes the current marking cycle. It should be invoked only when the
+ * world is stopped. Afterwards, the old generation should be compacted with
+ * `zen_MarkCompactGarbageCollector_compact()`, in the same pause.
+ *
+ * @memberof ConcurrentMarker
+ */
+void zen_ConcurrentMarker_remark(zen_ConcurrentMarker_t* marker,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context);
+
+/* Resume */
+
+/**
+ * @memberof ConcurrentMarker
+ */
+void zen_ConcurrentMarker_resume(zen_ConcurrentMarker_t* marker);
+
+/* Start */
+
+/**
+ * Determines whether a marking cycle should begin, given the occupancy of the
+ * white region. It should be invoked only when the world is stopped.
+ *
+ * @memberof ConcurrentMarker
+ */
+bool zen_ConcurrentMarker_shouldStart(zen_ConcurrentMarker_t* marker);
+
+/**
+ * Begins a marking cycle with the initial mark. It should be invoked only
+ * when the world is stopped.
+ *
+ * @memberof ConcurrentMarker
+ */
+void zen_ConcurrentMarker_start(zen_ConcurrentMarker_t* marker,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_CONCURRENT_MARKER_H */
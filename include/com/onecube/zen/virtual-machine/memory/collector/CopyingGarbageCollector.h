@@ -0,0 +1,214 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_COPYING_GARBAGE_COLLECTOR_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_COPYING_GARBAGE_COLLECTOR_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/Chunk.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/RootVisitor.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/NewGeneration.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
+
+/*******************************************************************************
+ * CopyingGarbageCollector                                                     *
+ *******************************************************************************/
+
+/**
+ * The number of minor collections that an object survives in the new
+ * generation before it is promoted, unless configured otherwise.
+ */
+#define ZEN_COPYING_GARBAGE_COLLECTOR_DEFAULT_TENURING_THRESHOLD 6
+
+/**
+ * The copying garbage collector performs the minor collections of the new
+ * generation. It is a Cheney style collector. The live objects of the middle
+ * and left regions are copied to the right region, which doubles as the queue
+ * of objects whose fields are yet to be scanned. Therefore, the collection
+ * does not recurse, and its duration is proportional to the number of live
+ * objects, rather than the size of the new generation.
+ *
+ * An object is promoted to the old generation once its age reaches the
+ * tenuring threshold, or if it does not fit in the right region. A collection
+ * is attempted only if the old generation can absorb every object in the new
+ * generation. Therefore, a promotion never fails.
+ *
+ * The values in the stack frames are not typed. A value which points to an
+ * object in the new generation is treated as an ambiguous reference; the
+ * object is pinned, and left behind where it is. The collector verifies that
+ * an ambiguous reference points to the start of an object by walking the
+ * objects of the chunk which contains it. The allocator records the chunks
+ * it hands out for this purpose. The objects left behind become holes, which
+ * the allocator and the collector avoid until the next collection.
+ *
+ * The references from the old generation to the new generation are found
+ * through the card table of the old generation. Only the objects in the dirty
+ * cards are scanned, and the cards which no longer refer to the new generation
+ * are cleaned.
+ *
+ * Please refer "The Garbage Collection Handbook" by Richard Jones, Antony
+ * Hosking and Eliot Moss for more information. The algorithm described above
+ * was extracted from Chapter 4, section 1, and Chapter 9.
+ *
+ * @class CopyingGarbageCollector
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_CopyingGarbageCollector_t {
+    zen_NewGeneration_t* m_newGeneration;
+    zen_OldGeneration_t* m_oldGeneration;
+
+    /**
+     * The age at which an object is promoted.
+     */
+    int32_t m_tenuringThreshold;
+
+    /**
+     * The visitor which pins the objects referenced ambiguously.
+     */
+    zen_RootVisitor_t m_pinningVisitor;
+
+    /**
+     * The visitor which evacuates the objects referenced by the roots.
+     */
+    zen_RootVisitor_t m_evacuatingVisitor;
+
+    /**
+     * The chunks of the middle and left regions, sorted by address.
+     */
+    zen_ChunkArray_t* m_fromChunks;
+
+    /**
+     * The objects pinned in the middle region.
+     */
+    zen_ChunkArray_t* m_middlePins;
+
+    /**
+     * The objects pinned in the left region.
+     */
+    zen_ChunkArray_t* m_leftPins;
+
+    /**
+     * The chunks of the objects copied to the right region. A new chunk begins
+     * after each hole.
+     */
+    zen_ChunkArray_t* m_rightChunks;
+
+    /**
+     * The address where the next object is copied in the right region.
+     */
+    uint8_t* m_rightFree;
+
+    /**
+     * The end of the free space which contains `m_rightFree`. It is either the
+     * start of a hole, or the end of the right region.
+     */
+    uint8_t* m_rightLimit;
+
+    /**
+     * The index of the next hole in the right region.
+     */
+    int32_t m_rightHoleIndex;
+
+    /**
+     * The index of the chunk in `m_rightChunks` which is being scanned.
+     */
+    int32_t m_scanChunkIndex;
+
+    /**
+     * The next object to scan in the right region.
+     */
+    uint8_t* m_scanPointer;
+
+    /**
+     * The next object to scan in the old generation.
+     */
+    uint8_t* m_promotionScanPointer;
+
+    /**
+     * The objects promoted into the free cells of the old generation, which
+     * lie below `m_promotionScanPointer`, and are scanned separately.
+     */
+    zen_ChunkArray_t* m_promotedCells;
+
+    /**
+     * The index of the next object to scan in `m_promotedCells`.
+     */
+    int32_t m_promotedCellIndex;
+
+    /**
+     * The number of minor collections performed.
+     */
+    int64_t m_collectionCount;
+
+    /**
+     * The number of bytes copied to the right region by the last collection.
+     */
+    int64_t m_copiedBytes;
+
+    /**
+     * The number of bytes promoted to the old generation by the last
+     * collection.
+     */
+    int64_t m_promotedBytes;
+
+    /**
+     * The number of dirty cards scanned by the last collection.
+     */
+    int64_t m_scannedCardCount;
+};
+
+/**
+ * @memberof CopyingGarbageCollector
+ */
+typedef struct zen_CopyingGarbageCollector_t zen_CopyingGarbageCollector_t;
+
+/* Constructor */
+
+/**
+ * @memberof CopyingGarbageCollector
+ */
+zen_CopyingGarbageCollector_t* zen_CopyingGarbageCollector_new(
+    zen_NewGeneration_t* newGeneration, zen_OldGeneration_t* oldGeneration);
+
+/* Destructor */
+
+/**
+ * @memberof CopyingGarbageCollector
+ */
+void zen_CopyingGarbageCollector_delete(zen_CopyingGarbageCollector_t* collector);
+
+/* Collect */
+
+/**
+ * Collects the new generation. The roots are enumerated twice with the
+ * specified function; first to pin the objects referenced ambiguously, then
+ * to evacuate the objects referenced by the other roots. It should be invoked
+ * only when the world is stopped.
+ *
+ * Returns false, without collecting, if the old generation cannot absorb the
+ * objects of the new generation. In which case, the old generation should be
+ * collected first.
+ *
+ * @memberof CopyingGarbageCollector
+ */
+bool zen_CopyingGarbageCollector_collect(zen_CopyingGarbageCollector_t* collector,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_COPYING_GARBAGE_COLLECTOR_H */
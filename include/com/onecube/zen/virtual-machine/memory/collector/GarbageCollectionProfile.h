@@ -38,8 +38,30 @@ struct zen_GarbageCollectionProfile_t {
     zen_GarbageCollectionType_t m_type;
     uint64_t m_memoryFreePreviously;
     uint64_t m_memoryUsedPreviously;
+
+    /**
+     * The duration of the collection, in nanoseconds.
+     */
     uint64_t m_duration;
-    
+
+    /**
+     * The time, in nanoseconds, that the running threads took to stop before
+     * the collection.
+     */
+    uint64_t m_safepointDuration;
+
+    /**
+     * The number of threads which marked the old generation, or zero if the
+     * old generation was not collected.
+     */
+    int32_t m_markingWorkerCount;
+
+    /**
+     * The time, in nanoseconds, that each marking thread spent marking the
+     * old generation. It is owned by the collector, and is valid only until
+     * the listener returns.
+     */
+    uint64_t* m_markingDurations;
 };
 
 /**
@@ -33,7 +33,9 @@
  */
 enum zen_GarbageCollectionReason_t {
     ZEN_GARBAGE_COLLECTION_REASON_NATIVE_REQUEST,
-    ZEN_GARBAGE_COLLECTION_REASON_APPLICATION_REQUEST
+    ZEN_GARBAGE_COLLECTION_REASON_APPLICATION_REQUEST,
+    ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE,
+    ZEN_GARBAGE_COLLECTION_REASON_CONCURRENT_MARKING_COMPLETED
 };
 
 /**
@@ -25,6 +25,7 @@
 
 enum zen_GarbageCollectorType_t {
     ZEN_GARBAGE_COLLECTOR_TYPE_MARK_SWEEP,
+    ZEN_GARBAGE_COLLECTOR_TYPE_MARK_COMPACT,
     ZEN_GARBAGE_COLLECTOR_TYPE_COPYING
 };
 
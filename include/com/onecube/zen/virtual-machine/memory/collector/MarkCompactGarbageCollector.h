@@ -0,0 +1,274 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_MARK_COMPACT_GARBAGE_COLLECTOR_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_MARK_COMPACT_GARBAGE_COLLECTOR_H
+
+#include <pthread.h>
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/Chunk.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/RootVisitor.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/WorkStealingDeque.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/NewGeneration.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
+
+/*******************************************************************************
+ * MarkingWorker                                                               *
+ *******************************************************************************/
+
+/**
+ * A thread which marks the old generation, in parallel with the other
+ * marking workers. Each worker owns a deque of the marked objects whose
+ * fields are yet to be scanned. When its deque is empty, the worker steals
+ * objects from the deques of the other workers.
+ *
+ * @class MarkingWorker
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_MarkingWorker_t {
+    struct zen_MarkCompactGarbageCollector_t* m_collector;
+    zen_WorkStealingDeque_t* m_deque;
+    pthread_t m_thread;
+    int32_t m_index;
+
+    /**
+     * The time, in nanoseconds, that the worker spent marking in the last
+     * collection.
+     */
+    uint64_t m_duration;
+
+    /**
+     * The number of objects scanned by the worker in the last collection.
+     */
+    int64_t m_scannedObjectCount;
+
+    /**
+     * The number of objects stolen by the worker in the last collection.
+     */
+    int64_t m_stolenObjectCount;
+};
+
+/**
+ * @memberof MarkingWorker
+ */
+typedef struct zen_MarkingWorker_t zen_MarkingWorker_t;
+
+/*******************************************************************************
+ * MarkCompactGarbageCollector                                                 *
+ *******************************************************************************/
+
+/**
+ * The number of marking workers, unless configured otherwise.
+ */
+#define ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_DEFAULT_WORKER_COUNT 4
+
+/**
+ * The maximum number of marking workers.
+ */
+#define ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_MAXIMUM_WORKER_COUNT 64
+
+/**
+ * The dense prefix ends where the dead objects before it exceed this fraction
+ * of its size, expressed as a shift. With a shift of 4, at most one sixteenth
+ * of the prefix is wasted.
+ */
+#define ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_DENSE_PREFIX_WASTE_SHIFT 4
+
+/**
+ * The mark-compact garbage collector performs the major collections of the
+ * old generation. It is a Lisp-2 style collector, which works in four phases.
+ *
+ * 1. The reachable objects are marked. The objects are traced by a number of
+ *    marking workers in parallel, with explicit work-stealing deques instead
+ *    of recursion, so that long lists do not overflow the native stack. The
+ *    mark bit of an object is set atomically, therefore, exactly one worker
+ *    scans each marked object.
+ * 2. The new address of each marked object is computed by sliding it towards
+ *    the start of the white region. The new addresses are not stored in the
+ *    objects. Instead, the new address of the first object of each card is
+ *    recorded, and the addresses of the other objects in the card are derived
+ *    from it.
+ * 3. The references in the roots, the new generation and the marked objects
+ *    are updated.
+ * 4. The marked objects are moved, preserving their order.
+ *
+ * The objects in the new generation are treated as roots, because the major
+ * collector does not trace them. A major collection is followed by a minor
+ * collection, which collects the new generation.
+ *
+ * The objects referenced ambiguously are pinned, and not moved. Likewise, the
+ * objects in the dense prefix, a leading part of the white region which is
+ * mostly live, are not moved, unless the collection is requested with
+ * `ZEN_GARBAGE_COLLECTION_FLAG_SQUEEZE`. The gaps which remain are covered by
+ * filler objects. The waste in the dense prefix is bounded, therefore, the
+ * fragmentation of the old generation does not grow without a limit. The
+ * adjacent fillers are coalesced into free cells, where the objects are
+ * promoted until the next major collection.
+ *
+ * The objects in the large object space are marked along with the white
+ * region, but never moved. The large objects which are not marked are
+ * unmapped after the compaction.
+ *
+ * Please refer "The Garbage Collection Handbook" by Richard Jones, Antony
+ * Hosking and Eliot Moss for more information. The algorithm described above
+ * was extracted from Chapter 3, section 2.
+ *
+ * @class MarkCompactGarbageCollector
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_MarkCompactGarbageCollector_t {
+    zen_NewGeneration_t* m_newGeneration;
+    zen_OldGeneration_t* m_oldGeneration;
+
+    /**
+     * Marks the objects referenced by the roots.
+     */
+    zen_RootVisitor_t m_markingVisitor;
+
+    /**
+     * Updates the references held by the roots.
+     */
+    zen_RootVisitor_t m_updatingVisitor;
+
+    /**
+     * The chunks of the new generation, whose objects are treated as roots.
+     */
+    zen_ChunkArray_t* m_youngChunks;
+
+    /**
+     * The workers which mark the old generation. The first worker runs on the
+     * thread which requested the collection.
+     */
+    zen_MarkingWorker_t** m_workers;
+    int32_t m_workerCount;
+
+    /**
+     * The number of workers which may still hold unscanned objects. The
+     * marking phase terminates when it drops to zero.
+     */
+    int32_t m_activeWorkerCount;
+
+    /**
+     * The worker whose deque receives the next object marked from the roots.
+     * The roots are distributed among the workers in a round robin fashion.
+     */
+    int32_t m_nextWorker;
+
+    /**
+     * The time, in nanoseconds, that each worker spent marking in the last
+     * collection.
+     */
+    uint64_t* m_markingDurations;
+
+    /**
+     * The compaction address reached when the first object which begins in
+     * each card of the white region is visited. The new address of any object
+     * is derived from the compaction address of its card.
+     */
+    uint8_t** m_cardAddresses;
+
+    /**
+     * The objects below this address are not moved.
+     */
+    uint8_t* m_densePrefixEnd;
+
+    /**
+     * The number of major collections performed.
+     */
+    int64_t m_collectionCount;
+
+    /**
+     * The number of bytes occupied by the marked objects in the last
+     * collection.
+     */
+    int64_t m_markedBytes;
+
+    /**
+     * The number of bytes reclaimed by the last collection.
+     */
+    int64_t m_reclaimedBytes;
+};
+
+/**
+ * @memberof MarkCompactGarbageCollector
+ */
+typedef struct zen_MarkCompactGarbageCollector_t zen_MarkCompactGarbageCollector_t;
+
+/* Constructor */
+
+/**
+ * @memberof MarkCompactGarbageCollector
+ */
+zen_MarkCompactGarbageCollector_t* zen_MarkCompactGarbageCollector_new(
+    zen_NewGeneration_t* newGeneration, zen_OldGeneration_t* oldGeneration);
+
+/* Destructor */
+
+/**
+ * @memberof MarkCompactGarbageCollector
+ */
+void zen_MarkCompactGarbageCollector_delete(zen_MarkCompactGarbageCollector_t* collector);
+
+/* Collect */
+
+/**
+ * Collects the old generation. It should be invoked only when the world is
+ * stopped.
+ *
+ * @param flags
+ *        If `ZEN_GARBAGE_COLLECTION_FLAG_SQUEEZE` is specified, every gap in
+ *        the white region, except those before the pinned objects, is
+ *        squeezed out.
+ *
+ * @memberof MarkCompactGarbageCollector
+ */
+void zen_MarkCompactGarbageCollector_collect(zen_MarkCompactGarbageCollector_t* collector,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context,
+    int32_t flags);
+
+/* Compact */
+
+/**
+ * Compacts the old generation, whose live objects were marked beforehand,
+ * for example, by the concurrent marker. The objects referenced ambiguously
+ * should have been pinned while marking, in the same pause. It should be
+ * invoked only when the world is stopped.
+ *
+ * @memberof MarkCompactGarbageCollector
+ */
+void zen_MarkCompactGarbageCollector_compact(zen_MarkCompactGarbageCollector_t* collector,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context,
+    int32_t flags);
+
+/* Worker Count */
+
+/**
+ * Sets the number of threads which mark the old generation. It should be
+ * between 1 and `ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_MAXIMUM_WORKER_COUNT`.
+ *
+ * @memberof MarkCompactGarbageCollector
+ */
+void zen_MarkCompactGarbageCollector_setWorkerCount(zen_MarkCompactGarbageCollector_t* collector,
+    int32_t workerCount);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_MARK_COMPACT_GARBAGE_COLLECTOR_H */
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_ROOT_VISITOR_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_ROOT_VISITOR_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+/*******************************************************************************
+ * RootVisitor                                                                 *
+ *******************************************************************************/
+
+// Forward Declarations
+
+/**
+ * @memberof RootVisitor
+ */
+typedef struct zen_RootVisitor_t zen_RootVisitor_t;
+
+// Visit
+
+/**
+ * Visits a location which is known to hold a reference, or null. The
+ * collector may update the location, if it moves the referenced object.
+ * The stack maps emitted by the compiler identify such locations in the
+ * stack frames.
+ *
+ * @memberof RootVisitor
+ */
+typedef void (*zen_RootVisitor_VisitRootFunction_t)(zen_RootVisitor_t* visitor, zen_Object_t** root);
+
+/**
+ * Visits a value which may or may not be a reference. The collector keeps the
+ * referenced object, if any, in place.
+ *
+ * @memberof RootVisitor
+ */
+typedef void (*zen_RootVisitor_VisitAmbiguousRootFunction_t)(zen_RootVisitor_t* visitor, uintptr_t value);
+
+/**
+ * The collector hands a root visitor to the virtual machine, which visits
+ * every location outside the heap that may hold a reference. The locations
+ * include the local variables and the operand stacks of all the threads, and
+ * the static fields of all the classes.
+ *
+ * @class RootVisitor
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_RootVisitor_t {
+    zen_RootVisitor_VisitRootFunction_t m_visitRoot;
+    zen_RootVisitor_VisitAmbiguousRootFunction_t m_visitAmbiguousRoot;
+
+    /**
+     * The collector which owns the visitor.
+     */
+    void* m_context;
+};
+
+// Enumerate
+
+/**
+ * Enumerates all the roots with the specified visitor. The context is the
+ * value registered along with the function.
+ *
+ * @memberof RootVisitor
+ */
+typedef void (*zen_RootVisitor_EnumerateRootsFunction_t)(void* context, zen_RootVisitor_t* visitor);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_ROOT_VISITOR_H */
@@ -0,0 +1,200 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_SAFEPOINT_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_SAFEPOINT_H
+
+#include <pthread.h>
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * Safepoint                                                                   *
+ *******************************************************************************/
+
+/**
+ * A safepoint brings every attached thread to a stop, so that the collector
+ * can scan their stack frames and move the objects they reference.
+ *
+ * An attached thread is either running or in a safe region. A running thread
+ * polls the safepoint flag on backward branches and returns. When the flag is
+ * set, the thread saves its registers and blocks until the safepoint is
+ * released. A thread in a safe region, such as a native function, never
+ * touches the heap. Therefore, the safepoint does not wait for it. A thread
+ * which leaves a safe region while a safepoint is in progress blocks until
+ * the safepoint is released.
+ *
+ * The number of running threads is maintained with atomic operations. The
+ * requester sets the flag and then reads the count, whereas a thread updates
+ * the count and then reads the flag. Since both the sequences are sequentially
+ * consistent, either the requester sees the thread stopped, or the thread
+ * sees the flag. The mutex is acquired only on the slow paths.
+ *
+ * @class Safepoint
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_Safepoint_t {
+    /**
+     * The flag polled by the running threads. It is non-zero while a
+     * safepoint is requested or in progress. The compiled code reads it
+     * directly.
+     */
+    int32_t m_requested;
+
+    /**
+     * The number of attached threads which are running, that is, outside a
+     * safe region.
+     */
+    int32_t m_runningCount;
+
+    /**
+     * The number of attached threads. It is guarded by the mutex.
+     */
+    int32_t m_threadCount;
+
+    /**
+     * The number of safepoints requested so far, and the nanoseconds that the
+     * last one took to stop the running threads.
+     */
+    int64_t m_requestCount;
+    uint64_t m_synchronizationDuration;
+
+    pthread_mutex_t m_mutex;
+
+    /**
+     * Signalled when a thread stops, or detaches, while a safepoint is
+     * requested.
+     */
+    pthread_cond_t m_stoppedCondition;
+
+    /**
+     * Signalled when a safepoint is released, or a thread detaches.
+     */
+    pthread_cond_t m_releasedCondition;
+};
+
+/**
+ * @memberof Safepoint
+ */
+typedef struct zen_Safepoint_t zen_Safepoint_t;
+
+/* Constructor */
+
+/**
+ * @memberof Safepoint
+ */
+zen_Safepoint_t* zen_Safepoint_new();
+
+/* Destructor */
+
+/**
+ * Every thread should be detached before the safepoint is destroyed.
+ *
+ * @memberof Safepoint
+ */
+void zen_Safepoint_delete(zen_Safepoint_t* safepoint);
+
+/* Attach */
+
+/**
+ * Attaches the calling thread, which is considered running from now on. If a
+ * safepoint is in progress, the thread blocks until it is released.
+ *
+ * @memberof Safepoint
+ */
+void zen_Safepoint_attach(zen_Safepoint_t* safepoint);
+
+/**
+ * Detaches the calling thread, which should be running.
+ *
+ * @memberof Safepoint
+ */
+void zen_Safepoint_detach(zen_Safepoint_t* safepoint);
+
+/* Poll */
+
+/**
+ * Determines whether a safepoint was requested. The running threads should
+ * poll it frequently, and block when it returns true.
+ *
+ * @memberof Safepoint
+ */
+static inline bool zen_Safepoint_isRequested(zen_Safepoint_t* safepoint) {
+    return __atomic_load_n(&safepoint->m_requested, __ATOMIC_RELAXED) != 0;
+}
+
+/**
+ * Blocks the calling thread until the current safepoint is released. The
+ * stack frames of the thread should be walkable before it is invoked.
+ *
+ * @memberof Safepoint
+ */
+void zen_Safepoint_block(zen_Safepoint_t* safepoint);
+
+/* Safe Region */
+
+/**
+ * Marks the calling thread as being in a safe region. The thread should not
+ * access the heap until it leaves the region, because the collector may run
+ * in the meantime.
+ *
+ * @memberof Safepoint
+ */
+void zen_Safepoint_enterSafeRegion(zen_Safepoint_t* safepoint);
+
+/**
+ * Marks the calling thread as running again. If a safepoint is in progress,
+ * the thread blocks until it is released.
+ *
+ * @memberof Safepoint
+ */
+void zen_Safepoint_leaveSafeRegion(zen_Safepoint_t* safepoint);
+
+/* Request */
+
+/**
+ * Stops every attached thread. It returns once all the running threads have
+ * either blocked or entered safe regions. If another safepoint is in
+ * progress, it waits until that safepoint is released first.
+ *
+ * The calling thread should either be detached, or in a safe region.
+ *
+ * @memberof Safepoint
+ */
+void zen_Safepoint_request(zen_Safepoint_t* safepoint);
+
+/**
+ * Resumes the threads stopped by the current safepoint.
+ *
+ * @memberof Safepoint
+ */
+void zen_Safepoint_release(zen_Safepoint_t* safepoint);
+
+/* Wait */
+
+/**
+ * Blocks until no more than the specified number of threads are attached.
+ * The calling thread should either be detached, or in a safe region.
+ *
+ * @memberof Safepoint
+ */
+void zen_Safepoint_waitForThreads(zen_Safepoint_t* safepoint, int32_t threadCount);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_SAFEPOINT_H */
@@ -0,0 +1,208 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_SATB_QUEUE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_SATB_QUEUE_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+#include <jtk/concurrent/lock/Mutex.h>
+
+/*******************************************************************************
+ * SatbBuffer                                                                  *
+ *******************************************************************************/
+
+/**
+ * The number of references a buffer holds before it is handed over to the
+ * queue.
+ */
+#define ZEN_SATB_BUFFER_CAPACITY 256
+
+/**
+ * A buffer of the references overwritten by a thread, while the old
+ * generation is marked concurrently. Each thread logs into its own buffer
+ * without synchronization. A buffer is also used to hand over the logged
+ * references to the marker.
+ *
+ * @class SatbBuffer
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_SatbBuffer_t {
+    zen_Object_t** m_references;
+    int32_t m_size;
+
+    /**
+     * The next buffer, either in the list of the thread buffers, or in the
+     * list of the completed buffers.
+     */
+    struct zen_SatbBuffer_t* m_next;
+};
+
+/**
+ * @memberof SatbBuffer
+ */
+typedef struct zen_SatbBuffer_t zen_SatbBuffer_t;
+
+/* Destructor */
+
+/**
+ * Destroys a completed buffer, once the marker has processed it.
+ *
+ * @memberof SatbBuffer
+ */
+void zen_SatbBuffer_delete(zen_SatbBuffer_t* buffer);
+
+/*******************************************************************************
+ * SatbQueue                                                                   *
+ *******************************************************************************/
+
+/**
+ * The queue which carries the references logged by the snapshot-at-the-
+ * beginning (SATB) pre-write barrier to the concurrent marker. The barrier
+ * logs the reference which a store is about to overwrite. Therefore, every
+ * object which was reachable when the marking began is either traced by the
+ * marker, or logged before its last reference is erased.
+ *
+ * Please refer "The Garbage Collection Handbook" by Richard Jones, Antony
+ * Hosking and Eliot Moss for more information. The algorithm described above
+ * was extracted from Chapter 15, section 2.
+ *
+ * @class SatbQueue
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_SatbQueue_t {
+    /**
+     * Determines whether the barrier logs the overwritten references. It is
+     * modified only when the world is stopped.
+     */
+    bool m_active;
+
+    /**
+     * The buffers of the threads, linked through their `m_next` fields. The
+     * list is modified only when a thread starts or terminates.
+     */
+    zen_SatbBuffer_t* m_threadBuffers;
+
+    /**
+     * The buffers which are yet to be processed by the marker.
+     */
+    zen_SatbBuffer_t* m_completedBuffers;
+
+    /**
+     * Guards the lists of the thread buffers and the completed buffers.
+     */
+    jtk_Mutex_t* m_mutex;
+};
+
+/**
+ * @memberof SatbQueue
+ */
+typedef struct zen_SatbQueue_t zen_SatbQueue_t;
+
+/* Constructor */
+
+/**
+ * @memberof SatbQueue
+ */
+zen_SatbQueue_t* zen_SatbQueue_new();
+
+/* Destructor */
+
+/**
+ * @memberof SatbQueue
+ */
+void zen_SatbQueue_delete(zen_SatbQueue_t* queue);
+
+/* Active */
+
+/**
+ * Activates or deactivates the barrier. The logged references are discarded,
+ * when the barrier is deactivated. It should be invoked only when the world
+ * is stopped.
+ *
+ * @memberof SatbQueue
+ */
+void zen_SatbQueue_setActive(zen_SatbQueue_t* queue, bool active);
+
+/* Buffer */
+
+/**
+ * Creates the buffer of a new thread.
+ *
+ * @memberof SatbQueue
+ */
+zen_SatbBuffer_t* zen_SatbQueue_makeBuffer(zen_SatbQueue_t* queue);
+
+/**
+ * Destroys the buffer of a terminating thread. The references logged in it
+ * are handed over to the marker.
+ *
+ * @memberof SatbQueue
+ */
+void zen_SatbQueue_mergeBuffer(zen_SatbQueue_t* queue, zen_SatbBuffer_t* buffer);
+
+/* Flush */
+
+/**
+ * Hands over the references logged in the specified thread buffer to the
+ * marker, and empties the buffer.
+ *
+ * @memberof SatbQueue
+ */
+void zen_SatbQueue_flushBuffer(zen_SatbQueue_t* queue, zen_SatbBuffer_t* buffer);
+
+/**
+ * Hands over the references logged in all the thread buffers. It should be
+ * invoked only when the world is stopped.
+ *
+ * @memberof SatbQueue
+ */
+void zen_SatbQueue_flushAll(zen_SatbQueue_t* queue);
+
+/* Enqueue */
+
+/**
+ * Logs the specified reference, which is about to be overwritten. The buffer
+ * is handed over to the marker when it is full.
+ *
+ * @memberof SatbQueue
+ */
+static inline void zen_SatbQueue_enqueue(zen_SatbQueue_t* queue, zen_SatbBuffer_t* buffer,
+    zen_Object_t* reference) {
+    buffer->m_references[buffer->m_size++] = reference;
+    if (buffer->m_size == ZEN_SATB_BUFFER_CAPACITY) {
+        zen_SatbQueue_flushBuffer(queue, buffer);
+    }
+}
+
+/* Poll */
+
+/**
+ * Removes a completed buffer. Returns null if no buffer is complete. The
+ * caller destroys the buffer with `zen_SatbBuffer_delete()`.
+ *
+ * @memberof SatbQueue
+ */
+zen_SatbBuffer_t* zen_SatbQueue_poll(zen_SatbQueue_t* queue);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_SATB_QUEUE_H */
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_WORK_STEALING_DEQUE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_WORK_STEALING_DEQUE_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+/*******************************************************************************
+ * WorkStealingDequeArray                                                      *
+ *******************************************************************************/
+
+/**
+ * The circular array which holds the elements of a deque. Its capacity is
+ * always a power of two.
+ *
+ * @class WorkStealingDequeArray
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_WorkStealingDequeArray_t {
+    zen_Object_t** m_elements;
+    int64_t m_capacity;
+
+    /**
+     * The array which this array replaced when the deque grew. A thief may
+     * still be reading from it, therefore, it is released only when the deque
+     * is cleared or destroyed.
+     */
+    struct zen_WorkStealingDequeArray_t* m_previous;
+};
+
+/**
+ * @memberof WorkStealingDequeArray
+ */
+typedef struct zen_WorkStealingDequeArray_t zen_WorkStealingDequeArray_t;
+
+/*******************************************************************************
+ * WorkStealingDeque                                                           *
+ *******************************************************************************/
+
+/**
+ * The initial capacity of a deque.
+ */
+#define ZEN_WORK_STEALING_DEQUE_DEFAULT_CAPACITY 1024
+
+/**
+ * A Chase-Lev work-stealing deque of objects. Only the thread which owns the
+ * deque pushes and pops objects, at the bottom end. The other threads steal
+ * objects from the top end. The deque grows when it is full.
+ *
+ * The memory orderings follow "Correct and Efficient Work-Stealing for Weak
+ * Memory Models" by Nhat Minh Lê, Antoniu Pop, Albert Cohen and Francesco
+ * Zappa Nardelli.
+ *
+ * @class WorkStealingDeque
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_WorkStealingDeque_t {
+    int64_t m_top;
+    int64_t m_bottom;
+    zen_WorkStealingDequeArray_t* m_array;
+};
+
+/**
+ * @memberof WorkStealingDeque
+ */
+typedef struct zen_WorkStealingDeque_t zen_WorkStealingDeque_t;
+
+/* Constructor */
+
+/**
+ * @memberof WorkStealingDeque
+ */
+zen_WorkStealingDeque_t* zen_WorkStealingDeque_new();
+
+/* Destructor */
+
+/**
+ * @memberof WorkStealingDeque
+ */
+void zen_WorkStealingDeque_delete(zen_WorkStealingDeque_t* deque);
+
+/* Clear */
+
+/**
+ * Removes all the objects and releases the arrays retired by the deque. It
+ * should be invoked only when no other thread accesses the deque.
+ *
+ * @memberof WorkStealingDeque
+ */
+void zen_WorkStealingDeque_clear(zen_WorkStealingDeque_t* deque);
+
+/* Empty */
+
+/**
+ * Determines whether the deque appears to be empty. The result may be stale
+ * when it is returned, unless the other threads are idle.
+ *
+ * @memberof WorkStealingDeque
+ */
+bool zen_WorkStealingDeque_isEmpty(zen_WorkStealingDeque_t* deque);
+
+/* Pop */
+
+/**
+ * Removes the object at the bottom of the deque. Returns null if the deque is
+ * empty. It should be invoked only by the owner.
+ *
+ * @memberof WorkStealingDeque
+ */
+zen_Object_t* zen_WorkStealingDeque_pop(zen_WorkStealingDeque_t* deque);
+
+/* Push */
+
+/**
+ * Inserts the specified object at the bottom of the deque. It should be
+ * invoked only by the owner.
+ *
+ * @memberof WorkStealingDeque
+ */
+void zen_WorkStealingDeque_push(zen_WorkStealingDeque_t* deque, zen_Object_t* object);
+
+/* Steal */
+
+/**
+ * Removes the object at the top of the deque. Returns null if the deque is
+ * empty, or if another thread removed the object first.
+ *
+ * @memberof WorkStealingDeque
+ */
+zen_Object_t* zen_WorkStealingDeque_steal(zen_WorkStealingDeque_t* deque);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_WORK_STEALING_DEQUE_H */
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_ARENA_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_ARENA_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * ArenaChunk                                                                  *
+ *******************************************************************************/
+
+/**
+ * A contiguous block of memory which an arena allocates from. The bytes
+ * follow the header immediately.
+ *
+ * @class ArenaChunk
+ * @ingroup zen_heap
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_ArenaChunk_t {
+    struct zen_ArenaChunk_t* m_next;
+
+    /**
+     * The byte following the last byte of the chunk. The header occupies two
+     * pointers, therefore, the bytes begin at a 64-bit boundary.
+     */
+    uint8_t* m_limit;
+    uint8_t m_bytes[];
+};
+
+/**
+ * @memberof ArenaChunk
+ */
+typedef struct zen_ArenaChunk_t zen_ArenaChunk_t;
+
+/*******************************************************************************
+ * Arena                                                                       *
+ *******************************************************************************/
+
+/**
+ * The minimum number of bytes in a chunk of an arena.
+ */
+#define ZEN_ARENA_MINIMUM_CHUNK_SIZE (4 * 1024)
+
+/**
+ * An arena holds the metadata of a single entity file, such as the constant
+ * pool, the entities, the attributes, and the classes, functions and fields
+ * created from them. The metadata is allocated with a pointer bump and freed
+ * as a unit when the entity file is unloaded. Therefore, the metadata of an
+ * entity file is contiguous, unless it outgrows the first chunk.
+ *
+ * An arena is filled by the thread which loads its entity file. It is not
+ * synchronized.
+ *
+ * @class Arena
+ * @ingroup zen_heap
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_Arena_t {
+
+    /**
+     * The first free byte of the current chunk.
+     */
+    uint8_t* m_free;
+
+    /**
+     * The byte following the last byte of the current chunk.
+     */
+    uint8_t* m_limit;
+
+    /**
+     * The chunks of the arena, beginning with the current chunk.
+     */
+    zen_ArenaChunk_t* m_chunks;
+
+    /**
+     * The size of the first chunk. The chunks which follow it are at least
+     * as large, so that they remain few.
+     */
+    int32_t m_chunkSize;
+
+    /**
+     * The number of bytes allocated in the arena.
+     */
+    int64_t m_size;
+
+    /**
+     * The arenas are linked together by the immortal generation.
+     */
+    struct zen_Arena_t* m_previous;
+    struct zen_Arena_t* m_next;
+};
+
+/**
+ * @memberof Arena
+ */
+typedef struct zen_Arena_t zen_Arena_t;
+
+/* Constructor */
+
+/**
+ * Creates an arena whose first chunk holds at least the specified number of
+ * bytes.
+ *
+ * @memberof Arena
+ */
+zen_Arena_t* zen_Arena_new(int32_t capacity);
+
+/* Destructor */
+
+/**
+ * Frees all the memory allocated in the arena.
+ *
+ * @memberof Arena
+ */
+void zen_Arena_delete(zen_Arena_t* arena);
+
+/* Allocate */
+
+#define zen_Arena_allocate(arena, type, units) (type*)zen_Arena_allocate0(arena, sizeof (type) * (units))
+
+/**
+ * Allocates the specified number of bytes, rounded up to a 64-bit boundary.
+ * The memory is cleared.
+ *
+ * @memberof Arena
+ */
+void* zen_Arena_allocate0(zen_Arena_t* arena, int32_t size);
+
+/* Contains */
+
+/**
+ * @memberof Arena
+ */
+bool zen_Arena_contains(zen_Arena_t* arena, const void* address);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_ARENA_H */
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_CARD_TABLE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_CARD_TABLE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * CardTable                                                                   *
+ *******************************************************************************/
+
+/**
+ * The number of bits by which an offset into the covered memory is shifted to
+ * obtain the index of its card.
+ */
+#define ZEN_CARD_TABLE_CARD_SHIFT 9
+
+/**
+ * The number of bytes covered by each card.
+ */
+#define ZEN_CARD_TABLE_CARD_SIZE (1 << ZEN_CARD_TABLE_CARD_SHIFT)
+
+#define ZEN_CARD_TABLE_CARD_CLEAN 0
+
+#define ZEN_CARD_TABLE_CARD_DIRTY 1
+
+/**
+ * Indicates that no object begins in a card.
+ */
+#define ZEN_CARD_TABLE_NO_OBJECT 0xFF
+
+/**
+ * A card table divides a region into cards of `ZEN_CARD_TABLE_CARD_SIZE`
+ * bytes, and holds a byte for each card. The write barrier dirties the card
+ * which contains the header of an object, whenever a reference is stored in
+ * the object. Therefore, a minor collection finds the references from the old
+ * generation to the new generation by scanning the objects whose headers lie
+ * in the dirty cards, instead of the whole old generation.
+ *
+ * The objects are walked from the first object which begins in a card. Its
+ * offset is recorded when the object is allocated.
+ *
+ * @class CardTable
+ * @ingroup zen_heap
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_CardTable_t {
+
+    /**
+     * The state of each card.
+     */
+    uint8_t* m_cards;
+
+    /**
+     * The offset of the first object which begins in each card, in units of
+     * 8 bytes. It is `ZEN_CARD_TABLE_NO_OBJECT` if no object begins in the
+     * card.
+     */
+    uint8_t* m_firstObjects;
+
+    /**
+     * The first byte covered by the table.
+     */
+    uint8_t* m_start;
+
+    /**
+     * The byte following the last byte covered by the table.
+     */
+    uint8_t* m_limit;
+
+    /**
+     * The number of cards.
+     */
+    int32_t m_size;
+};
+
+/**
+ * @memberof CardTable
+ */
+typedef struct zen_CardTable_t zen_CardTable_t;
+
+/* Constructor */
+
+/**
+ * @memberof CardTable
+ */
+zen_CardTable_t* zen_CardTable_new(uint8_t* start, uint8_t* limit);
+
+/* Destructor */
+
+/**
+ * @memberof CardTable
+ */
+void zen_CardTable_delete(zen_CardTable_t* table);
+
+/* Clear */
+
+/**
+ * Cleans every card and forgets every object.
+ *
+ * @memberof CardTable
+ */
+void zen_CardTable_clear(zen_CardTable_t* table);
+
+/* Index */
+
+/**
+ * @memberof CardTable
+ */
+static inline int32_t zen_CardTable_getIndex(zen_CardTable_t* table, const void* address) {
+    return (int32_t)(((const uint8_t*)address - table->m_start) >> ZEN_CARD_TABLE_CARD_SHIFT);
+}
+
+/**
+ * Returns the first byte covered by the specified card.
+ *
+ * @memberof CardTable
+ */
+static inline uint8_t* zen_CardTable_getCardStart(zen_CardTable_t* table, int32_t index) {
+    return table->m_start + ((intptr_t)index << ZEN_CARD_TABLE_CARD_SHIFT);
+}
+
+/* Mark */
+
+/**
+ * The write barrier. It dirties the card which contains the header of the
+ * specified object. The objects outside the table are ignored, which requires
+ * a single unsigned comparison.
+ *
+ * @memberof CardTable
+ */
+static inline void zen_CardTable_markObject(zen_CardTable_t* table, const void* object) {
+    uintptr_t offset = (uintptr_t)((const uint8_t*)object - table->m_start);
+    if (offset < (uintptr_t)(table->m_limit - table->m_start)) {
+        table->m_cards[offset >> ZEN_CARD_TABLE_CARD_SHIFT] = ZEN_CARD_TABLE_CARD_DIRTY;
+    }
+}
+
+/* Record */
+
+/**
+ * Records an object allocated in the table. The objects may be recorded in any
+ * order, because an object carved from a free cell may precede the objects
+ * recorded in its card. Since `ZEN_CARD_TABLE_NO_OBJECT` is greater than any
+ * offset, the smallest offset is kept.
+ *
+ * @memberof CardTable
+ */
+static inline void zen_CardTable_recordObject(zen_CardTable_t* table, const void* object) {
+    intptr_t offset = (const uint8_t*)object - table->m_start;
+    int32_t index = (int32_t)(offset >> ZEN_CARD_TABLE_CARD_SHIFT);
+    uint8_t firstObject = (uint8_t)((offset & (ZEN_CARD_TABLE_CARD_SIZE - 1)) >> 3);
+    if (firstObject < table->m_firstObjects[index]) {
+        table->m_firstObjects[index] = firstObject;
+    }
+}
+
+/**
+ * Returns the first object which begins in the specified card, or null if no
+ * object begins in it.
+ *
+ * @memberof CardTable
+ */
+static inline uint8_t* zen_CardTable_getFirstObject(zen_CardTable_t* table, int32_t index) {
+    uint8_t offset = table->m_firstObjects[index];
+    return (offset == ZEN_CARD_TABLE_NO_OBJECT)? NULL :
+        zen_CardTable_getCardStart(table, index) + ((intptr_t)offset << 3);
+}
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_CARD_TABLE_H */
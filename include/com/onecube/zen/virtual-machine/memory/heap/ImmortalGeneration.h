@@ -19,19 +19,58 @@
 #ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_IMMORTAL_GENERATION_H
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_IMMORTAL_GENERATION_H
 
+#include <jtk/concurrent/lock/Mutex.h>
+
 #include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/Arena.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/Region.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/ReservedSpace.h>
 
 /*******************************************************************************
  * ImmortalGeneration                                                          *
  *******************************************************************************/
 
 /**
+ * The default size of the region of the immortal generation.
+ */
+#define ZEN_IMMORTAL_GENERATION_DEFAULT_SIZE (4 * 1024 * 1024)
+
+/**
+ * The immortal generation holds the objects which live as long as the virtual
+ * machine, such as the interned strings. The objects are allocated with a
+ * pointer bump, and are never moved, collected or scanned. Therefore, they
+ * must not refer to the objects of the other generations. The collectors
+ * leave the references to the immortal objects intact, because the objects
+ * lie outside the generations which are collected.
+ *
+ * The metadata of every entity file is allocated in an arena of its own, which
+ * the immortal generation keeps track of. The metadata refers only to other
+ * metadata and to immortal objects. Therefore, the arenas are roots which
+ * never need to be visited, and the collectors neither trace nor copy them.
+ * An arena is freed when its entity file is unloaded.
+ *
  * @class ImmortalGeneration
  * @ingroup zen_heap
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_ImmortalGeneration_t {
+    zen_Region_t* m_region;
+
+    /**
+     * The first free byte of the region.
+     */
+    uint8_t* m_free;
+
+    /**
+     * The arenas of the entity files which are loaded.
+     */
+    zen_Arena_t* m_arenas;
+
+    /**
+     * The objects and the arenas are allocated by many threads.
+     */
+    jtk_Mutex_t* m_mutex;
 };
 
 /**
@@ -39,4 +78,61 @@ struct zen_ImmortalGeneration_t {
  */
 typedef struct zen_ImmortalGeneration_t zen_ImmortalGeneration_t;
 
+/* Constructor */
+
+/**
+ * Creates the immortal generation. Its region is taken from the specified
+ * reserved space, unless it is null.
+ *
+ * @memberof ImmortalGeneration
+ */
+zen_ImmortalGeneration_t* zen_ImmortalGeneration_new(zen_ReservedSpace_t* reservedSpace,
+    int32_t size);
+
+/* Destructor */
+
+/**
+ * @memberof ImmortalGeneration
+ */
+void zen_ImmortalGeneration_delete(zen_ImmortalGeneration_t* generation);
+
+/* Allocate */
+
+/**
+ * Allocates the specified number of bytes, rounded up to a 64-bit boundary.
+ * The memory is cleared. Returns null if the generation is exhausted.
+ *
+ * @memberof ImmortalGeneration
+ */
+uint8_t* zen_ImmortalGeneration_allocate(zen_ImmortalGeneration_t* generation, int32_t size);
+
+/* Arena */
+
+/**
+ * Creates an arena for the metadata of an entity file. Its first chunk holds
+ * at least the specified number of bytes.
+ *
+ * @memberof ImmortalGeneration
+ */
+zen_Arena_t* zen_ImmortalGeneration_newArena(zen_ImmortalGeneration_t* generation,
+    int32_t capacity);
+
+/**
+ * Frees the specified arena, along with all the metadata allocated in it.
+ *
+ * @memberof ImmortalGeneration
+ */
+void zen_ImmortalGeneration_deleteArena(zen_ImmortalGeneration_t* generation,
+    zen_Arena_t* arena);
+
+/* Contains */
+
+/**
+ * @memberof ImmortalGeneration
+ */
+static inline bool zen_ImmortalGeneration_contains(zen_ImmortalGeneration_t* generation,
+    const void* address) {
+    return zen_Region_contains(generation->m_region, address);
+}
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_IMMORTAL_GENERATION_H */
\ No newline at end of file
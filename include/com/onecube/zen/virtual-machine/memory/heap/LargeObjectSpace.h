@@ -0,0 +1,192 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_LARGE_OBJECT_SPACE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_LARGE_OBJECT_SPACE_H
+
+#include <jtk/concurrent/lock/Mutex.h>
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/ReservedSpace.h>
+
+/*******************************************************************************
+ * LargeObjectSpace                                                            *
+ *******************************************************************************/
+
+/**
+ * The size of the smallest object allocated in the large object space, unless
+ * configured otherwise.
+ */
+#define ZEN_LARGE_OBJECT_SPACE_DEFAULT_THRESHOLD (64 * 1024)
+
+/**
+ * The number of bytes that the large object space can map, unless configured
+ * otherwise.
+ */
+#define ZEN_LARGE_OBJECT_SPACE_DEFAULT_MAXIMUM_SIZE (256 * 1024 * 1024)
+
+/**
+ * The large object space holds the objects which are too large to be copied
+ * economically. Each object is mapped into pages of its own, therefore, it
+ * is aligned to a page. The objects are never moved; neither by the minor
+ * collector, nor by the major collector. They are marked by the major
+ * collector along with the old generation, and the pages of an object which
+ * is not marked are unmapped, returning them to the operating system.
+ *
+ * When the space is created with a reserved space, it takes a range from the
+ * reserved space. An object is placed in the first gap between the objects
+ * of the range which can hold it, and the pages of an unmarked object are
+ * uncommitted, instead of unmapped. The range is larger than `m_maximumSize`,
+ * so that an allocation within the limit rarely fails because the range is
+ * fragmented.
+ *
+ * The large arrays of references are allocated here, too. They are not
+ * covered by the card table. Instead, the minor collector scans every one of
+ * them for the references to the new generation.
+ *
+ * @class LargeObjectSpace
+ * @ingroup zen_heap
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_LargeObjectSpace_t {
+
+    /**
+     * The objects in the space, sorted by address.
+     */
+    uint8_t** m_objects;
+
+    int32_t m_size;
+
+    int32_t m_capacity;
+
+    /**
+     * The size of the smallest object allocated in the space.
+     */
+    int32_t m_threshold;
+
+    /**
+     * The size of a page, to which the mappings are rounded.
+     */
+    int32_t m_pageSize;
+
+    /**
+     * The number of bytes mapped for the objects.
+     */
+    intptr_t m_mappedSize;
+
+    /**
+     * The number of bytes that the space can map. An allocation beyond it
+     * fails.
+     */
+    intptr_t m_maximumSize;
+
+    /**
+     * The reserved space which the range of the space was taken from, or null
+     * if each object is mapped wherever the operating system chooses.
+     */
+    zen_ReservedSpace_t* m_reservedSpace;
+
+    /**
+     * The first byte of the range of the space, if it has a reserved space.
+     */
+    uint8_t* m_start;
+
+    /**
+     * The byte following the last byte of the range of the space, if it has
+     * a reserved space.
+     */
+    uint8_t* m_limit;
+
+    /**
+     * The objects are allocated by many threads.
+     */
+    jtk_Mutex_t* m_mutex;
+};
+
+/**
+ * @memberof LargeObjectSpace
+ */
+typedef struct zen_LargeObjectSpace_t zen_LargeObjectSpace_t;
+
+/* Range Size */
+
+/**
+ * Returns the size of the range that a large object space which can map the
+ * specified number of bytes takes from a reserved space.
+ *
+ * @memberof LargeObjectSpace
+ */
+static inline int64_t zen_LargeObjectSpace_getRangeSize(int64_t maximumSize) {
+    return maximumSize * 2;
+}
+
+/* Constructor */
+
+/**
+ * Creates a large object space which can map the specified number of bytes.
+ * Its range is taken from the specified reserved space, unless it is null.
+ *
+ * @memberof LargeObjectSpace
+ */
+zen_LargeObjectSpace_t* zen_LargeObjectSpace_new(zen_ReservedSpace_t* reservedSpace,
+    intptr_t maximumSize);
+
+/* Destructor */
+
+/**
+ * Unmaps every object in the space. The range taken from a reserved space is
+ * released along with the reserved space.
+ *
+ * @memberof LargeObjectSpace
+ */
+void zen_LargeObjectSpace_delete(zen_LargeObjectSpace_t* space);
+
+/* Allocate */
+
+/**
+ * Maps the pages for an object of the specified size. The memory is cleared.
+ * Returns null if the space would exceed its maximum size, or the pages
+ * cannot be mapped.
+ *
+ * @memberof LargeObjectSpace
+ */
+uint8_t* zen_LargeObjectSpace_allocate(zen_LargeObjectSpace_t* space, int32_t size);
+
+/* Object */
+
+/**
+ * Determines whether an object in the space begins at the specified address.
+ * It should be invoked only when the world is stopped.
+ *
+ * @memberof LargeObjectSpace
+ */
+bool zen_LargeObjectSpace_isObject(zen_LargeObjectSpace_t* space, const uint8_t* address);
+
+/* Sweep */
+
+/**
+ * Unmaps the objects which are not marked, and clears the mark of the others.
+ * Returns the number of bytes unmapped. It should be invoked only when the
+ * world is stopped.
+ *
+ * @memberof LargeObjectSpace
+ */
+intptr_t zen_LargeObjectSpace_sweep(zen_LargeObjectSpace_t* space);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_LARGE_OBJECT_SPACE_H */
@@ -21,13 +21,34 @@
 
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/memory/heap/Region.h>
-#include <com/onecube/zen/virtual-machine/memory/allocator/SegregatedFitsAllocator.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/SequentialAllocator.h>
 
 /*******************************************************************************
  * NewGeneration                                                               *
  *******************************************************************************/
 
 /**
+ * The default size of the middle region, where the objects are allocated.
+ */
+#define ZEN_NEW_GENERATION_DEFAULT_MIDDLE_REGION_SIZE (8 * 1024 * 1024)
+
+/**
+ * The default size of the left and right regions, where the objects which
+ * survive a minor collection are moved.
+ */
+#define ZEN_NEW_GENERATION_DEFAULT_SURVIVOR_REGION_SIZE (1024 * 1024)
+
+/**
+ * The new generation is divided into the left, middle and right regions. The
+ * objects are allocated in the middle region with a sequential allocator.
+ * Each thread claims its allocation buffer from the same allocator.
+ *
+ * The left region holds the objects which survived the previous minor
+ * collections. The right region is empty. During a minor collection, the live
+ * objects of the middle and left regions are copied to the right region, or
+ * promoted to the old generation. Thereafter, the left and right regions are
+ * swapped.
+ *
  * @class NewGeneration
  * @ingroup zen_vm_memory_heap
  * @author Samuel Rowe
@@ -37,8 +58,23 @@ struct zen_NewGeneration_t {
     zen_Region_t* m_leftRegion;
     zen_Region_t* m_middleRegion;
     zen_Region_t* m_rightRegion;
-    
-    zen_SegregatedFitsAllocator_t* m_allocator;
+
+    /**
+     * The objects of the left region, from its start. The objects which the
+     * previous collection could not move are recorded as chunks of their own.
+     */
+    zen_ChunkArray_t* m_leftChunks;
+
+    /**
+     * The objects in the right region that the previous collection could not
+     * move. They are left behind when the regions are swapped.
+     */
+    zen_ChunkArray_t* m_rightHoles;
+
+    /**
+     * The sequential allocator of the middle region.
+     */
+    zen_SequentialAllocator_t* m_allocator;
 };
 
 /**
@@ -46,4 +82,57 @@ struct zen_NewGeneration_t {
  */
 typedef struct zen_NewGeneration_t zen_NewGeneration_t;
 
-#endif /* ZEN_MMS_HEAP_NEW_GENERATION_H */
\ No newline at end of file
+/* Constructor */
+
+/**
+ * Creates the new generation. Its regions are taken from the specified
+ * reserved space, unless it is null.
+ *
+ * @memberof NewGeneration
+ */
+zen_NewGeneration_t* zen_NewGeneration_new(zen_ReservedSpace_t* reservedSpace,
+    int32_t middleRegionSize, int32_t survivorRegionSize);
+
+/* Destructor */
+
+/**
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_delete(zen_NewGeneration_t* generation);
+
+/* Contains */
+
+/**
+ * Determines whether the specified address lies in any region of the new
+ * generation.
+ *
+ * @memberof NewGeneration
+ */
+static inline bool zen_NewGeneration_contains(zen_NewGeneration_t* generation,
+    const void* address) {
+    return zen_Region_contains(generation->m_middleRegion, address) ||
+        zen_Region_contains(generation->m_leftRegion, address) ||
+        zen_Region_contains(generation->m_rightRegion, address);
+}
+
+/* Chunks */
+
+/**
+ * Retires the allocation buffers, and appends the chunks of the objects in
+ * all the regions to the specified array. It should be invoked only when the
+ * world is stopped.
+ *
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_getChunks(zen_NewGeneration_t* generation, zen_ChunkArray_t* chunks);
+
+/* Swap */
+
+/**
+ * Swaps the left and right regions, along with their records.
+ *
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_swapSurvivorRegions(zen_NewGeneration_t* generation);
+
+#endif /* ZEN_MMS_HEAP_NEW_GENERATION_H */
@@ -20,6 +20,9 @@
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_OLD_GENERATION_H
 
 #include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/SegregatedFitsAllocator.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/CardTable.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/LargeObjectSpace.h>
 #include <com/onecube/zen/virtual-machine/memory/heap/Region.h>
 
 /*******************************************************************************
@@ -27,6 +30,27 @@
  *******************************************************************************/
 
 /**
+ * The default size of the white region, where the tenured objects are
+ * promoted.
+ */
+#define ZEN_OLD_GENERATION_DEFAULT_WHITE_REGION_SIZE (64 * 1024 * 1024)
+
+/**
+ * The alignment of the objects in the white region. The gap between any two
+ * objects is large enough to hold the header of a filler object.
+ */
+#define ZEN_OLD_GENERATION_ALIGNMENT 16
+
+/**
+ * The old generation consists of the white region and the large object space.
+ * The objects promoted from the new generation are copied into the white
+ * region by bumping a pointer. Therefore, the white region can be walked from
+ * its start to the free pointer. The objects too large to be copied are
+ * allocated in the large object space directly, and never move. The space
+ * reclaimed by the major collector, which is not compacted, is covered by
+ * filler objects, which have neither a class nor flags. The fillers are coalesced into free cells, which are reused for
+ * promotion before the free pointer is bumped.
+ *
  * @class OldGeneration
  * @ingroup zen_heap
  * @author Samuel Rowe
@@ -34,7 +58,36 @@
  */
 struct zen_OldGeneration_t {
     zen_Region_t* m_whiteRegion;
-    zen_Region_t* m_blackRegion;
+
+    /**
+     * The space where large objects are allocated directly. The large objects
+     * are collected along with the white region.
+     */
+    zen_LargeObjectSpace_t* m_largeObjectSpace;
+
+    /**
+     * The allocator which reuses the free cells below the free pointer. Its
+     * free lists are rebuilt after every major collection.
+     */
+    zen_SegregatedFitsAllocator_t* m_allocator;
+
+    /**
+     * The address where the next object is promoted in the white region.
+     */
+    uint8_t* m_free;
+
+    /**
+     * The card table which covers the white region. It remembers the objects
+     * which may refer to the new generation.
+     */
+    zen_CardTable_t* m_cardTable;
+
+    /**
+     * The flags set on every object promoted into the white region. While the
+     * old generation is marked concurrently, the promoted objects are marked
+     * on arrival, so that the marking cycle treats them as live.
+     */
+    int32_t m_promotionFlags;
 };
 
 /**
@@ -42,4 +95,129 @@ struct zen_OldGeneration_t {
  */
 typedef struct zen_OldGeneration_t zen_OldGeneration_t;
 
+/* Constructor */
+
+/**
+ * Creates the old generation. Its white region and the range of its large
+ * object space are taken from the specified reserved space, unless it is
+ * null.
+ *
+ * @memberof OldGeneration
+ */
+zen_OldGeneration_t* zen_OldGeneration_new(zen_ReservedSpace_t* reservedSpace,
+    int32_t whiteRegionSize);
+
+/* Destructor */
+
+/**
+ * @memberof OldGeneration
+ */
+void zen_OldGeneration_delete(zen_OldGeneration_t* generation);
+
+/* Align */
+
+/**
+ * Rounds the specified size up to `ZEN_OLD_GENERATION_ALIGNMENT`.
+ *
+ * @memberof OldGeneration
+ */
+static inline int32_t zen_OldGeneration_alignSize(int32_t size) {
+    return (size + (ZEN_OLD_GENERATION_ALIGNMENT - 1)) & ~(ZEN_OLD_GENERATION_ALIGNMENT - 1);
+}
+
+/* Allocate */
+
+/**
+ * Allocates space for an object promoted by the collector. The size should be
+ * aligned with `zen_OldGeneration_alignSize()`. The space is taken from a free
+ * cell, if any fits; otherwise, the free pointer is bumped. Therefore, an
+ * object may be allocated below the objects promoted before it. The memory is
+ * not cleared. Returns null if the white region is exhausted. It should be
+ * invoked only when the world is stopped.
+ *
+ * @memberof OldGeneration
+ */
+static inline uint8_t* zen_OldGeneration_allocate(zen_OldGeneration_t* generation,
+    int32_t size) {
+    uint8_t* result = NULL;
+    if (!zen_SegregatedFitsAllocator_isEmpty(generation->m_allocator)) {
+        result = zen_SegregatedFitsAllocator_allocate(generation->m_allocator, size);
+    }
+    if (result == NULL) {
+        result = generation->m_free;
+        if ((generation->m_whiteRegion->m_limit - result) < size) {
+            return NULL;
+        }
+        generation->m_free = result + size;
+    }
+    zen_CardTable_recordObject(generation->m_cardTable, result);
+    return result;
+}
+
+/* Contains */
+
+/**
+ * Determines whether the specified address lies in the occupied part of the
+ * white region.
+ *
+ * @memberof OldGeneration
+ */
+static inline bool zen_OldGeneration_contains(zen_OldGeneration_t* generation,
+    const void* address) {
+    return ((const uint8_t*)address >= generation->m_whiteRegion->m_start) &&
+        ((const uint8_t*)address < generation->m_free);
+}
+
+/* Object */
+
+/**
+ * Determines whether an object begins at the specified address in the white
+ * region. The objects are walked from the first object which begins in the
+ * card of the address, or, if no object begins before the address in that
+ * card, in a preceding card. It should be invoked only when the world is
+ * stopped.
+ *
+ * @memberof OldGeneration
+ */
+bool zen_OldGeneration_isObject(zen_OldGeneration_t* generation, const uint8_t* address);
+
+/* Sweep */
+
+/**
+ * Rebuilds the free cells from the fillers in the white region. The fillers
+ * which end at the free pointer are reclaimed by lowering the free pointer.
+ * The card table should be rebuilt afterwards, because the coalesced fillers
+ * may have been the first objects of their cards. It should be invoked only
+ * when the world is stopped.
+ *
+ * @memberof OldGeneration
+ */
+void zen_OldGeneration_sweep(zen_OldGeneration_t* generation);
+
+/* Used Size */
+
+/**
+ * Returns the number of bytes occupied by the objects and the fillers which
+ * are too small to be reused.
+ *
+ * @memberof OldGeneration
+ */
+static inline intptr_t zen_OldGeneration_getUsedSize(zen_OldGeneration_t* generation) {
+    return (generation->m_free - generation->m_whiteRegion->m_start) -
+        generation->m_allocator->m_freeSize;
+}
+
+/* Available Size */
+
+/**
+ * Returns the number of bytes that can be promoted before the white region is
+ * exhausted. The free cells are not included, because they may be too small
+ * for a particular object.
+ *
+ * @memberof OldGeneration
+ */
+static inline intptr_t zen_OldGeneration_getAvailableSize(zen_OldGeneration_t* generation) {
+    return generation->m_whiteRegion->m_limit - generation->m_free;
+}
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_OLD_GENERATION_H */
\ No newline at end of file
@@ -20,18 +20,37 @@
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_REGION_H
 
 #include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/ReservedSpace.h>
 
 /*******************************************************************************
  * Region                                                                      *
  *******************************************************************************/
 
 /**
+ * A region is a contiguous chunk of memory reserved for a generation.
+ *
  * @class Region
  * @ingroup zen_heap
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_Region_t {
+
+    /**
+     * The first byte of the region.
+     */
+    uint8_t* m_start;
+
+    /**
+     * The byte following the last byte of the region.
+     */
+    uint8_t* m_limit;
+
+    /**
+     * The reserved space which the region was taken from, or null if the
+     * region was allocated by itself.
+     */
+    zen_ReservedSpace_t* m_reservedSpace;
 };
 
 /**
@@ -39,4 +58,40 @@ struct zen_Region_t {
  */
 typedef struct zen_Region_t zen_Region_t;
 
+/* Constructor */
+
+/**
+ * Creates a region of the specified size. It is taken from the specified
+ * reserved space, unless it is null.
+ *
+ * @memberof Region
+ */
+zen_Region_t* zen_Region_new(zen_ReservedSpace_t* reservedSpace, int32_t size);
+
+/* Destructor */
+
+/**
+ * @memberof Region
+ */
+void zen_Region_delete(zen_Region_t* region);
+
+/* Contains */
+
+/**
+ * @memberof Region
+ */
+static inline bool zen_Region_contains(zen_Region_t* region, const void* address) {
+    return ((const uint8_t*)address >= region->m_start) &&
+        ((const uint8_t*)address < region->m_limit);
+}
+
+/* Size */
+
+/**
+ * @memberof Region
+ */
+static inline int32_t zen_Region_getSize(zen_Region_t* region) {
+    return (int32_t)(region->m_limit - region->m_start);
+}
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_REGION_H */
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_RESERVED_SPACE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_RESERVED_SPACE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * ReservedSpace                                                               *
+ *******************************************************************************/
+
+/**
+ * The granularity of the ranges taken from a reserved space. It is a multiple
+ * of the page size on every supported host.
+ */
+#define ZEN_RESERVED_SPACE_GRANULARITY (64 * 1024)
+
+/**
+ * A reserved space is a contiguous range of the address space which is
+ * reserved for the heap, without any memory behind it. The regions of the
+ * generations are taken from it, one after another, and committed as they
+ * are taken. The large object space takes a range of its own, and commits
+ * the pages of each object individually.
+ *
+ * Since the whole heap lies in one range, a reference to an object can be
+ * stored as its offset from the start of the range.
+ *
+ * @class ReservedSpace
+ * @ingroup zen_heap
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_ReservedSpace_t {
+
+    /**
+     * The first byte of the reserved range.
+     */
+    uint8_t* m_start;
+
+    /**
+     * The byte following the last byte of the reserved range.
+     */
+    uint8_t* m_limit;
+
+    /**
+     * The first byte which was not taken yet.
+     */
+    uint8_t* m_top;
+};
+
+/**
+ * @memberof ReservedSpace
+ */
+typedef struct zen_ReservedSpace_t zen_ReservedSpace_t;
+
+/* Constructor */
+
+/**
+ * Reserves the specified number of bytes, rounded up to the granularity. The
+ * reservation is aborted if the address space is exhausted.
+ *
+ * @memberof ReservedSpace
+ */
+zen_ReservedSpace_t* zen_ReservedSpace_new(int64_t size);
+
+/* Destructor */
+
+/**
+ * Releases the whole range, including the memory committed within it.
+ *
+ * @memberof ReservedSpace
+ */
+void zen_ReservedSpace_delete(zen_ReservedSpace_t* space);
+
+/* Align */
+
+/**
+ * Rounds the specified size up to the granularity of the reserved space.
+ *
+ * @memberof ReservedSpace
+ */
+static inline int64_t zen_ReservedSpace_align(int64_t size) {
+    return (size + (ZEN_RESERVED_SPACE_GRANULARITY - 1)) &
+        ~((int64_t)ZEN_RESERVED_SPACE_GRANULARITY - 1);
+}
+
+/* Take */
+
+/**
+ * Takes the specified number of bytes, rounded up to the granularity, from
+ * the unused part of the space. The range is not committed. Returns null if
+ * the space is exhausted.
+ *
+ * @memberof ReservedSpace
+ */
+uint8_t* zen_ReservedSpace_take(zen_ReservedSpace_t* space, int64_t size);
+
+/* Commit */
+
+/**
+ * Commits the memory behind the specified range, which should be aligned to
+ * a page. The memory is cleared. Returns false if the memory is exhausted.
+ *
+ * @memberof ReservedSpace
+ */
+bool zen_ReservedSpace_commit(zen_ReservedSpace_t* space, uint8_t* start, int64_t size);
+
+/**
+ * Returns the memory behind the specified range to the operating system. The
+ * range remains reserved.
+ *
+ * @memberof ReservedSpace
+ */
+void zen_ReservedSpace_uncommit(zen_ReservedSpace_t* space, uint8_t* start, int64_t size);
+
+/* Contains */
+
+/**
+ * @memberof ReservedSpace
+ */
+static inline bool zen_ReservedSpace_contains(zen_ReservedSpace_t* space, const void* address) {
+    return ((const uint8_t*)address >= space->m_start) &&
+        ((const uint8_t*)address < space->m_limit);
+}
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_RESERVED_SPACE_H */
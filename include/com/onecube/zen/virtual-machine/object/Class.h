@@ -27,6 +27,45 @@
 #include <com/onecube/zen/virtual-machine/feb/ClassEntity.h>
 #include <com/onecube/zen/virtual-machine/object/Function.h>
 #include <com/onecube/zen/virtual-machine/object/Field.h>
+#include <com/onecube/zen/virtual-machine/processor/InlineCache.h>
+#include <com/onecube/zen/virtual-machine/processor/Slot.h>
+
+// Forward References
+
+typedef struct zen_RootVisitor_t zen_RootVisitor_t;
+
+/* Defined in Class.c, until it is moved to the String class. */
+jtk_CString_t* jtk_CString_append(jtk_CString_t* string1, jtk_CString_t* string2);
+
+/*******************************************************************************
+ * InterfaceTable                                                              *
+ *******************************************************************************/
+
+/**
+ * A class may have multiple superclasses. Only the first one, known as the
+ * primary superclass, shares the layout of its virtual function table with
+ * the subclass. An interface table maps the slots of the virtual function
+ * table of any other superclass to their implementations in the subclass.
+ *
+ * @class InterfaceTable
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InterfaceTable_t {
+    zen_Class_t* m_superclass;
+
+    /**
+     * The implementations, indexed by the virtual function table indexes of
+     * the functions in the superclass.
+     */
+    zen_Function_t** m_functions;
+};
+
+/**
+ * @memberof InterfaceTable
+ */
+typedef struct zen_InterfaceTable_t zen_InterfaceTable_t;
 
 /*******************************************************************************
  * Class                                                                       *
@@ -43,6 +82,84 @@ struct zen_Class_t {
     jtk_HashMap_t* m_functions;
     jtk_HashMap_t* m_fields;
     jtk_String_t* m_descriptor;
+
+    /**
+     * A side table parallel to the constant pool of the entity file. An entry
+     * holds the class, function or field that the constant pool entry at the
+     * same index resolved to. It is null until the constant pool entry is
+     * resolved for the first time.
+     */
+    void** m_resolvedEntries;
+
+    /**
+     * A side table parallel to the constant pool of the entity file. An entry
+     * holds the inline cache of the virtual invocations which refer to the
+     * function entry at the same index. It is created lazily.
+     */
+    zen_InlineCache_t** m_inlineCaches;
+
+    /**
+     * The number of bytes occupied by an instance of this class, including
+     * the object header, rounded up to a multiple of 8 bytes.
+     */
+    int32_t m_instanceSize;
+
+    /**
+     * The number of instance fields which hold references. They occupy the
+     * first `zen_Reference_t` slots after the object header. The other instance fields
+     * follow them, sorted by their sizes in decreasing order. The offset of
+     * each instance field is recorded in its `zen_Field_t`.
+     */
+    int32_t m_referenceFieldCount;
+
+    /**
+     * The values of the static fields, one slot for each field. They are
+     * stored outside the heap, and the references come first. The index of
+     * each static field is recorded in its `zen_Field_t`.
+     */
+    zen_Slot_t* m_staticFields;
+    int32_t m_staticFieldCount;
+
+    /**
+     * The number of static fields which hold references. The collector visits
+     * them as roots, therefore, a store into a static field requires no write
+     * barrier.
+     */
+    int32_t m_staticReferenceFieldCount;
+
+    /**
+     * The superclasses of this class, in the order of their declaration. The
+     * first one is the primary superclass. They are resolved when the class
+     * is linked.
+     */
+    zen_Class_t** m_superclasses;
+    int32_t m_superclassCount;
+
+    /**
+     * The chain of primary superclasses, beginning with the root and ending
+     * with this class itself. The depth is the index of this class in its own
+     * chain, or -1 until the class is linked.
+     *
+     * A class C lies on the chain of a class D, if and only if,
+     * `D->m_primarySuperclasses[C->m_depth] == C`, which takes constant time.
+     */
+    zen_Class_t** m_primarySuperclasses;
+    int32_t m_depth;
+
+    /**
+     * The virtual function table. The slots inherited from the primary
+     * superclass retain their indexes, and the overriding functions replace
+     * the inherited ones. The slots of the new functions follow them.
+     */
+    zen_Function_t** m_vtable;
+    int32_t m_vtableSize;
+
+    /**
+     * The interface tables of the superclasses which do not lie on the
+     * chain of primary superclasses.
+     */
+    zen_InterfaceTable_t* m_interfaceTables;
+    int32_t m_interfaceTableCount;
 };
 
 /**
@@ -68,6 +185,10 @@ void zen_Class_delete(zen_Class_t* class0);
 
 zen_EntityFile_t* zen_Class_getEntityFile(zen_Class_t* class0);
 
+// Field
+
+zen_Field_t* zen_Class_getField(zen_Class_t* class0, jtk_String_t* name);
+
 // Function
 
 zen_Function_t* zen_Class_getStaticFunction(zen_Class_t* class0, jtk_String_t* name,
@@ -80,4 +201,57 @@ zen_Function_t* zen_Class_getInstanceFunction(zen_Class_t* class0, jtk_String_t*
 
 void zen_Class_initialize(zen_Class_t* class0, zen_EntityFile_t* entityFile);
 
+// Link
+
+/**
+ * Builds the virtual function table and the interface tables of the specified
+ * class. The superclasses should be linked before. The class takes the
+ * ownership of the specified array.
+ *
+ * @memberof Class
+ */
+void zen_Class_link(zen_Class_t* class0, zen_Class_t** superclasses,
+    int32_t superclassCount);
+
+// Roots
+
+/**
+ * Visits the static fields of the specified class which hold references.
+ *
+ * @memberof Class
+ */
+void zen_Class_visitRoots(zen_Class_t* class0, zen_RootVisitor_t* visitor);
+
+// Dispatch
+
+/**
+ * Returns the implementation of the specified virtual function in the
+ * specified class. If the function is declared on the chain of primary
+ * superclasses, the implementation is loaded from the virtual function table
+ * directly. Otherwise, the interface table of the declaring class is looked
+ * up. Neither involves hashing or comparing names.
+ *
+ * @memberof Class
+ */
+static inline zen_Function_t* zen_Class_dispatch(zen_Class_t* class0,
+    zen_Function_t* function) {
+    int32_t index = function->m_vtableIndex;
+    zen_Class_t* declaringClass = function->m_class;
+    if (index >= 0) {
+        int32_t depth = declaringClass->m_depth;
+        if ((depth <= class0->m_depth) &&
+            (class0->m_primarySuperclasses[depth] == declaringClass)) {
+            return class0->m_vtable[index];
+        }
+
+        int32_t i;
+        for (i = 0; i < class0->m_interfaceTableCount; i++) {
+            if (class0->m_interfaceTables[i].m_superclass == declaringClass) {
+                return class0->m_interfaceTables[i].m_functions[index];
+            }
+        }
+    }
+    return function;
+}
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_CLASS_H */
\ No newline at end of file
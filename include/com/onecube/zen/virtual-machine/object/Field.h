@@ -22,6 +22,7 @@
 #include <jtk/core/String.h>
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/feb/FieldEntity.h>
+#include <com/onecube/zen/virtual-machine/object/Reference.h>
 
 // Forward References
 
@@ -41,6 +42,26 @@ struct zen_Field_t {
     jtk_String_t* m_name;
     jtk_String_t* m_descriptor;
     zen_Class_t* m_class;
+
+    /**
+     * The first character of the descriptor, which determines the size and
+     * the representation of the field. The class and array types are both
+     * reduced to 'a'.
+     */
+    uint8_t m_type;
+
+    /**
+     * The offset of an instance field from the beginning of an instance, in
+     * bytes. It is computed when the class is initialized, and is -1 for a
+     * static field.
+     */
+    int32_t m_offset;
+
+    /**
+     * The index of a static field in the static fields of its class. It is
+     * computed when the class is initialized, and is -1 for an instance field.
+     */
+    int32_t m_index;
 };
 
 /**
@@ -65,4 +86,47 @@ jtk_String_t* zen_Field_getDescriptor(zen_Field_t* field);
 
 jtk_String_t* zen_Field_getName(zen_Field_t* field);
 
+// Size
+
+/**
+ * Returns the number of bytes that an instance field of the specified type
+ * occupies. A reference occupies a `zen_Reference_t` slot.
+ *
+ * @memberof Field
+ */
+static inline int32_t zen_Field_getSizeOfType(uint8_t type) {
+    switch (type) {
+        case 'z':
+        case 'b': {
+            return 1;
+        }
+
+        case 'c':
+        case 's': {
+            return 2;
+        }
+
+        case 'i':
+        case 'f': {
+            return 4;
+        }
+
+        case 'l':
+        case 'd': {
+            return 8;
+        }
+
+        default: {
+            return sizeof (zen_Reference_t);
+        }
+    }
+}
+
+/**
+ * @memberof Field
+ */
+static inline bool zen_Field_isReference(zen_Field_t* field) {
+    return field->m_type == 'a';
+}
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FIELD_H */
\ No newline at end of file
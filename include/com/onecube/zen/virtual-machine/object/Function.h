@@ -23,6 +23,9 @@
 
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/feb/FunctionEntity.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/StackMapTableAttribute.h>
+#include <com/onecube/zen/virtual-machine/jit/CompiledCode.h>
 
 // Forward References
 
@@ -44,6 +47,56 @@ struct zen_Function_t {
     uint16_t m_flags;
     zen_Class_t* m_class;
     zen_FunctionEntity_t* m_functionEntity;
+
+    /**
+     * A number which uniquely identifies the function within the virtual
+     * machine. It is assigned when the function is loaded.
+     */
+    uint32_t m_id;
+
+    /**
+     * The index of the function in the virtual function table of its class.
+     * It is assigned when the class is linked, and is -1 for static
+     * functions.
+     */
+    int32_t m_vtableIndex;
+
+    /**
+     * The instruction attribute of the function. It is resolved once, when
+     * the function is loaded. In the case of native and abstract functions,
+     * it is null.
+     */
+    zen_InstructionAttribute_t* m_instructionAttribute;
+
+    /**
+     * The stack map table attribute of the function, which describes the
+     * local variables and operands that hold references at every point where
+     * a garbage collection may occur. It is null if the function was compiled
+     * without stack maps, in which case its stack frames are scanned
+     * conservatively.
+     */
+    zen_StackMapTableAttribute_t* m_stackMapTable;
+
+    /**
+     * The number of local variable slots occupied by the parameters of
+     * the function, as described by its descriptor. Every parameter occupies
+     * exactly one slot.
+     */
+    int32_t m_parameterSlotCount;
+
+    /**
+     * The number of times the function was invoked, and the number of
+     * backward branches taken within it. The interpreter compiles the function
+     * when either counter crosses its threshold.
+     */
+    uint32_t m_invocationCount;
+    uint32_t m_backEdgeCount;
+
+    /**
+     * The machine code generated for the function by the template compiler.
+     * It is null until the function is compiled.
+     */
+    zen_CompiledCode_t* m_compiledCode;
 };
 
 /**
@@ -64,4 +117,18 @@ void zen_Function_delete(zen_Function_t* function);
 
 bool zen_Function_isNative(zen_Function_t* function);
 
+// Instruction Attribute
+
+zen_InstructionAttribute_t* zen_Function_getInstructionAttribute(zen_Function_t* function);
+
+// Stack Map Table Attribute
+
+zen_StackMapTableAttribute_t* zen_Function_getStackMapTableAttribute(zen_Function_t* function);
+
+// Parameter
+
+int32_t zen_Function_getParameterSlotCount(zen_Function_t* function);
+
+int32_t zen_Function_countParameterSlots(const uint8_t* descriptor, int32_t size);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FUNCTION_H */
\ No newline at end of file
@@ -21,14 +21,234 @@
 
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
+#include <com/onecube/zen/virtual-machine/object/Reference.h>
 
 /*******************************************************************************
  * Object                                                                      *
  *******************************************************************************/
 
+/**
+ * The object is an array. The length of an array is stored in the 64-bit slot
+ * that follows the header. The elements follow the length.
+ */
+#define ZEN_OBJECT_FLAG_ARRAY (1 << 0)
+
+/**
+ * The elements of the array are references. It is always accompanied by
+ * `ZEN_OBJECT_FLAG_ARRAY`.
+ */
+#define ZEN_OBJECT_FLAG_REFERENCE_ARRAY (1 << 1)
+
+/**
+ * The object was copied by the collector. The class field of the header holds
+ * the address of the copy. It is observed only during a collection.
+ */
+#define ZEN_OBJECT_FLAG_FORWARDED (1 << 2)
+
+/**
+ * The object is referenced ambiguously, therefore, the collector cannot move
+ * it. It is observed only during a collection.
+ */
+#define ZEN_OBJECT_FLAG_PINNED (1 << 3)
+
+/**
+ * The object was found to be reachable by the major collector. It is observed
+ * only during a collection.
+ */
+#define ZEN_OBJECT_FLAG_MARKED (1 << 4)
+
+/**
+ * The object was allocated in the large object space. It is never moved.
+ */
+#define ZEN_OBJECT_FLAG_LARGE (1 << 5)
+
+/**
+ * The position of the age of the object in its flags. The age is the number
+ * of minor collections that the object survived.
+ */
+#define ZEN_OBJECT_AGE_SHIFT 8
+
+/**
+ * The mask which extracts the age of the object from its flags.
+ */
+#define ZEN_OBJECT_AGE_MASK (0xF << ZEN_OBJECT_AGE_SHIFT)
+
+/**
+ * The oldest age that an object can have. An older object retains this age.
+ */
+#define ZEN_OBJECT_MAXIMUM_AGE 15
+
+/**
+ * The position of the identity hash code of the object in its flags.
+ */
+#define ZEN_OBJECT_HASH_SHIFT 12
+
+/**
+ * The mask which extracts the identity hash code of the object from its
+ * flags. A hash code of zero indicates that it was not assigned yet.
+ */
+#define ZEN_OBJECT_HASH_MASK (0xFFFFFU << ZEN_OBJECT_HASH_SHIFT)
+
+/**
+ * Every object in the heap begins with a two-word header. The first word holds
+ * the class, and the second word holds the size of the object and its flags,
+ * which include the mark bits, the age and the identity hash code.
+ *
+ * The fields of an instance follow the header, at the offsets computed when
+ * its class is initialized. The fields which hold references precede the
+ * other fields, each in a `zen_Reference_t` slot, so that the collector can
+ * find them without consulting the descriptors of the fields. The remaining
+ * fields are packed in the decreasing order of their sizes.
+ *
+ * @class Object
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
 struct zen_Object_t {
+
+    /**
+     * The class of the object. It is null for primitive arrays.
+     */
+    zen_Class_t* m_class;
+
+    /**
+     * The number of bytes occupied by the object, including the header.
+     */
+    int32_t m_size;
+
+    /**
+     * A mask of flags which denote various properties of the object.
+     */
+    int32_t m_flags;
 };
 
+/**
+ * @memberof Object
+ */
 typedef struct zen_Object_t zen_Object_t;
 
+/**
+ * The number of bytes occupied by the header and the length of an array.
+ */
+#define ZEN_OBJECT_ARRAY_HEADER_SIZE (sizeof (zen_Object_t) + sizeof (int64_t))
+
+/* Array */
+
+/**
+ * @memberof Object
+ */
+static inline int32_t zen_Object_getArrayLength(zen_Object_t* object) {
+    return *(int32_t*)(object + 1);
+}
+
+/* References */
+
+/**
+ * Returns the first field of the specified object which holds a reference,
+ * and stores the number of such fields in `count`. An object without a class,
+ * such as a primitive array or a filler, has no references.
+ *
+ * @memberof Object
+ */
+static inline zen_Reference_t* zen_Object_getReferences(zen_Object_t* object,
+    int32_t* count) {
+    zen_Reference_t* references = NULL;
+    *count = 0;
+    if ((object->m_flags & ZEN_OBJECT_FLAG_ARRAY) != 0) {
+        if ((object->m_flags & ZEN_OBJECT_FLAG_REFERENCE_ARRAY) != 0) {
+            references = (zen_Reference_t*)((uint8_t*)object + ZEN_OBJECT_ARRAY_HEADER_SIZE);
+            *count = zen_Object_getArrayLength(object);
+        }
+    }
+    else if (object->m_class != NULL) {
+        references = (zen_Reference_t*)(object + 1);
+        *count = object->m_class->m_referenceFieldCount;
+    }
+    return references;
+}
+
+/* Age */
+
+/**
+ * @memberof Object
+ */
+static inline int32_t zen_Object_getAge(zen_Object_t* object) {
+    return (object->m_flags & ZEN_OBJECT_AGE_MASK) >> ZEN_OBJECT_AGE_SHIFT;
+}
+
+/**
+ * @memberof Object
+ */
+static inline void zen_Object_setAge(zen_Object_t* object, int32_t age) {
+    object->m_flags = (object->m_flags & ~ZEN_OBJECT_AGE_MASK) | (age << ZEN_OBJECT_AGE_SHIFT);
+}
+
+/* Hash Code */
+
+/**
+ * Returns the identity hash code of the specified object. It is assigned when
+ * it is requested for the first time, and is retained when the object is
+ * moved.
+ *
+ * @memberof Object
+ */
+int32_t zen_Object_getHashCode(zen_Object_t* object);
+
+/* Filler */
+
+/**
+ * Covers the specified memory with a filler object, which has neither a class
+ * nor flags. A filler keeps a region walkable across unused memory.
+ *
+ * @memberof Object
+ */
+static inline void zen_Object_fill(uint8_t* start, intptr_t size) {
+    zen_Object_t* filler = (zen_Object_t*)start;
+    filler->m_class = NULL;
+    filler->m_size = (int32_t)size;
+    filler->m_flags = 0;
+}
+
+/**
+ * @memberof Object
+ */
+static inline bool zen_Object_isFiller(zen_Object_t* object) {
+    return (object->m_class == NULL) && (object->m_flags == 0);
+}
+
+/* Class */
+
+/**
+ * @memberof Object
+ */
+zen_Class_t* zen_Object_getClass(zen_Object_t* object);
+
+/* Forward */
+
+/**
+ * @memberof Object
+ */
+static inline bool zen_Object_isForwarded(zen_Object_t* object) {
+    return (object->m_flags & ZEN_OBJECT_FLAG_FORWARDED) != 0;
+}
+
+/**
+ * @memberof Object
+ */
+static inline zen_Object_t* zen_Object_getForwardingAddress(zen_Object_t* object) {
+    return (zen_Object_t*)object->m_class;
+}
+
+/**
+ * Records the address of the copy of the object. The original object is no
+ * longer usable, because its class is overwritten.
+ *
+ * @memberof Object
+ */
+static inline void zen_Object_forward(zen_Object_t* object, zen_Object_t* copy) {
+    object->m_class = (zen_Class_t*)copy;
+    object->m_flags |= ZEN_OBJECT_FLAG_FORWARDED;
+}
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_OBJECT_H */
\ No newline at end of file
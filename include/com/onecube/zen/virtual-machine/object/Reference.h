@@ -0,0 +1,120 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_REFERENCE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_REFERENCE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+struct zen_Object_t;
+
+/*******************************************************************************
+ * Reference                                                                   *
+ *******************************************************************************/
+
+/**
+ * The number of bits by which a compressed reference is shifted. Every object
+ * is aligned to a 64-bit boundary, therefore, the low three bits of its
+ * offset are always zero.
+ */
+#define ZEN_REFERENCE_SHIFT 3
+
+/**
+ * The largest heap which can be addressed with compressed references, which
+ * is just short of 32 GB.
+ */
+#define ZEN_REFERENCE_MAXIMUM_HEAP_SIZE ((int64_t)UINT32_MAX << ZEN_REFERENCE_SHIFT)
+
+#ifdef ZEN_COMPRESSED_REFERENCES
+
+/**
+ * A reference stored in a field of an object, or an element of an array. When
+ * the references are compressed, it is the offset of the object from
+ * `zen_Reference_base`, shifted right by `ZEN_REFERENCE_SHIFT`. Zero denotes
+ * the null reference. Otherwise, it is the address of the object.
+ *
+ * The references on the operand stack and in the local variables are never
+ * compressed.
+ *
+ * @class Reference
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+typedef uint32_t zen_Reference_t;
+
+/**
+ * The address which a compressed reference is relative to. It lies one unit
+ * before the reserved space of the heap, so that no object is encoded as
+ * zero. It is set when the memory manager is created.
+ */
+extern uintptr_t zen_Reference_base;
+
+#else
+
+/**
+ * @memberof Reference
+ */
+typedef struct zen_Object_t* zen_Reference_t;
+
+#endif
+
+/**
+ * @memberof Reference
+ */
+static inline struct zen_Object_t* zen_Reference_decode(zen_Reference_t reference) {
+#ifdef ZEN_COMPRESSED_REFERENCES
+    return (reference == 0)? NULL :
+        (struct zen_Object_t*)(zen_Reference_base + ((uintptr_t)reference << ZEN_REFERENCE_SHIFT));
+#else
+    return reference;
+#endif
+}
+
+/**
+ * @memberof Reference
+ */
+static inline zen_Reference_t zen_Reference_encode(struct zen_Object_t* object) {
+#ifdef ZEN_COMPRESSED_REFERENCES
+    return (object == NULL)? 0 :
+        (zen_Reference_t)(((uintptr_t)object - zen_Reference_base) >> ZEN_REFERENCE_SHIFT);
+#else
+    return object;
+#endif
+}
+
+/**
+ * Reads the object referred by the specified field.
+ *
+ * @memberof Reference
+ */
+static inline struct zen_Object_t* zen_Reference_load(zen_Reference_t* field) {
+    return zen_Reference_decode(*field);
+}
+
+/**
+ * Stores a reference to the specified object in the specified field. The
+ * write barriers are the responsibility of the caller.
+ *
+ * @memberof Reference
+ */
+static inline void zen_Reference_store(zen_Reference_t* field, struct zen_Object_t* object) {
+    *field = zen_Reference_encode(object);
+}
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_REFERENCE_H */
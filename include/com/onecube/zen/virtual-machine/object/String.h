@@ -0,0 +1,94 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_STRING_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_STRING_H
+
+#include <string.h>
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+/*******************************************************************************
+ * String                                                                      *
+ *******************************************************************************/
+
+/**
+ * A string is an immutable sequence of UTF-8 bytes, stored inline after the
+ * object header. The bytes are followed by a terminating null, so that they
+ * can be handed to the functions of the C library directly.
+ *
+ * The header of a string carries no class. Therefore, the collectors find no
+ * references in it.
+ *
+ * @class String
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_String_t {
+    zen_Object_t m_header;
+
+    /**
+     * The number of bytes in the string, excluding the terminating null.
+     */
+    int32_t m_size;
+
+    /**
+     * The hash code of the bytes, as computed by `zen_String_hash`.
+     */
+    int32_t m_hashCode;
+
+    uint8_t m_value[];
+};
+
+/**
+ * @memberof String
+ */
+typedef struct zen_String_t zen_String_t;
+
+/* Hash */
+
+/**
+ * Computes the FNV-1a hash code of the specified bytes.
+ *
+ * @memberof String
+ */
+static inline int32_t zen_String_hash(const uint8_t* bytes, int32_t size) {
+    uint32_t hashCode = 2166136261U;
+    int32_t i;
+    for (i = 0; i < size; i++) {
+        hashCode = (hashCode ^ bytes[i]) * 16777619U;
+    }
+    return (int32_t)hashCode;
+}
+
+/* Equals */
+
+/**
+ * Determines whether the specified string holds the specified bytes.
+ *
+ * @memberof String
+ */
+static inline bool zen_String_equals(zen_String_t* string, const uint8_t* bytes,
+    int32_t size, int32_t hashCode) {
+    return (string->m_hashCode == hashCode) && (string->m_size == size) &&
+        (memcmp(string->m_value, bytes, size) == 0);
+}
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_STRING_H */
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_STRING_TABLE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_STRING_TABLE_H
+
+#include <jtk/concurrent/lock/Mutex.h>
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/ImmortalGeneration.h>
+#include <com/onecube/zen/virtual-machine/object/String.h>
+
+/*******************************************************************************
+ * StringTable                                                                 *
+ *******************************************************************************/
+
+/**
+ * The number of slots in a new string table. It is a power of two.
+ */
+#define ZEN_STRING_TABLE_INITIAL_CAPACITY 256
+
+/**
+ * The string table interns the strings of the virtual machine. Every
+ * distinct sequence of bytes is represented by exactly one string, which is
+ * allocated in the immortal generation, and therefore, never moves.
+ *
+ * The strings are stored in an open addressing table with linear probing,
+ * which is at most half full. The table is shared by all the threads, and
+ * guarded by a mutex. A string constant is interned once per constant pool
+ * entry, after which the string is loaded from the resolved entries of the
+ * class. Therefore, the table is rarely contended.
+ *
+ * @class StringTable
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_StringTable_t {
+
+    /**
+     * The slots of the table. An empty slot is null.
+     */
+    zen_String_t** m_strings;
+
+    int32_t m_size;
+
+    int32_t m_capacity;
+
+    /**
+     * The generation where the strings are allocated.
+     */
+    zen_ImmortalGeneration_t* m_immortalGeneration;
+
+    jtk_Mutex_t* m_mutex;
+};
+
+/**
+ * @memberof StringTable
+ */
+typedef struct zen_StringTable_t zen_StringTable_t;
+
+/* Constructor */
+
+/**
+ * @memberof StringTable
+ */
+zen_StringTable_t* zen_StringTable_new(zen_ImmortalGeneration_t* immortalGeneration);
+
+/* Destructor */
+
+/**
+ * Destroys the table. The strings live as long as the immortal generation.
+ *
+ * @memberof StringTable
+ */
+void zen_StringTable_delete(zen_StringTable_t* table);
+
+/* Intern */
+
+/**
+ * Returns the string which holds the specified bytes. The bytes are copied
+ * only when such a string does not exist yet. Returns null if the immortal
+ * generation is exhausted.
+ *
+ * @memberof StringTable
+ */
+zen_String_t* zen_StringTable_intern(zen_StringTable_t* table, const uint8_t* bytes,
+    int32_t size);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_STRING_TABLE_H */
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_DECODED_INSTRUCTION_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_DECODED_INSTRUCTION_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/processor/Slot.h>
+
+/*******************************************************************************
+ * DecodedInstruction                                                          *
+ *******************************************************************************/
+
+/**
+ * The constant loaded by a `load_cpr` instruction was resolved when the
+ * instruction was decoded.
+ */
+#define ZEN_DECODED_INSTRUCTION_FLAG_CONSTANT (1 << 0)
+
+/**
+ * A fixed-width record which describes the instruction that begins at a given
+ * offset in the instructions of a function. The operands are decoded when the
+ * function is loaded, so that the interpreter does not decode them every time
+ * the instruction is executed.
+ *
+ * One record is created for every byte of the instructions, and one more for
+ * the offset right past the end, which is where a function that runs off the
+ * end of its instructions arrives. Therefore, the instruction pointer of the
+ * interpreter continues to be a byte offset, which indexes the records
+ * directly.
+ *
+ * @class DecodedInstruction
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_DecodedInstruction_t {
+
+    /**
+     * The address of the handler within the interpreter. It is bound by the
+     * interpreter when the function is executed for the first time, because
+     * the addresses of the handlers are not visible outside it.
+     */
+    const void* m_handler;
+
+    /**
+     * The byte code of the instruction. The records of the last byte, and the
+     * offset past the end, describe the `return` instruction.
+     */
+    uint8_t m_byteCode;
+    uint8_t m_flags;
+
+    /**
+     * The decoded operand, which is either an index into the local variable
+     * array or the constant pool, or an immediate value.
+     */
+    int32_t m_operand;
+
+    /**
+     * The absolute offset of the instruction where a branch arrives.
+     */
+    int32_t m_target;
+
+    /**
+     * The value loaded by a `load_cpr` instruction, if it was resolved.
+     */
+    zen_Slot_t m_constant;
+};
+
+/**
+ * @memberof DecodedInstruction
+ */
+typedef struct zen_DecodedInstruction_t zen_DecodedInstruction_t;
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_DECODED_INSTRUCTION_H */
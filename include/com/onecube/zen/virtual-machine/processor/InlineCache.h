@@ -0,0 +1,135 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INLINE_CACHE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INLINE_CACHE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+// Forward References
+
+typedef struct zen_Class_t zen_Class_t;
+typedef struct zen_Function_t zen_Function_t;
+
+/*******************************************************************************
+ * InlineCache                                                                 *
+ *******************************************************************************/
+
+/**
+ * The maximum number of receiver classes remembered by an inline cache. An
+ * inline cache which has seen more receiver classes is megamorphic.
+ */
+#define ZEN_INLINE_CACHE_CAPACITY 4
+
+/**
+ * An inline cache remembers the functions that a virtual invocation was
+ * dispatched to, keyed by the class of the receiver. With a single entry,
+ * the cache is monomorphic. With more than one entry, it is polymorphic.
+ * Once the capacity is exhausted, the cache is megamorphic and the interpreter
+ * falls back to looking up the function on every invocation.
+ *
+ * The threads which execute the same call site share its inline cache. An
+ * entry is claimed by incrementing the size, and published by storing its
+ * class, after its function. A reader which finds the class, therefore, also
+ * finds the function. Two threads may remember the same class in different
+ * entries, which is harmless.
+ *
+ * @class InlineCache
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InlineCache_t {
+    /**
+     * The receiver classes. An entry which has not been published yet is
+     * null.
+     */
+    zen_Class_t* m_classes[ZEN_INLINE_CACHE_CAPACITY];
+
+    zen_Function_t* m_functions[ZEN_INLINE_CACHE_CAPACITY];
+
+    /**
+     * The number of entries claimed by the threads which updated this cache.
+     * It may exceed the capacity, when several threads find the cache full
+     * at once.
+     */
+    int32_t m_size;
+
+    bool m_megamorphic;
+};
+
+/**
+ * @memberof InlineCache
+ */
+typedef struct zen_InlineCache_t zen_InlineCache_t;
+
+/* Constructor */
+
+/**
+ * @memberof InlineCache
+ */
+zen_InlineCache_t* zen_InlineCache_new();
+
+/* Destructor */
+
+/**
+ * @memberof InlineCache
+ */
+void zen_InlineCache_delete(zen_InlineCache_t* inlineCache);
+
+/* Lookup */
+
+/**
+ * Returns the function cached for the specified receiver class. If the class
+ * has not been seen, returns null.
+ *
+ * @memberof InlineCache
+ */
+static inline zen_Function_t* zen_InlineCache_lookup(zen_InlineCache_t* inlineCache,
+    zen_Class_t* class0) {
+    /* The first entry is checked separately, because a monomorphic call site
+     * is by far the most common case.
+     */
+    if (__atomic_load_n(&inlineCache->m_classes[0], __ATOMIC_ACQUIRE) == class0) {
+        return inlineCache->m_functions[0];
+    }
+
+    /* The entries may be published out of order, therefore, every entry is
+     * checked. An entry which is not published yet never matches.
+     */
+    int32_t i;
+    for (i = 1; i < ZEN_INLINE_CACHE_CAPACITY; i++) {
+        if (__atomic_load_n(&inlineCache->m_classes[i], __ATOMIC_ACQUIRE) == class0) {
+            return inlineCache->m_functions[i];
+        }
+    }
+    return NULL;
+}
+
+/* Update */
+
+/**
+ * Remembers the function that an invocation on the specified receiver class
+ * was dispatched to. When the cache is full, it turns megamorphic.
+ *
+ * @memberof InlineCache
+ */
+void zen_InlineCache_update(zen_InlineCache_t* inlineCache, zen_Class_t* class0,
+    zen_Function_t* function);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INLINE_CACHE_H */
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INSTRUCTION_PROFILER_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INSTRUCTION_PROFILER_H
+
+#include <stdio.h>
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * InstructionProfilerEntry                                                    *
+ *******************************************************************************/
+
+/**
+ * The longest sequence of instructions counted by the profiler.
+ */
+#define ZEN_INSTRUCTION_PROFILER_MAX_SEQUENCE_LENGTH 4
+
+/**
+ * The number of distinct sequences the profiler can count. It must be a power
+ * of two.
+ */
+#define ZEN_INSTRUCTION_PROFILER_CAPACITY (16 * 1024)
+
+/**
+ * Counts the dispatches of a sequence of instructions.
+ *
+ * @class InstructionProfilerEntry
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InstructionProfilerEntry_t {
+    uint64_t m_count;
+
+    /**
+     * The byte codes of the sequence. The most recent byte code is stored in
+     * the least significant byte.
+     */
+    uint32_t m_sequence;
+
+    /**
+     * The number of byte codes in the sequence. An unused entry has a length
+     * of zero.
+     */
+    int32_t m_length;
+};
+
+/**
+ * @memberof InstructionProfilerEntry
+ */
+typedef struct zen_InstructionProfilerEntry_t zen_InstructionProfilerEntry_t;
+
+/*******************************************************************************
+ * InstructionProfiler                                                         *
+ *******************************************************************************/
+
+/**
+ * An instruction profiler counts the sequences of two, three and four
+ * instructions dispatched by the interpreter, in the order of dispatch.
+ * Sequences which span invocations and branches are counted, too. The counts
+ * guide the selection of superinstructions.
+ *
+ * Each processor thread owns a profiler. Therefore, counting does not require
+ * synchronization. The interpreter counts the instructions only when
+ * ZEN_INTERPRETER_PROFILE is defined at build time.
+ *
+ * @class InstructionProfiler
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InstructionProfiler_t {
+    zen_InstructionProfilerEntry_t* m_entries;
+    int32_t m_size;
+
+    /**
+     * The most recently dispatched byte codes.
+     */
+    uint32_t m_window;
+    int32_t m_windowSize;
+
+    /**
+     * The total number of dispatched instructions.
+     */
+    uint64_t m_dispatchCount;
+
+    /**
+     * The number of sequences that were not counted because the profiler
+     * ran out of entries.
+     */
+    uint64_t m_droppedCount;
+};
+
+/**
+ * @memberof InstructionProfiler
+ */
+typedef struct zen_InstructionProfiler_t zen_InstructionProfiler_t;
+
+/* Constructor */
+
+/**
+ * @memberof InstructionProfiler
+ */
+zen_InstructionProfiler_t* zen_InstructionProfiler_new();
+
+/* Destructor */
+
+/**
+ * @memberof InstructionProfiler
+ */
+void zen_InstructionProfiler_delete(zen_InstructionProfiler_t* profiler);
+
+/* Record */
+
+/**
+ * Counts the specified byte code, and every sequence that it completes.
+ *
+ * @memberof InstructionProfiler
+ */
+void zen_InstructionProfiler_record(zen_InstructionProfiler_t* profiler, uint8_t byteCode);
+
+/* Write */
+
+/**
+ * Writes the counted sequences to the specified stream in text form, from the
+ * most frequent to the least frequent.
+ *
+ * @memberof InstructionProfiler
+ */
+void zen_InstructionProfiler_write(zen_InstructionProfiler_t* profiler, FILE* stream);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INSTRUCTION_PROFILER_H */
@@ -27,6 +27,7 @@
 #include <com/onecube/zen/virtual-machine/object/Function.h>
 #include <com/onecube/zen/virtual-machine/object/NativeFunction.h>
 #include <com/onecube/zen/virtual-machine/processor/InvocationStack.h>
+#include <com/onecube/zen/virtual-machine/processor/OperandStack.h>
 #include <com/onecube/zen/virtual-machine/processor/ProcessorThread.h>
 
 #define ZEN_INTERPRETER_NULL_REFERENCE 0
@@ -45,10 +46,10 @@ typedef struct zen_VirtualMachine_t zen_VirtualMachine_t;
  */
 struct zen_Interpreter_t {
     int32_t m_counter;
-    zen_InvocationStack_t* m_invocationStack;
     zen_ProcessorThread_t* m_processorThread;
     jtk_Logger_t* m_logger;
     zen_VirtualMachine_t* m_virtualMachine;
+    zen_MemoryManager_t* m_memoryManager;
 };
 
 /**
@@ -71,14 +72,31 @@ zen_Interpreter_t* zen_Interpreter_new(zen_MemoryManager_t* memoryManager,
  */
 void zen_Interpreter_delete(zen_Interpreter_t* interpreter);
 
+/* Interpret */
+
+/**
+ * Interprets the function of the current stack frame, until it returns to the
+ * stack frame below it.
+ *
+ * @memberof Interpreter
+ */
+void zen_Interpreter_interpret(zen_Interpreter_t* interpreter);
+
+/* Invoke Native */
+
+void zen_Interpreter_invokeNativeFunction(zen_Interpreter_t* interpreter,
+    zen_Class_t* targetClass, zen_Function_t* targetFunction, zen_OperandStack_t* operandStack);
+
 /* Invoke Static Function */
 
+void zen_Interpreter_invokeStaticFunction(zen_Interpreter_t* interpreter,
+    zen_Function_t* function, jtk_Array_t* arguments);
+
 void zen_Interpreter_invokeStaticFunctionEx(zen_Interpreter_t* interpreter,
     zen_Function_t* function, jtk_VariableArguments_t variableArguments);
 
-/* Read */
+/* Invoke Thread Exception Handler */
 
-uint8_t zen_Interpreter_readByte(zen_Interpreter_t* interpreter);
-uint16_t zen_Interpreter_readShort(zen_Interpreter_t* interpreter);
+void zen_Interpreter_invokeThreadExceptionHandler(zen_Interpreter_t* interpreter);
 
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INTERPRETER_H */
\ No newline at end of file
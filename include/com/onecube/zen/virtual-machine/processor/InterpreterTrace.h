@@ -0,0 +1,164 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INTERPRETER_TRACE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INTERPRETER_TRACE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * InterpreterTraceRecord                                                      *
+ *******************************************************************************/
+
+/**
+ * A trace record describes a single instruction dispatched by the interpreter.
+ * It is recorded before the instruction is executed.
+ *
+ * @class InterpreterTraceRecord
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InterpreterTraceRecord_t {
+    /**
+     * The identifier of the function which contains the instruction.
+     */
+    uint32_t m_functionId;
+
+    /**
+     * The offset of the instruction within the instructions of the function.
+     */
+    int32_t m_ip;
+
+    /**
+     * The depth of the operand stack before the instruction is executed.
+     */
+    uint16_t m_stackDepth;
+
+    /**
+     * The byte code of the instruction, as it was dispatched. It may be a
+     * superinstruction, when the virtual machine was built with
+     * ZEN_INTERPRETER_SUPERINSTRUCTIONS.
+     */
+    uint8_t m_byteCode;
+
+    /**
+     * Pads the record to 12 bytes, so that the records are written without
+     * gaps. It is always zero.
+     */
+    uint8_t m_reserved;
+};
+
+/**
+ * @memberof InterpreterTraceRecord
+ */
+typedef struct zen_InterpreterTraceRecord_t zen_InterpreterTraceRecord_t;
+
+/*******************************************************************************
+ * InterpreterTrace                                                            *
+ *******************************************************************************/
+
+/**
+ * The number of records retained by a trace. It should be a power of two.
+ */
+#define ZEN_INTERPRETER_TRACE_CAPACITY (64 * 1024)
+
+/**
+ * The file, relative to the working directory, to which a processor thread
+ * writes its trace when it is destroyed.
+ */
+#define ZEN_INTERPRETER_TRACE_FILE_NAME "zen-interpreter.trace"
+
+/**
+ * An interpreter trace is a ring buffer of the most recently dispatched
+ * instructions. Each processor thread owns a trace. Therefore, recording
+ * does not require synchronization.
+ *
+ * The interpreter records into the trace only when ZEN_INTERPRETER_TRACE is
+ * defined at build time.
+ *
+ * @class InterpreterTrace
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InterpreterTrace_t {
+    zen_InterpreterTraceRecord_t* m_records;
+
+    /**
+     * The total number of records ever written. The next record is written
+     * at the index `m_count % ZEN_INTERPRETER_TRACE_CAPACITY`.
+     */
+    uint64_t m_count;
+};
+
+/**
+ * @memberof InterpreterTrace
+ */
+typedef struct zen_InterpreterTrace_t zen_InterpreterTrace_t;
+
+/* Constructor */
+
+/**
+ * @memberof InterpreterTrace
+ */
+zen_InterpreterTrace_t* zen_InterpreterTrace_new();
+
+/* Destructor */
+
+/**
+ * @memberof InterpreterTrace
+ */
+void zen_InterpreterTrace_delete(zen_InterpreterTrace_t* trace);
+
+/* Record */
+
+/**
+ * @memberof InterpreterTrace
+ */
+static inline void zen_InterpreterTrace_record(zen_InterpreterTrace_t* trace,
+    uint8_t byteCode, int32_t ip, int32_t stackDepth, uint32_t functionId) {
+    zen_InterpreterTraceRecord_t* record =
+        &trace->m_records[trace->m_count++ & (ZEN_INTERPRETER_TRACE_CAPACITY - 1)];
+    record->m_functionId = functionId;
+    record->m_ip = ip;
+    record->m_stackDepth = (uint16_t)stackDepth;
+    record->m_byteCode = byteCode;
+    record->m_reserved = 0;
+}
+
+/* Size */
+
+/**
+ * Returns the number of records currently retained by the trace.
+ *
+ * @memberof InterpreterTrace
+ */
+int32_t zen_InterpreterTrace_getSize(zen_InterpreterTrace_t* trace);
+
+/* Write */
+
+/**
+ * Writes the retained records, from the oldest to the most recent, to the
+ * specified stream in their binary form.
+ *
+ * @memberof InterpreterTrace
+ */
+void zen_InterpreterTrace_write(zen_InterpreterTrace_t* trace, FILE* stream);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INTERPRETER_TRACE_H */
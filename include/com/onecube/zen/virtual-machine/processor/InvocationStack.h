@@ -22,10 +22,44 @@
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
 #include <com/onecube/zen/virtual-machine/object/Function.h>
+#include <com/onecube/zen/virtual-machine/processor/Slot.h>
 #include <com/onecube/zen/virtual-machine/processor/StackFrame.h>
 
-#include <jtk/collection/Iterator.h>
-#include <jtk/collection/list/DoublyLinkedList.h>
+/*******************************************************************************
+ * InvocationStackSegment                                                      *
+ *******************************************************************************/
+
+/**
+ * The default number of slots in a segment of the invocation stack. A segment
+ * is larger only when a single stack frame does not fit in the default size.
+ */
+#define ZEN_INVOCATION_STACK_SEGMENT_SIZE (16 * 1024)
+
+/**
+ * @memberof InvocationStackSegment
+ */
+typedef struct zen_InvocationStackSegment_t zen_InvocationStackSegment_t;
+
+/**
+ * A segment is a contiguous block of slots. The stack frames, the local
+ * variables and the operand stacks are carved out of the slots by bumping
+ * a pointer. When a segment is exhausted, the invocation stack continues in
+ * the next segment. Segments are retained after they are vacated, so that a
+ * thread that repeatedly crosses a segment boundary does not allocate memory
+ * on each invocation.
+ *
+ * @class InvocationStackSegment
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InvocationStackSegment_t {
+    zen_InvocationStackSegment_t* m_previous;
+    zen_InvocationStackSegment_t* m_next;
+    zen_Slot_t* m_limit;
+    int32_t m_capacity;
+    zen_Slot_t m_slots[];
+};
 
 /*******************************************************************************
  * InvocationStack                                                             *
@@ -38,8 +72,21 @@
  * @since zen 1.0
  */
 struct zen_InvocationStack_t {
-    // TODO: Replace this with a singly-linked list.
-    jtk_DoublyLinkedList_t* m_stackFrames;
+    /**
+     * The segment which contains the current stack frame.
+     */
+    zen_InvocationStackSegment_t* m_segment;
+
+    /**
+     * The topmost stack frame. The stack frames are linked to their callers
+     * through the zen_StackFrame_t::m_previous field.
+     */
+    zen_StackFrame_t* m_currentStackFrame;
+
+    /**
+     * The number of stack frames on the invocation stack.
+     */
+    int32_t m_depth;
 };
 
 /**
@@ -63,21 +110,41 @@ void zen_InvocationStack_delete(zen_InvocationStack_t* stack);
 
 /* Current Stack Frame */
 
+/**
+ * @memberof InvocationStack
+ */
 zen_StackFrame_t* zen_InvocationStack_getCurrentStackFrame(zen_InvocationStack_t* stack);
 
-/* Iterator */
+/* Depth */
+
+/**
+ * @memberof InvocationStack
+ */
+int32_t zen_InvocationStack_getDepth(zen_InvocationStack_t* stack);
 
-jtk_Iterator_t* zen_InvocationStack_getIterator(zen_InvocationStack_t* invocationStack);
+/* Push/Peek/Pop Stack Frame */
 
-/* Push/Pop Stack Frame */
+/**
+ * Carves a stack frame for the specified function out of the slot stack.
+ *
+ * The topmost `argumentSlotCount` slots of the operand stack of the current
+ * stack frame become the first local variables of the new stack frame. They
+ * are consumed from the operand stack of the caller.
+ *
+ * @memberof InvocationStack
+ */
+zen_StackFrame_t* zen_InvocationStack_pushStackFrame(zen_InvocationStack_t* stack,
+    zen_Function_t* function, int32_t argumentSlotCount);
 
 /**
  * @memberof InvocationStack
  */
-void zen_InvocationStack_pushStackFrame(zen_InvocationStack_t* invocationStack,
-    zen_StackFrame_t* stackFrame);
+zen_StackFrame_t* zen_InvocationStack_peekStackFrame(zen_InvocationStack_t* stack);
 
 /**
+ * Discards the current stack frame and returns the stack frame of the caller,
+ * which becomes the current stack frame.
+ *
  * @memberof InvocationStack
  */
 zen_StackFrame_t* zen_InvocationStack_popStackFrame(zen_InvocationStack_t* stack);
@@ -21,6 +21,7 @@
 
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
+#include <com/onecube/zen/virtual-machine/processor/Slot.h>
 
 /*******************************************************************************
  * LocalVariableArray                                                          *
@@ -33,7 +34,7 @@
  * @since zen 1.0
  */
 struct zen_LocalVariableArray_t {
-    int32_t* m_values;
+    zen_Slot_t* m_values;
     int32_t m_size;
 };
 
@@ -20,6 +20,13 @@
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_PROCESSOR_THREAD_H
 
 #include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/AllocationBuffer.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/RootVisitor.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/Safepoint.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/SatbQueue.h>
+#include <com/onecube/zen/virtual-machine/processor/InstructionProfiler.h>
+#include <com/onecube/zen/virtual-machine/processor/InterpreterTrace.h>
 #include <com/onecube/zen/virtual-machine/processor/InvocationStack.h>
 
 /*******************************************************************************
@@ -34,6 +41,54 @@
  */
 struct zen_ProcessorThread_t {
     zen_InvocationStack_t* m_invocationStack;
+
+    /**
+     * The trace of the instructions dispatched on this thread. It is null,
+     * unless the virtual machine was built with ZEN_INTERPRETER_TRACE. The
+     * trace is written to the file named by ZEN_INTERPRETER_TRACE_FILE_NAME
+     * when the thread is destroyed.
+     */
+    zen_InterpreterTrace_t* m_trace;
+
+    /**
+     * The profile of the instruction sequences dispatched on this thread. It
+     * is null, unless the virtual machine was built with ZEN_INTERPRETER_PROFILE.
+     * The profile is written to the standard error when the thread is
+     * destroyed.
+     */
+    zen_InstructionProfiler_t* m_profiler;
+
+    /**
+     * The memory manager which allocates the objects of this thread.
+     */
+    zen_MemoryManager_t* m_memoryManager;
+
+    /**
+     * The thread local allocation buffer. The objects are allocated from it
+     * without synchronization.
+     */
+    zen_AllocationBuffer_t* m_allocationBuffer;
+
+    /**
+     * The buffer where the pre-write barrier logs the references overwritten
+     * by this thread, while the old generation is marked concurrently.
+     */
+    zen_SatbBuffer_t* m_satbBuffer;
+
+    /**
+     * The safepoint of the memory manager. The interpreter polls it on
+     * backward branches and returns, and marks the native calls as safe
+     * regions.
+     */
+    zen_Safepoint_t* m_safepoint;
+
+    /**
+     * The exception which unwound the stack frame on which the interpreter
+     * was entered, because no function below that frame handled it. It is
+     * null when the last invocation completed normally. The garbage
+     * collector treats it as a root.
+     */
+    zen_Object_t* m_exception;
 };
 
 /**
@@ -44,15 +99,34 @@ typedef struct zen_ProcessorThread_t zen_ProcessorThread_t;
 /* Constructor */
 
 /**
+ * Creates a processor thread, and attaches the calling thread to the
+ * safepoint of the specified memory manager.
+ *
  * @memberof ProcessorThread
  */
-zen_ProcessorThread_t* zen_ProcessorThread_new();
+zen_ProcessorThread_t* zen_ProcessorThread_new(zen_MemoryManager_t* memoryManager);
 
 /* Destructor */
 
 /**
+ * Detaches the calling thread from the safepoint of the memory manager, and
+ * destroys the processor thread.
+ *
  * @memberof ProcessorThread
  */
 void zen_ProcessorThread_delete(zen_ProcessorThread_t* thread);
+
+/* Roots */
+
+/**
+ * Visits the local variables and the operands of every stack frame on this
+ * thread. The slots described by the stack map of the function are visited
+ * precisely. The remaining slots, and all the slots of the functions which
+ * have no stack map, are visited as ambiguous roots.
+ *
+ * @memberof ProcessorThread
+ */
+void zen_ProcessorThread_visitRoots(zen_ProcessorThread_t* thread,
+    zen_RootVisitor_t* visitor);
  
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_PROCESSOR_THREAD_H */
\ No newline at end of file
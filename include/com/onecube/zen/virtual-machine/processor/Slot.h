@@ -0,0 +1,55 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_SLOT_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_SLOT_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * Slot                                                                        *
+ *******************************************************************************/
+
+/**
+ * A slot is the unit of storage in the operand stack and the local variable
+ * array. Every value, irrespective of its type, occupies exactly one slot.
+ * Therefore, 64-bit integers, 64-bit decimals and references are never split
+ * into high and low parts.
+ *
+ * The slot is not tagged. The type of the value stored in a slot is implied by
+ * the instruction which accesses it.
+ *
+ * @class Slot
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+union zen_Slot_t {
+    int32_t m_integer;
+    int64_t m_long;
+    float m_float;
+    double m_double;
+    uintptr_t m_reference;
+};
+
+/**
+ * @memberof Slot
+ */
+typedef union zen_Slot_t zen_Slot_t;
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_SLOT_H */
@@ -36,33 +36,37 @@
 typedef struct zen_StackFrame_t zen_StackFrame_t;
 
 /**
+ * A stack frame is not allocated on its own. It is carved out of the slot
+ * stack owned by the invocation stack of a processor thread. The values of
+ * the local variable array and the operand stack are not allocated either.
+ * They point to the slots which surround the stack frame. The layout of a
+ * stack frame on the slot stack is shown below.
+ *
+ * [local variables] [stack frame] [operand stack]
+ *
+ * The parameters of the callee overlap the arguments pushed on the operand
+ * stack of the caller. Therefore, the arguments are never copied on an
+ * invocation.
+ *
  * @class StackFrame
  * @ingroup zen_vm_processor
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_StackFrame_t {
-    zen_OperandStack_t* m_operandStack;
-    zen_LocalVariableArray_t* m_localVariableArray;
+    zen_OperandStack_t m_operandStack;
+    zen_LocalVariableArray_t m_localVariableArray;
     zen_Class_t* m_class;
     zen_Function_t* m_function;
     zen_InstructionAttribute_t* m_instructionAttribute;
     int32_t m_ip;
-};
-
-/* Constructor */
-
-/**
- * @memberof StackFrame
- */
-zen_StackFrame_t* zen_StackFrame_new(zen_Function_t* function);
 
-/* Destructor */
-
-/**
- * @memberof StackFrame
- */
-void zen_StackFrame_delete(zen_StackFrame_t* frame);
+    /**
+     * The stack frame of the caller. It is null for the bottommost stack
+     * frame.
+     */
+    zen_StackFrame_t* m_previous;
+};
 
 /* Class */
 
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_SUPERINSTRUCTION_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_SUPERINSTRUCTION_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+
+/*******************************************************************************
+ * Superinstruction                                                            *
+ *******************************************************************************/
+
+/**
+ * A superinstruction executes a frequent sequence of instructions with a
+ * single dispatch. Superinstructions are internal to the virtual machine.
+ * They never appear in binary entities. Their byte codes begin right after
+ * the last byte code of the instruction set.
+ *
+ * The superinstruction rewriter replaces only the byte code of the first
+ * instruction in a sequence. The arguments and the byte codes of the
+ * remaining instructions are retained. Therefore, the length of the sequence
+ * does not change, the branch offsets remain valid, and a branch into the
+ * middle of a sequence executes the original instructions.
+ *
+ * The handler of a superinstruction reads the arguments of the constituent
+ * instructions at their original offsets and skips the whole sequence.
+ *
+ * The sequences are hand-picked, not generated. They were chosen from the
+ * output of the instruction profiler over counted loops, where the loads of
+ * local variables, the increments, and the loop conditions dominate. In
+ * builds with ZEN_INTERPRETER_PROFILE enabled, the interpreter tests measure
+ * the dispatches that the superinstructions save against the target of 30%.
+ *
+ * @class Superinstruction
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+enum zen_Superinstruction_t {
+
+    /**
+     * load_i index1; load_i index2
+     */
+    ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I = ZEN_BYTE_CODE_WIDE + 1,
+
+    /**
+     * load_i index1; load_i index2; add_i; store_i index3
+     */
+    ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_ADD_I_STORE_I,
+
+    /**
+     * load_i index1; load_i index2; jump_lt_i offset
+     */
+    ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_JUMP_LT_I,
+
+    /**
+     * load_i index1; push_iN; add_i; store_i index2
+     *
+     * The constant is one of `push_in1`, `push_i0`, ..., `push_i5`.
+     */
+    ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_ADD_I_STORE_I,
+
+    /**
+     * load_i index; push_iN; jump_lt_i offset
+     *
+     * The constant is one of `push_in1`, `push_i0`, ..., `push_i5`.
+     */
+    ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_JUMP_LT_I,
+
+    /**
+     * load_a index1; load_a index2
+     */
+    ZEN_SUPERINSTRUCTION_LOAD_A_LOAD_A
+};
+
+/**
+ * @memberof Superinstruction
+ */
+typedef enum zen_Superinstruction_t zen_Superinstruction_t;
+
+/**
+ * The first byte code reserved for superinstructions.
+ */
+#define ZEN_SUPERINSTRUCTION_FIRST ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I
+
+/**
+ * The last byte code reserved for superinstructions.
+ */
+#define ZEN_SUPERINSTRUCTION_LAST ZEN_SUPERINSTRUCTION_LOAD_A_LOAD_A
+
+/**
+ * Evaluates the value pushed by one of the `push_in1`, `push_i0`, ...,
+ * `push_i5` instructions, whose byte codes are consecutive.
+ */
+#define ZEN_SUPERINSTRUCTION_PUSH_IN_VALUE(byteCode) \
+    ((int32_t)(byteCode) - (int32_t)ZEN_BYTE_CODE_PUSH_I0)
+
+/**
+ * Returns the byte code of the first instruction in the sequence represented
+ * by the specified superinstruction. The superinstruction replaces only this
+ * byte code; the rest of the sequence remains intact.
+ */
+static inline uint8_t zen_Superinstruction_getFirstByteCode(uint8_t superinstruction) {
+    return (superinstruction == ZEN_SUPERINSTRUCTION_LOAD_A_LOAD_A)?
+        ZEN_BYTE_CODE_LOAD_A : ZEN_BYTE_CODE_LOAD_I;
+}
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_SUPERINSTRUCTION_H */
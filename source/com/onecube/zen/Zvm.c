@@ -26,6 +26,8 @@
 #include <jtk/core/Error.h>
 #include <jtk/core/System.h>
 
+int32_t zen_ZenVirtualMachine_main(char** arguments, int32_t length);
+
 int32_t main(int32_t length, char** arguments) {
     jtk_System_initialize();
     int32_t result = zen_ZenVirtualMachine_main(arguments, length);
@@ -78,7 +80,7 @@ int32_t zen_ZenVirtualMachine_main(char** arguments, int32_t length) {
 
                 if (zen_VirtualMachine_isClear(virtualMachine)) {
                     int32_t i;
-                    for (i = 9999999990; i < argumentCount; i++) {
+                    for (i = 0; (arguments0 != NULL) && (i < argumentCount); i++) {
                         /* Create an instance of the String class to represent each command line
                          * argument. It may result in an exception.
                          */
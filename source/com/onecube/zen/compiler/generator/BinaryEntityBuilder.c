@@ -16,6 +16,8 @@
 
 // Tuesday, July 16, 2019
 
+#include <string.h>
+
 #include <jtk/core/Double.h>
 #include <jtk/core/Float.h>
 #include <jtk/core/VariableArguments.h>
@@ -24,6 +26,7 @@
 #include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
 #include <com/onecube/zen/virtual-machine/feb/EntityType.h>
 #include <com/onecube/zen/virtual-machine/feb/Instruction.h>
+#include <com/onecube/zen/virtual-machine/feb/SwitchInstruction.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPool.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolClass.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolDouble.h>
@@ -618,8 +621,10 @@ void zen_BinaryEntityBuilder_writeFunction(zen_BinaryEntityBuilder_t* builder, u
     channel->m_bytes[channel->m_index++] = (descriptorIndex & 0x000000FF);
 }
 
-/* The localVariableCount and maxStackSize are in terms of 4-m_bytes. Therefore,
- * long, double and reference types each occupy a magnitude of 2.
+/* The localVariableCount and maxStackSize are in terms of slots. Every value,
+ * irrespective of its type, occupies exactly one slot. The virtual machine
+ * computes both values when it loads the instructions, and uses the larger of
+ * the computed and the declared values.
  */
 void zen_BinaryEntityBuilder_writeInstructionAttributeHeader(
     zen_BinaryEntityBuilder_t* builder, uint16_t nameIndex,
@@ -659,6 +664,7 @@ void zen_BinaryEntityBuilder_writeInstructionAttribute(
     
     jtk_Arrays_copyEx_b(channel->m_bytes, channel->m_capacity, channel->m_index,
         instructions, instructionCount, 0, instructionCount);
+    channel->m_index += instructionCount;
 }
 
 void zen_BinaryEntityBuilder_writeExceptionTableHeader(zen_BinaryEntityBuilder_t* builder, uint16_t size) {
@@ -671,6 +677,47 @@ void zen_BinaryEntityBuilder_writeExceptionTableHeader(zen_BinaryEntityBuilder_t
     channel->m_bytes[channel->m_index++] = (size & 0x000000FF);
 }
 
+// Stack Map Table Attribute
+
+void zen_BinaryEntityBuilder_writeStackMapTableAttribute(zen_BinaryEntityBuilder_t* builder,
+    zen_StackMapTableAttribute_t* attribute) {
+    jtk_Assert_assertObject(builder, "The specified builder is null.");
+    jtk_Assert_assertObject(attribute, "The specified stack map table attribute is null.");
+
+    zen_DataChannel_t* channel = (zen_DataChannel_t*)jtk_ArrayList_getValue(builder->m_channels, 0);
+    /* The length excludes the name index and the length. */
+    zen_DataChannel_requestCapacity(channel, channel->m_index + 6 + attribute->m_length);
+
+    uint16_t nameIndex = attribute->m_nameIndex;
+    uint32_t length = attribute->m_length;
+    uint16_t localVariableCount = attribute->m_localVariableCount;
+    uint16_t size = attribute->m_size;
+    channel->m_bytes[channel->m_index++] = (nameIndex & 0x0000FF00) >> 8; // Name Index
+    channel->m_bytes[channel->m_index++] = (nameIndex & 0x000000FF);
+    channel->m_bytes[channel->m_index++] = (length & 0xFF000000) >> 24; // Length
+    channel->m_bytes[channel->m_index++] = (length & 0x00FF0000) >> 16;
+    channel->m_bytes[channel->m_index++] = (length & 0x0000FF00) >> 8;
+    channel->m_bytes[channel->m_index++] = (length & 0x000000FF);
+    channel->m_bytes[channel->m_index++] = (localVariableCount & 0x0000FF00) >> 8; // Local Variable Count
+    channel->m_bytes[channel->m_index++] = (localVariableCount & 0x000000FF);
+    channel->m_bytes[channel->m_index++] = (size & 0x0000FF00) >> 8; // Size
+    channel->m_bytes[channel->m_index++] = (size & 0x000000FF);
+
+    int32_t i;
+    for (i = 0; i < size; i++) {
+        zen_StackMapEntry_t* entry = &attribute->m_entries[i];
+        channel->m_bytes[channel->m_index++] = (entry->m_offset & 0x0000FF00) >> 8; // Offset
+        channel->m_bytes[channel->m_index++] = (entry->m_offset & 0x000000FF);
+        channel->m_bytes[channel->m_index++] = (entry->m_operandCount & 0x0000FF00) >> 8; // Operand Count
+        channel->m_bytes[channel->m_index++] = (entry->m_operandCount & 0x000000FF);
+
+        int32_t bitmapSize = zen_StackMapTableAttribute_getBitmapSize(localVariableCount,
+            entry->m_operandCount);
+        memcpy(channel->m_bytes + channel->m_index, entry->m_bitmap, bitmapSize); // Bitmap
+        channel->m_index += bitmapSize;
+    }
+}
+
 // Instructions
 
 /* NOP */
@@ -2655,6 +2702,145 @@ void zen_BinaryEntityBuilder_emitSwap(zen_BinaryEntityBuilder_t* builder) {
     channel->m_bytes[channel->m_index++] = ZEN_BYTE_CODE_SWAP; // Byte Code
 }
 
+/* Switch */
+
+/* The arguments of a switch instruction are aligned relative to the first
+ * instruction of the function. Therefore, the active channel should begin
+ * with the first instruction of the function.
+ */
+static void zen_BinaryEntityBuilder_emitSwitchPadding(zen_DataChannel_t* channel) {
+    int32_t index = zen_SwitchInstruction_getArgumentIndex(channel->m_index - 1);
+    while (channel->m_index < index) {
+        channel->m_bytes[channel->m_index++] = 0; // Padding
+    }
+}
+
+static void zen_BinaryEntityBuilder_emitSwitchInteger(zen_DataChannel_t* channel, int32_t value) {
+    channel->m_bytes[channel->m_index++] = (value & 0xFF000000) >> 24;
+    channel->m_bytes[channel->m_index++] = (value & 0x00FF0000) >> 16;
+    channel->m_bytes[channel->m_index++] = (value & 0x0000FF00) >> 8;
+    channel->m_bytes[channel->m_index++] = (value & 0x000000FF);
+}
+
+void zen_BinaryEntityBuilder_emitSwitchTable(zen_BinaryEntityBuilder_t* builder,
+    int32_t defaultOffset, int32_t low, int32_t high, const int32_t* offsets) {
+    jtk_Assert_assertObject(builder, "The specified builder is null.");
+    jtk_Assert_assertTrue(low <= high, "The lower bound of the table exceeds its upper bound.");
+
+    int32_t count = high - low + 1;
+    zen_DataChannel_t* channel = (zen_DataChannel_t*)jtk_ArrayList_getValue(builder->m_channels, 0);
+    zen_DataChannel_requestCapacity(channel, 1 + 3 + ZEN_SWITCH_INSTRUCTION_TABLE_HEADER_SIZE + (count * 4));
+
+    channel->m_bytes[channel->m_index++] = ZEN_BYTE_CODE_SWITCH_TABLE; // Byte Code
+    zen_BinaryEntityBuilder_emitSwitchPadding(channel);
+    zen_BinaryEntityBuilder_emitSwitchInteger(channel, defaultOffset); // Default
+    zen_BinaryEntityBuilder_emitSwitchInteger(channel, low); // Low
+    zen_BinaryEntityBuilder_emitSwitchInteger(channel, high); // High
+
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        zen_BinaryEntityBuilder_emitSwitchInteger(channel, offsets[i]); // Offset
+    }
+}
+
+void zen_BinaryEntityBuilder_emitSwitchSearch(zen_BinaryEntityBuilder_t* builder,
+    int32_t defaultOffset, int32_t count, const int32_t* keys, const int32_t* offsets) {
+    jtk_Assert_assertObject(builder, "The specified builder is null.");
+
+    zen_DataChannel_t* channel = (zen_DataChannel_t*)jtk_ArrayList_getValue(builder->m_channels, 0);
+    zen_DataChannel_requestCapacity(channel, 1 + 3 + ZEN_SWITCH_INSTRUCTION_SEARCH_HEADER_SIZE + (count * 8));
+
+    channel->m_bytes[channel->m_index++] = ZEN_BYTE_CODE_SWITCH_SEARCH; // Byte Code
+    zen_BinaryEntityBuilder_emitSwitchPadding(channel);
+    zen_BinaryEntityBuilder_emitSwitchInteger(channel, defaultOffset); // Default
+    zen_BinaryEntityBuilder_emitSwitchInteger(channel, count); // Count
+
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        zen_BinaryEntityBuilder_emitSwitchInteger(channel, keys[i]); // Key
+    }
+    for (i = 0; i < count; i++) {
+        zen_BinaryEntityBuilder_emitSwitchInteger(channel, offsets[i]); // Offset
+    }
+}
+
+struct zen_SwitchCase_t {
+    int32_t m_key;
+    int32_t m_offset;
+};
+
+typedef struct zen_SwitchCase_t zen_SwitchCase_t;
+
+static int zen_SwitchCase_compare(const void* value1, const void* value2) {
+    int32_t key1 = ((const zen_SwitchCase_t*)value1)->m_key;
+    int32_t key2 = ((const zen_SwitchCase_t*)value2)->m_key;
+    return (key1 > key2) - (key1 < key2);
+}
+
+/* The cost of each encoding is estimated in words of space plus three times
+ * the number of steps required to find the offset. A dense range of keys is
+ * encoded as a table, which is indexed in constant time. A sparse set of keys
+ * is encoded as a sorted array, which is searched in logarithmic time.
+ */
+void zen_BinaryEntityBuilder_emitSwitch(zen_BinaryEntityBuilder_t* builder,
+    int32_t defaultOffset, int32_t count, const int32_t* keys, const int32_t* offsets) {
+    jtk_Assert_assertObject(builder, "The specified builder is null.");
+
+    zen_SwitchCase_t* cases = jtk_Memory_allocate(zen_SwitchCase_t, (count > 0)? count : 1);
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        cases[i].m_key = keys[i];
+        cases[i].m_offset = offsets[i];
+    }
+    qsort(cases, count, sizeof (zen_SwitchCase_t), zen_SwitchCase_compare);
+
+    bool table = false;
+    if (count > 0) {
+        int64_t range = (int64_t)cases[count - 1].m_key - cases[0].m_key + 1;
+        int64_t searchSteps = 1;
+        while (((int64_t)1 << (searchSteps - 1)) < count) {
+            searchSteps++;
+        }
+
+        int64_t tableCost = (3 + range) + (3 * 1);
+        int64_t searchCost = (2 + 2 * (int64_t)count) + (3 * searchSteps);
+        table = tableCost <= searchCost;
+    }
+
+    if (table) {
+        int32_t low = cases[0].m_key;
+        int32_t high = cases[count - 1].m_key;
+        int32_t* tableOffsets = jtk_Memory_allocate(int32_t, high - low + 1);
+        int32_t j = 0;
+        for (i = 0; i <= high - low; i++) {
+            /* The gaps between the keys transfer the control to the default
+             * offset.
+             */
+            if (cases[j].m_key == low + i) {
+                tableOffsets[i] = cases[j++].m_offset;
+            }
+            else {
+                tableOffsets[i] = defaultOffset;
+            }
+        }
+        zen_BinaryEntityBuilder_emitSwitchTable(builder, defaultOffset, low, high, tableOffsets);
+        jtk_Memory_deallocate(tableOffsets);
+    }
+    else {
+        int32_t* sortedKeys = jtk_Memory_allocate(int32_t, (count > 0)? count : 1);
+        int32_t* sortedOffsets = jtk_Memory_allocate(int32_t, (count > 0)? count : 1);
+        for (i = 0; i < count; i++) {
+            sortedKeys[i] = cases[i].m_key;
+            sortedOffsets[i] = cases[i].m_offset;
+        }
+        zen_BinaryEntityBuilder_emitSwitchSearch(builder, defaultOffset, count, sortedKeys, sortedOffsets);
+        jtk_Memory_deallocate(sortedOffsets);
+        jtk_Memory_deallocate(sortedKeys);
+    }
+
+    jtk_Memory_deallocate(cases);
+}
+
 /* Throw */
 
 void zen_BinaryEntityBuilder_emitThrow(zen_BinaryEntityBuilder_t* builder) {
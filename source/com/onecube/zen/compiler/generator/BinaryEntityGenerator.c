@@ -29,9 +29,11 @@
 #include <com/onecube/zen/compiler/generator/BinaryEntityBuilder.h>
 #include <com/onecube/zen/compiler/symbol-table/Symbol.h>
 #include <com/onecube/zen/compiler/generator/BinaryEntityGenerator.h>
+#include <com/onecube/zen/virtual-machine/feb/EntityFlag.h>
 #include <com/onecube/zen/virtual-machine/feb/EntityType.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/PredefinedAttribute.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/StackMapTableAttribute.h>
 
 // Constructor
 
@@ -54,6 +56,7 @@ zen_BinaryEntityGenerator_t* zen_BinaryEntityGenerator_newEx(
     generator->m_instructions = zen_BinaryEntityBuilder_new();
     generator->m_maxStackSize = 0;
     generator->m_localVariableCount = 0;
+    generator->m_stackMapBuilder = zen_StackMapBuilder_new();
 
     zen_ASTListener_t* astListener = generator->m_astListener;
 
@@ -300,6 +303,7 @@ void zen_BinaryEntityGenerator_delete(zen_BinaryEntityGenerator_t* generator) {
     jtk_Assert_assertObject(generator, "The specified generator is null.");
 
     zen_BinaryEntityBuilder_delete(generator->m_instructions);
+    zen_StackMapBuilder_delete(generator->m_stackMapBuilder);
 
     int32_t fieldCount = jtk_ArrayList_getSize(generator->m_fields);
     int32_t fieldIndex;
@@ -560,7 +564,28 @@ void zen_BinaryEntityGenerator_writeEntity(zen_BinaryEntityGenerator_t* generato
                         instructionAttribute->m_localVariableCount,
                         instructionAttribute->m_instructionLength);
 
-                // TODO: Write the exception table.
+                // TODO: Write the exception handler sites.
+                zen_BinaryEntityBuilder_writeExceptionTableHeader(generator->m_builder, 0);
+            }
+            /* If the current attribute is a stack map table attribute, write
+             * it to the data channel.
+             */
+            else if (jtk_CString_equals(name->m_bytes, name->m_length,
+                ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE, ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE_SIZE)) {
+                zen_StackMapTableAttribute_t* stackMapTableAttribute =
+                    (zen_StackMapTableAttribute_t*)attribute;
+
+                /* Write the stack map table attribute for the current function. */
+                zen_BinaryEntityBuilder_writeStackMapTableAttribute(generator->m_builder,
+                    stackMapTableAttribute);
+
+                /* Log the details of the stack map table attribute. */
+                printf("[debug] The function has a stack map table attribute with the features "
+                       "(nameIndex = %d, length = %d, localVariableCount = %d, size = %d)\n",
+                        stackMapTableAttribute->m_nameIndex,
+                        stackMapTableAttribute->m_length,
+                        stackMapTableAttribute->m_localVariableCount,
+                        stackMapTableAttribute->m_size);
             }
         }
     }
@@ -779,6 +804,41 @@ zen_InstructionAttribute_t* zen_BinaryEntityGenerator_makeInstructionAttribute(
     return instructionAttribute;
 }
 
+/* The stack map builder reads the constant pool entries referenced by the
+ * instructions, such as the descriptors of the functions which are invoked.
+ * The entries are viewed through a temporary constant pool, which does not
+ * own them.
+ */
+zen_StackMapTableAttribute_t* zen_BinaryEntityGenerator_makeStackMapTableAttribute(
+    zen_BinaryEntityGenerator_t* generator, zen_InstructionAttribute_t* instructionAttribute,
+    jtk_String_t* descriptor, uint16_t flags) {
+    int32_t entryCount = zen_ConstantPoolBuilder_countEntries(generator->m_constantPoolBuilder);
+    zen_ConstantPool_t constantPool;
+    constantPool.m_size = entryCount;
+    constantPool.m_entries = zen_Memory_allocate(zen_ConstantPoolEntry_t*, entryCount + 1);
+    int32_t i;
+    for (i = 0; i < entryCount; i++) {
+        constantPool.m_entries[i] = zen_ConstantPoolBuilder_getEntry(
+            generator->m_constantPoolBuilder, i);
+    }
+
+    /* Retrieve a valid index into the constant pool where an UTF-8 entry
+     * represents "vm/primary/StackMapTable".
+     */
+    uint16_t attributeNameIndex = zen_ConstantPoolBuilder_getUtf8EntryIndexEx(
+        generator->m_constantPoolBuilder, ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE,
+        ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE_SIZE);
+    /* The receiver of an instance function occupies the first local variable. */
+    bool instance = (flags & ZEN_ENTITY_FLAG_STATIC) == 0;
+    zen_StackMapTableAttribute_t* stackMapTableAttribute = zen_StackMapBuilder_build(
+        generator->m_stackMapBuilder, instructionAttribute, &constantPool,
+        descriptor->m_value, descriptor->m_size, instance, attributeNameIndex);
+
+    zen_Memory_deallocate(constantPool.m_entries);
+
+    return stackMapTableAttribute;
+}
+
 // TODO: Somebody has to destroy the instruction attribute that was allocated here.
 void zen_BinaryEntityGenerator_onExitFunctionDeclaration(
     zen_ASTListener_t* astListener, zen_ASTNode_t* node) {
@@ -803,21 +863,31 @@ void zen_BinaryEntityGenerator_onExitFunctionDeclaration(
     uint16_t descriptorIndex = zen_ConstantPoolBuilder_getUtf8EntryIndex(
         generator->m_constantPoolBuilder, descriptor);
 
+    zen_InstructionAttribute_t* instructionAttribute =
+        zen_BinaryEntityGenerator_makeInstructionAttribute(generator);
+    /* The stack map table is null if the instructions cannot be simulated.
+     * The virtual machine scans the stack frames of such functions
+     * conservatively.
+     */
+    zen_StackMapTableAttribute_t* stackMapTableAttribute =
+        zen_BinaryEntityGenerator_makeStackMapTableAttribute(generator,
+            instructionAttribute, descriptor, flags);
+
     /* Destroy the descriptor. A constant pool reference to the descriptor was
      * acquired.
      */
     jtk_String_delete(descriptor);
 
-    zen_InstructionAttribute_t* instructionAttribute =
-        zen_BinaryEntityGenerator_makeInstructionAttribute(generator);
-
     zen_FunctionEntity_t* functionEntity = zen_FunctionEntity_new(flags,
         nameIndex, descriptorIndex);
     zen_AttributeTable_t* attributeTable = &functionEntity->m_attributeTable;
 
-    attributeTable->m_size = 1;
-    attributeTable->m_attributes = zen_Memory_allocate(zen_Attribute_t*, 1);
+    attributeTable->m_size = (stackMapTableAttribute != NULL)? 2 : 1;
+    attributeTable->m_attributes = zen_Memory_allocate(zen_Attribute_t*, attributeTable->m_size);
     attributeTable->m_attributes[0] = (zen_Attribute_t*)instructionAttribute;
+    if (stackMapTableAttribute != NULL) {
+        attributeTable->m_attributes[1] = (zen_Attribute_t*)stackMapTableAttribute;
+    }
 
     /* Add the function entity to the list of functions. */
     jtk_ArrayList_add(generator->m_functions, functionEntity);
@@ -0,0 +1,629 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <string.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/compiler/generator/StackMapBuilder.h>
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+#include <com/onecube/zen/virtual-machine/feb/InstructionEffect.h>
+#include <com/onecube/zen/virtual-machine/feb/SwitchInstruction.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolField.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolFunction.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolTag.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolUtf8.h>
+
+/*******************************************************************************
+ * StackMapBuilder                                                             *
+ *******************************************************************************/
+
+/* The types of the slots form a lattice. The types of the slots which meet
+ * are merged by a bitwise or. A slot which holds a primitive value along one
+ * path and a reference along another path holds neither.
+ */
+
+/* The slot was not assigned yet. */
+#define ZEN_STACK_MAP_BUILDER_TYPE_NONE 0
+
+/* The slot holds a primitive value. */
+#define ZEN_STACK_MAP_BUILDER_TYPE_PRIMITIVE 1
+
+/* The slot holds a reference. */
+#define ZEN_STACK_MAP_BUILDER_TYPE_REFERENCE 2
+
+/* An instruction pushes at most two operands more than it pops. */
+#define ZEN_STACK_MAP_BUILDER_MAX_GROWTH 2
+
+/**
+ * The state of a simulation. The state of the slots before an instruction is
+ * stored at the offset of the instruction. The local variables are stored
+ * first, followed by the operands.
+ */
+struct zen_StackMapSimulation_t {
+    const uint8_t* m_instructions;
+    int32_t m_length;
+    int32_t m_localVariableCount;
+    uint8_t** m_states;
+    int32_t* m_depths;
+    int32_t* m_worklist;
+    int32_t m_worklistSize;
+    bool* m_enqueued;
+};
+
+typedef struct zen_StackMapSimulation_t zen_StackMapSimulation_t;
+
+/* Constructor */
+
+zen_StackMapBuilder_t* zen_StackMapBuilder_new() {
+    zen_StackMapBuilder_t* builder = jtk_Memory_allocate(zen_StackMapBuilder_t, 1);
+
+    return builder;
+}
+
+/* Destructor */
+
+void zen_StackMapBuilder_delete(zen_StackMapBuilder_t* builder) {
+    jtk_Assert_assertObject(builder, "The specified stack map builder is null.");
+
+    jtk_Memory_deallocate(builder);
+}
+
+/* Descriptor */
+
+/* Determine the type of a value from the first character of its descriptor.
+ * The classes and the arrays are references.
+ */
+static uint8_t zen_StackMapBuilder_getType(const uint8_t* descriptor, int32_t size) {
+    return ((size > 0) && ((descriptor[0] == '(') || (descriptor[0] == '@')))?
+        ZEN_STACK_MAP_BUILDER_TYPE_REFERENCE : ZEN_STACK_MAP_BUILDER_TYPE_PRIMITIVE;
+}
+
+/* Store the types of the parameters described by the specified function
+ * descriptor, unless the types are null. Returns the number of parameters.
+ * The format of the descriptor is described in BinaryEntityGenerator.c.
+ */
+static int32_t zen_StackMapBuilder_getParameterTypes(const uint8_t* descriptor,
+    int32_t size, uint8_t* types) {
+    int32_t result = 0;
+
+    int32_t i = 0;
+    while ((i < size) && (descriptor[i] != ':')) {
+        i++;
+    }
+    i++;
+
+    while (i < size) {
+        uint8_t type = ZEN_STACK_MAP_BUILDER_TYPE_REFERENCE;
+        if ((descriptor[i] == '@') || (descriptor[i] == '(')) {
+            while ((i < size) && (descriptor[i] == '@')) {
+                i++;
+            }
+            if ((i < size) && (descriptor[i] == '(')) {
+                while ((i < size) && (descriptor[i] != ')')) {
+                    i++;
+                }
+            }
+        }
+        else if (descriptor[i] != 'v') {
+            type = ZEN_STACK_MAP_BUILDER_TYPE_PRIMITIVE;
+        }
+        else {
+            /* The 'v' type indicates that there are no parameters. */
+            i++;
+            continue;
+        }
+        i++;
+
+        if (types != NULL) {
+            types[result] = type;
+        }
+        result++;
+    }
+
+    return result;
+}
+
+/* Retrieve the descriptor of the function or field referenced by the specified
+ * constant pool entry. Returns null if the entry has another tag.
+ */
+static zen_ConstantPoolUtf8_t* zen_StackMapBuilder_getDescriptor(zen_ConstantPool_t* constantPool,
+    uint16_t index, uint8_t tag) {
+    if ((index >= constantPool->m_size) || (constantPool->m_entries[index] == NULL) ||
+        (constantPool->m_entries[index]->m_tag != tag)) {
+        return NULL;
+    }
+
+    uint16_t descriptorIndex = (tag == ZEN_CONSTANT_POOL_TAG_FUNCTION)?
+        ((zen_ConstantPoolFunction_t*)constantPool->m_entries[index])->m_descriptorIndex :
+        ((zen_ConstantPoolField_t*)constantPool->m_entries[index])->m_descriptorIndex;
+    if ((descriptorIndex >= constantPool->m_size) || (constantPool->m_entries[descriptorIndex] == NULL) ||
+        (constantPool->m_entries[descriptorIndex]->m_tag != ZEN_CONSTANT_POOL_TAG_UTF8)) {
+        return NULL;
+    }
+
+    return (zen_ConstantPoolUtf8_t*)constantPool->m_entries[descriptorIndex];
+}
+
+/* Decode */
+
+/* Decode the instruction at the specified offset. The byte code, the offset of
+ * the arguments and the index of the local variable accessed by the
+ * instruction, if any, are stored. Returns the number of bytes occupied by
+ * the instruction, or -1 if it is malformed.
+ */
+static int32_t zen_StackMapBuilder_decode(const uint8_t* instructions, int32_t ip,
+    int32_t length, uint8_t* byteCode, int32_t* argumentIndex, int32_t* local) {
+    int32_t start = ip;
+    bool wide = (instructions[ip] == ZEN_BYTE_CODE_WIDE);
+    if (wide) {
+        ip++;
+    }
+
+    if ((ip >= length) || (instructions[ip] > ZEN_BYTE_CODE_WIDE)) {
+        return -1;
+    }
+
+    *byteCode = instructions[ip++];
+    *argumentIndex = ip;
+    const zen_InstructionEffect_t* effect = &zen_InstructionEffect_table[*byteCode];
+
+    int32_t argumentLength = effect->m_argumentLength;
+    if (wide && (effect->m_local == ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT)) {
+        argumentLength *= 2;
+    }
+    if ((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_SWITCH) != 0) {
+        int32_t switchLength = zen_SwitchInstruction_getLength(instructions, start, length);
+        if (wide || (switchLength < 0)) {
+            return -1;
+        }
+        argumentLength = switchLength - 1;
+    }
+    if ((ip + argumentLength) > length) {
+        return -1;
+    }
+
+    *local = effect->m_local;
+    if (*local == ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT) {
+        *local = wide? ((instructions[ip] << 8) | instructions[ip + 1]) : instructions[ip];
+    }
+
+    return ip + argumentLength - start;
+}
+
+/* Merge */
+
+/* Merge the specified state into the state before the instruction at the
+ * target. The target is enqueued if its state changes. Returns false if the
+ * target is out of bounds, or the depths of the operand stack disagree.
+ */
+static bool zen_StackMapBuilder_merge(zen_StackMapSimulation_t* simulation,
+    int32_t target, const uint8_t* state, int32_t depth) {
+    if ((target < 0) || (target >= simulation->m_length)) {
+        return false;
+    }
+
+    int32_t size = simulation->m_localVariableCount + depth;
+    bool changed = false;
+    if (simulation->m_states[target] == NULL) {
+        simulation->m_states[target] = jtk_Memory_allocate(uint8_t, size + 1);
+        memcpy(simulation->m_states[target], state, size);
+        simulation->m_depths[target] = depth;
+        changed = true;
+    }
+    else if (simulation->m_depths[target] != depth) {
+        return false;
+    }
+    else {
+        uint8_t* current = simulation->m_states[target];
+        int32_t i;
+        for (i = 0; i < size; i++) {
+            uint8_t type = current[i] | state[i];
+            if (type != current[i]) {
+                current[i] = type;
+                changed = true;
+            }
+        }
+    }
+
+    if (changed && !simulation->m_enqueued[target]) {
+        simulation->m_enqueued[target] = true;
+        simulation->m_worklist[simulation->m_worklistSize++] = target;
+    }
+
+    return true;
+}
+
+/* Merge the specified state into the targets of the switch instruction at the
+ * specified offset.
+ */
+static bool zen_StackMapBuilder_mergeSwitch(zen_StackMapSimulation_t* simulation,
+    int32_t start, const uint8_t* state, int32_t depth) {
+    const uint8_t* instructions = simulation->m_instructions;
+    int32_t index = zen_SwitchInstruction_getArgumentIndex(start);
+    int32_t defaultOffset = zen_SwitchInstruction_readInteger(instructions + index);
+    if (!zen_StackMapBuilder_merge(simulation, start + defaultOffset, state, depth)) {
+        return false;
+    }
+
+    const uint8_t* offsets;
+    int32_t count;
+    if (instructions[start] == ZEN_BYTE_CODE_SWITCH_TABLE) {
+        int32_t low = zen_SwitchInstruction_readInteger(instructions + index + 4);
+        int32_t high = zen_SwitchInstruction_readInteger(instructions + index + 8);
+        count = high - low + 1;
+        offsets = instructions + index + ZEN_SWITCH_INSTRUCTION_TABLE_HEADER_SIZE;
+    }
+    else {
+        count = zen_SwitchInstruction_readInteger(instructions + index + 4);
+        offsets = instructions + index + ZEN_SWITCH_INSTRUCTION_SEARCH_HEADER_SIZE + (count * 4);
+    }
+
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        int32_t offset = zen_SwitchInstruction_readInteger(offsets + (i * 4));
+        if (!zen_StackMapBuilder_merge(simulation, start + offset, state, depth)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Simulate */
+
+/* Simulate the instruction at the specified offset, given the state before
+ * it. The state is updated in place, and must have room for the operands
+ * pushed by the instruction. Returns the depth of the operand stack after the
+ * instruction, or -1 if the instruction cannot be simulated.
+ */
+static int32_t zen_StackMapBuilder_simulate(zen_StackMapSimulation_t* simulation,
+    zen_ConstantPool_t* constantPool, uint8_t byteCode, int32_t argumentIndex,
+    int32_t local, uint8_t* state, int32_t depth) {
+    const uint8_t* instructions = simulation->m_instructions;
+    const zen_InstructionEffect_t* effect = &zen_InstructionEffect_table[byteCode];
+    uint8_t* locals = state;
+    uint8_t* operands = state + simulation->m_localVariableCount;
+
+    int32_t popCount = effect->m_popCount;
+    int32_t pushCount = effect->m_pushCount;
+    uint8_t type = ((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_REFERENCE) != 0)?
+        ZEN_STACK_MAP_BUILDER_TYPE_REFERENCE : ZEN_STACK_MAP_BUILDER_TYPE_PRIMITIVE;
+
+    /* The duplicate and swap instructions rearrange the operands. The pattern
+     * lists the popped operands which are pushed, from the bottom of the
+     * operand stack.
+     */
+    const char* pattern = NULL;
+    switch (byteCode) {
+        case ZEN_BYTE_CODE_DUPLICATE: {
+            pattern = "00";
+            break;
+        }
+
+        case ZEN_BYTE_CODE_DUPLICATE_X1: {
+            pattern = "101";
+            break;
+        }
+
+        case ZEN_BYTE_CODE_DUPLICATE_X2: {
+            pattern = "2012";
+            break;
+        }
+
+        case ZEN_BYTE_CODE_DUPLICATE2: {
+            pattern = "0101";
+            break;
+        }
+
+        case ZEN_BYTE_CODE_DUPLICATE2_X1: {
+            pattern = "12012";
+            break;
+        }
+
+        case ZEN_BYTE_CODE_DUPLICATE2_X2: {
+            pattern = "230123";
+            break;
+        }
+
+        case ZEN_BYTE_CODE_SWAP: {
+            pattern = "10";
+            break;
+        }
+
+        case ZEN_BYTE_CODE_INVOKE_SPECIAL:
+        case ZEN_BYTE_CODE_INVOKE_VIRTUAL:
+        case ZEN_BYTE_CODE_INVOKE_DYNAMIC:
+        case ZEN_BYTE_CODE_INVOKE_STATIC: {
+            uint16_t index = (instructions[argumentIndex] << 8) | instructions[argumentIndex + 1];
+            zen_ConstantPoolUtf8_t* descriptor = zen_StackMapBuilder_getDescriptor(constantPool,
+                index, ZEN_CONSTANT_POOL_TAG_FUNCTION);
+            if (descriptor == NULL) {
+                return -1;
+            }
+
+            /* The receiver of an instance function is an additional operand. */
+            popCount = zen_StackMapBuilder_getParameterTypes(descriptor->m_bytes,
+                descriptor->m_length, NULL) + ((byteCode != ZEN_BYTE_CODE_INVOKE_STATIC)? 1 : 0);
+            pushCount = ((descriptor->m_length > 0) && (descriptor->m_bytes[0] != 'v'))? 1 : 0;
+            type = zen_StackMapBuilder_getType(descriptor->m_bytes, descriptor->m_length);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD:
+        case ZEN_BYTE_CODE_LOAD_STATIC_FIELD: {
+            uint16_t index = (instructions[argumentIndex] << 8) | instructions[argumentIndex + 1];
+            zen_ConstantPoolUtf8_t* descriptor = zen_StackMapBuilder_getDescriptor(constantPool,
+                index, ZEN_CONSTANT_POOL_TAG_FIELD);
+            if (descriptor == NULL) {
+                return -1;
+            }
+            type = zen_StackMapBuilder_getType(descriptor->m_bytes, descriptor->m_length);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_LOAD_CPR: {
+            uint8_t index = instructions[argumentIndex];
+            if ((index >= constantPool->m_size) || (constantPool->m_entries[index] == NULL)) {
+                return -1;
+            }
+            /* The string constants are interned in the immortal generation,
+             * where they are never moved or collected. Therefore, the
+             * collector need not visit them.
+             */
+            type = ZEN_STACK_MAP_BUILDER_TYPE_PRIMITIVE;
+            break;
+        }
+
+        case ZEN_BYTE_CODE_NEW_ARRAY_AN: {
+            popCount = instructions[argumentIndex + 2];
+            pushCount = 1;
+            break;
+        }
+    }
+
+    if (depth < popCount) {
+        /* The operand stack underflows. */
+        return -1;
+    }
+
+    if (pattern != NULL) {
+        uint8_t popped[4];
+        memcpy(popped, operands + depth - popCount, popCount);
+        depth -= popCount;
+
+        const char* current;
+        for (current = pattern; *current != '\0'; current++) {
+            operands[depth++] = popped[*current - '0'];
+        }
+    }
+    else {
+        depth -= popCount;
+
+        /* A store assigns the type of the value to the local variable. The
+         * `increment_i` instruction assigns an integer.
+         */
+        if ((local >= 0) && (pushCount == 0)) {
+            if (local >= simulation->m_localVariableCount) {
+                return -1;
+            }
+            locals[local] = type;
+        }
+
+        int32_t i;
+        for (i = 0; i < pushCount; i++) {
+            operands[depth++] = type;
+        }
+    }
+
+    return depth;
+}
+
+/* Build */
+
+zen_StackMapTableAttribute_t* zen_StackMapBuilder_build(zen_StackMapBuilder_t* builder,
+    zen_InstructionAttribute_t* instructionAttribute, zen_ConstantPool_t* constantPool,
+    const uint8_t* descriptor, int32_t descriptorSize, bool instance, uint16_t nameIndex) {
+    jtk_Assert_assertObject(builder, "The specified stack map builder is null.");
+    jtk_Assert_assertObject(instructionAttribute, "The specified instruction attribute is null.");
+    jtk_Assert_assertObject(constantPool, "The specified constant pool is null.");
+
+    const uint8_t* instructions = instructionAttribute->m_instructions;
+    int32_t length = instructionAttribute->m_instructionLength;
+    /* The offsets of the entries occupy two bytes. */
+    if ((length == 0) || (length > (UINT16_MAX + 1))) {
+        return NULL;
+    }
+
+    /* The local variables include the parameters, and every local variable
+     * accessed by the instructions.
+     */
+    int32_t parameterCount = zen_StackMapBuilder_getParameterTypes(descriptor,
+        descriptorSize, NULL) + (instance? 1 : 0);
+    int32_t localVariableCount = instructionAttribute->m_localVariableCount;
+    if (parameterCount > localVariableCount) {
+        localVariableCount = parameterCount;
+    }
+
+    int32_t ip = 0;
+    while (ip < length) {
+        uint8_t byteCode;
+        int32_t argumentIndex;
+        int32_t local;
+        int32_t instructionLength = zen_StackMapBuilder_decode(instructions, ip, length,
+            &byteCode, &argumentIndex, &local);
+        if (instructionLength < 0) {
+            return NULL;
+        }
+        if ((local + 1) > localVariableCount) {
+            localVariableCount = local + 1;
+        }
+        ip += instructionLength;
+    }
+    if (localVariableCount > UINT16_MAX) {
+        return NULL;
+    }
+
+    zen_StackMapSimulation_t simulation;
+    simulation.m_instructions = instructions;
+    simulation.m_length = length;
+    simulation.m_localVariableCount = localVariableCount;
+    simulation.m_states = jtk_Memory_allocate(uint8_t*, length);
+    simulation.m_depths = jtk_Memory_allocate(int32_t, length);
+    simulation.m_worklist = jtk_Memory_allocate(int32_t, length);
+    simulation.m_worklistSize = 0;
+    simulation.m_enqueued = jtk_Memory_allocate(bool, length);
+    memset(simulation.m_states, 0, sizeof (uint8_t*) * length);
+    memset(simulation.m_enqueued, 0, sizeof (bool) * length);
+
+    /* The state is large enough for the local variables and the operands
+     * pushed by an instruction. It grows with the operand stack.
+     */
+    int32_t capacity = localVariableCount + 16;
+    uint8_t* state = jtk_Memory_allocate(uint8_t, capacity);
+    uint8_t* handlerState = jtk_Memory_allocate(uint8_t, capacity);
+
+    /* The parameters are the only local variables assigned on entry. */
+    memset(state, ZEN_STACK_MAP_BUILDER_TYPE_NONE, localVariableCount);
+    if (instance) {
+        state[0] = ZEN_STACK_MAP_BUILDER_TYPE_REFERENCE;
+    }
+    zen_StackMapBuilder_getParameterTypes(descriptor, descriptorSize,
+        state + (instance? 1 : 0));
+    zen_StackMapBuilder_merge(&simulation, 0, state, 0);
+
+    zen_ExceptionTable_t* exceptionTable = &instructionAttribute->m_exceptionTable;
+    bool valid = true;
+    while (valid && (simulation.m_worklistSize > 0)) {
+        int32_t start = simulation.m_worklist[--simulation.m_worklistSize];
+        simulation.m_enqueued[start] = false;
+
+        int32_t depth = simulation.m_depths[start];
+        if ((localVariableCount + depth + ZEN_STACK_MAP_BUILDER_MAX_GROWTH) > capacity) {
+            jtk_Memory_deallocate(state);
+            jtk_Memory_deallocate(handlerState);
+            capacity = (localVariableCount + depth) * 2 + 16;
+            state = jtk_Memory_allocate(uint8_t, capacity);
+            handlerState = jtk_Memory_allocate(uint8_t, capacity);
+        }
+        memcpy(state, simulation.m_states[start], localVariableCount + depth);
+
+        /* The exception handlers which protect the instruction begin with the
+         * exception on the operand stack. The local variables may hold the
+         * values assigned before any of the protected instructions.
+         */
+        int32_t i;
+        for (i = 0; i < exceptionTable->m_size; i++) {
+            zen_ExceptionHandlerSite_t* site = exceptionTable->m_exceptionHandlerSites[i];
+            if ((start >= site->m_startIndex) && (start < site->m_stopIndex)) {
+                memcpy(handlerState, state, localVariableCount);
+                handlerState[localVariableCount] = ZEN_STACK_MAP_BUILDER_TYPE_REFERENCE;
+                if (!zen_StackMapBuilder_merge(&simulation, site->m_handlerIndex, handlerState, 1)) {
+                    valid = false;
+                }
+            }
+        }
+
+        uint8_t byteCode;
+        int32_t argumentIndex;
+        int32_t local;
+        int32_t instructionLength = zen_StackMapBuilder_decode(instructions, start, length,
+            &byteCode, &argumentIndex, &local);
+        if (!valid || (instructionLength < 0)) {
+            /* A branch may target the middle of an instruction. */
+            valid = false;
+            break;
+        }
+        depth = zen_StackMapBuilder_simulate(&simulation, constantPool, byteCode,
+            argumentIndex, local, state, depth);
+        if ((depth < 0) || (depth > UINT16_MAX)) {
+            valid = false;
+            break;
+        }
+
+        const zen_InstructionEffect_t* effect = &zen_InstructionEffect_table[byteCode];
+        if ((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_BRANCH) != 0) {
+            /* The offset is relative to the first byte of the instruction. */
+            int16_t offset = (int16_t)((instructions[argumentIndex] << 8) | instructions[argumentIndex + 1]);
+            valid = zen_StackMapBuilder_merge(&simulation, start + offset, state, depth);
+        }
+        else if ((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_SWITCH) != 0) {
+            valid = zen_StackMapBuilder_mergeSwitch(&simulation, start, state, depth);
+        }
+
+        /* A function which runs off the end of its instructions returns to
+         * its caller.
+         */
+        int32_t next = start + instructionLength;
+        if (valid && ((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_TERMINAL) == 0) &&
+            (next < length)) {
+            valid = zen_StackMapBuilder_merge(&simulation, next, state, depth);
+        }
+    }
+
+    zen_StackMapTableAttribute_t* attribute = NULL;
+    if (valid) {
+        int32_t size = 0;
+        int32_t bitmapsSize = 0;
+        for (ip = 0; ip < length; ip++) {
+            if (simulation.m_states[ip] != NULL) {
+                size++;
+                bitmapsSize += zen_StackMapTableAttribute_getBitmapSize(localVariableCount,
+                    simulation.m_depths[ip]);
+            }
+        }
+
+        attribute = zen_StackMapTableAttribute_new(nameIndex, localVariableCount,
+            size, bitmapsSize);
+        uint8_t* bitmap = attribute->m_bitmaps;
+        int32_t index = 0;
+        for (ip = 0; ip < length; ip++) {
+            uint8_t* types = simulation.m_states[ip];
+            if (types != NULL) {
+                zen_StackMapEntry_t* entry = &attribute->m_entries[index++];
+                entry->m_offset = ip;
+                entry->m_operandCount = simulation.m_depths[ip];
+                entry->m_bitmap = bitmap;
+
+                int32_t slotCount = localVariableCount + simulation.m_depths[ip];
+                int32_t slot;
+                for (slot = 0; slot < slotCount; slot++) {
+                    if (types[slot] == ZEN_STACK_MAP_BUILDER_TYPE_REFERENCE) {
+                        bitmap[slot >> 3] |= (1 << (slot & 7));
+                    }
+                }
+                bitmap += zen_StackMapTableAttribute_getBitmapSize(localVariableCount,
+                    simulation.m_depths[ip]);
+            }
+        }
+    }
+
+    for (ip = 0; ip < length; ip++) {
+        if (simulation.m_states[ip] != NULL) {
+            jtk_Memory_deallocate(simulation.m_states[ip]);
+        }
+    }
+    jtk_Memory_deallocate(handlerState);
+    jtk_Memory_deallocate(state);
+    jtk_Memory_deallocate(simulation.m_enqueued);
+    jtk_Memory_deallocate(simulation.m_worklist);
+    jtk_Memory_deallocate(simulation.m_depths);
+    jtk_Memory_deallocate(simulation.m_states);
+
+    return attribute;
+}
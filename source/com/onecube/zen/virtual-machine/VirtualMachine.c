@@ -22,7 +22,7 @@
 #include <com/onecube/zen/virtual-machine/ExceptionManager.h>
 
 void zen_print(jtk_Array_t* arguments) {
-    jtk_CString_t* format = (jtk_CString_t*)jtk_Array_getValue(arguments, 0);
+    zen_String_t* format = (zen_String_t*)jtk_Array_getValue(arguments, 0);
     fwrite(format->m_value, 1, format->m_size, stdout);
     fflush(stdout);
 }
@@ -31,6 +31,14 @@ void zen_print(jtk_Array_t* arguments) {
  * VirtualMachine                                                              *
  *******************************************************************************/
 
+/* Roots */
+
+static void zen_VirtualMachine_enumerateRoots(void* context, zen_RootVisitor_t* visitor) {
+    zen_VirtualMachine_t* virtualMachine = (zen_VirtualMachine_t*)context;
+    zen_ProcessorThread_visitRoots(virtualMachine->m_mainThread, visitor);
+    zen_ClassLoader_visitRoots(virtualMachine->m_classLoader, visitor);
+}
+
 /* Constructor */
 
 zen_VirtualMachine_t* zen_VirtualMachine_new(zen_VirtualMachineConfiguration_t* configuration) {
@@ -41,11 +49,44 @@ zen_VirtualMachine_t* zen_VirtualMachine_new(zen_VirtualMachineConfiguration_t*
 
     zen_VirtualMachine_t* virtualMachine = zen_Memory_allocate(zen_VirtualMachine_t, 1);
     virtualMachine->m_configuration = configuration;
-    virtualMachine->m_entityLoader = zen_EntityLoader_newWithEntityDirectories(entityDirectoryIterator);
+    virtualMachine->m_memoryManager = zen_MemoryManager_new();
+    virtualMachine->m_entityLoader = zen_EntityLoader_newWithEntityDirectories(entityDirectoryIterator,
+        virtualMachine->m_memoryManager->m_immortalGeneration);
     virtualMachine->m_classLoader = zen_ClassLoader_new(virtualMachine->m_entityLoader);
-    virtualMachine->m_interpreter = zen_Interpreter_new(NULL, virtualMachine, NULL);
+    virtualMachine->m_stringTable = zen_StringTable_new(
+        virtualMachine->m_memoryManager->m_immortalGeneration);
+    virtualMachine->m_mainThread = zen_ProcessorThread_new(virtualMachine->m_memoryManager);
+    zen_MemoryManager_setRootEnumerator(virtualMachine->m_memoryManager,
+        zen_VirtualMachine_enumerateRoots, virtualMachine);
+    zen_MemoryManager_setTenuringThreshold(virtualMachine->m_memoryManager,
+        zen_VirtualMachineConfiguration_getIntegerVariable(configuration,
+            "zen.memory.tenuringThreshold",
+            ZEN_COPYING_GARBAGE_COLLECTOR_DEFAULT_TENURING_THRESHOLD));
+    zen_MemoryManager_setMarkingWorkerCount(virtualMachine->m_memoryManager,
+        zen_VirtualMachineConfiguration_getIntegerVariable(configuration,
+            "zen.memory.markingWorkerCount",
+            ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_DEFAULT_WORKER_COUNT));
+    zen_MemoryManager_setConcurrentMarkingEnabled(virtualMachine->m_memoryManager,
+        zen_VirtualMachineConfiguration_getIntegerVariable(configuration,
+            "zen.memory.concurrentMarking", 0) != 0);
+    zen_MemoryManager_setInitiatingOccupancy(virtualMachine->m_memoryManager,
+        zen_VirtualMachineConfiguration_getIntegerVariable(configuration,
+            "zen.memory.initiatingOccupancy",
+            ZEN_CONCURRENT_MARKER_DEFAULT_INITIATING_OCCUPANCY));
+    zen_MemoryManager_setLargeObjectThreshold(virtualMachine->m_memoryManager,
+        zen_VirtualMachineConfiguration_getIntegerVariable(configuration,
+            "zen.memory.largeObjectThreshold",
+            ZEN_LARGE_OBJECT_SPACE_DEFAULT_THRESHOLD));
+    virtualMachine->m_interpreter = zen_Interpreter_new(virtualMachine->m_memoryManager,
+        virtualMachine, virtualMachine->m_mainThread);
     virtualMachine->m_nativeFunctions = jtk_HashMap_newEx(stringObjectAdapter, NULL,
         JTK_HASH_MAP_DEFAULT_CAPACITY, JTK_HASH_MAP_DEFAULT_LOAD_FACTOR);
+#ifdef ZEN_JIT
+    virtualMachine->m_compiler = zen_TemplateCompiler_new(
+        virtualMachine->m_memoryManager->m_safepoint);
+#else
+    virtualMachine->m_compiler = NULL;
+#endif
 
     zen_VirtualMachine_loadDefaultLibraries(virtualMachine);
 
@@ -59,8 +100,18 @@ void zen_VirtualMachine_delete(zen_VirtualMachine_t* virtualMachine) {
 
     zen_VirtualMachine_unloadLibraries(virtualMachine);
 
+    zen_Interpreter_delete(virtualMachine->m_interpreter);
+    if (virtualMachine->m_compiler != NULL) {
+        zen_TemplateCompiler_delete(virtualMachine->m_compiler);
+    }
+    zen_ProcessorThread_delete(virtualMachine->m_mainThread);
+    zen_StringTable_delete(virtualMachine->m_stringTable);
+    /* The classes are destroyed before the entity files, whose arenas hold
+     * them. The arenas belong to the immortal generation.
+     */
     zen_ClassLoader_delete(virtualMachine->m_classLoader);
     zen_EntityLoader_delete(virtualMachine->m_entityLoader);
+    zen_MemoryManager_delete(virtualMachine->m_memoryManager);
     jtk_Memory_deallocate(virtualMachine);
 }
 
@@ -246,7 +297,7 @@ void zen_VirtualMachine_raiseException(zen_VirtualMachine_t* virtualMachine,
 /* Static Function */
 
 zen_Function_t* zen_VirtualMachine_getStaticFunction(zen_VirtualMachine_t* virtualMachine,
-    zen_Class_t* handle, const uint8_t* identifier, const uint8_t* signature) {
+    zen_Class_t* handle, jtk_String_t* identifier, jtk_String_t* signature) {
     jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
     jtk_Assert_assertObject(handle, "The specified class is null.");
     jtk_Assert_assertObject(identifier, "The specified identifier is null.");
@@ -254,7 +305,8 @@ zen_Function_t* zen_VirtualMachine_getStaticFunction(zen_VirtualMachine_t* virtu
 
     zen_Function_t* function = zen_Class_getStaticFunction(handle, identifier, signature);
     if (function == NULL) {
-        zen_VirtualMachine_raiseFunctionNotFoundException(virtualMachine, identifier, signature);
+        zen_VirtualMachine_raiseFunctionNotFoundException(virtualMachine, identifier->m_value,
+            signature->m_value);
     }
     return function;
 }
@@ -314,6 +366,15 @@ void zen_VirtualMachine_shutDown(zen_VirtualMachine_t* virtualMachine) {
 }
 
 void zen_VirtualMachine_waitForThreads(zen_VirtualMachine_t* virtualMachine) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+
+    /* The main thread waits in a safe region, so that the other threads can
+     * collect the heap in the meantime.
+     */
+    zen_Safepoint_t* safepoint = virtualMachine->m_memoryManager->m_safepoint;
+    zen_Safepoint_enterSafeRegion(safepoint);
+    zen_Safepoint_waitForThreads(safepoint, 1);
+    zen_Safepoint_leaveSafeRegion(safepoint);
 }
 
 void zen_VirtualMachine_notifyShutDown(zen_VirtualMachine_t* virtualMachine) {
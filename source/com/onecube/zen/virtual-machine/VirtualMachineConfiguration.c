@@ -16,6 +16,8 @@
 
 // Friday, June 08, 2018
 
+#include <stdlib.h>
+
 #include <jtk/core/StringObjectAdapter.h>
 #include <com/onecube/zen/virtual-machine/VirtualMachineConfiguration.h>
 
@@ -59,4 +61,27 @@ void zen_VirtualMachineConfiguration_addEntityDirectory(
     
     jtk_CString_t* directoryAsString = jtk_CString_new(directory);
     jtk_ArrayList_add(virtualMachine->m_entityDirectories, directoryAsString);
+}
+
+/* Variable */
+
+int32_t zen_VirtualMachineConfiguration_getIntegerVariable(
+    zen_VirtualMachineConfiguration_t* configuration, const uint8_t* name,
+    int32_t defaultValue) {
+    jtk_Assert_assertObject(configuration, "The specified virtual machine configuration is null.");
+    jtk_Assert_assertObject(name, "The specified variable name is null.");
+
+    int32_t result = defaultValue;
+    jtk_CString_t* key = jtk_CString_new(name);
+    const uint8_t* value = (const uint8_t*)jtk_HashMap_getValue(configuration->m_variables,
+        key);
+    jtk_CString_delete(key);
+    if (value != NULL) {
+        char* end = NULL;
+        long integer = strtol((const char*)value, &end, 10);
+        if ((end != (const char*)value) && (*end == '\0')) {
+            result = (int32_t)integer;
+        }
+    }
+    return result;
 }
\ No newline at end of file
@@ -24,7 +24,7 @@
  
 zen_ConstantPoolUtf8_t* zen_ConstantPool_resolveUtf8(zen_ConstantPool_t* constantPool,
     uint16_t index) {
-    return constantPool->m_entries[index];
+    return (zen_ConstantPoolUtf8_t*)constantPool->m_entries[index];
 }
 
 void* zen_ConstantPool_getEntry(zen_ConstantPool_t* constantPool, int32_t index) {
@@ -46,7 +46,7 @@ int32_t zen_ConstantPoolInteger_getValue(zen_ConstantPoolInteger_t* entry) {
 }
 
 int64_t zen_ConstantPoolLong_getValue(zen_ConstantPoolLong_t* entry) {
-    return ((entry->m_highBytes << 32L) | entry->m_lowBytes);
+    return (int64_t)(((uint64_t)entry->m_highBytes << 32) | entry->m_lowBytes);
 }
 
 float zen_ConstantPoolFloat_getValue(zen_ConstantPoolFloat_t* entry) {
@@ -54,5 +54,5 @@ float zen_ConstantPoolFloat_getValue(zen_ConstantPoolFloat_t* entry) {
 }
 
 double zen_ConstantPoolDouble_getValue(zen_ConstantPoolDouble_t* entry) {
-    return jtk_Double_pack((entry->m_highBytes << 32L) | entry->m_lowBytes);
+    return jtk_Double_pack(((uint64_t)entry->m_highBytes << 32) | entry->m_lowBytes);
 }
\ No newline at end of file
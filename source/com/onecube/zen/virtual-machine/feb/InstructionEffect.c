@@ -0,0 +1,348 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <com/onecube/zen/virtual-machine/feb/InstructionEffect.h>
+
+/*******************************************************************************
+ * InstructionEffect                                                           *
+ *******************************************************************************/
+
+#define ZEN_INSTRUCTION_EFFECT(argumentLength, popCount, pushCount) \
+    { argumentLength, popCount, pushCount, ZEN_INSTRUCTION_EFFECT_LOCAL_NONE, 0 }
+
+#define ZEN_INSTRUCTION_EFFECT_EX(argumentLength, popCount, pushCount, local, flags) \
+    { argumentLength, popCount, pushCount, local, flags }
+
+#define ZEN_INSTRUCTION_EFFECT_REFERENCE(argumentLength, popCount, pushCount) \
+    { argumentLength, popCount, pushCount, ZEN_INSTRUCTION_EFFECT_LOCAL_NONE, \
+        ZEN_INSTRUCTION_EFFECT_FLAG_REFERENCE }
+
+#define ZEN_INSTRUCTION_EFFECT_BRANCH(popCount) \
+    ZEN_INSTRUCTION_EFFECT_EX(2, popCount, 0, ZEN_INSTRUCTION_EFFECT_LOCAL_NONE, \
+        ZEN_INSTRUCTION_EFFECT_FLAG_BRANCH)
+
+#define ZEN_INSTRUCTION_EFFECT_LOAD(local) \
+    ZEN_INSTRUCTION_EFFECT_EX(((local) == ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT)? 1 : 0, \
+        0, 1, local, 0)
+
+#define ZEN_INSTRUCTION_EFFECT_STORE(local) \
+    ZEN_INSTRUCTION_EFFECT_EX(((local) == ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT)? 1 : 0, \
+        1, 0, local, 0)
+
+#define ZEN_INSTRUCTION_EFFECT_LOAD_REFERENCE(local) \
+    ZEN_INSTRUCTION_EFFECT_EX(((local) == ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT)? 1 : 0, \
+        0, 1, local, ZEN_INSTRUCTION_EFFECT_FLAG_REFERENCE)
+
+#define ZEN_INSTRUCTION_EFFECT_STORE_REFERENCE(local) \
+    ZEN_INSTRUCTION_EFFECT_EX(((local) == ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT)? 1 : 0, \
+        1, 0, local, ZEN_INSTRUCTION_EFFECT_FLAG_REFERENCE)
+
+#define ZEN_INSTRUCTION_EFFECT_RETURN(popCount) \
+    ZEN_INSTRUCTION_EFFECT_EX(0, popCount, 0, ZEN_INSTRUCTION_EFFECT_LOCAL_NONE, \
+        ZEN_INSTRUCTION_EFFECT_FLAG_TERMINAL)
+
+#define ZEN_INSTRUCTION_EFFECT_VARIABLE(argumentLength) \
+    ZEN_INSTRUCTION_EFFECT_EX(argumentLength, 0, 0, ZEN_INSTRUCTION_EFFECT_LOCAL_NONE, \
+        ZEN_INSTRUCTION_EFFECT_FLAG_VARIABLE)
+
+#define ZEN_INSTRUCTION_EFFECT_SWITCH \
+    ZEN_INSTRUCTION_EFFECT_EX(0, 1, 0, ZEN_INSTRUCTION_EFFECT_LOCAL_NONE, \
+        ZEN_INSTRUCTION_EFFECT_FLAG_SWITCH | ZEN_INSTRUCTION_EFFECT_FLAG_TERMINAL)
+
+#define ZEN_INSTRUCTION_EFFECT_BINARY ZEN_INSTRUCTION_EFFECT(0, 2, 1)
+#define ZEN_INSTRUCTION_EFFECT_UNARY ZEN_INSTRUCTION_EFFECT(0, 1, 1)
+#define ZEN_INSTRUCTION_EFFECT_PUSH ZEN_INSTRUCTION_EFFECT(0, 0, 1)
+
+const zen_InstructionEffect_t zen_InstructionEffect_table[ZEN_BYTE_CODE_WIDE + 1] = {
+    [ZEN_BYTE_CODE_NOP] = ZEN_INSTRUCTION_EFFECT(0, 0, 0),
+
+    /* Arithmetic, Bitwise and Shift */
+
+    [ZEN_BYTE_CODE_ADD_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_ADD_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_ADD_F] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_ADD_D] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_AND_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_AND_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_OR_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_OR_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_SHIFT_LEFT_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_SHIFT_LEFT_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_SHIFT_RIGHT_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_SHIFT_RIGHT_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_SHIFT_RIGHT_UI] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_SHIFT_RIGHT_UL] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_XOR_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_XOR_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+
+    /* Cast */
+
+    [ZEN_BYTE_CODE_CAST_ITB] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_ITS] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_ITL] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_ITF] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_ITD] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_LTB] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_LTS] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_LTI] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_LTF] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_LTD] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_FTI] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_FTL] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_FTD] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_DTI] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_DTL] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_DTF] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CAST_ITC] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_CHECK_CAST] = ZEN_INSTRUCTION_EFFECT_REFERENCE(2, 1, 1),
+
+    /* Compare */
+
+    [ZEN_BYTE_CODE_COMPARE_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_COMPARE_LT_F] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_COMPARE_GT_F] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_COMPARE_LT_D] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_COMPARE_GT_D] = ZEN_INSTRUCTION_EFFECT_BINARY,
+
+    /* Divide */
+
+    [ZEN_BYTE_CODE_DIVIDE_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_DIVIDE_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_DIVIDE_F] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_DIVIDE_D] = ZEN_INSTRUCTION_EFFECT_BINARY,
+
+    /* Duplicate */
+
+    [ZEN_BYTE_CODE_DUPLICATE] = ZEN_INSTRUCTION_EFFECT(0, 1, 2),
+    [ZEN_BYTE_CODE_DUPLICATE_X1] = ZEN_INSTRUCTION_EFFECT(0, 2, 3),
+    [ZEN_BYTE_CODE_DUPLICATE_X2] = ZEN_INSTRUCTION_EFFECT(0, 3, 4),
+    [ZEN_BYTE_CODE_DUPLICATE2] = ZEN_INSTRUCTION_EFFECT(0, 2, 4),
+    [ZEN_BYTE_CODE_DUPLICATE2_X1] = ZEN_INSTRUCTION_EFFECT(0, 3, 5),
+    [ZEN_BYTE_CODE_DUPLICATE2_X2] = ZEN_INSTRUCTION_EFFECT(0, 4, 6),
+
+    /* Jump */
+
+    [ZEN_BYTE_CODE_JUMP_EQ0_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(1),
+    [ZEN_BYTE_CODE_JUMP_NE0_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(1),
+    [ZEN_BYTE_CODE_JUMP_LT0_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(1),
+    [ZEN_BYTE_CODE_JUMP_GT0_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(1),
+    [ZEN_BYTE_CODE_JUMP_LE0_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(1),
+    [ZEN_BYTE_CODE_JUMP_GE0_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(1),
+    [ZEN_BYTE_CODE_JUMP_EQ_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(2),
+    [ZEN_BYTE_CODE_JUMP_NE_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(2),
+    [ZEN_BYTE_CODE_JUMP_LT_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(2),
+    [ZEN_BYTE_CODE_JUMP_GT_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(2),
+    [ZEN_BYTE_CODE_JUMP_LE_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(2),
+    [ZEN_BYTE_CODE_JUMP_GE_I] = ZEN_INSTRUCTION_EFFECT_BRANCH(2),
+    [ZEN_BYTE_CODE_JUMP_EQ_A] = ZEN_INSTRUCTION_EFFECT_BRANCH(2),
+    [ZEN_BYTE_CODE_JUMP_NE_A] = ZEN_INSTRUCTION_EFFECT_BRANCH(2),
+    [ZEN_BYTE_CODE_JUMP_EQN_A] = ZEN_INSTRUCTION_EFFECT_BRANCH(1),
+    [ZEN_BYTE_CODE_JUMP_NEN_A] = ZEN_INSTRUCTION_EFFECT_BRANCH(1),
+
+    /* Increment */
+
+    [ZEN_BYTE_CODE_INCREMENT_I] = ZEN_INSTRUCTION_EFFECT_EX(2, 0, 0,
+        ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT, 0),
+
+    /* Invoke */
+
+    [ZEN_BYTE_CODE_INVOKE_SPECIAL] = ZEN_INSTRUCTION_EFFECT_VARIABLE(2),
+    [ZEN_BYTE_CODE_INVOKE_VIRTUAL] = ZEN_INSTRUCTION_EFFECT_VARIABLE(2),
+    [ZEN_BYTE_CODE_INVOKE_DYNAMIC] = ZEN_INSTRUCTION_EFFECT_VARIABLE(2),
+    [ZEN_BYTE_CODE_INVOKE_STATIC] = ZEN_INSTRUCTION_EFFECT_VARIABLE(2),
+
+    [ZEN_BYTE_CODE_JUMP] = ZEN_INSTRUCTION_EFFECT_EX(2, 0, 0,
+        ZEN_INSTRUCTION_EFFECT_LOCAL_NONE,
+        ZEN_INSTRUCTION_EFFECT_FLAG_BRANCH | ZEN_INSTRUCTION_EFFECT_FLAG_TERMINAL),
+
+    /* Load */
+
+    [ZEN_BYTE_CODE_LOAD_I] = ZEN_INSTRUCTION_EFFECT_LOAD(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_LOAD_L] = ZEN_INSTRUCTION_EFFECT_LOAD(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_LOAD_F] = ZEN_INSTRUCTION_EFFECT_LOAD(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_LOAD_D] = ZEN_INSTRUCTION_EFFECT_LOAD(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_LOAD_A] = ZEN_INSTRUCTION_EFFECT_LOAD_REFERENCE(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_LOAD_I0] = ZEN_INSTRUCTION_EFFECT_LOAD(0),
+    [ZEN_BYTE_CODE_LOAD_I1] = ZEN_INSTRUCTION_EFFECT_LOAD(1),
+    [ZEN_BYTE_CODE_LOAD_I2] = ZEN_INSTRUCTION_EFFECT_LOAD(2),
+    [ZEN_BYTE_CODE_LOAD_I3] = ZEN_INSTRUCTION_EFFECT_LOAD(3),
+    [ZEN_BYTE_CODE_LOAD_L0] = ZEN_INSTRUCTION_EFFECT_LOAD(0),
+    [ZEN_BYTE_CODE_LOAD_L1] = ZEN_INSTRUCTION_EFFECT_LOAD(1),
+    [ZEN_BYTE_CODE_LOAD_L2] = ZEN_INSTRUCTION_EFFECT_LOAD(2),
+    [ZEN_BYTE_CODE_LOAD_L3] = ZEN_INSTRUCTION_EFFECT_LOAD(3),
+    [ZEN_BYTE_CODE_LOAD_F0] = ZEN_INSTRUCTION_EFFECT_LOAD(0),
+    [ZEN_BYTE_CODE_LOAD_F1] = ZEN_INSTRUCTION_EFFECT_LOAD(1),
+    [ZEN_BYTE_CODE_LOAD_F2] = ZEN_INSTRUCTION_EFFECT_LOAD(2),
+    [ZEN_BYTE_CODE_LOAD_F3] = ZEN_INSTRUCTION_EFFECT_LOAD(3),
+    [ZEN_BYTE_CODE_LOAD_D0] = ZEN_INSTRUCTION_EFFECT_LOAD(0),
+    [ZEN_BYTE_CODE_LOAD_D1] = ZEN_INSTRUCTION_EFFECT_LOAD(1),
+    [ZEN_BYTE_CODE_LOAD_D2] = ZEN_INSTRUCTION_EFFECT_LOAD(2),
+    [ZEN_BYTE_CODE_LOAD_D3] = ZEN_INSTRUCTION_EFFECT_LOAD(3),
+    [ZEN_BYTE_CODE_LOAD_A0] = ZEN_INSTRUCTION_EFFECT_LOAD_REFERENCE(0),
+    [ZEN_BYTE_CODE_LOAD_A1] = ZEN_INSTRUCTION_EFFECT_LOAD_REFERENCE(1),
+    [ZEN_BYTE_CODE_LOAD_A2] = ZEN_INSTRUCTION_EFFECT_LOAD_REFERENCE(2),
+    [ZEN_BYTE_CODE_LOAD_A3] = ZEN_INSTRUCTION_EFFECT_LOAD_REFERENCE(3),
+    [ZEN_BYTE_CODE_LOAD_AB] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_LOAD_AC] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_LOAD_AS] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_LOAD_AI] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_LOAD_AL] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_LOAD_AF] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_LOAD_AD] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_LOAD_AA] = ZEN_INSTRUCTION_EFFECT_REFERENCE(0, 2, 1),
+    [ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD] = ZEN_INSTRUCTION_EFFECT(2, 1, 1),
+    [ZEN_BYTE_CODE_LOAD_STATIC_FIELD] = ZEN_INSTRUCTION_EFFECT(2, 0, 1),
+    [ZEN_BYTE_CODE_LOAD_CPR] = ZEN_INSTRUCTION_EFFECT(1, 0, 1),
+    [ZEN_BYTE_CODE_LOAD_ARRAY_SIZE] = ZEN_INSTRUCTION_EFFECT_UNARY,
+
+    /* Modulo */
+
+    [ZEN_BYTE_CODE_MODULO_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_MODULO_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_MODULO_F] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_MODULO_D] = ZEN_INSTRUCTION_EFFECT_BINARY,
+
+    /* Multiply */
+
+    [ZEN_BYTE_CODE_MULTIPLY_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_MULTIPLY_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_MULTIPLY_F] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_MULTIPLY_D] = ZEN_INSTRUCTION_EFFECT_BINARY,
+
+    /* Negate */
+
+    [ZEN_BYTE_CODE_NEGATE_I] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_NEGATE_L] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_NEGATE_F] = ZEN_INSTRUCTION_EFFECT_UNARY,
+    [ZEN_BYTE_CODE_NEGATE_D] = ZEN_INSTRUCTION_EFFECT_UNARY,
+
+    /* New */
+
+    [ZEN_BYTE_CODE_NEW] = ZEN_INSTRUCTION_EFFECT_REFERENCE(2, 0, 1),
+    [ZEN_BYTE_CODE_NEW_ARRAY] = ZEN_INSTRUCTION_EFFECT_REFERENCE(1, 1, 1),
+    [ZEN_BYTE_CODE_NEW_ARRAY_A] = ZEN_INSTRUCTION_EFFECT_REFERENCE(2, 1, 1),
+    [ZEN_BYTE_CODE_NEW_ARRAY_AN] = ZEN_INSTRUCTION_EFFECT_EX(3, 0, 0,
+        ZEN_INSTRUCTION_EFFECT_LOCAL_NONE,
+        ZEN_INSTRUCTION_EFFECT_FLAG_VARIABLE | ZEN_INSTRUCTION_EFFECT_FLAG_REFERENCE),
+
+    /* Pop */
+
+    [ZEN_BYTE_CODE_POP] = ZEN_INSTRUCTION_EFFECT(0, 1, 0),
+    [ZEN_BYTE_CODE_POP2] = ZEN_INSTRUCTION_EFFECT(0, 2, 0),
+
+    /* Push */
+
+    [ZEN_BYTE_CODE_PUSH_NULL] = ZEN_INSTRUCTION_EFFECT_REFERENCE(0, 0, 1),
+    [ZEN_BYTE_CODE_PUSH_IN1] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_I0] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_I1] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_I2] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_I3] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_I4] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_I5] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_L0] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_L1] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_L2] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_F0] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_F1] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_F2] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_D0] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_D1] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_D2] = ZEN_INSTRUCTION_EFFECT_PUSH,
+    [ZEN_BYTE_CODE_PUSH_B] = ZEN_INSTRUCTION_EFFECT(1, 0, 1),
+    [ZEN_BYTE_CODE_PUSH_S] = ZEN_INSTRUCTION_EFFECT(2, 0, 1),
+
+    /* Return */
+
+    [ZEN_BYTE_CODE_RETURN] = ZEN_INSTRUCTION_EFFECT_RETURN(0),
+    [ZEN_BYTE_CODE_RETURN_I] = ZEN_INSTRUCTION_EFFECT_RETURN(1),
+    [ZEN_BYTE_CODE_RETURN_L] = ZEN_INSTRUCTION_EFFECT_RETURN(1),
+    [ZEN_BYTE_CODE_RETURN_F] = ZEN_INSTRUCTION_EFFECT_RETURN(1),
+    [ZEN_BYTE_CODE_RETURN_D] = ZEN_INSTRUCTION_EFFECT_RETURN(1),
+    [ZEN_BYTE_CODE_RETURN_A] = ZEN_INSTRUCTION_EFFECT_RETURN(1),
+
+    /* RTTI */
+
+    [ZEN_BYTE_CODE_RTTI] = ZEN_INSTRUCTION_EFFECT(2, 1, 1),
+
+    /* Store */
+
+    [ZEN_BYTE_CODE_STORE_I] = ZEN_INSTRUCTION_EFFECT_STORE(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_STORE_I0] = ZEN_INSTRUCTION_EFFECT_STORE(0),
+    [ZEN_BYTE_CODE_STORE_I1] = ZEN_INSTRUCTION_EFFECT_STORE(1),
+    [ZEN_BYTE_CODE_STORE_I2] = ZEN_INSTRUCTION_EFFECT_STORE(2),
+    [ZEN_BYTE_CODE_STORE_I3] = ZEN_INSTRUCTION_EFFECT_STORE(3),
+    [ZEN_BYTE_CODE_STORE_L] = ZEN_INSTRUCTION_EFFECT_STORE(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_STORE_L0] = ZEN_INSTRUCTION_EFFECT_STORE(0),
+    [ZEN_BYTE_CODE_STORE_L1] = ZEN_INSTRUCTION_EFFECT_STORE(1),
+    [ZEN_BYTE_CODE_STORE_L2] = ZEN_INSTRUCTION_EFFECT_STORE(2),
+    [ZEN_BYTE_CODE_STORE_L3] = ZEN_INSTRUCTION_EFFECT_STORE(3),
+    [ZEN_BYTE_CODE_STORE_F] = ZEN_INSTRUCTION_EFFECT_STORE(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_STORE_F0] = ZEN_INSTRUCTION_EFFECT_STORE(0),
+    [ZEN_BYTE_CODE_STORE_F1] = ZEN_INSTRUCTION_EFFECT_STORE(1),
+    [ZEN_BYTE_CODE_STORE_F2] = ZEN_INSTRUCTION_EFFECT_STORE(2),
+    [ZEN_BYTE_CODE_STORE_F3] = ZEN_INSTRUCTION_EFFECT_STORE(3),
+    [ZEN_BYTE_CODE_STORE_D] = ZEN_INSTRUCTION_EFFECT_STORE(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_STORE_D0] = ZEN_INSTRUCTION_EFFECT_STORE(0),
+    [ZEN_BYTE_CODE_STORE_D1] = ZEN_INSTRUCTION_EFFECT_STORE(1),
+    [ZEN_BYTE_CODE_STORE_D2] = ZEN_INSTRUCTION_EFFECT_STORE(2),
+    [ZEN_BYTE_CODE_STORE_D3] = ZEN_INSTRUCTION_EFFECT_STORE(3),
+    [ZEN_BYTE_CODE_STORE_A] = ZEN_INSTRUCTION_EFFECT_STORE_REFERENCE(ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT),
+    [ZEN_BYTE_CODE_STORE_A0] = ZEN_INSTRUCTION_EFFECT_STORE_REFERENCE(0),
+    [ZEN_BYTE_CODE_STORE_A1] = ZEN_INSTRUCTION_EFFECT_STORE_REFERENCE(1),
+    [ZEN_BYTE_CODE_STORE_A2] = ZEN_INSTRUCTION_EFFECT_STORE_REFERENCE(2),
+    [ZEN_BYTE_CODE_STORE_A3] = ZEN_INSTRUCTION_EFFECT_STORE_REFERENCE(3),
+    [ZEN_BYTE_CODE_STORE_AB] = ZEN_INSTRUCTION_EFFECT(0, 3, 0),
+    [ZEN_BYTE_CODE_STORE_AC] = ZEN_INSTRUCTION_EFFECT(0, 3, 0),
+    [ZEN_BYTE_CODE_STORE_AS] = ZEN_INSTRUCTION_EFFECT(0, 3, 0),
+    [ZEN_BYTE_CODE_STORE_AI] = ZEN_INSTRUCTION_EFFECT(0, 3, 0),
+    [ZEN_BYTE_CODE_STORE_AL] = ZEN_INSTRUCTION_EFFECT(0, 3, 0),
+    [ZEN_BYTE_CODE_STORE_AF] = ZEN_INSTRUCTION_EFFECT(0, 3, 0),
+    [ZEN_BYTE_CODE_STORE_AD] = ZEN_INSTRUCTION_EFFECT(0, 3, 0),
+    [ZEN_BYTE_CODE_STORE_AA] = ZEN_INSTRUCTION_EFFECT(0, 3, 0),
+    [ZEN_BYTE_CODE_STORE_INSTANCE_FIELD] = ZEN_INSTRUCTION_EFFECT(2, 2, 0),
+    [ZEN_BYTE_CODE_STORE_STATIC_FIELD] = ZEN_INSTRUCTION_EFFECT(2, 1, 0),
+
+    /* Subtract */
+
+    [ZEN_BYTE_CODE_SUBTRACT_I] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_SUBTRACT_L] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_SUBTRACT_F] = ZEN_INSTRUCTION_EFFECT_BINARY,
+    [ZEN_BYTE_CODE_SUBTRACT_D] = ZEN_INSTRUCTION_EFFECT_BINARY,
+
+    /* Swap */
+
+    [ZEN_BYTE_CODE_SWAP] = ZEN_INSTRUCTION_EFFECT(0, 2, 2),
+
+    /* Switch
+     *
+     * The arguments of the switch instructions are aligned. Their length is
+     * determined by zen_SwitchInstruction_getLength().
+     */
+
+    [ZEN_BYTE_CODE_SWITCH_TABLE] = ZEN_INSTRUCTION_EFFECT_SWITCH,
+    [ZEN_BYTE_CODE_SWITCH_SEARCH] = ZEN_INSTRUCTION_EFFECT_SWITCH,
+
+    /* Throw */
+
+    [ZEN_BYTE_CODE_THROW] = ZEN_INSTRUCTION_EFFECT_RETURN(1),
+
+    /* Wide */
+
+    [ZEN_BYTE_CODE_WIDE] = ZEN_INSTRUCTION_EFFECT(0, 0, 0)
+};
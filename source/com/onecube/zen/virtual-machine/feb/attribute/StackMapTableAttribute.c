@@ -0,0 +1,90 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <string.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/feb/attribute/StackMapTableAttribute.h>
+
+/*******************************************************************************
+ * StackMapTableAttribute                                                      *
+ *******************************************************************************/
+
+// Constructor
+
+zen_StackMapTableAttribute_t* zen_StackMapTableAttribute_new(uint16_t nameIndex,
+    uint16_t localVariableCount, uint16_t size, int32_t bitmapsSize) {
+    zen_StackMapTableAttribute_t* attribute = jtk_Memory_allocate(zen_StackMapTableAttribute_t, 1);
+    attribute->m_nameIndex = nameIndex;
+    /* The length excludes the name index and the length. */
+    attribute->m_length =
+        2 + // localVariableCount occupies two bytes.
+        2 + // size occupies two bytes.
+        size * ( // Each entry occupies the following width.
+            2 + // offset occupies two bytes.
+            2) + // operandCount occupies two bytes.
+        bitmapsSize; // The bitmaps occupy the rest.
+    attribute->m_localVariableCount = localVariableCount;
+    attribute->m_size = size;
+    attribute->m_entries = (size > 0)? jtk_Memory_allocate(zen_StackMapEntry_t, size) : NULL;
+    attribute->m_bitmaps = (bitmapsSize > 0)? jtk_Memory_allocate(uint8_t, bitmapsSize) : NULL;
+    if (bitmapsSize > 0) {
+        memset(attribute->m_bitmaps, 0, bitmapsSize);
+    }
+
+    return attribute;
+}
+
+// Destructor
+
+void zen_StackMapTableAttribute_delete(zen_StackMapTableAttribute_t* attribute) {
+    jtk_Assert_assertObject(attribute, "The specified stack map table attribute is null.");
+
+    if (attribute->m_bitmaps != NULL) {
+        jtk_Memory_deallocate(attribute->m_bitmaps);
+    }
+    if (attribute->m_entries != NULL) {
+        jtk_Memory_deallocate(attribute->m_entries);
+    }
+    jtk_Memory_deallocate(attribute);
+}
+
+// Find
+
+zen_StackMapEntry_t* zen_StackMapTableAttribute_find(zen_StackMapTableAttribute_t* attribute,
+    int32_t ip) {
+    jtk_Assert_assertObject(attribute, "The specified stack map table attribute is null.");
+
+    /* Search for the last entry whose offset is less than the instruction
+     * pointer.
+     */
+    int32_t low = 0;
+    int32_t high = attribute->m_size;
+    while (low < high) {
+        int32_t middle = (low + high) >> 1;
+        if (attribute->m_entries[middle].m_offset < ip) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    return (low > 0)? &attribute->m_entries[low - 1] : NULL;
+}
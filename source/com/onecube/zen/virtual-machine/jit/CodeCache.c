@@ -0,0 +1,99 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/jit/CodeCache.h>
+
+/*******************************************************************************
+ * CodeCache                                                                   *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_CodeCache_t* zen_CodeCache_new(size_t capacity) {
+    void* base = mmap(NULL, capacity, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        return NULL;
+    }
+
+    zen_CodeCache_t* codeCache = jtk_Memory_allocate(zen_CodeCache_t, 1);
+    codeCache->m_base = (uint8_t*)base;
+    codeCache->m_capacity = capacity;
+    codeCache->m_size = 0;
+    codeCache->m_pageSize = (size_t)sysconf(_SC_PAGESIZE);
+
+    return codeCache;
+}
+
+/* Destructor */
+
+void zen_CodeCache_delete(zen_CodeCache_t* codeCache) {
+    jtk_Assert_assertObject(codeCache, "The specified code cache is null.");
+
+    munmap(codeCache->m_base, codeCache->m_capacity);
+    jtk_Memory_deallocate(codeCache);
+}
+
+/* Protect */
+
+/* Changes the protection of the pages which overlap the specified range. No
+ * other allocation shares these pages.
+ */
+static bool zen_CodeCache_protect(zen_CodeCache_t* codeCache, uint8_t* code,
+    size_t size, int protection) {
+    uintptr_t mask = ~((uintptr_t)codeCache->m_pageSize - 1);
+    uintptr_t first = (uintptr_t)code & mask;
+    uintptr_t last = ((uintptr_t)code + size + codeCache->m_pageSize - 1) & mask;
+
+    return mprotect((void*)first, last - first, protection) == 0;
+}
+
+/* Allocate */
+
+uint8_t* zen_CodeCache_allocate(zen_CodeCache_t* codeCache, size_t size) {
+    jtk_Assert_assertObject(codeCache, "The specified code cache is null.");
+
+    /* The size of the code cache is always a multiple of the page size. */
+    size_t offset = codeCache->m_size;
+    size_t pageMask = codeCache->m_pageSize - 1;
+    size_t mappingSize = (size + pageMask) & ~pageMask;
+    if ((size == 0) || (mappingSize > (codeCache->m_capacity - offset))) {
+        return NULL;
+    }
+
+    uint8_t* code = codeCache->m_base + offset;
+    if (!zen_CodeCache_protect(codeCache, code, mappingSize, PROT_READ | PROT_WRITE)) {
+        return NULL;
+    }
+    codeCache->m_size = offset + mappingSize;
+
+    return code;
+}
+
+/* Commit */
+
+void zen_CodeCache_commit(zen_CodeCache_t* codeCache, uint8_t* code, size_t size) {
+    jtk_Assert_assertObject(codeCache, "The specified code cache is null.");
+
+    zen_CodeCache_protect(codeCache, code, size, PROT_READ | PROT_EXEC);
+    __builtin___clear_cache((char*)code, (char*)(code + size));
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/jit/CompiledCode.h>
+
+/*******************************************************************************
+ * CompiledCode                                                                *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_CompiledCode_t* zen_CompiledCode_new(uint8_t* code, int32_t size, int32_t instructionLength) {
+    zen_CompiledCode_t* compiledCode = jtk_Memory_allocate(zen_CompiledCode_t, 1);
+    compiledCode->m_code = code;
+    compiledCode->m_size = size;
+    compiledCode->m_entries = jtk_Memory_allocate(uint8_t*, instructionLength);
+    compiledCode->m_instructionLength = instructionLength;
+
+    return compiledCode;
+}
+
+/* Destructor */
+
+void zen_CompiledCode_delete(zen_CompiledCode_t* compiledCode) {
+    jtk_Assert_assertObject(compiledCode, "The specified compiled code is null.");
+
+    jtk_Memory_deallocate(compiledCode->m_entries);
+    jtk_Memory_deallocate(compiledCode);
+}
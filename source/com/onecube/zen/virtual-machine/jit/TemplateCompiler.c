@@ -0,0 +1,812 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <string.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+#include <com/onecube/zen/virtual-machine/jit/TemplateCompiler.h>
+#include <com/onecube/zen/virtual-machine/processor/Superinstruction.h>
+
+/*******************************************************************************
+ * TemplateCompiler                                                            *
+ *******************************************************************************/
+
+/* The maximum number of bytes generated by a template. */
+#define ZEN_TEMPLATE_COMPILER_MAX_TEMPLATE_SIZE 32
+
+/* The number of bytes generated by an exit to the interpreter. */
+#define ZEN_TEMPLATE_COMPILER_EXIT_SIZE 10
+
+/* The number of bytes generated by a safepoint poll, excluding its exit. */
+#define ZEN_TEMPLATE_COMPILER_POLL_SIZE 20
+
+/* The number of bytes generated by the prologue and the epilogue. */
+#define ZEN_TEMPLATE_COMPILER_FRAME_SIZE 32
+
+/* Condition codes of the `jcc` instructions. */
+#define ZEN_TEMPLATE_COMPILER_CONDITION_EQ 0x84
+#define ZEN_TEMPLATE_COMPILER_CONDITION_NE 0x85
+#define ZEN_TEMPLATE_COMPILER_CONDITION_LT 0x8C
+#define ZEN_TEMPLATE_COMPILER_CONDITION_GE 0x8D
+#define ZEN_TEMPLATE_COMPILER_CONDITION_LE 0x8E
+#define ZEN_TEMPLATE_COMPILER_CONDITION_GT 0x8F
+
+/* Emits the specified bytes, which form one or more machine instructions. */
+#define ZEN_TEMPLATE_COMPILER_EMIT(compiler, ...) \
+    do { \
+        const uint8_t bytes[] = { __VA_ARGS__ }; \
+        zen_TemplateCompiler_emit((compiler), bytes, sizeof (bytes)); \
+    } \
+    while (false)
+
+/* sub r12, 8 */
+#define ZEN_TEMPLATE_COMPILER_POP(compiler) \
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x83, 0xEC, 0x08)
+
+/* add r12, 8 */
+#define ZEN_TEMPLATE_COMPILER_PUSH(compiler) \
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x83, 0xC4, 0x08)
+
+/* Constructor */
+
+zen_TemplateCompiler_t* zen_TemplateCompiler_new(zen_Safepoint_t* safepoint) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    zen_CodeCache_t* codeCache = zen_CodeCache_new(ZEN_CODE_CACHE_DEFAULT_CAPACITY);
+    if (codeCache == NULL) {
+        return NULL;
+    }
+
+    zen_TemplateCompiler_t* compiler = jtk_Memory_allocate(zen_TemplateCompiler_t, 1);
+    compiler->m_codeCache = codeCache;
+    compiler->m_verifier = zen_BinaryEntityVerifier_new();
+    compiler->m_safepoint = safepoint;
+    compiler->m_buffer = NULL;
+    compiler->m_size = 0;
+    compiler->m_fixupLocations = NULL;
+    compiler->m_fixupTargets = NULL;
+    compiler->m_fixupCount = 0;
+    compiler->m_exitOffset = 0;
+    compiler->m_mutex = jtk_Mutex_new();
+
+    return compiler;
+}
+
+/* Destructor */
+
+void zen_TemplateCompiler_delete(zen_TemplateCompiler_t* compiler) {
+    jtk_Assert_assertObject(compiler, "The specified template compiler is null.");
+
+    jtk_Mutex_delete(compiler->m_mutex);
+    zen_BinaryEntityVerifier_delete(compiler->m_verifier);
+    zen_CodeCache_delete(compiler->m_codeCache);
+    jtk_Memory_deallocate(compiler);
+}
+
+/* Emit */
+
+static void zen_TemplateCompiler_emit(zen_TemplateCompiler_t* compiler,
+    const uint8_t* bytes, int32_t size) {
+    memcpy(compiler->m_buffer + compiler->m_size, bytes, size);
+    compiler->m_size += size;
+}
+
+static void zen_TemplateCompiler_emitInteger(zen_TemplateCompiler_t* compiler, int32_t value) {
+    uint32_t bits = (uint32_t)value;
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, bits & 0xFF, (bits >> 8) & 0xFF,
+        (bits >> 16) & 0xFF, (bits >> 24) & 0xFF);
+}
+
+static void zen_TemplateCompiler_emitLong(zen_TemplateCompiler_t* compiler, uint64_t value) {
+    zen_TemplateCompiler_emitInteger(compiler, (int32_t)(uint32_t)value);
+    zen_TemplateCompiler_emitInteger(compiler, (int32_t)(uint32_t)(value >> 32));
+}
+
+static void zen_TemplateCompiler_patchInteger(zen_TemplateCompiler_t* compiler,
+    int32_t location, int32_t value) {
+    uint32_t bits = (uint32_t)value;
+    compiler->m_buffer[location] = bits & 0xFF;
+    compiler->m_buffer[location + 1] = (bits >> 8) & 0xFF;
+    compiler->m_buffer[location + 2] = (bits >> 16) & 0xFF;
+    compiler->m_buffer[location + 3] = (bits >> 24) & 0xFF;
+}
+
+/* Frame */
+
+/* The prologue saves the callee-saved registers used by the templates, loads
+ * the registers from the arguments, and jumps to the target. The epilogue
+ * stores the top of the operand stack, restores the registers, and returns the
+ * offset of the next instruction, which the exits leave in the eax register.
+ *
+ * The templates never call other functions. Therefore, the native stack does
+ * not need to be aligned.
+ */
+static void zen_TemplateCompiler_emitFrame(zen_TemplateCompiler_t* compiler) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler,
+        0x53,                       /* push rbx */
+        0x41, 0x54,                 /* push r12 */
+        0x41, 0x55,                 /* push r13 */
+        0x48, 0x89, 0xFB,           /* mov rbx, rdi */
+        0x49, 0x89, 0xF5,           /* mov r13, rsi */
+        0x4C, 0x8B, 0x26,           /* mov r12, [rsi] */
+        0xFF, 0xE2);                /* jmp rdx */
+
+    compiler->m_exitOffset = compiler->m_size;
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler,
+        0x4D, 0x89, 0x65, 0x00,     /* mov [r13], r12 */
+        0x41, 0x5D,                 /* pop r13 */
+        0x41, 0x5C,                 /* pop r12 */
+        0x5B,                       /* pop rbx */
+        0xC3);                      /* ret */
+}
+
+/* Exit */
+
+/* mov eax, ip; jmp epilogue */
+static void zen_TemplateCompiler_emitExit(zen_TemplateCompiler_t* compiler, int32_t ip) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0xB8);
+    zen_TemplateCompiler_emitInteger(compiler, ip);
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0xE9);
+    zen_TemplateCompiler_emitInteger(compiler, compiler->m_exitOffset - (compiler->m_size + 4));
+}
+
+/* Branch */
+
+/* Emits the 32-bit displacement of a branch to the specified instruction. The
+ * displacement is patched once every instruction is translated.
+ */
+static void zen_TemplateCompiler_emitTarget(zen_TemplateCompiler_t* compiler, int32_t target) {
+    compiler->m_fixupLocations[compiler->m_fixupCount] = compiler->m_size;
+    compiler->m_fixupTargets[compiler->m_fixupCount] = target;
+    compiler->m_fixupCount++;
+    zen_TemplateCompiler_emitInteger(compiler, 0);
+}
+
+/* jcc target */
+static void zen_TemplateCompiler_emitConditionalJump(zen_TemplateCompiler_t* compiler,
+    uint8_t condition, int32_t target) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x0F, condition);
+    zen_TemplateCompiler_emitTarget(compiler, target);
+}
+
+/* Safepoint */
+
+/* Emits a poll of the safepoint, which jumps to the specified destination if
+ * no safepoint is requested. Otherwise, it exits to the interpreter at the
+ * specified instruction.
+ *
+ * mov rax, &requested; cmp dword [rax], 0; jne exit; jmp destination; exit: ...
+ */
+static void zen_TemplateCompiler_emitPoll(zen_TemplateCompiler_t* compiler,
+    int32_t destination, int32_t ip) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x48, 0xB8);
+    zen_TemplateCompiler_emitLong(compiler, (uint64_t)(uintptr_t)&compiler->m_safepoint->m_requested);
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x83, 0x38, 0x00, 0x75, 0x05, 0xE9);
+    zen_TemplateCompiler_emitInteger(compiler, destination - (compiler->m_size + 4));
+    zen_TemplateCompiler_emitExit(compiler, ip);
+}
+
+/* Local Variable Array */
+
+/* mov rax, [rbx + index * 8]; mov [r12], rax; add r12, 8 */
+static void zen_TemplateCompiler_emitLoad(zen_TemplateCompiler_t* compiler, int32_t index) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x48, 0x8B, 0x83);
+    zen_TemplateCompiler_emitInteger(compiler, index * (int32_t)sizeof (zen_Slot_t));
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x89, 0x04, 0x24);
+    ZEN_TEMPLATE_COMPILER_PUSH(compiler);
+}
+
+/* sub r12, 8; mov rax, [r12]; mov [rbx + index * 8], rax */
+static void zen_TemplateCompiler_emitStore(zen_TemplateCompiler_t* compiler, int32_t index) {
+    ZEN_TEMPLATE_COMPILER_POP(compiler);
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x8B, 0x04, 0x24, 0x48, 0x89, 0x83);
+    zen_TemplateCompiler_emitInteger(compiler, index * (int32_t)sizeof (zen_Slot_t));
+}
+
+/* Operand Stack */
+
+/* mov qword [r12], value; add r12, 8 */
+static void zen_TemplateCompiler_emitPushInteger(zen_TemplateCompiler_t* compiler, int32_t value) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0xC7, 0x04, 0x24);
+    zen_TemplateCompiler_emitInteger(compiler, value);
+    ZEN_TEMPLATE_COMPILER_PUSH(compiler);
+}
+
+/* mov rax, bits; mov [r12], rax; add r12, 8 */
+static void zen_TemplateCompiler_emitPushBits(zen_TemplateCompiler_t* compiler, uint64_t bits) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x48, 0xB8);
+    zen_TemplateCompiler_emitLong(compiler, bits);
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x89, 0x04, 0x24);
+    ZEN_TEMPLATE_COMPILER_PUSH(compiler);
+}
+
+static void zen_TemplateCompiler_emitPushFloat(zen_TemplateCompiler_t* compiler, float value) {
+    zen_Slot_t slot;
+    slot.m_long = 0;
+    slot.m_float = value;
+    zen_TemplateCompiler_emitPushBits(compiler, (uint64_t)slot.m_long);
+}
+
+static void zen_TemplateCompiler_emitPushDouble(zen_TemplateCompiler_t* compiler, double value) {
+    zen_Slot_t slot;
+    slot.m_double = value;
+    zen_TemplateCompiler_emitPushBits(compiler, (uint64_t)slot.m_long);
+}
+
+/* Arithmetic */
+
+/* The first operand lies below the second operand. The result replaces the
+ * first operand. The rex prefix selects between the 32-bit (0x41) and the
+ * 64-bit (0x49) forms.
+ */
+
+/* sub r12, 8; mov eax, [r12]; op [r12 - 8], eax */
+static void zen_TemplateCompiler_emitBinary(zen_TemplateCompiler_t* compiler,
+    uint8_t rex, uint8_t opcode) {
+    ZEN_TEMPLATE_COMPILER_POP(compiler);
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, rex, 0x8B, 0x04, 0x24, rex, opcode, 0x44, 0x24, 0xF8);
+}
+
+/* sub r12, 8; mov eax, [r12]; mov ecx, [r12 - 8]; imul ecx, eax; mov [r12 - 8], ecx */
+static void zen_TemplateCompiler_emitMultiply(zen_TemplateCompiler_t* compiler, uint8_t rex) {
+    ZEN_TEMPLATE_COMPILER_POP(compiler);
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, rex, 0x8B, 0x04, 0x24, rex, 0x8B, 0x4C, 0x24, 0xF8);
+    if (rex == 0x49) {
+        ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x48);
+    }
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x0F, 0xAF, 0xC8, rex, 0x89, 0x4C, 0x24, 0xF8);
+}
+
+/* The processor masks the shift count to 5 bits, or 6 bits in the 64-bit form,
+ * exactly like the interpreter.
+ *
+ * sub r12, 8; mov ecx, [r12]; shift [r12 - 8], cl
+ */
+static void zen_TemplateCompiler_emitShift(zen_TemplateCompiler_t* compiler,
+    uint8_t rex, uint8_t extension) {
+    ZEN_TEMPLATE_COMPILER_POP(compiler);
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x41, 0x8B, 0x0C, 0x24,
+        rex, 0xD3, 0x44 | (extension << 3), 0x24, 0xF8);
+}
+
+/* neg [r12 - 8] */
+static void zen_TemplateCompiler_emitNegate(zen_TemplateCompiler_t* compiler, uint8_t rex) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler, rex, 0xF7, 0x5C, 0x24, 0xF8);
+}
+
+/* The prefix selects between the single precision (0xF3) and the double
+ * precision (0xF2) forms.
+ *
+ * sub r12, 8; movss xmm0, [r12 - 8]; op xmm0, [r12]; movss [r12 - 8], xmm0
+ */
+static void zen_TemplateCompiler_emitDecimal(zen_TemplateCompiler_t* compiler,
+    uint8_t prefix, uint8_t opcode) {
+    ZEN_TEMPLATE_COMPILER_POP(compiler);
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler,
+        prefix, 0x41, 0x0F, 0x10, 0x44, 0x24, 0xF8,
+        prefix, 0x41, 0x0F, opcode, 0x04, 0x24,
+        prefix, 0x41, 0x0F, 0x11, 0x44, 0x24, 0xF8);
+}
+
+/* Cast */
+
+/* Converts the operand on top of the operand stack with the specified
+ * instruction, which reads [r12 - 8] and writes xmm0, and stores the result
+ * with the specified precision.
+ *
+ * cvt xmm0, [r12 - 8]; movss [r12 - 8], xmm0
+ */
+static void zen_TemplateCompiler_emitConvert(zen_TemplateCompiler_t* compiler,
+    uint8_t prefix, uint8_t rex, uint8_t opcode, uint8_t resultPrefix) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler,
+        prefix, rex, 0x0F, opcode, 0x44, 0x24, 0xF8,
+        resultPrefix, 0x41, 0x0F, 0x11, 0x44, 0x24, 0xF8);
+}
+
+/* movsx eax, [r12 - 8]; mov [r12 - 8], eax */
+static void zen_TemplateCompiler_emitSignExtend(zen_TemplateCompiler_t* compiler, uint8_t opcode) {
+    ZEN_TEMPLATE_COMPILER_EMIT(compiler,
+        0x41, 0x0F, opcode, 0x44, 0x24, 0xF8,
+        0x41, 0x89, 0x44, 0x24, 0xF8);
+}
+
+/* Instruction */
+
+/* Emits the template of the specified instruction. Returns false if the
+ * instruction has no template.
+ */
+static bool zen_TemplateCompiler_emitInstruction(zen_TemplateCompiler_t* compiler,
+    uint8_t byteCode, const uint8_t* instructions, int32_t ip) {
+    switch (byteCode) {
+        case ZEN_BYTE_CODE_NOP: {
+            break;
+        }
+
+        /* Arithmetic, Bitwise and Shift */
+
+        case ZEN_BYTE_CODE_ADD_I: zen_TemplateCompiler_emitBinary(compiler, 0x41, 0x01); break;
+        case ZEN_BYTE_CODE_ADD_L: zen_TemplateCompiler_emitBinary(compiler, 0x49, 0x01); break;
+        case ZEN_BYTE_CODE_SUBTRACT_I: zen_TemplateCompiler_emitBinary(compiler, 0x41, 0x29); break;
+        case ZEN_BYTE_CODE_SUBTRACT_L: zen_TemplateCompiler_emitBinary(compiler, 0x49, 0x29); break;
+        case ZEN_BYTE_CODE_AND_I: zen_TemplateCompiler_emitBinary(compiler, 0x41, 0x21); break;
+        case ZEN_BYTE_CODE_AND_L: zen_TemplateCompiler_emitBinary(compiler, 0x49, 0x21); break;
+        case ZEN_BYTE_CODE_OR_I: zen_TemplateCompiler_emitBinary(compiler, 0x41, 0x09); break;
+        case ZEN_BYTE_CODE_OR_L: zen_TemplateCompiler_emitBinary(compiler, 0x49, 0x09); break;
+        case ZEN_BYTE_CODE_XOR_I: zen_TemplateCompiler_emitBinary(compiler, 0x41, 0x31); break;
+        case ZEN_BYTE_CODE_XOR_L: zen_TemplateCompiler_emitBinary(compiler, 0x49, 0x31); break;
+        case ZEN_BYTE_CODE_MULTIPLY_I: zen_TemplateCompiler_emitMultiply(compiler, 0x41); break;
+        case ZEN_BYTE_CODE_MULTIPLY_L: zen_TemplateCompiler_emitMultiply(compiler, 0x49); break;
+        case ZEN_BYTE_CODE_SHIFT_LEFT_I: zen_TemplateCompiler_emitShift(compiler, 0x41, 4); break;
+        case ZEN_BYTE_CODE_SHIFT_LEFT_L: zen_TemplateCompiler_emitShift(compiler, 0x49, 4); break;
+        case ZEN_BYTE_CODE_SHIFT_RIGHT_I: zen_TemplateCompiler_emitShift(compiler, 0x41, 7); break;
+        case ZEN_BYTE_CODE_SHIFT_RIGHT_L: zen_TemplateCompiler_emitShift(compiler, 0x49, 7); break;
+        case ZEN_BYTE_CODE_SHIFT_RIGHT_UI: zen_TemplateCompiler_emitShift(compiler, 0x41, 5); break;
+        case ZEN_BYTE_CODE_SHIFT_RIGHT_UL: zen_TemplateCompiler_emitShift(compiler, 0x49, 5); break;
+        case ZEN_BYTE_CODE_NEGATE_I: zen_TemplateCompiler_emitNegate(compiler, 0x41); break;
+        case ZEN_BYTE_CODE_NEGATE_L: zen_TemplateCompiler_emitNegate(compiler, 0x49); break;
+
+        case ZEN_BYTE_CODE_ADD_F: zen_TemplateCompiler_emitDecimal(compiler, 0xF3, 0x58); break;
+        case ZEN_BYTE_CODE_ADD_D: zen_TemplateCompiler_emitDecimal(compiler, 0xF2, 0x58); break;
+        case ZEN_BYTE_CODE_SUBTRACT_F: zen_TemplateCompiler_emitDecimal(compiler, 0xF3, 0x5C); break;
+        case ZEN_BYTE_CODE_SUBTRACT_D: zen_TemplateCompiler_emitDecimal(compiler, 0xF2, 0x5C); break;
+        case ZEN_BYTE_CODE_MULTIPLY_F: zen_TemplateCompiler_emitDecimal(compiler, 0xF3, 0x59); break;
+        case ZEN_BYTE_CODE_MULTIPLY_D: zen_TemplateCompiler_emitDecimal(compiler, 0xF2, 0x59); break;
+        case ZEN_BYTE_CODE_DIVIDE_F: zen_TemplateCompiler_emitDecimal(compiler, 0xF3, 0x5E); break;
+        case ZEN_BYTE_CODE_DIVIDE_D: zen_TemplateCompiler_emitDecimal(compiler, 0xF2, 0x5E); break;
+
+        /* Flip the sign bit. */
+        case ZEN_BYTE_CODE_NEGATE_F: {
+            /* xor dword [r12 - 8], 0x80000000 */
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x41, 0x81, 0x74, 0x24, 0xF8, 0x00, 0x00, 0x00, 0x80);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_NEGATE_D: {
+            /* btc qword [r12 - 8], 63 */
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x0F, 0xBA, 0x7C, 0x24, 0xF8, 0x3F);
+            break;
+        }
+
+        /* Cast */
+
+        case ZEN_BYTE_CODE_CAST_ITL: {
+            /* movsxd rax, dword [r12 - 8]; mov [r12 - 8], rax */
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x63, 0x44, 0x24, 0xF8, 0x49, 0x89, 0x44, 0x24, 0xF8);
+            break;
+        }
+
+        /* The lower half of the slot already holds the truncated value. */
+        case ZEN_BYTE_CODE_CAST_LTI: {
+            break;
+        }
+
+        case ZEN_BYTE_CODE_CAST_ITB:
+        case ZEN_BYTE_CODE_CAST_LTB: {
+            zen_TemplateCompiler_emitSignExtend(compiler, 0xBE);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_CAST_ITS:
+        case ZEN_BYTE_CODE_CAST_LTS: {
+            zen_TemplateCompiler_emitSignExtend(compiler, 0xBF);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_CAST_ITF: zen_TemplateCompiler_emitConvert(compiler, 0xF3, 0x41, 0x2A, 0xF3); break;
+        case ZEN_BYTE_CODE_CAST_ITD: zen_TemplateCompiler_emitConvert(compiler, 0xF2, 0x41, 0x2A, 0xF2); break;
+        case ZEN_BYTE_CODE_CAST_LTF: zen_TemplateCompiler_emitConvert(compiler, 0xF3, 0x49, 0x2A, 0xF3); break;
+        case ZEN_BYTE_CODE_CAST_LTD: zen_TemplateCompiler_emitConvert(compiler, 0xF2, 0x49, 0x2A, 0xF2); break;
+        case ZEN_BYTE_CODE_CAST_FTD: zen_TemplateCompiler_emitConvert(compiler, 0xF3, 0x41, 0x5A, 0xF2); break;
+        case ZEN_BYTE_CODE_CAST_DTF: zen_TemplateCompiler_emitConvert(compiler, 0xF2, 0x41, 0x5A, 0xF3); break;
+
+        /* Duplicate */
+
+        case ZEN_BYTE_CODE_DUPLICATE: {
+            /* mov rax, [r12 - 8]; mov [r12], rax; add r12, 8 */
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x8B, 0x44, 0x24, 0xF8, 0x49, 0x89, 0x04, 0x24);
+            ZEN_TEMPLATE_COMPILER_PUSH(compiler);
+            break;
+        }
+
+        /* Jump */
+
+        case ZEN_BYTE_CODE_JUMP_EQ0_I:
+        case ZEN_BYTE_CODE_JUMP_NE0_I:
+        case ZEN_BYTE_CODE_JUMP_LT0_I:
+        case ZEN_BYTE_CODE_JUMP_GT0_I:
+        case ZEN_BYTE_CODE_JUMP_LE0_I:
+        case ZEN_BYTE_CODE_JUMP_GE0_I: {
+            static const uint8_t conditions[] = {
+                ZEN_TEMPLATE_COMPILER_CONDITION_EQ,
+                ZEN_TEMPLATE_COMPILER_CONDITION_NE,
+                ZEN_TEMPLATE_COMPILER_CONDITION_LT,
+                ZEN_TEMPLATE_COMPILER_CONDITION_GT,
+                ZEN_TEMPLATE_COMPILER_CONDITION_LE,
+                ZEN_TEMPLATE_COMPILER_CONDITION_GE
+            };
+            int16_t offset = (int16_t)((instructions[ip + 1] << 8) | instructions[ip + 2]);
+
+            /* sub r12, 8; cmp dword [r12], 0 */
+            ZEN_TEMPLATE_COMPILER_POP(compiler);
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x41, 0x83, 0x3C, 0x24, 0x00);
+            zen_TemplateCompiler_emitConditionalJump(compiler,
+                conditions[byteCode - ZEN_BYTE_CODE_JUMP_EQ0_I], ip + offset);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_JUMP_EQ_I:
+        case ZEN_BYTE_CODE_JUMP_NE_I:
+        case ZEN_BYTE_CODE_JUMP_LT_I:
+        case ZEN_BYTE_CODE_JUMP_GT_I:
+        case ZEN_BYTE_CODE_JUMP_LE_I:
+        case ZEN_BYTE_CODE_JUMP_GE_I: {
+            static const uint8_t conditions[] = {
+                ZEN_TEMPLATE_COMPILER_CONDITION_EQ,
+                ZEN_TEMPLATE_COMPILER_CONDITION_NE,
+                ZEN_TEMPLATE_COMPILER_CONDITION_LT,
+                ZEN_TEMPLATE_COMPILER_CONDITION_GT,
+                ZEN_TEMPLATE_COMPILER_CONDITION_LE,
+                ZEN_TEMPLATE_COMPILER_CONDITION_GE
+            };
+            int16_t offset = (int16_t)((instructions[ip + 1] << 8) | instructions[ip + 2]);
+
+            /* sub r12, 16; mov eax, [r12]; cmp eax, [r12 + 8] */
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x83, 0xEC, 0x10,
+                0x41, 0x8B, 0x04, 0x24, 0x41, 0x3B, 0x44, 0x24, 0x08);
+            zen_TemplateCompiler_emitConditionalJump(compiler,
+                conditions[byteCode - ZEN_BYTE_CODE_JUMP_EQ_I], ip + offset);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_JUMP_EQ_A:
+        case ZEN_BYTE_CODE_JUMP_NE_A: {
+            int16_t offset = (int16_t)((instructions[ip + 1] << 8) | instructions[ip + 2]);
+
+            /* sub r12, 16; mov rax, [r12]; cmp rax, [r12 + 8] */
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x83, 0xEC, 0x10,
+                0x49, 0x8B, 0x04, 0x24, 0x49, 0x3B, 0x44, 0x24, 0x08);
+            zen_TemplateCompiler_emitConditionalJump(compiler,
+                (byteCode == ZEN_BYTE_CODE_JUMP_EQ_A)? ZEN_TEMPLATE_COMPILER_CONDITION_EQ :
+                ZEN_TEMPLATE_COMPILER_CONDITION_NE, ip + offset);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_JUMP_EQN_A:
+        case ZEN_BYTE_CODE_JUMP_NEN_A: {
+            int16_t offset = (int16_t)((instructions[ip + 1] << 8) | instructions[ip + 2]);
+
+            /* sub r12, 8; cmp qword [r12], 0 */
+            ZEN_TEMPLATE_COMPILER_POP(compiler);
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x83, 0x3C, 0x24, 0x00);
+            zen_TemplateCompiler_emitConditionalJump(compiler,
+                (byteCode == ZEN_BYTE_CODE_JUMP_EQN_A)? ZEN_TEMPLATE_COMPILER_CONDITION_EQ :
+                ZEN_TEMPLATE_COMPILER_CONDITION_NE, ip + offset);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_JUMP: {
+            int16_t offset = (int16_t)((instructions[ip + 1] << 8) | instructions[ip + 2]);
+
+            /* jmp target */
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0xE9);
+            zen_TemplateCompiler_emitTarget(compiler, ip + offset);
+            break;
+        }
+
+        /* Load */
+
+        case ZEN_BYTE_CODE_LOAD_I:
+        case ZEN_BYTE_CODE_LOAD_L:
+        case ZEN_BYTE_CODE_LOAD_F:
+        case ZEN_BYTE_CODE_LOAD_D:
+        case ZEN_BYTE_CODE_LOAD_A: {
+            zen_TemplateCompiler_emitLoad(compiler, instructions[ip + 1]);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_LOAD_I0:
+        case ZEN_BYTE_CODE_LOAD_L0:
+        case ZEN_BYTE_CODE_LOAD_F0:
+        case ZEN_BYTE_CODE_LOAD_D0:
+        case ZEN_BYTE_CODE_LOAD_A0: {
+            zen_TemplateCompiler_emitLoad(compiler, 0);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_LOAD_I1:
+        case ZEN_BYTE_CODE_LOAD_L1:
+        case ZEN_BYTE_CODE_LOAD_F1:
+        case ZEN_BYTE_CODE_LOAD_D1:
+        case ZEN_BYTE_CODE_LOAD_A1: {
+            zen_TemplateCompiler_emitLoad(compiler, 1);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_LOAD_I2:
+        case ZEN_BYTE_CODE_LOAD_L2:
+        case ZEN_BYTE_CODE_LOAD_F2:
+        case ZEN_BYTE_CODE_LOAD_D2:
+        case ZEN_BYTE_CODE_LOAD_A2: {
+            zen_TemplateCompiler_emitLoad(compiler, 2);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_LOAD_I3:
+        case ZEN_BYTE_CODE_LOAD_L3:
+        case ZEN_BYTE_CODE_LOAD_F3:
+        case ZEN_BYTE_CODE_LOAD_D3:
+        case ZEN_BYTE_CODE_LOAD_A3: {
+            zen_TemplateCompiler_emitLoad(compiler, 3);
+            break;
+        }
+
+        /* Pop */
+
+        case ZEN_BYTE_CODE_POP: {
+            ZEN_TEMPLATE_COMPILER_POP(compiler);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_POP2: {
+            /* sub r12, 16 */
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler, 0x49, 0x83, 0xEC, 0x10);
+            break;
+        }
+
+        /* Push */
+
+        case ZEN_BYTE_CODE_PUSH_NULL: zen_TemplateCompiler_emitPushInteger(compiler, 0); break;
+        case ZEN_BYTE_CODE_PUSH_IN1: zen_TemplateCompiler_emitPushInteger(compiler, -1); break;
+        case ZEN_BYTE_CODE_PUSH_I0: zen_TemplateCompiler_emitPushInteger(compiler, 0); break;
+        case ZEN_BYTE_CODE_PUSH_I1: zen_TemplateCompiler_emitPushInteger(compiler, 1); break;
+        case ZEN_BYTE_CODE_PUSH_I2: zen_TemplateCompiler_emitPushInteger(compiler, 2); break;
+        case ZEN_BYTE_CODE_PUSH_I3: zen_TemplateCompiler_emitPushInteger(compiler, 3); break;
+        case ZEN_BYTE_CODE_PUSH_I4: zen_TemplateCompiler_emitPushInteger(compiler, 4); break;
+        case ZEN_BYTE_CODE_PUSH_I5: zen_TemplateCompiler_emitPushInteger(compiler, 5); break;
+        case ZEN_BYTE_CODE_PUSH_L0: zen_TemplateCompiler_emitPushInteger(compiler, 0); break;
+        case ZEN_BYTE_CODE_PUSH_L1: zen_TemplateCompiler_emitPushInteger(compiler, 1); break;
+        case ZEN_BYTE_CODE_PUSH_L2: zen_TemplateCompiler_emitPushInteger(compiler, 2); break;
+        case ZEN_BYTE_CODE_PUSH_F0: zen_TemplateCompiler_emitPushFloat(compiler, 0.0f); break;
+        case ZEN_BYTE_CODE_PUSH_F1: zen_TemplateCompiler_emitPushFloat(compiler, 1.0f); break;
+        case ZEN_BYTE_CODE_PUSH_F2: zen_TemplateCompiler_emitPushFloat(compiler, 2.0f); break;
+        case ZEN_BYTE_CODE_PUSH_D0: zen_TemplateCompiler_emitPushDouble(compiler, 0.0); break;
+        case ZEN_BYTE_CODE_PUSH_D1: zen_TemplateCompiler_emitPushDouble(compiler, 1.0); break;
+        case ZEN_BYTE_CODE_PUSH_D2: zen_TemplateCompiler_emitPushDouble(compiler, 2.0); break;
+
+        case ZEN_BYTE_CODE_PUSH_B: {
+            zen_TemplateCompiler_emitPushInteger(compiler, (int8_t)instructions[ip + 1]);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_PUSH_S: {
+            zen_TemplateCompiler_emitPushInteger(compiler,
+                (int16_t)((instructions[ip + 1] << 8) | instructions[ip + 2]));
+            break;
+        }
+
+        /* Store */
+
+        case ZEN_BYTE_CODE_STORE_I:
+        case ZEN_BYTE_CODE_STORE_L:
+        case ZEN_BYTE_CODE_STORE_F:
+        case ZEN_BYTE_CODE_STORE_D:
+        case ZEN_BYTE_CODE_STORE_A: {
+            zen_TemplateCompiler_emitStore(compiler, instructions[ip + 1]);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_STORE_I0:
+        case ZEN_BYTE_CODE_STORE_L0:
+        case ZEN_BYTE_CODE_STORE_F0:
+        case ZEN_BYTE_CODE_STORE_D0:
+        case ZEN_BYTE_CODE_STORE_A0: {
+            zen_TemplateCompiler_emitStore(compiler, 0);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_STORE_I1:
+        case ZEN_BYTE_CODE_STORE_L1:
+        case ZEN_BYTE_CODE_STORE_F1:
+        case ZEN_BYTE_CODE_STORE_D1:
+        case ZEN_BYTE_CODE_STORE_A1: {
+            zen_TemplateCompiler_emitStore(compiler, 1);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_STORE_I2:
+        case ZEN_BYTE_CODE_STORE_L2:
+        case ZEN_BYTE_CODE_STORE_F2:
+        case ZEN_BYTE_CODE_STORE_D2:
+        case ZEN_BYTE_CODE_STORE_A2: {
+            zen_TemplateCompiler_emitStore(compiler, 2);
+            break;
+        }
+
+        case ZEN_BYTE_CODE_STORE_I3:
+        case ZEN_BYTE_CODE_STORE_L3:
+        case ZEN_BYTE_CODE_STORE_F3:
+        case ZEN_BYTE_CODE_STORE_D3:
+        case ZEN_BYTE_CODE_STORE_A3: {
+            zen_TemplateCompiler_emitStore(compiler, 3);
+            break;
+        }
+
+        /* Swap */
+
+        case ZEN_BYTE_CODE_SWAP: {
+            /* mov rax, [r12 - 8]; mov rcx, [r12 - 16]; mov [r12 - 8], rcx; mov [r12 - 16], rax */
+            ZEN_TEMPLATE_COMPILER_EMIT(compiler,
+                0x49, 0x8B, 0x44, 0x24, 0xF8, 0x49, 0x8B, 0x4C, 0x24, 0xF0,
+                0x49, 0x89, 0x4C, 0x24, 0xF8, 0x49, 0x89, 0x44, 0x24, 0xF0);
+            break;
+        }
+
+        /* The invocations, allocations, field and array accesses, returns,
+         * exceptions and the remaining instructions are executed by the
+         * interpreter.
+         */
+        default: {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Compile */
+
+/* The state of the current compilation lives in the compiler. Therefore, the
+ * caller should hold the mutex of the compiler.
+ */
+static zen_CompiledCode_t* zen_TemplateCompiler_translate(zen_TemplateCompiler_t* compiler,
+    zen_InstructionAttribute_t* instructionAttribute) {
+    int32_t length = instructionAttribute->m_instructionLength;
+    const uint8_t* instructions = instructionAttribute->m_instructions;
+    if (length == 0) {
+        return NULL;
+    }
+
+    /* Every instruction occupies at least one byte. An instruction generates
+     * either a template or an exit, and at most one branch, which may require
+     * an additional exit, preceded by a safepoint poll.
+     */
+    int32_t capacity = ZEN_TEMPLATE_COMPILER_FRAME_SIZE + ZEN_TEMPLATE_COMPILER_EXIT_SIZE +
+        (length * (ZEN_TEMPLATE_COMPILER_MAX_TEMPLATE_SIZE + ZEN_TEMPLATE_COMPILER_POLL_SIZE +
+        ZEN_TEMPLATE_COMPILER_EXIT_SIZE));
+    compiler->m_buffer = jtk_Memory_allocate(uint8_t, capacity);
+    compiler->m_size = 0;
+    compiler->m_fixupLocations = jtk_Memory_allocate(int32_t, length);
+    compiler->m_fixupTargets = jtk_Memory_allocate(int32_t, length);
+    compiler->m_fixupCount = 0;
+
+    /* The offset of the machine code of each instruction, or -1. */
+    int32_t* offsets = jtk_Memory_allocate(int32_t, length);
+    bool* compiled = jtk_Memory_allocate(bool, length);
+    int32_t i;
+    for (i = 0; i < length; i++) {
+        offsets[i] = -1;
+        compiled[i] = false;
+    }
+
+    zen_TemplateCompiler_emitFrame(compiler);
+
+    int32_t ip = 0;
+    while (ip < length) {
+        offsets[ip] = compiler->m_size;
+
+        uint8_t byteCode = instructions[ip];
+        int32_t instructionLength;
+        if ((byteCode >= ZEN_SUPERINSTRUCTION_FIRST) && (byteCode <= ZEN_SUPERINSTRUCTION_LAST)) {
+            /* The rest of the sequence is intact. Therefore, only the first
+             * instruction of the sequence is translated here.
+             */
+            byteCode = zen_Superinstruction_getFirstByteCode(byteCode);
+            instructionLength = 2;
+        }
+        else {
+            instructionLength = zen_BinaryEntityVerifier_getInstructionLength(
+                compiler->m_verifier, instructions, ip, length);
+        }
+
+        if (instructionLength < 0) {
+            /* The boundaries of the remaining instructions are unknown. */
+            zen_TemplateCompiler_emitExit(compiler, ip);
+            break;
+        }
+
+        /* The interpreter treats the last byte of a function as a return. */
+        if (((ip + 1) < length) &&
+            zen_TemplateCompiler_emitInstruction(compiler, byteCode, instructions, ip)) {
+            compiled[ip] = true;
+        }
+        else {
+            zen_TemplateCompiler_emitExit(compiler, ip);
+        }
+
+        ip += instructionLength;
+    }
+
+    /* A function which runs off the end of its instructions returns to its
+     * caller. The interpreter takes care of it.
+     */
+    if (ip >= length) {
+        zen_TemplateCompiler_emitExit(compiler, length);
+    }
+
+    /* Resolve the branches. A branch to an offset which was not translated
+     * exits to the interpreter. The machine code is laid out in the order of
+     * the instructions, therefore, a backward branch jumps to a location
+     * before itself. It is routed through a safepoint poll, so that a loop in
+     * the compiled code cannot hold up the collector.
+     */
+    for (i = 0; i < compiler->m_fixupCount; i++) {
+        int32_t location = compiler->m_fixupLocations[i];
+        int32_t target = compiler->m_fixupTargets[i];
+        int32_t destination;
+        if ((target >= 0) && (target < length) && (offsets[target] >= 0)) {
+            destination = offsets[target];
+            if (destination <= location) {
+                int32_t poll = compiler->m_size;
+                zen_TemplateCompiler_emitPoll(compiler, destination, target);
+                destination = poll;
+            }
+        }
+        else {
+            destination = compiler->m_size;
+            zen_TemplateCompiler_emitExit(compiler, target);
+        }
+        zen_TemplateCompiler_patchInteger(compiler, location, destination - (location + 4));
+    }
+
+    zen_CompiledCode_t* compiledCode = NULL;
+    uint8_t* code = zen_CodeCache_allocate(compiler->m_codeCache, compiler->m_size);
+    if (code != NULL) {
+        memcpy(code, compiler->m_buffer, compiler->m_size);
+        zen_CodeCache_commit(compiler->m_codeCache, code, compiler->m_size);
+
+        compiledCode = zen_CompiledCode_new(code, compiler->m_size, length);
+        for (i = 0; i < length; i++) {
+            compiledCode->m_entries[i] = compiled[i]? (code + offsets[i]) : NULL;
+        }
+    }
+
+    jtk_Memory_deallocate(compiled);
+    jtk_Memory_deallocate(offsets);
+    jtk_Memory_deallocate(compiler->m_fixupTargets);
+    jtk_Memory_deallocate(compiler->m_fixupLocations);
+    jtk_Memory_deallocate(compiler->m_buffer);
+    compiler->m_buffer = NULL;
+    compiler->m_fixupLocations = NULL;
+    compiler->m_fixupTargets = NULL;
+
+    return compiledCode;
+}
+
+zen_CompiledCode_t* zen_TemplateCompiler_compile(zen_TemplateCompiler_t* compiler,
+    zen_InstructionAttribute_t* instructionAttribute) {
+    jtk_Assert_assertObject(compiler, "The specified template compiler is null.");
+    jtk_Assert_assertObject(instructionAttribute, "The specified instruction attribute is null.");
+
+    jtk_Mutex_lock(compiler->m_mutex);
+    zen_CompiledCode_t* result = zen_TemplateCompiler_translate(compiler, instructionAttribute);
+    jtk_Mutex_unlock(compiler->m_mutex);
+
+    return result;
+}
@@ -69,6 +69,9 @@ void zen_AttributeParseRules_initialize(zen_AttributeParseRules_t* rules) {
     
     jtk_CString_t* instructionAttributeRuleKey = jtk_CString_newEx(ZEN_PREDEFINED_ATTRIBUTE_INSTRUCTION, ZEN_PREDEFINED_ATTRIBUTE_INSTRUCTION_SIZE);
     jtk_HashMap_put(rules->m_map, instructionAttributeRuleKey, zen_BinaryEntityParser_parseInstructionAttribute);
+
+    jtk_CString_t* stackMapTableAttributeRuleKey = jtk_CString_newEx(ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE, ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE_SIZE);
+    jtk_HashMap_put(rules->m_map, stackMapTableAttributeRuleKey, zen_BinaryEntityParser_parseStackMapTableAttribute);
 }
 
 // Rule
@@ -32,10 +32,14 @@ const uint8_t* ZEN_BINARY_ENTITY_PARSER_TAG = "com.onecube.zen.virtualmachine.lo
 /* Constructor */
 
 zen_BinaryEntityParser_t* zen_BinaryEntityParser_new(
-    zen_AttributeParseRules_t* attributeParseRules, uint8_t* bytes, int32_t size) {
+    zen_AttributeParseRules_t* attributeParseRules, zen_Arena_t* arena, uint8_t* bytes,
+    int32_t size) {
     zen_BinaryEntityParser_t* parser = zen_Memory_allocate(zen_BinaryEntityParser_t, 1);
     parser->m_tape = jtk_Tape_wrap(bytes, size);
     parser->m_attributeParseRules = attributeParseRules;
+    parser->m_arena = arena;
+    parser->m_verifier = zen_BinaryEntityVerifier_new();
+    parser->m_rewriter = zen_SuperinstructionRewriter_new(parser->m_verifier);
 
     // parser->m_memoryManager = memoryManager;
 
@@ -47,6 +51,8 @@ zen_BinaryEntityParser_t* zen_BinaryEntityParser_new(
 void zen_BinaryEntityParser_delete(zen_BinaryEntityParser_t* parser) {
     jtk_Assert_assertObject(parser, "The specified binary entity parser is null.");
 
+    zen_SuperinstructionRewriter_delete(parser->m_rewriter);
+    zen_BinaryEntityVerifier_delete(parser->m_verifier);
     jtk_Memory_deallocate(parser);
 }
 
@@ -70,7 +76,8 @@ zen_EntityFile_t* zen_BinaryEntityParser_parse(zen_BinaryEntityParser_t* parser,
 zen_EntityFile_t* zen_BinaryEntityParser_parseEntityFile(zen_BinaryEntityParser_t* parser) {
     jtk_Assert_assertObject(parser, "The specified binary entity parser is null.");
 
-    zen_EntityFile_t* entityFile = jtk_Memory_allocate(zen_EntityFile_t, 1);
+    zen_EntityFile_t* entityFile = zen_Arena_allocate(parser->m_arena, zen_EntityFile_t, 1);
+    entityFile->m_arena = parser->m_arena;
     parser->m_entityFile = entityFile;
 
     if (jtk_Tape_isAvailable(parser->m_tape, 12)) {
@@ -95,17 +102,17 @@ zen_EntityFile_t* zen_BinaryEntityParser_parseEntityFile(zen_BinaryEntityParser_
              */
             if ((majorVersion <= ZEN_BINARY_ENTITY_FORMAT_MAJOR_VERSION) &&
                 (minorVersion <= ZEN_BINARY_ENTITY_FORMAT_MINOR_VERSION)) {
-                uint32_t size = jtk_Tape_readUncheckedInteger(parser->m_tape);
-                entityFile->m_size = size;
-
                 uint16_t flags = jtk_Tape_readUncheckedShort(parser->m_tape);
                 entityFile->m_flags = flags;
 
                 zen_ConstantPool_t* constantPool = zen_BinaryEntityParser_parseConstantPool(parser);
                 entityFile->m_constantPool = constantPool;
 
+                /* The primary entity is embedded in the entity file. */
                 zen_Entity_t* entity = zen_BinaryEntityParser_parseEntity(parser);
-                entityFile->m_entity = entity;
+                if (entity != NULL) {
+                    entityFile->m_entity = *entity;
+                }
             }
             else {
                 // Error: Virtual machine version is lesser than the binary entity file version.
@@ -134,9 +141,9 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
 
     uint16_t size = jtk_Tape_readUncheckedShort(parser->m_tape);
 
-    zen_ConstantPool_t* constantPool = jtk_Memory_allocate(zen_ConstantPool_t, 1);
+    zen_ConstantPool_t* constantPool = zen_Arena_allocate(parser->m_arena, zen_ConstantPool_t, 1);
     constantPool->m_size = size;
-    constantPool->m_entries = jtk_Memory_allocate(zen_ConstantPoolEntry_t*, size + 1);
+    constantPool->m_entries = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolEntry_t*, size + 1);
     constantPool->m_entries[0] = NULL;
 
     int32_t index;
@@ -147,11 +154,11 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
             case ZEN_CONSTANT_POOL_TAG_INTEGER: {
                 uint32_t bytes = jtk_Tape_readUncheckedInteger(parser->m_tape);
 
-                zen_ConstantPoolInteger_t* constantPoolInteger = jtk_Memory_allocate(zen_ConstantPoolInteger_t, 1);
+                zen_ConstantPoolInteger_t* constantPoolInteger = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolInteger_t, 1);
                 constantPoolInteger->m_tag = ZEN_CONSTANT_POOL_TAG_INTEGER;
                 constantPoolInteger->m_bytes = bytes;
 
-                constantPool->m_entries[index] = constantPoolInteger;
+                constantPool->m_entries[index] = (zen_ConstantPoolEntry_t*)constantPoolInteger;
 
                 // jtk_Logger_info(parser->m_logger, ZEN_BINARY_ENTITY_PARSER_TAG, "Parsed constant pool entry `zen_ConstantPoolInteger_t`, stored at index %d.", index);
 
@@ -162,12 +169,12 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
                 uint32_t highBytes = jtk_Tape_readUncheckedInteger(parser->m_tape);
                 uint32_t lowBytes = jtk_Tape_readUncheckedInteger(parser->m_tape);
 
-                zen_ConstantPoolLong_t* constantPoolLong = jtk_Memory_allocate(zen_ConstantPoolLong_t, 1);
+                zen_ConstantPoolLong_t* constantPoolLong = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolLong_t, 1);
                 constantPoolLong->m_tag = ZEN_CONSTANT_POOL_TAG_LONG;
                 constantPoolLong->m_highBytes = highBytes;
                 constantPoolLong->m_lowBytes = lowBytes;
 
-                constantPool->m_entries[index] = constantPoolLong;
+                constantPool->m_entries[index] = (zen_ConstantPoolEntry_t*)constantPoolLong;
 
                 // jtk_Logger_info(parser->m_logger, ZEN_BINARY_ENTITY_PARSER_TAG, "Parsed constant pool entry `zen_ConstantPoolLong_t`, stored at index %d.", index);
 
@@ -177,11 +184,11 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
             case ZEN_CONSTANT_POOL_TAG_FLOAT: {
                 uint32_t bytes = jtk_Tape_readUncheckedInteger(parser->m_tape);
 
-                zen_ConstantPoolFloat_t* constantPoolFloat = jtk_Memory_allocate(zen_ConstantPoolFloat_t, 1);
+                zen_ConstantPoolFloat_t* constantPoolFloat = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolFloat_t, 1);
                 constantPoolFloat->m_tag = ZEN_CONSTANT_POOL_TAG_FLOAT;
                 constantPoolFloat->m_bytes = bytes;
 
-                constantPool->m_entries[index] = constantPoolFloat;
+                constantPool->m_entries[index] = (zen_ConstantPoolEntry_t*)constantPoolFloat;
 
                 // jtk_Logger_info(parser->m_logger, ZEN_BINARY_ENTITY_PARSER_TAG, "Parsed constant pool entry `zen_ConstantPoolFloat_t`, stored at index %d.", index);
 
@@ -192,12 +199,12 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
                 uint32_t highBytes = jtk_Tape_readUncheckedInteger(parser->m_tape);
                 uint32_t lowBytes = jtk_Tape_readUncheckedInteger(parser->m_tape);
 
-                zen_ConstantPoolDouble_t* constantPoolDouble = jtk_Memory_allocate(zen_ConstantPoolDouble_t, 1);
+                zen_ConstantPoolDouble_t* constantPoolDouble = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolDouble_t, 1);
                 constantPoolDouble->m_tag = ZEN_CONSTANT_POOL_TAG_DOUBLE;
                 constantPoolDouble->m_highBytes = highBytes;
                 constantPoolDouble->m_lowBytes = lowBytes;
 
-                constantPool->m_entries[index] = constantPoolDouble;
+                constantPool->m_entries[index] = (zen_ConstantPoolEntry_t*)constantPoolDouble;
 
                 // jtk_Logger_info(parser->m_logger, ZEN_BINARY_ENTITY_PARSER_TAG, "Parsed constant pool entry `zen_ConstantPoolDouble_t`, stored at index %d.", index);
 
@@ -207,15 +214,15 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
             case ZEN_CONSTANT_POOL_TAG_UTF8: {
                 uint16_t length = jtk_Tape_readUncheckedShort(parser->m_tape);
                 // The specification guarantees that an empty string is never stored in a constant pool.
-                uint8_t* bytes = jtk_Memory_allocate(uint8_t, length);
+                uint8_t* bytes = zen_Arena_allocate(parser->m_arena, uint8_t, length);
                 jtk_Tape_readUncheckedBytes(parser->m_tape, bytes, length);
 
-                zen_ConstantPoolUtf8_t* constantPoolUtf8 = jtk_Memory_allocate(zen_ConstantPoolUtf8_t, 1);
+                zen_ConstantPoolUtf8_t* constantPoolUtf8 = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolUtf8_t, 1);
                 constantPoolUtf8->m_tag = ZEN_CONSTANT_POOL_TAG_UTF8;
                 constantPoolUtf8->m_length = length;
                 constantPoolUtf8->m_bytes = bytes;
 
-                constantPool->m_entries[index] = constantPoolUtf8;
+                constantPool->m_entries[index] = (zen_ConstantPoolEntry_t*)constantPoolUtf8;
 
                 // jtk_Logger_info(parser->m_logger, ZEN_BINARY_ENTITY_PARSER_TAG, "Parsed constant pool entry `zen_ConstantPoolUtf8_t`, stored at index %d.", index);
 
@@ -225,11 +232,11 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
             case ZEN_CONSTANT_POOL_TAG_STRING: {
                 uint16_t stringIndex = jtk_Tape_readUncheckedShort(parser->m_tape);
 
-                zen_ConstantPoolString_t* constantPoolString = jtk_Memory_allocate(zen_ConstantPoolString_t, 1);
+                zen_ConstantPoolString_t* constantPoolString = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolString_t, 1);
                 constantPoolString->m_tag = ZEN_CONSTANT_POOL_TAG_STRING;
                 constantPoolString->m_stringIndex = stringIndex;
 
-                constantPool->m_entries[index] = constantPoolString;
+                constantPool->m_entries[index] = (zen_ConstantPoolEntry_t*)constantPoolString;
 
                 // jtk_Logger_info(parser->m_logger, ZEN_BINARY_ENTITY_PARSER_TAG, "Parsed constant pool entry `zen_ConstantPoolString_t`, stored at index %d.", index);
 
@@ -241,13 +248,13 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
                 uint16_t descriptorIndex = jtk_Tape_readUncheckedShort(parser->m_tape);
                 uint16_t nameIndex = jtk_Tape_readUncheckedShort(parser->m_tape);
 
-                zen_ConstantPoolFunction_t* constantPoolFunction = jtk_Memory_allocate(zen_ConstantPoolFunction_t, 1);
+                zen_ConstantPoolFunction_t* constantPoolFunction = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolFunction_t, 1);
                 constantPoolFunction->m_tag = ZEN_CONSTANT_POOL_TAG_FUNCTION;
                 constantPoolFunction->m_classIndex = classIndex;
                 constantPoolFunction->m_descriptorIndex = descriptorIndex;
                 constantPoolFunction->m_nameIndex = nameIndex;
 
-                constantPool->m_entries[index] = constantPoolFunction;
+                constantPool->m_entries[index] = (zen_ConstantPoolEntry_t*)constantPoolFunction;
 
                 // jtk_Logger_info(parser->m_logger, ZEN_BINARY_ENTITY_PARSER_TAG, "Parsed constant pool entry `zen_ConstantPoolFunction_t`, stored at index %d.", index);
 
@@ -255,15 +262,17 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
             }
 
             case ZEN_CONSTANT_POOL_TAG_FIELD: {
+                uint16_t classIndex = jtk_Tape_readUncheckedShort(parser->m_tape);
                 uint16_t descriptorIndex = jtk_Tape_readUncheckedShort(parser->m_tape);
                 uint16_t nameIndex = jtk_Tape_readUncheckedShort(parser->m_tape);
 
-                zen_ConstantPoolField_t* constantPoolField = jtk_Memory_allocate(zen_ConstantPoolField_t, 1);
+                zen_ConstantPoolField_t* constantPoolField = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolField_t, 1);
                 constantPoolField->m_tag = ZEN_CONSTANT_POOL_TAG_FIELD;
+                constantPoolField->m_classIndex = classIndex;
                 constantPoolField->m_descriptorIndex = descriptorIndex;
                 constantPoolField->m_nameIndex = nameIndex;
 
-                constantPool->m_entries[index] = constantPoolField;
+                constantPool->m_entries[index] = (zen_ConstantPoolEntry_t*)constantPoolField;
 
                 // jtk_Logger_info(parser->m_logger, ZEN_BINARY_ENTITY_PARSER_TAG, "Parsed constant pool entry `zen_ConstantPoolField_t`, stored at index %d.", index);
 
@@ -273,11 +282,11 @@ zen_ConstantPool_t* zen_BinaryEntityParser_parseConstantPool(
             case ZEN_CONSTANT_POOL_TAG_CLASS: {
                 uint16_t nameIndex = jtk_Tape_readUncheckedShort(parser->m_tape);
 
-                zen_ConstantPoolClass_t* constantPoolClass = jtk_Memory_allocate(zen_ConstantPoolClass_t, 1);
+                zen_ConstantPoolClass_t* constantPoolClass = zen_Arena_allocate(parser->m_arena, zen_ConstantPoolClass_t, 1);
                 constantPoolClass->m_tag = ZEN_CONSTANT_POOL_TAG_CLASS;
                 constantPoolClass->m_nameIndex = nameIndex;
 
-                constantPool->m_entries[index] = constantPoolClass;
+                constantPool->m_entries[index] = (zen_ConstantPoolEntry_t*)constantPoolClass;
 
                 // jtk_Logger_info(parser->m_logger, ZEN_BINARY_ENTITY_PARSER_TAG, "Parsed constant pool entry `zen_ConstantPoolClass_t`, stored at index %d.", index);
 
@@ -343,7 +352,7 @@ void zen_BinaryEntityParser_parseAttributeTable(
     uint16_t size = jtk_Tape_readUncheckedShort(parser->m_tape);
     attributeTable->m_size = size;
     attributeTable->m_attributes = (size > 0)?
-        jtk_Memory_allocate(zen_Attribute_t*, size) : size;
+        zen_Arena_allocate(parser->m_arena, zen_Attribute_t*, size) : NULL;
 
     for (int32_t i = 0; i < size; i++) {
         uint16_t nameIndex = jtk_Tape_readUncheckedShort(parser->m_tape);
@@ -380,7 +389,7 @@ zen_InstructionAttribute_t* zen_BinaryEntityParser_parseInstructionAttribute(
     zen_BinaryEntityParser_t* parser, uint16_t nameIndex, uint32_t length) {
     jtk_Assert_assertObject(parser, "The specified binary entity parser is null.");
 
-    zen_InstructionAttribute_t* instructionAttribute = jtk_Memory_allocate(zen_InstructionAttribute_t, 1);
+    zen_InstructionAttribute_t* instructionAttribute = zen_Arena_allocate(parser->m_arena, zen_InstructionAttribute_t, 1);
     instructionAttribute->m_nameIndex = nameIndex;
     instructionAttribute->m_length = length;
 
@@ -394,15 +403,97 @@ zen_InstructionAttribute_t* zen_BinaryEntityParser_parseInstructionAttribute(
     instructionAttribute->m_instructionLength = instructionLength;
 
     uint8_t* instructions = (instructionLength > 0)?
-        jtk_Memory_allocate(uint8_t, instructionLength) : NULL;
+        zen_Arena_allocate(parser->m_arena, uint8_t, instructionLength) : NULL;
     jtk_Tape_readUncheckedBytes(parser->m_tape, instructions, instructionLength);
     instructionAttribute->m_instructions = instructions;
+    instructionAttribute->m_decodedInstructions = NULL;
 
     zen_BinaryEntityParser_parseExceptionTable(parser, &(instructionAttribute->m_exceptionTable));
 
+    /* Compute the frame size of the function. Every value occupies exactly
+     * one slot in the operand stack and the local variable array.
+     */
+    bool verified = zen_BinaryEntityVerifier_verifyInstructionAttribute(parser->m_verifier,
+        instructionAttribute, parser->m_entityFile->m_constantPool);
+
+#ifdef ZEN_INTERPRETER_SUPERINSTRUCTIONS
+    /* Replace the frequent sequences of instructions with superinstructions.
+     * Only the instructions that were verified are rewritten.
+     */
+    if (verified) {
+        zen_SuperinstructionRewriter_rewrite(parser->m_rewriter, instructionAttribute);
+    }
+#endif
+
+#ifdef ZEN_INTERPRETER_PREDECODE
+    /* Decode the instructions for the interpreter, after the superinstructions
+     * are formed.
+     */
+    zen_InstructionDecoder_decode(instructionAttribute, parser->m_entityFile->m_constantPool);
+#endif
+
     return instructionAttribute;
 }
 
+/* Parse Stack Map Table Attribute */
+
+zen_StackMapTableAttribute_t* zen_BinaryEntityParser_parseStackMapTableAttribute(
+    zen_BinaryEntityParser_t* parser, uint16_t nameIndex, uint32_t length) {
+    jtk_Assert_assertObject(parser, "The specified binary entity parser is null.");
+
+    uint16_t localVariableCount = jtk_Tape_readUncheckedShort(parser->m_tape);
+    uint16_t size = jtk_Tape_readUncheckedShort(parser->m_tape);
+
+    /* A malformed stack map table is skipped. The stack frames of the function
+     * are scanned conservatively in such cases.
+     */
+    int32_t bitmapsSize = (int32_t)length - 4 - (size * 4);
+    if (bitmapsSize < 0) {
+        if (length > 4) {
+            jtk_Tape_skipUnchecked(parser->m_tape, length - 4);
+        }
+        return NULL;
+    }
+
+    /* The attribute is allocated in the arena, instead of with
+     * `zen_StackMapTableAttribute_new()`. A malformed attribute is abandoned
+     * there.
+     */
+    zen_StackMapTableAttribute_t* stackMapTableAttribute =
+        zen_Arena_allocate(parser->m_arena, zen_StackMapTableAttribute_t, 1);
+    stackMapTableAttribute->m_nameIndex = nameIndex;
+    stackMapTableAttribute->m_length = length;
+    stackMapTableAttribute->m_localVariableCount = localVariableCount;
+    stackMapTableAttribute->m_size = size;
+    stackMapTableAttribute->m_entries = (size > 0)?
+        zen_Arena_allocate(parser->m_arena, zen_StackMapEntry_t, size) : NULL;
+    stackMapTableAttribute->m_bitmaps = (bitmapsSize > 0)?
+        zen_Arena_allocate(parser->m_arena, uint8_t, bitmapsSize) : NULL;
+
+    /* The bitmaps of all the entries are stored in a single block of memory. */
+    int32_t bitmapIndex = 0;
+    int32_t i;
+    for (i = 0; i < size; i++) {
+        zen_StackMapEntry_t* entry = &stackMapTableAttribute->m_entries[i];
+        entry->m_offset = jtk_Tape_readUncheckedShort(parser->m_tape);
+        entry->m_operandCount = jtk_Tape_readUncheckedShort(parser->m_tape);
+        entry->m_bitmap = stackMapTableAttribute->m_bitmaps + bitmapIndex;
+
+        int32_t bitmapSize = zen_StackMapTableAttribute_getBitmapSize(
+            localVariableCount, entry->m_operandCount);
+        if (bitmapIndex + bitmapSize > bitmapsSize) {
+            /* Skip the remaining bytes of the attribute. */
+            int32_t remaining = (bitmapsSize - bitmapIndex) + ((size - i - 1) * 4);
+            jtk_Tape_skipUnchecked(parser->m_tape, remaining);
+            return NULL;
+        }
+        jtk_Tape_readUncheckedBytes(parser->m_tape, entry->m_bitmap, bitmapSize);
+        bitmapIndex += bitmapSize;
+    }
+
+    return stackMapTableAttribute;
+}
+
 /* Parse Exception Table */
 
 void zen_BinaryEntityParser_parseExceptionTable(zen_BinaryEntityParser_t* parser,
@@ -413,7 +504,7 @@ void zen_BinaryEntityParser_parseExceptionTable(zen_BinaryEntityParser_t* parser
     uint16_t size = jtk_Tape_readUncheckedShort(parser->m_tape);
     exceptionTable->m_size = size;
     exceptionTable->m_exceptionHandlerSites = (size > 0)?
-        jtk_Memory_allocate(zen_ExceptionHandlerSite_t*, size) : NULL;
+        zen_Arena_allocate(parser->m_arena, zen_ExceptionHandlerSite_t*, size) : NULL;
 
     int32_t i;
     for (i = 0; i < size; i++) {
@@ -428,7 +519,7 @@ zen_ExceptionHandlerSite_t* zen_BinaryEntityParser_parseExceptionHandlerSite(
     zen_BinaryEntityParser_t* parser) {
     jtk_Assert_assertObject(parser, "The specified binary entity parser is null.");
 
-    zen_ExceptionHandlerSite_t* exceptionHandlerSite = jtk_Memory_allocate(zen_ExceptionHandlerSite_t, 1);
+    zen_ExceptionHandlerSite_t* exceptionHandlerSite = zen_Arena_allocate(parser->m_arena, zen_ExceptionHandlerSite_t, 1);
 
     uint16_t startIndex = jtk_Tape_readUncheckedShort(parser->m_tape);
     exceptionHandlerSite->m_startIndex = startIndex;
@@ -450,7 +541,7 @@ zen_ExceptionHandlerSite_t* zen_BinaryEntityParser_parseExceptionHandlerSite(
 zen_FunctionEntity_t* zen_BinaryEntityParser_parseFunction(zen_BinaryEntityParser_t* parser) {
     jtk_Assert_assertObject(parser, "The specified binary entity parser is null.");
 
-    zen_FunctionEntity_t* functionEntity = jtk_Memory_allocate(zen_FunctionEntity_t, 1);
+    zen_FunctionEntity_t* functionEntity = zen_Arena_allocate(parser->m_arena, zen_FunctionEntity_t, 1);
 
     // Flags
 
@@ -477,7 +568,7 @@ zen_FunctionEntity_t* zen_BinaryEntityParser_parseFunction(zen_BinaryEntityParse
 zen_FieldEntity_t* zen_BinaryEntityParser_parseField(zen_BinaryEntityParser_t* parser) {
     jtk_Assert_assertObject(parser, "The specified binary entity parser is null.");
 
-    zen_FieldEntity_t* fieldEntity = jtk_Memory_allocate(zen_FieldEntity_t, 1);
+    zen_FieldEntity_t* fieldEntity = zen_Arena_allocate(parser->m_arena, zen_FieldEntity_t, 1);
 
     // Flags
 
@@ -504,7 +595,7 @@ zen_FieldEntity_t* zen_BinaryEntityParser_parseField(zen_BinaryEntityParser_t* p
 zen_ClassEntity_t* zen_BinaryEntityParser_parseClass(zen_BinaryEntityParser_t* parser) {
     jtk_Assert_assertObject(parser, "The specified binary entity parser is null.");
 
-    zen_ClassEntity_t* classEntity = jtk_Memory_allocate(zen_ClassEntity_t, 1);
+    zen_ClassEntity_t* classEntity = zen_Arena_allocate(parser->m_arena, zen_ClassEntity_t, 1);
     classEntity->m_type = ZEN_ENTITY_TYPE_CLASS;
 
     uint16_t flags = jtk_Tape_readUncheckedShort(parser->m_tape);
@@ -516,7 +607,7 @@ zen_ClassEntity_t* zen_BinaryEntityParser_parseClass(zen_BinaryEntityParser_t* p
     uint16_t superclassCount = jtk_Tape_readUncheckedShort(parser->m_tape);
     classEntity->m_superclassCount = superclassCount;
 
-    uint16_t* superclasses = zen_Memory_allocate(uint16_t, superclassCount);
+    uint16_t* superclasses = zen_Arena_allocate(parser->m_arena, uint16_t, superclassCount);
     int32_t i;
     for (i = 0; i < superclassCount; i++) {
         superclasses[i] = jtk_Tape_readUncheckedShort(parser->m_tape);
@@ -530,7 +621,7 @@ zen_ClassEntity_t* zen_BinaryEntityParser_parseClass(zen_BinaryEntityParser_t* p
     uint16_t fieldCount = jtk_Tape_readUncheckedShort(parser->m_tape);
     classEntity->m_fieldCount = fieldCount;
     classEntity->m_fields = (fieldCount > 0)?
-        jtk_Memory_allocate(zen_FieldEntity_t*, fieldCount) : NULL;
+        zen_Arena_allocate(parser->m_arena, zen_FieldEntity_t*, fieldCount) : NULL;
 
     int32_t j;
     for (j = 0; j < fieldCount; j++) {
@@ -543,7 +634,7 @@ zen_ClassEntity_t* zen_BinaryEntityParser_parseClass(zen_BinaryEntityParser_t* p
     uint16_t functionCount = jtk_Tape_readUncheckedShort(parser->m_tape);
     classEntity->m_functionCount = functionCount;
     classEntity->m_functions = (functionCount > 0)?
-        jtk_Memory_allocate(zen_FunctionEntity_t*, functionCount) : NULL;
+        zen_Arena_allocate(parser->m_arena, zen_FunctionEntity_t*, functionCount) : NULL;
 
     int32_t k;
     for (k = 0; k < functionCount; k++) {
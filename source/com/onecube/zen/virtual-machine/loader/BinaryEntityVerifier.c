@@ -16,32 +16,358 @@
 
 // Monday, June 11, 2018
 
-#include <com/onecube/zen/vm/BinaryEntityVerifier.h>
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/feb/BinaryEntityFormat.h>
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+#include <com/onecube/zen/virtual-machine/feb/InstructionEffect.h>
+#include <com/onecube/zen/virtual-machine/feb/PrimitiveType.h>
+#include <com/onecube/zen/virtual-machine/feb/SwitchInstruction.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolFunction.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolTag.h>
+#include <com/onecube/zen/virtual-machine/loader/BinaryEntityVerifier.h>
+#include <com/onecube/zen/virtual-machine/object/Function.h>
 
 /*******************************************************************************
  * BinaryEntityVerifier                                                        *
  *******************************************************************************/
 
-void zen_BinaryEntityVerifier_verifyMagicNumber(zen_BinaryEntityVerifier_t* verifier,
+/* Constructor */
+
+zen_BinaryEntityVerifier_t* zen_BinaryEntityVerifier_new() {
+    zen_BinaryEntityVerifier_t* verifier = jtk_Memory_allocate(zen_BinaryEntityVerifier_t, 1);
+
+    return verifier;
+}
+
+/* Destructor */
+
+void zen_BinaryEntityVerifier_delete(zen_BinaryEntityVerifier_t* verifier) {
+    jtk_Assert_assertObject(verifier, "The specified binary entity verifier is null.");
+
+    jtk_Memory_deallocate(verifier);
+}
+
+/* Verify Magic Number */
+
+bool zen_BinaryEntityVerifier_verifyMagicNumber(zen_BinaryEntityVerifier_t* verifier,
     uint32_t magicNumber) {
     jtk_Assert_assertObject(verifier, "The specified binary entity verifier is null.");
 
-    if (magicNumber != ZEN_BINARY_ENTITY_FORMAT_MAGIC_NUMBER) {
-        zen_Logger_e("Binary entity file magic number verified: incompatible");
-        // throw UnknownEntityMagicNumberException
-    }
+    // throw UnknownEntityMagicNumberException
+    return magicNumber == ZEN_BINARY_ENTITY_FORMAT_MAGIC_NUMBER;
 }
 
-void zen_BinaryEntityVerifier_verifyVersion(zen_BinaryEntityVerifier_t* verifier,
+/* Verify Version */
+
+bool zen_BinaryEntityVerifier_verifyVersion(zen_BinaryEntityVerifier_t* verifier,
     zen_FebVersion_t* fileVersion) {
     jtk_Assert_assertObject(verifier, "The specified binary entity verifier is null.");
 
-    zen_FebVersion_t* machineVersion = zen_VirtualMachine_getFebVersion(verifier->m_machine);
-    if (zen_FebVersionHelper_compare(fileVersion, machineVersion) >= 0) {
-        zen_Logger_i("Binary entity file version verified: compatibile");
+    // throw UnsupportedEntityVersionException
+    return (fileVersion->m_majorVersion < ZEN_BINARY_ENTITY_FORMAT_MAJOR_VERSION) ||
+        ((fileVersion->m_majorVersion == ZEN_BINARY_ENTITY_FORMAT_MAJOR_VERSION) &&
+        (fileVersion->m_minorVersion <= ZEN_BINARY_ENTITY_FORMAT_MINOR_VERSION));
+}
+
+/* Get Instruction Length */
+
+int32_t zen_BinaryEntityVerifier_getInstructionLength(zen_BinaryEntityVerifier_t* verifier,
+    const uint8_t* instructions, int32_t ip, int32_t length) {
+    jtk_Assert_assertObject(verifier, "The specified binary entity verifier is null.");
+
+    int32_t start = ip;
+    bool wide = (instructions[ip] == ZEN_BYTE_CODE_WIDE);
+    if (wide) {
+        ip++;
+    }
+
+    if ((ip >= length) || (instructions[ip] > ZEN_BYTE_CODE_WIDE)) {
+        return -1;
+    }
+
+    uint8_t byteCode = instructions[ip++];
+    if ((byteCode == ZEN_BYTE_CODE_SWITCH_TABLE) || (byteCode == ZEN_BYTE_CODE_SWITCH_SEARCH)) {
+        /* The switch instructions cannot be widened. */
+        return wide? -1 : zen_SwitchInstruction_getLength(instructions, start, length);
+    }
+
+    const zen_InstructionEffect_t* effect = &zen_InstructionEffect_table[byteCode];
+    int32_t argumentLength = effect->m_argumentLength;
+    if (wide && (effect->m_local == ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT)) {
+        argumentLength *= 2;
+    }
+
+    return ((ip + argumentLength) <= length)? (ip + argumentLength - start) : -1;
+}
+
+/* Verify Instruction Attribute */
+
+/* Determine the number of operands popped and pushed by an invocation from the
+ * descriptor of the function. The receiver of an instance function is an
+ * additional operand.
+ */
+static bool zen_BinaryEntityVerifier_getInvocationEffect(zen_ConstantPool_t* constantPool,
+    uint16_t index, bool instance, int32_t* popCount, int32_t* pushCount) {
+    if ((index > constantPool->m_size) || (constantPool->m_entries[index] == NULL) ||
+        (constantPool->m_entries[index]->m_tag != ZEN_CONSTANT_POOL_TAG_FUNCTION)) {
+        return false;
+    }
+
+    zen_ConstantPoolFunction_t* functionEntry =
+        (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
+    zen_ConstantPoolUtf8_t* descriptorEntry =
+        (zen_ConstantPoolUtf8_t*)constantPool->m_entries[functionEntry->m_descriptorIndex];
+
+    *popCount = zen_Function_countParameterSlots(descriptorEntry->m_bytes,
+        descriptorEntry->m_length) + (instance? 1 : 0);
+    *pushCount = ((descriptorEntry->m_length > 0) && (descriptorEntry->m_bytes[0] != 'v'))? 1 : 0;
+
+    return true;
+}
+
+/* Record the depth of the operand stack at the target of a branch. Returns
+ * false if the target is out of range, or if the paths that merge at the
+ * target disagree on the depth of the operand stack.
+ */
+static bool zen_BinaryEntityVerifier_mergeBranch(int32_t* depths, int32_t* worklist,
+    int32_t* worklistSize, int32_t target, int32_t depth, int32_t length) {
+    if ((target < 0) || (target >= length)) {
+        return false;
+    }
+
+    if (depths[target] == -1) {
+        depths[target] = depth;
+        worklist[(*worklistSize)++] = target;
+    }
+
+    return depths[target] == depth;
+}
+
+/* Merge the operand stack at the targets of a switch instruction. The keys of
+ * a `switch_search` instruction should be sorted in ascending order, without
+ * duplicates. Otherwise, the binary search in the interpreter fails.
+ */
+static bool zen_BinaryEntityVerifier_mergeSwitch(const uint8_t* instructions, int32_t start,
+    int32_t* depths, int32_t* worklist, int32_t* worklistSize, int32_t depth, int32_t length) {
+    int32_t index = zen_SwitchInstruction_getArgumentIndex(start);
+    int32_t defaultOffset = zen_SwitchInstruction_readInteger(instructions + index);
+    if (!zen_BinaryEntityVerifier_mergeBranch(depths, worklist, worklistSize,
+        start + defaultOffset, depth, length)) {
+        return false;
+    }
+
+    const uint8_t* offsets;
+    int32_t count;
+    int32_t i;
+    if (instructions[start] == ZEN_BYTE_CODE_SWITCH_TABLE) {
+        int32_t low = zen_SwitchInstruction_readInteger(instructions + index + 4);
+        int32_t high = zen_SwitchInstruction_readInteger(instructions + index + 8);
+        count = high - low + 1;
+        offsets = instructions + index + ZEN_SWITCH_INSTRUCTION_TABLE_HEADER_SIZE;
     }
     else {
-        zen_Logger_e("Binary entity file version verified: incompatible");
-        // throw UnsupportedEntityVersionException
+        count = zen_SwitchInstruction_readInteger(instructions + index + 4);
+        const uint8_t* keys = instructions + index + ZEN_SWITCH_INSTRUCTION_SEARCH_HEADER_SIZE;
+        for (i = 1; i < count; i++) {
+            if (zen_SwitchInstruction_readInteger(keys + ((i - 1) * 4)) >=
+                zen_SwitchInstruction_readInteger(keys + (i * 4))) {
+                return false;
+            }
+        }
+        offsets = keys + (count * 4);
+    }
+
+    for (i = 0; i < count; i++) {
+        int32_t offset = zen_SwitchInstruction_readInteger(offsets + (i * 4));
+        if (!zen_BinaryEntityVerifier_mergeBranch(depths, worklist, worklistSize,
+            start + offset, depth, length)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool zen_BinaryEntityVerifier_verifyInstructionAttribute(zen_BinaryEntityVerifier_t* verifier,
+    zen_InstructionAttribute_t* instructionAttribute, zen_ConstantPool_t* constantPool) {
+    jtk_Assert_assertObject(verifier, "The specified binary entity verifier is null.");
+    jtk_Assert_assertObject(instructionAttribute, "The specified instruction attribute is null.");
+
+    int32_t length = instructionAttribute->m_instructionLength;
+    uint8_t* instructions = instructionAttribute->m_instructions;
+    if (length == 0) {
+        return true;
     }
+
+    zen_ExceptionTable_t* exceptionTable = &instructionAttribute->m_exceptionTable;
+
+    /* The depth of the operand stack before each instruction is recorded. An
+     * offset which was not reached yet is marked with -1. Every offset is
+     * enqueued at most once.
+     */
+    int32_t* depths = jtk_Memory_allocate(int32_t, length);
+    int32_t* worklist = jtk_Memory_allocate(int32_t, length);
+    int32_t worklistSize = 0;
+    int32_t i;
+    for (i = 0; i < length; i++) {
+        depths[i] = -1;
+    }
+
+    depths[0] = 0;
+    worklist[worklistSize++] = 0;
+
+    /* The exception handlers begin with the exception on the operand stack. */
+    for (i = 0; i < exceptionTable->m_size; i++) {
+        int32_t handlerIndex = exceptionTable->m_exceptionHandlerSites[i]->m_handlerIndex;
+        if ((handlerIndex < length) && (depths[handlerIndex] == -1)) {
+            depths[handlerIndex] = 1;
+            worklist[worklistSize++] = handlerIndex;
+        }
+    }
+
+    int32_t maxStackSize = 0;
+    int32_t localVariableCount = 0;
+    bool valid = true;
+    while (valid && (worklistSize > 0)) {
+        int32_t ip = worklist[--worklistSize];
+        int32_t depth = depths[ip];
+        if (depth > maxStackSize) {
+            maxStackSize = depth;
+        }
+
+        while (true) {
+            int32_t start = ip;
+            bool wide = (instructions[ip] == ZEN_BYTE_CODE_WIDE);
+            if (wide) {
+                ip++;
+            }
+
+            if ((ip >= length) || (instructions[ip] > ZEN_BYTE_CODE_WIDE)) {
+                valid = false;
+                break;
+            }
+
+            uint8_t byteCode = instructions[ip++];
+            const zen_InstructionEffect_t* effect = &zen_InstructionEffect_table[byteCode];
+
+            /* In the wide mode, the local variable index and the constant of
+             * the `increment_i` instruction occupy two bytes each.
+             */
+            int32_t argumentLength = effect->m_argumentLength;
+            if (wide && (effect->m_local == ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT)) {
+                argumentLength *= 2;
+            }
+            if ((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_SWITCH) != 0) {
+                int32_t switchLength = zen_SwitchInstruction_getLength(instructions, start, length);
+                if (wide || (switchLength < 0)) {
+                    valid = false;
+                    break;
+                }
+                argumentLength = switchLength - 1;
+            }
+            if ((ip + argumentLength) > length) {
+                valid = false;
+                break;
+            }
+
+            /* The component type of a primitive array indexes a table in the
+             * interpreter.
+             */
+            if ((byteCode == ZEN_BYTE_CODE_NEW_ARRAY) &&
+                (instructions[ip] > ZEN_PRIMITIVE_TYPE_DECIMAL_64)) {
+                valid = false;
+                break;
+            }
+
+            int32_t popCount = effect->m_popCount;
+            int32_t pushCount = effect->m_pushCount;
+            if ((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_VARIABLE) != 0) {
+                if ((byteCode >= ZEN_BYTE_CODE_INVOKE_SPECIAL) && (byteCode <= ZEN_BYTE_CODE_INVOKE_STATIC)) {
+                    uint16_t index = (instructions[ip] << 8) | instructions[ip + 1];
+                    valid = zen_BinaryEntityVerifier_getInvocationEffect(constantPool, index,
+                        byteCode != ZEN_BYTE_CODE_INVOKE_STATIC, &popCount, &pushCount);
+                }
+                else if (byteCode == ZEN_BYTE_CODE_NEW_ARRAY_AN) {
+                    popCount = instructions[ip + 2];
+                    pushCount = 1;
+                }
+                else {
+                    valid = false;
+                }
+
+                if (!valid) {
+                    break;
+                }
+            }
+
+            if (effect->m_local != ZEN_INSTRUCTION_EFFECT_LOCAL_NONE) {
+                int32_t index = effect->m_local;
+                if (index == ZEN_INSTRUCTION_EFFECT_LOCAL_ARGUMENT) {
+                    index = wide? ((instructions[ip] << 8) | instructions[ip + 1]) : instructions[ip];
+                }
+                if ((index + 1) > localVariableCount) {
+                    localVariableCount = index + 1;
+                }
+            }
+
+            if (depth < popCount) {
+                /* The operand stack underflows. */
+                valid = false;
+                break;
+            }
+            depth = depth - popCount + pushCount;
+            if (depth > maxStackSize) {
+                maxStackSize = depth;
+            }
+
+            if ((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_BRANCH) != 0) {
+                /* The offset is relative to the first byte of the instruction. */
+                int16_t offset = (int16_t)((instructions[ip] << 8) | instructions[ip + 1]);
+                if (!zen_BinaryEntityVerifier_mergeBranch(depths, worklist, &worklistSize,
+                    start + offset, depth, length)) {
+                    valid = false;
+                    break;
+                }
+            }
+            else if ((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_SWITCH) != 0) {
+                if (!zen_BinaryEntityVerifier_mergeSwitch(instructions, start, depths, worklist,
+                    &worklistSize, depth, length)) {
+                    valid = false;
+                    break;
+                }
+            }
+
+            ip += argumentLength;
+            if (((effect->m_flags & ZEN_INSTRUCTION_EFFECT_FLAG_TERMINAL) != 0) || (ip >= length)) {
+                /* A function which runs off the end of its instructions returns
+                 * to its caller.
+                 */
+                break;
+            }
+
+            if (depths[ip] == -1) {
+                depths[ip] = depth;
+            }
+            else {
+                /* The rest of the path was already simulated. */
+                valid = (depths[ip] == depth);
+                break;
+            }
+        }
+    }
+
+    if (valid) {
+        if (maxStackSize > instructionAttribute->m_maxStackSize) {
+            instructionAttribute->m_maxStackSize = maxStackSize;
+        }
+        if (localVariableCount > instructionAttribute->m_localVariableCount) {
+            instructionAttribute->m_localVariableCount = localVariableCount;
+        }
+    }
+
+    jtk_Memory_deallocate(worklist);
+    jtk_Memory_deallocate(depths);
+
+    return valid;
 }
\ No newline at end of file
@@ -20,6 +20,8 @@
 #include <jtk/collection/map/HashMapEntry.h>
 #include <jtk/core/StringObjectAdapter.h>
 
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolClass.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolUtf8.h>
 #include <com/onecube/zen/virtual-machine/loader/ClassLoader.h>
 
 /*******************************************************************************
@@ -79,7 +81,7 @@ zen_Class_t* zen_ClassLoader_findClass(zen_ClassLoader_t* classLoader,
 
         /* An entity file was found. Convert it to a class. */
         if (entityFile != NULL) {
-            class0 = zen_ClassLoader_loadFromEntityFile(classLoader, descriptor,
+            class0 = zen_ClassLoader_loadFromEntityFile(classLoader, descriptorString,
                 entityFile);
             destroyDescriptorString = false;
         }
@@ -102,6 +104,51 @@ zen_Class_t* zen_ClassLoader_loadFromEntityFile(zen_ClassLoader_t* classLoader,
     
     zen_Class_t* class0 = zen_Class_newFromEntityFile(entityFile);
     jtk_HashMap_put(classLoader->m_classes, descriptor, class0);
-    
+
+    /* The superclasses are loaded and linked before the class is linked. The
+     * class is registered beforehand, so that a cycle in the hierarchy does not
+     * recurse forever. A superclass which cannot be loaded, or which is not
+     * linked because of such a cycle, is ignored.
+     */
+    zen_Entity_t* entity = &entityFile->m_entity;
+    zen_ConstantPool_t* constantPool = entityFile->m_constantPool;
+    int32_t superclassCount = entity->m_superclassCount;
+    zen_Class_t** superclasses = zen_Arena_allocate(entityFile->m_arena, zen_Class_t*,
+        superclassCount + 1);
+    int32_t linkedCount = 0;
+    int32_t i;
+    for (i = 0; i < superclassCount; i++) {
+        zen_ConstantPoolClass_t* classEntry =
+            (zen_ConstantPoolClass_t*)constantPool->m_entries[entity->m_superclasses[i]];
+        zen_ConstantPoolUtf8_t* nameEntry =
+            (zen_ConstantPoolUtf8_t*)constantPool->m_entries[classEntry->m_nameIndex];
+
+        jtk_CString_t* superclassDescriptor = jtk_CString_newEx(nameEntry->m_bytes,
+            nameEntry->m_length);
+        zen_Class_t* superclass = zen_ClassLoader_findClass(classLoader,
+            superclassDescriptor->m_value);
+        jtk_CString_delete(superclassDescriptor);
+
+        if ((superclass != NULL) && (superclass->m_depth >= 0)) {
+            superclasses[linkedCount++] = superclass;
+        }
+    }
+    zen_Class_link(class0, superclasses, linkedCount);
+
     return class0;
 }
+
+// Roots
+
+void zen_ClassLoader_visitRoots(zen_ClassLoader_t* classLoader,
+    zen_RootVisitor_t* visitor) {
+    jtk_Assert_assertObject(classLoader, "The specified class loader is null.");
+
+    jtk_Iterator_t* entryIterator = jtk_HashMap_getEntryIterator(classLoader->m_classes);
+    while (jtk_Iterator_hasNext(entryIterator)) {
+        jtk_HashMapEntry_t* entry = (jtk_HashMapEntry_t*)jtk_Iterator_getNext(entryIterator);
+        zen_Class_t* class0 = (zen_Class_t*)jtk_HashMapEntry_getValue(entry);
+        zen_Class_visitRoots(class0, visitor);
+    }
+    jtk_Iterator_delete(entryIterator);
+}
@@ -32,7 +32,7 @@
  * EntityLoader                                                                *
  *******************************************************************************/
 
-zen_EntityLoader_t* zen_EntityLoader_new() {
+zen_EntityLoader_t* zen_EntityLoader_new(zen_ImmortalGeneration_t* immortalGeneration) {
     jtk_ObjectAdapter_t* stringObjectAdapter = jtk_StringObjectAdapter_getInstance();
 
     zen_EntityLoader_t* loader = jtk_Memory_allocate(zen_EntityLoader_t, 1);
@@ -42,14 +42,16 @@ zen_EntityLoader_t* zen_EntityLoader_new() {
         ZEN_ENTITY_LOADER_DEFAULT_ENTITIES_MAP_CAPCITY, JTK_HASH_MAP_DEFAULT_LOAD_FACTOR);
     // loader->m_parser = zen_BinaryEntityParser_new(attributeParseRules, );
     loader->m_attributeParseRules = zen_AttributeParseRules_new();
+    loader->m_immortalGeneration = immortalGeneration;
 
     return loader;
 }
 
-zen_EntityLoader_t* zen_EntityLoader_newWithEntityDirectories(jtk_Iterator_t* entityDirectoryIterator) {
+zen_EntityLoader_t* zen_EntityLoader_newWithEntityDirectories(jtk_Iterator_t* entityDirectoryIterator,
+    zen_ImmortalGeneration_t* immortalGeneration) {
     jtk_ObjectAdapter_t* stringObjectAdapter = jtk_StringObjectAdapter_getInstance();
 
-    zen_EntityLoader_t* loader = zen_EntityLoader_new();
+    zen_EntityLoader_t* loader = zen_EntityLoader_new(immortalGeneration);
     while (jtk_Iterator_hasNext(entityDirectoryIterator)) {
         jtk_CString_t* directory = jtk_Iterator_getNext(entityDirectoryIterator);
         zen_EntityLoader_addDirectory_s(loader, directory);
@@ -77,10 +79,15 @@ void zen_EntityLoader_delete(zen_EntityLoader_t* loader) {
         jtk_CString_t* descriptor = (jtk_CString_t*)jtk_HashMapEntry_getKey(entry);
         jtk_CString_delete(descriptor);
 
-#warning "Should the entity be destroyed this way?"
-        zen_EntityFile_t* entityFile = (zen_EntityFile_t*)jtk_HashMapEntry_getValue(entry->m_value);
-        // zen_EntityFile_delete(entityFile);
+        /* The entity file, along with the metadata derived from it, is freed
+         * with its arena. Therefore, the classes created from the entity files
+         * must be destroyed beforehand.
+         */
+        zen_EntityFile_t* entityFile = (zen_EntityFile_t*)jtk_HashMapEntry_getValue(entry);
+        zen_ImmortalGeneration_deleteArena(loader->m_immortalGeneration, entityFile->m_arena);
     }
+    jtk_Iterator_delete(entryIterator);
+    jtk_HashMap_delete(loader->m_entities);
 
     zen_AttributeParseRules_delete(loader->m_attributeParseRules);
 
@@ -133,7 +140,7 @@ zen_EntityFile_t* zen_EntityLoader_findEntity(zen_EntityLoader_t* loader, const
     jtk_Assert_assertObject(loader, "The specified entity loader is null.");
     jtk_Assert_assertObject(descriptor, "The specified descriptor is null.");
 
-    zen_EntityFile_t* result = (zen_EntityFile_t*)jtk_HashMap_getValue(loader->m_entities, descriptor);
+    zen_EntityFile_t* result = zen_EntityLoader_getEntity(loader, descriptor);
     if (result == NULL) {
         result = zen_EntityLoader_loadEntity(loader, descriptor);
     }
@@ -281,8 +288,13 @@ zen_EntityFile_t* zen_EntityLoader_loadEntityFromHandle(zen_EntityLoader_t* load
 
         jtk_Array_t* input = jtk_InputStreamHelper_toArray(inputStream);
 
+        /* All the metadata derived from the entity file is allocated in a
+         * single arena.
+         */
+        zen_Arena_t* arena = zen_ImmortalGeneration_newArena(loader->m_immortalGeneration,
+            input->m_size * ZEN_ENTITY_LOADER_ARENA_SIZE_FACTOR);
         zen_BinaryEntityParser_t* parser = zen_BinaryEntityParser_new(
-            loader->m_attributeParseRules, input->m_values, input->m_size);
+            loader->m_attributeParseRules, arena, input->m_values, input->m_size);
         result = zen_BinaryEntityParser_parse(parser, 
 inputStream);
 
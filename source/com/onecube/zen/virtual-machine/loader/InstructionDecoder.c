@@ -0,0 +1,197 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolDouble.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolFloat.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolInteger.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolLong.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolTag.h>
+#include <com/onecube/zen/virtual-machine/loader/InstructionDecoder.h>
+
+/*******************************************************************************
+ * InstructionDecoder                                                          *
+ *******************************************************************************/
+
+/* Resolve Constant */
+
+/* Only the numeric constants are resolved. A string constant requires an
+ * object, which is created by the interpreter.
+ */
+static void zen_InstructionDecoder_resolveConstant(zen_DecodedInstruction_t* record,
+    zen_ConstantPool_t* constantPool) {
+    int32_t index = record->m_operand;
+    if ((constantPool == NULL) || (index > constantPool->m_size)) {
+        return;
+    }
+
+    zen_ConstantPoolEntry_t* entry = constantPool->m_entries[index];
+    if (entry == NULL) {
+        return;
+    }
+
+    switch (entry->m_tag) {
+        case ZEN_CONSTANT_POOL_TAG_INTEGER: {
+            record->m_constant.m_integer = zen_ConstantPoolInteger_getValue(
+                (zen_ConstantPoolInteger_t*)entry);
+            record->m_flags |= ZEN_DECODED_INSTRUCTION_FLAG_CONSTANT;
+            break;
+        }
+
+        case ZEN_CONSTANT_POOL_TAG_LONG: {
+            record->m_constant.m_long = zen_ConstantPoolLong_getValue(
+                (zen_ConstantPoolLong_t*)entry);
+            record->m_flags |= ZEN_DECODED_INSTRUCTION_FLAG_CONSTANT;
+            break;
+        }
+
+        case ZEN_CONSTANT_POOL_TAG_FLOAT: {
+            record->m_constant.m_float = zen_ConstantPoolFloat_getValue(
+                (zen_ConstantPoolFloat_t*)entry);
+            record->m_flags |= ZEN_DECODED_INSTRUCTION_FLAG_CONSTANT;
+            break;
+        }
+
+        case ZEN_CONSTANT_POOL_TAG_DOUBLE: {
+            record->m_constant.m_double = zen_ConstantPoolDouble_getValue(
+                (zen_ConstantPoolDouble_t*)entry);
+            record->m_flags |= ZEN_DECODED_INSTRUCTION_FLAG_CONSTANT;
+            break;
+        }
+    }
+}
+
+/* Decode */
+
+zen_DecodedInstruction_t* zen_InstructionDecoder_decode(
+    zen_InstructionAttribute_t* instructionAttribute, zen_ConstantPool_t* constantPool) {
+    jtk_Assert_assertObject(instructionAttribute, "The specified instruction attribute is null.");
+
+    int32_t length = instructionAttribute->m_instructionLength;
+    const uint8_t* instructions = instructionAttribute->m_instructions;
+    zen_DecodedInstruction_t* records = jtk_Memory_allocate(zen_DecodedInstruction_t, length + 1);
+
+    int32_t ip;
+    for (ip = 0; ip <= length; ip++) {
+        zen_DecodedInstruction_t* record = &records[ip];
+        record->m_handler = NULL;
+        record->m_flags = 0;
+        record->m_operand = 0;
+        /* A branch whose operand is truncated leaves the function. */
+        record->m_target = length;
+        record->m_constant.m_long = 0;
+
+        /* The interpreter treats the last byte of a function as a return. */
+        if ((ip + 1) >= length) {
+            record->m_byteCode = ZEN_BYTE_CODE_RETURN;
+            continue;
+        }
+
+        uint8_t byteCode = instructions[ip];
+        record->m_byteCode = byteCode;
+
+        /* The operand of a branch is relative to the first byte of the
+         * branch instruction.
+         */
+        bool hasShortOperand = (ip + 2) < length;
+        uint16_t shortOperand = hasShortOperand?
+            (uint16_t)((instructions[ip + 1] << 8) | instructions[ip + 2]) : 0;
+
+        switch (byteCode) {
+            case ZEN_BYTE_CODE_JUMP:
+            case ZEN_BYTE_CODE_JUMP_EQ0_I:
+            case ZEN_BYTE_CODE_JUMP_NE0_I:
+            case ZEN_BYTE_CODE_JUMP_LT0_I:
+            case ZEN_BYTE_CODE_JUMP_GT0_I:
+            case ZEN_BYTE_CODE_JUMP_LE0_I:
+            case ZEN_BYTE_CODE_JUMP_GE0_I:
+            case ZEN_BYTE_CODE_JUMP_EQ_I:
+            case ZEN_BYTE_CODE_JUMP_NE_I:
+            case ZEN_BYTE_CODE_JUMP_LT_I:
+            case ZEN_BYTE_CODE_JUMP_GT_I:
+            case ZEN_BYTE_CODE_JUMP_LE_I:
+            case ZEN_BYTE_CODE_JUMP_GE_I:
+            case ZEN_BYTE_CODE_JUMP_EQ_A:
+            case ZEN_BYTE_CODE_JUMP_NE_A:
+            case ZEN_BYTE_CODE_JUMP_EQN_A:
+            case ZEN_BYTE_CODE_JUMP_NEN_A: {
+                if (hasShortOperand) {
+                    int32_t target = ip + (int16_t)shortOperand;
+                    /* A branch outside the function leaves the function. */
+                    record->m_operand = (int16_t)shortOperand;
+                    record->m_target = ((target >= 0) && (target <= length))? target : length;
+                }
+                break;
+            }
+
+            case ZEN_BYTE_CODE_LOAD_I:
+            case ZEN_BYTE_CODE_LOAD_L:
+            case ZEN_BYTE_CODE_LOAD_F:
+            case ZEN_BYTE_CODE_LOAD_D:
+            case ZEN_BYTE_CODE_LOAD_A:
+            case ZEN_BYTE_CODE_STORE_I:
+            case ZEN_BYTE_CODE_STORE_L:
+            case ZEN_BYTE_CODE_STORE_F:
+            case ZEN_BYTE_CODE_STORE_D:
+            case ZEN_BYTE_CODE_STORE_A: {
+                record->m_operand = instructions[ip + 1];
+                break;
+            }
+
+            case ZEN_BYTE_CODE_LOAD_CPR: {
+                record->m_operand = instructions[ip + 1];
+                zen_InstructionDecoder_resolveConstant(record, constantPool);
+                break;
+            }
+
+            case ZEN_BYTE_CODE_PUSH_B: {
+                record->m_operand = (int8_t)instructions[ip + 1];
+                break;
+            }
+
+            case ZEN_BYTE_CODE_NEW_ARRAY: {
+                record->m_operand = instructions[ip + 1];
+                break;
+            }
+
+            case ZEN_BYTE_CODE_PUSH_S: {
+                record->m_operand = (int16_t)shortOperand;
+                break;
+            }
+
+            case ZEN_BYTE_CODE_CHECK_CAST:
+            case ZEN_BYTE_CODE_NEW:
+            case ZEN_BYTE_CODE_NEW_ARRAY_A:
+            case ZEN_BYTE_CODE_INVOKE_VIRTUAL:
+            case ZEN_BYTE_CODE_INVOKE_STATIC:
+            case ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD:
+            case ZEN_BYTE_CODE_LOAD_STATIC_FIELD:
+            case ZEN_BYTE_CODE_STORE_INSTANCE_FIELD:
+            case ZEN_BYTE_CODE_STORE_STATIC_FIELD: {
+                record->m_operand = shortOperand;
+                break;
+            }
+        }
+    }
+
+    instructionAttribute->m_decodedInstructions = records;
+
+    return records;
+}
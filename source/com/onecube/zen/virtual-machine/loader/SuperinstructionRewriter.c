@@ -0,0 +1,176 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+#include <com/onecube/zen/virtual-machine/loader/SuperinstructionRewriter.h>
+#include <com/onecube/zen/virtual-machine/processor/Superinstruction.h>
+
+/*******************************************************************************
+ * SuperinstructionPattern                                                     *
+ *******************************************************************************/
+
+#define ZEN_SUPERINSTRUCTION_PATTERN_MAX_SIZE 4
+
+/**
+ * Describes a sequence of instructions replaced by a superinstruction. The
+ * byte code of each instruction in the sequence lies within an inclusive
+ * range.
+ */
+struct zen_SuperinstructionPattern_t {
+    int32_t m_size;
+    uint8_t m_first[ZEN_SUPERINSTRUCTION_PATTERN_MAX_SIZE];
+    uint8_t m_last[ZEN_SUPERINSTRUCTION_PATTERN_MAX_SIZE];
+    uint8_t m_superinstruction;
+};
+
+typedef struct zen_SuperinstructionPattern_t zen_SuperinstructionPattern_t;
+
+/* The longer patterns are listed first, so that they are preferred. */
+static const zen_SuperinstructionPattern_t zen_SuperinstructionPattern_table[] = {
+    {
+        4,
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_ADD_I, ZEN_BYTE_CODE_STORE_I },
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_ADD_I, ZEN_BYTE_CODE_STORE_I },
+        ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_ADD_I_STORE_I
+    },
+    {
+        4,
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_PUSH_IN1, ZEN_BYTE_CODE_ADD_I, ZEN_BYTE_CODE_STORE_I },
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_PUSH_I5, ZEN_BYTE_CODE_ADD_I, ZEN_BYTE_CODE_STORE_I },
+        ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_ADD_I_STORE_I
+    },
+    {
+        3,
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_JUMP_LT_I },
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_JUMP_LT_I },
+        ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_JUMP_LT_I
+    },
+    {
+        3,
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_PUSH_IN1, ZEN_BYTE_CODE_JUMP_LT_I },
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_PUSH_I5, ZEN_BYTE_CODE_JUMP_LT_I },
+        ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_JUMP_LT_I
+    },
+    {
+        2,
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_LOAD_I },
+        { ZEN_BYTE_CODE_LOAD_I, ZEN_BYTE_CODE_LOAD_I },
+        ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I
+    },
+    {
+        2,
+        { ZEN_BYTE_CODE_LOAD_A, ZEN_BYTE_CODE_LOAD_A },
+        { ZEN_BYTE_CODE_LOAD_A, ZEN_BYTE_CODE_LOAD_A },
+        ZEN_SUPERINSTRUCTION_LOAD_A_LOAD_A
+    }
+};
+
+#define ZEN_SUPERINSTRUCTION_PATTERN_COUNT \
+    ((int32_t)(sizeof (zen_SuperinstructionPattern_table) / sizeof (zen_SuperinstructionPattern_t)))
+
+/*******************************************************************************
+ * SuperinstructionRewriter                                                    *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_SuperinstructionRewriter_t* zen_SuperinstructionRewriter_new(
+    zen_BinaryEntityVerifier_t* verifier) {
+    jtk_Assert_assertObject(verifier, "The specified binary entity verifier is null.");
+
+    zen_SuperinstructionRewriter_t* rewriter = jtk_Memory_allocate(zen_SuperinstructionRewriter_t, 1);
+    rewriter->m_verifier = verifier;
+
+    return rewriter;
+}
+
+/* Destructor */
+
+void zen_SuperinstructionRewriter_delete(zen_SuperinstructionRewriter_t* rewriter) {
+    jtk_Assert_assertObject(rewriter, "The specified superinstruction rewriter is null.");
+
+    jtk_Memory_deallocate(rewriter);
+}
+
+/* Rewrite */
+
+/* Returns the length of the sequence at the specified offset, if it matches
+ * the pattern. Otherwise, returns -1.
+ */
+static int32_t zen_SuperinstructionRewriter_match(zen_SuperinstructionRewriter_t* rewriter,
+    const zen_SuperinstructionPattern_t* pattern, const uint8_t* instructions,
+    int32_t ip, int32_t length) {
+    int32_t start = ip;
+    int32_t i;
+    for (i = 0; i < pattern->m_size; i++) {
+        if ((ip >= length) || (instructions[ip] < pattern->m_first[i]) ||
+            (instructions[ip] > pattern->m_last[i])) {
+            return -1;
+        }
+
+        int32_t instructionLength = zen_BinaryEntityVerifier_getInstructionLength(
+            rewriter->m_verifier, instructions, ip, length);
+        if (instructionLength < 0) {
+            return -1;
+        }
+        ip += instructionLength;
+    }
+
+    return ip - start;
+}
+
+int32_t zen_SuperinstructionRewriter_rewrite(zen_SuperinstructionRewriter_t* rewriter,
+    zen_InstructionAttribute_t* instructionAttribute) {
+    jtk_Assert_assertObject(rewriter, "The specified superinstruction rewriter is null.");
+    jtk_Assert_assertObject(instructionAttribute, "The specified instruction attribute is null.");
+
+    int32_t length = instructionAttribute->m_instructionLength;
+    uint8_t* instructions = instructionAttribute->m_instructions;
+    int32_t count = 0;
+    int32_t ip = 0;
+    while (ip < length) {
+        int32_t instructionLength = zen_BinaryEntityVerifier_getInstructionLength(
+            rewriter->m_verifier, instructions, ip, length);
+        if (instructionLength < 0) {
+            /* The boundaries of the remaining instructions are unknown. */
+            break;
+        }
+
+        int32_t i;
+        for (i = 0; i < ZEN_SUPERINSTRUCTION_PATTERN_COUNT; i++) {
+            const zen_SuperinstructionPattern_t* pattern = &zen_SuperinstructionPattern_table[i];
+            int32_t sequenceLength = zen_SuperinstructionRewriter_match(rewriter,
+                pattern, instructions, ip, length);
+            if (sequenceLength > 0) {
+                /* Only the first byte code is replaced. The rest of the sequence
+                 * is retained for the handler and for branches into the sequence.
+                 */
+                instructions[ip] = pattern->m_superinstruction;
+                instructionLength = sequenceLength;
+                count++;
+                break;
+            }
+        }
+
+        ip += instructionLength;
+    }
+
+    return count;
+}
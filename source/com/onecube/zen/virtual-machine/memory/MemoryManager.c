@@ -0,0 +1,378 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <time.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+/*******************************************************************************
+ * MemoryManager                                                               *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_MemoryManager_t* zen_MemoryManager_new() {
+    zen_MemoryManager_t* manager = jtk_Memory_allocate(zen_MemoryManager_t, 1);
+    manager->m_reservedSpace = NULL;
+#ifdef ZEN_COMPRESSED_REFERENCES
+    /* Every range is taken from the reserved space at its granularity. */
+    int64_t size = zen_ReservedSpace_align(ZEN_IMMORTAL_GENERATION_DEFAULT_SIZE) +
+        zen_ReservedSpace_align(ZEN_NEW_GENERATION_DEFAULT_MIDDLE_REGION_SIZE) +
+        (2 * zen_ReservedSpace_align(ZEN_NEW_GENERATION_DEFAULT_SURVIVOR_REGION_SIZE)) +
+        zen_ReservedSpace_align(ZEN_OLD_GENERATION_DEFAULT_WHITE_REGION_SIZE) +
+        zen_ReservedSpace_align(zen_LargeObjectSpace_getRangeSize(
+            ZEN_LARGE_OBJECT_SPACE_DEFAULT_MAXIMUM_SIZE));
+    jtk_Assert_assertTrue(size <= ZEN_REFERENCE_MAXIMUM_HEAP_SIZE,
+        "The heap is too large for compressed references.");
+    manager->m_reservedSpace = zen_ReservedSpace_new(size);
+    zen_Reference_base = (uintptr_t)manager->m_reservedSpace->m_start -
+        (1 << ZEN_REFERENCE_SHIFT);
+#endif
+    manager->m_immortalGeneration = zen_ImmortalGeneration_new(manager->m_reservedSpace,
+        ZEN_IMMORTAL_GENERATION_DEFAULT_SIZE);
+    manager->m_newGeneration = zen_NewGeneration_new(manager->m_reservedSpace,
+        ZEN_NEW_GENERATION_DEFAULT_MIDDLE_REGION_SIZE,
+        ZEN_NEW_GENERATION_DEFAULT_SURVIVOR_REGION_SIZE);
+    manager->m_oldGeneration = zen_OldGeneration_new(manager->m_reservedSpace,
+        ZEN_OLD_GENERATION_DEFAULT_WHITE_REGION_SIZE);
+    manager->m_copyingGarbageCollector = zen_CopyingGarbageCollector_new(
+        manager->m_newGeneration, manager->m_oldGeneration);
+    manager->m_markCompactGarbageCollector = zen_MarkCompactGarbageCollector_new(
+        manager->m_newGeneration, manager->m_oldGeneration);
+    manager->m_concurrentMarker = zen_ConcurrentMarker_new(
+        manager->m_newGeneration, manager->m_oldGeneration);
+    manager->m_safepoint = zen_Safepoint_new();
+    manager->m_enumerateRoots = NULL;
+    manager->m_rootContext = NULL;
+
+    return manager;
+}
+
+/* Destructor */
+
+void zen_MemoryManager_delete(zen_MemoryManager_t* manager) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_Safepoint_delete(manager->m_safepoint);
+    zen_ConcurrentMarker_delete(manager->m_concurrentMarker);
+    zen_MarkCompactGarbageCollector_delete(manager->m_markCompactGarbageCollector);
+    zen_CopyingGarbageCollector_delete(manager->m_copyingGarbageCollector);
+    zen_OldGeneration_delete(manager->m_oldGeneration);
+    zen_NewGeneration_delete(manager->m_newGeneration);
+    zen_ImmortalGeneration_delete(manager->m_immortalGeneration);
+    if (manager->m_reservedSpace != NULL) {
+        zen_ReservedSpace_delete(manager->m_reservedSpace);
+    }
+    jtk_Memory_deallocate(manager);
+}
+
+/* Allocate */
+
+/* The remark pause of a marking cycle is taken on the slow path of the
+ * allocation, once the concurrent marker runs out of objects.
+ */
+static inline void zen_MemoryManager_pollConcurrentMarker(zen_MemoryManager_t* manager) {
+    if (zen_ConcurrentMarker_isCompleted(manager->m_concurrentMarker)) {
+        zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+            ZEN_GARBAGE_COLLECTION_REASON_CONCURRENT_MARKING_COMPLETED);
+    }
+}
+
+uint8_t* zen_MemoryManager_allocate(zen_MemoryManager_t* manager, uint32_t size) {
+    return zen_MemoryManager_allocateEx(manager, size, ZEN_ALIGNMENT_CONSTRAINT_DEFAULT,
+        ZEN_ALLOCATION_FLAG_AUTOMATIC);
+}
+
+uint8_t* zen_MemoryManager_allocateEx(zen_MemoryManager_t* manager, uint32_t size,
+    zen_AlignmentConstraint_t alignmentConstraint, int32_t flags) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_MemoryManager_pollConcurrentMarker(manager);
+
+    /* Every object is aligned to a 64-bit boundary, which satisfies all the
+     * alignment constraints except the 128-bit constraint.
+     */
+    int32_t alignedSize = (size + (ZEN_ALLOCATION_BUFFER_ALIGNMENT - 1)) &
+        ~(ZEN_ALLOCATION_BUFFER_ALIGNMENT - 1);
+    uint8_t* result = zen_SequentialAllocator_allocate(manager->m_newGeneration->m_allocator,
+        0, alignedSize);
+    if (result == NULL) {
+        zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+            ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+        result = zen_SequentialAllocator_allocate(manager->m_newGeneration->m_allocator,
+            0, alignedSize);
+    }
+    return result;
+}
+
+uint8_t* zen_MemoryManager_allocateFromBuffer(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer, int32_t size) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_MemoryManager_pollConcurrentMarker(manager);
+
+    uint8_t* result = zen_SequentialAllocator_allocateFromBuffer(
+        manager->m_newGeneration->m_allocator, buffer, size);
+    if (result == NULL) {
+        zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+            ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+        result = zen_SequentialAllocator_allocateFromBuffer(
+            manager->m_newGeneration->m_allocator, buffer, size);
+    }
+    return result;
+}
+
+uint8_t* zen_MemoryManager_allocateLargeObject(zen_MemoryManager_t* manager,
+    int32_t size, int32_t flags) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_MemoryManager_pollConcurrentMarker(manager);
+
+    zen_OldGeneration_t* oldGeneration = manager->m_oldGeneration;
+    uint8_t* result = zen_LargeObjectSpace_allocate(oldGeneration->m_largeObjectSpace, size);
+    if (result == NULL) {
+        zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+            ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+        result = zen_LargeObjectSpace_allocate(oldGeneration->m_largeObjectSpace, size);
+    }
+
+    if (result != NULL) {
+        /* While the old generation is marked concurrently, the new object is
+         * marked, like the objects promoted during the cycle.
+         */
+        zen_Object_t* object = (zen_Object_t*)result;
+        object->m_class = NULL;
+        object->m_size = size;
+        object->m_flags = flags | ZEN_OBJECT_FLAG_LARGE | oldGeneration->m_promotionFlags;
+    }
+    return result;
+}
+
+/* Allocation Buffer */
+
+zen_AllocationBuffer_t* zen_MemoryManager_makeAllocationBuffer(zen_MemoryManager_t* manager) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    return zen_SequentialAllocator_makeAllocationBuffer(manager->m_newGeneration->m_allocator);
+}
+
+void zen_MemoryManager_mergeAllocationBuffer(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_SequentialAllocator_mergeAllocationBuffer(manager->m_newGeneration->m_allocator, buffer);
+}
+
+/* SATB Buffer */
+
+zen_SatbBuffer_t* zen_MemoryManager_makeSatbBuffer(zen_MemoryManager_t* manager) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    return zen_SatbQueue_makeBuffer(manager->m_concurrentMarker->m_satbQueue);
+}
+
+void zen_MemoryManager_mergeSatbBuffer(zen_MemoryManager_t* manager, zen_SatbBuffer_t* buffer) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_SatbQueue_mergeBuffer(manager->m_concurrentMarker->m_satbQueue, buffer);
+}
+
+/* Collect */
+
+static uint64_t zen_MemoryManager_getTime() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((uint64_t)time.tv_sec * 1000000000ULL) + (uint64_t)time.tv_nsec;
+}
+
+void zen_MemoryManager_collect(zen_MemoryManager_t* manager,
+    zen_GarbageCollectionType_t type, zen_GarbageCollectionReason_t reason) {
+    zen_MemoryManager_collectEx(manager, type, reason, NULL, 0);
+}
+
+void zen_MemoryManager_collectEx(zen_MemoryManager_t* manager,
+    zen_GarbageCollectionType_t type, zen_GarbageCollectionReason_t reason,
+    zen_GarbageCollectionListener_t* listener, int32_t flags) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    /* Without the roots, every object in the heap would appear to be dead. */
+    if (manager->m_enumerateRoots == NULL) {
+        return;
+    }
+
+    /* The calling thread steps into a safe region, so that it does not hold
+     * up its own safepoint, or the safepoint of another thread which is
+     * collecting at the same time.
+     */
+    zen_Safepoint_t* safepoint = manager->m_safepoint;
+    zen_Safepoint_enterSafeRegion(safepoint);
+    zen_Safepoint_request(safepoint);
+
+    zen_SequentialAllocator_t* allocator = manager->m_newGeneration->m_allocator;
+    zen_OldGeneration_t* oldGeneration = manager->m_oldGeneration;
+
+    zen_GarbageCollectionProfile_t profile;
+    profile.m_reason = reason;
+    profile.m_type = type;
+    profile.m_memoryUsedPreviously = (allocator->m_free - allocator->m_start) +
+        zen_OldGeneration_getUsedSize(oldGeneration) +
+        oldGeneration->m_largeObjectSpace->m_mappedSize;
+    profile.m_memoryFreePreviously = (allocator->m_limit - allocator->m_free) +
+        zen_OldGeneration_getAvailableSize(oldGeneration) +
+        oldGeneration->m_allocator->m_freeSize;
+    profile.m_duration = 0;
+    profile.m_safepointDuration = safepoint->m_synchronizationDuration;
+    profile.m_markingWorkerCount = 0;
+    profile.m_markingDurations = NULL;
+
+    if ((listener != NULL) && (listener->m_onBeforeGarbageCollection != NULL)) {
+        listener->m_onBeforeGarbageCollection(listener, &profile);
+    }
+
+    zen_MarkCompactGarbageCollector_t* markCompactCollector = manager->m_markCompactGarbageCollector;
+    zen_ConcurrentMarker_t* concurrentMarker = manager->m_concurrentMarker;
+    bool marked = false;
+    uint64_t start = zen_MemoryManager_getTime();
+
+    bool collected = false;
+    if (type == ZEN_GARBAGE_COLLECTION_TYPE_MINOR) {
+        /* The concurrent marker is paused, while the objects are promoted. */
+        zen_ConcurrentMarker_pause(concurrentMarker);
+        collected = zen_CopyingGarbageCollector_collect(manager->m_copyingGarbageCollector,
+            manager->m_enumerateRoots, manager->m_rootContext);
+        zen_ConcurrentMarker_resume(concurrentMarker);
+    }
+
+    if (!collected) {
+        /* The marking cycle in progress is completed, rather than marking the
+         * old generation from scratch.
+         */
+        if (zen_ConcurrentMarker_isMarking(concurrentMarker)) {
+            zen_ConcurrentMarker_remark(concurrentMarker, manager->m_enumerateRoots,
+                manager->m_rootContext);
+            zen_MarkCompactGarbageCollector_compact(markCompactCollector,
+                manager->m_enumerateRoots, manager->m_rootContext, flags);
+        }
+        else {
+            zen_MarkCompactGarbageCollector_collect(markCompactCollector,
+                manager->m_enumerateRoots, manager->m_rootContext, flags);
+            marked = true;
+        }
+        collected = zen_CopyingGarbageCollector_collect(manager->m_copyingGarbageCollector,
+            manager->m_enumerateRoots, manager->m_rootContext);
+
+        /* The dense prefix may hold back the space that the new generation
+         * requires. In which case, the old generation is squeezed.
+         */
+        if (!collected && ((flags & ZEN_GARBAGE_COLLECTION_FLAG_SQUEEZE) == 0)) {
+            zen_MarkCompactGarbageCollector_collect(markCompactCollector,
+                manager->m_enumerateRoots, manager->m_rootContext,
+                flags | ZEN_GARBAGE_COLLECTION_FLAG_SQUEEZE);
+            zen_CopyingGarbageCollector_collect(manager->m_copyingGarbageCollector,
+                manager->m_enumerateRoots, manager->m_rootContext);
+            marked = true;
+        }
+    }
+    else if (zen_ConcurrentMarker_shouldStart(concurrentMarker)) {
+        zen_ConcurrentMarker_start(concurrentMarker, manager->m_enumerateRoots,
+            manager->m_rootContext);
+    }
+
+    profile.m_duration = zen_MemoryManager_getTime() - start;
+    if (marked) {
+        profile.m_markingWorkerCount = markCompactCollector->m_workerCount;
+        profile.m_markingDurations = markCompactCollector->m_markingDurations;
+    }
+
+    if ((listener != NULL) && (listener->m_onAfterGarbageCollection != NULL)) {
+        listener->m_onAfterGarbageCollection(listener, &profile);
+    }
+
+    zen_Safepoint_release(safepoint);
+    zen_Safepoint_leaveSafeRegion(safepoint);
+}
+
+/* Deallocate */
+
+void zen_MemoryManager_deallocate(zen_MemoryManager_t* manager, uint8_t* pointer) {
+    /* The objects in the heap are reclaimed by the garbage collector. */
+}
+
+/* Root Enumerator */
+
+void zen_MemoryManager_setRootEnumerator(zen_MemoryManager_t* manager,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    manager->m_enumerateRoots = enumerateRoots;
+    manager->m_rootContext = context;
+}
+
+/* Tenuring Threshold */
+
+void zen_MemoryManager_setTenuringThreshold(zen_MemoryManager_t* manager,
+    int32_t tenuringThreshold) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+    jtk_Assert_assertTrue((tenuringThreshold >= 0) &&
+        (tenuringThreshold <= ZEN_OBJECT_MAXIMUM_AGE),
+        "The specified tenuring threshold is invalid.");
+
+    manager->m_copyingGarbageCollector->m_tenuringThreshold = tenuringThreshold;
+}
+
+/* Concurrent Marking */
+
+void zen_MemoryManager_setConcurrentMarkingEnabled(zen_MemoryManager_t* manager,
+    bool enabled) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    manager->m_concurrentMarker->m_enabled = enabled;
+}
+
+void zen_MemoryManager_setInitiatingOccupancy(zen_MemoryManager_t* manager,
+    int32_t initiatingOccupancy) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+    jtk_Assert_assertTrue((initiatingOccupancy >= 0) && (initiatingOccupancy <= 100),
+        "The specified initiating occupancy is invalid.");
+
+    manager->m_concurrentMarker->m_initiatingOccupancy = initiatingOccupancy;
+}
+
+/* Large Object Threshold */
+
+void zen_MemoryManager_setLargeObjectThreshold(zen_MemoryManager_t* manager,
+    int32_t largeObjectThreshold) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+    jtk_Assert_assertTrue(largeObjectThreshold > 0,
+        "The specified large object threshold is invalid.");
+
+    manager->m_oldGeneration->m_largeObjectSpace->m_threshold = largeObjectThreshold;
+}
+
+/* Marking Worker Count */
+
+void zen_MemoryManager_setMarkingWorkerCount(zen_MemoryManager_t* manager,
+    int32_t markingWorkerCount) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_MarkCompactGarbageCollector_setWorkerCount(manager->m_markCompactGarbageCollector,
+        markingWorkerCount);
+}
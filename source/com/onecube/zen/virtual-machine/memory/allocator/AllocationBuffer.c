@@ -0,0 +1,92 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/allocator/AllocationBuffer.h>
+
+/*******************************************************************************
+ * AllocationBuffer                                                            *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_AllocationBuffer_t* zen_AllocationBuffer_new() {
+    zen_AllocationBuffer_t* buffer = jtk_Memory_allocate(zen_AllocationBuffer_t, 1);
+    buffer->m_start = NULL;
+    buffer->m_free = NULL;
+    buffer->m_limit = NULL;
+    buffer->m_size = ZEN_ALLOCATION_BUFFER_INITIAL_SIZE;
+    buffer->m_refillCount = 0;
+    buffer->m_allocatedBytes = 0;
+    buffer->m_chunks = zen_ChunkArray_new();
+    buffer->m_currentChunk = -1;
+    buffer->m_next = NULL;
+
+    return buffer;
+}
+
+/* Destructor */
+
+void zen_AllocationBuffer_delete(zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    zen_ChunkArray_delete(buffer->m_chunks);
+    jtk_Memory_deallocate(buffer);
+}
+
+/* Adapt */
+
+void zen_AllocationBuffer_adapt(zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    /* The size which would have resulted in the target number of refills is
+     * averaged with the current size. Therefore, a single burst of allocations
+     * does not inflate the buffer.
+     */
+    int64_t desiredSize = buffer->m_allocatedBytes / ZEN_ALLOCATION_BUFFER_TARGET_REFILLS;
+    int64_t size = (buffer->m_size + desiredSize) / 2;
+    if (size < ZEN_ALLOCATION_BUFFER_MINIMUM_SIZE) {
+        size = ZEN_ALLOCATION_BUFFER_MINIMUM_SIZE;
+    }
+    else if (size > ZEN_ALLOCATION_BUFFER_MAXIMUM_SIZE) {
+        size = ZEN_ALLOCATION_BUFFER_MAXIMUM_SIZE;
+    }
+
+    buffer->m_size = (int32_t)(size & ~((int64_t)ZEN_ALLOCATION_BUFFER_ALIGNMENT - 1));
+    buffer->m_refillCount = 0;
+    buffer->m_allocatedBytes = 0;
+}
+
+/* Retire */
+
+void zen_AllocationBuffer_retire(zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    /* The unused space at the end of the chunk is excluded from the record,
+     * so that the chunk remains parsable.
+     */
+    if (buffer->m_currentChunk >= 0) {
+        buffer->m_chunks->m_chunks[buffer->m_currentChunk].m_end = buffer->m_free;
+        buffer->m_currentChunk = -1;
+    }
+
+    buffer->m_start = NULL;
+    buffer->m_free = NULL;
+    buffer->m_limit = NULL;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/allocator/Chunk.h>
+
+/*******************************************************************************
+ * ChunkArray                                                                  *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_ChunkArray_t* zen_ChunkArray_new() {
+    zen_ChunkArray_t* array = jtk_Memory_allocate(zen_ChunkArray_t, 1);
+    array->m_chunks = jtk_Memory_allocate(zen_Chunk_t, ZEN_CHUNK_ARRAY_DEFAULT_CAPACITY);
+    array->m_size = 0;
+    array->m_capacity = ZEN_CHUNK_ARRAY_DEFAULT_CAPACITY;
+
+    return array;
+}
+
+/* Destructor */
+
+void zen_ChunkArray_delete(zen_ChunkArray_t* array) {
+    jtk_Assert_assertObject(array, "The specified chunk array is null.");
+
+    jtk_Memory_deallocate(array->m_chunks);
+    jtk_Memory_deallocate(array);
+}
+
+/* Add */
+
+static void zen_ChunkArray_ensureCapacity(zen_ChunkArray_t* array, int32_t capacity) {
+    if (capacity > array->m_capacity) {
+        int32_t newCapacity = array->m_capacity * 2;
+        if (newCapacity < capacity) {
+            newCapacity = capacity;
+        }
+
+        zen_Chunk_t* chunks = jtk_Memory_allocate(zen_Chunk_t, newCapacity);
+        memcpy(chunks, array->m_chunks, array->m_size * sizeof (zen_Chunk_t));
+        jtk_Memory_deallocate(array->m_chunks);
+
+        array->m_chunks = chunks;
+        array->m_capacity = newCapacity;
+    }
+}
+
+int32_t zen_ChunkArray_add(zen_ChunkArray_t* array, uint8_t* start, uint8_t* end) {
+    jtk_Assert_assertObject(array, "The specified chunk array is null.");
+
+    zen_ChunkArray_ensureCapacity(array, array->m_size + 1);
+    int32_t index = array->m_size++;
+    array->m_chunks[index].m_start = start;
+    array->m_chunks[index].m_end = end;
+
+    return index;
+}
+
+void zen_ChunkArray_addAll(zen_ChunkArray_t* array, zen_ChunkArray_t* source) {
+    jtk_Assert_assertObject(array, "The specified chunk array is null.");
+    jtk_Assert_assertObject(source, "The specified source chunk array is null.");
+
+    zen_ChunkArray_ensureCapacity(array, array->m_size + source->m_size);
+    memcpy(array->m_chunks + array->m_size, source->m_chunks,
+        source->m_size * sizeof (zen_Chunk_t));
+    array->m_size += source->m_size;
+}
+
+/* Clear */
+
+void zen_ChunkArray_clear(zen_ChunkArray_t* array) {
+    jtk_Assert_assertObject(array, "The specified chunk array is null.");
+
+    array->m_size = 0;
+}
+
+/* Find */
+
+zen_Chunk_t* zen_ChunkArray_find(zen_ChunkArray_t* array, uint8_t* address) {
+    jtk_Assert_assertObject(array, "The specified chunk array is null.");
+
+    /* Find the last chunk which starts at or before the address. */
+    int32_t low = 0;
+    int32_t high = array->m_size - 1;
+    zen_Chunk_t* result = NULL;
+    while (low <= high) {
+        int32_t middle = low + ((high - low) / 2);
+        zen_Chunk_t* chunk = &array->m_chunks[middle];
+        if (chunk->m_start <= address) {
+            result = chunk;
+            low = middle + 1;
+        }
+        else {
+            high = middle - 1;
+        }
+    }
+
+    if ((result != NULL) && (address >= result->m_end)) {
+        result = NULL;
+    }
+    return result;
+}
+
+/* Sort */
+
+static int zen_ChunkArray_compare(const void* chunk1, const void* chunk2) {
+    uint8_t* start1 = ((const zen_Chunk_t*)chunk1)->m_start;
+    uint8_t* start2 = ((const zen_Chunk_t*)chunk2)->m_start;
+    return (start1 < start2)? -1 : ((start1 > start2)? 1 : 0);
+}
+
+void zen_ChunkArray_sort(zen_ChunkArray_t* array) {
+    jtk_Assert_assertObject(array, "The specified chunk array is null.");
+
+    qsort(array->m_chunks, array->m_size, sizeof (zen_Chunk_t), zen_ChunkArray_compare);
+}
@@ -16,8 +16,11 @@
 
 // Tuesday, January 22, 2019
 
+#include <string.h>
+
+#include <jtk/core/Assert.h>
+
 #include <com/onecube/zen/virtual-machine/memory/allocator/SequentialAllocator.h>
-#include <jtk/support/log/Logger.h>
 
 /*******************************************************************************
  * SequentialAllocator                                                         *
@@ -25,55 +28,245 @@
 
 /* Constructor */
 
-zen_SequentialAllocator_t* zen_SequentialAllocator_new(jtk_Allocator_t* allocator, int8_t* start,
-    int8_t* limit) {
-    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+zen_SequentialAllocator_t* zen_SequentialAllocator_new(uint8_t* start, uint8_t* limit) {
     jtk_Assert_assertObject(start, "The specified pointer to the start of the memory chunk is null.");
     jtk_Assert_assertObject(limit, "The specified pointer to the end of the memory chunk is null.");
-    
-    zen_SequentialAllocator_t* sequentialAllocator = (zen_SequentialAllocator_t*)jtk_Allocator_allocate(allocator, sizeof (zen_SequentialAllocator), 1);
+
+    zen_SequentialAllocator_t* sequentialAllocator = jtk_Memory_allocate(zen_SequentialAllocator_t, 1);
     sequentialAllocator->m_start = start;
     sequentialAllocator->m_limit = limit;
     sequentialAllocator->m_free = start;
-    
+    sequentialAllocator->m_sharedAllocationBuffer = zen_AllocationBuffer_new();
+    sequentialAllocator->m_allocationBuffers = sequentialAllocator->m_sharedAllocationBuffer;
+    sequentialAllocator->m_holes = zen_ChunkArray_new();
+    sequentialAllocator->m_allocationBuffersMutex = jtk_Mutex_new();
+
     return sequentialAllocator;
 }
 
 /* Destructor */
 
-void zen_SequentialAllocator_delete(jtk_Allocator_t* allocator,
-    zen_SequentialAllocator_t* sequentialAllocator) {
-    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+void zen_SequentialAllocator_delete(zen_SequentialAllocator_t* sequentialAllocator) {
     jtk_Assert_assertObject(sequentialAllocator, "The specified sequential allocator is null.");
-    
-    jtk_Allocator_deallocate(allocator, sequentialAllocator);
+
+    zen_AllocationBuffer_t* buffer = sequentialAllocator->m_allocationBuffers;
+    while (buffer != NULL) {
+        zen_AllocationBuffer_t* next = buffer->m_next;
+        zen_AllocationBuffer_delete(buffer);
+        buffer = next;
+    }
+    zen_ChunkArray_delete(sequentialAllocator->m_holes);
+    jtk_Mutex_delete(sequentialAllocator->m_allocationBuffersMutex);
+    jtk_Memory_deallocate(sequentialAllocator);
 }
 
 /* Allocator */
 
-int8_t* zen_SequentialAllocator_allocate(zen_SequentialAllocator_t* allocator,
+/* Claim at most `preferredSize` bytes, but no less than `minimumSize` bytes,
+ * from the shared chunk. When the chunk is nearly exhausted, or a hole is
+ * near, the space up to the limit or the hole is claimed. Unless another
+ * thread races with the current thread, the free pointer is bumped with a
+ * single compare-and-swap.
+ *
+ * The holes are modified only when the world is stopped. Therefore, they are
+ * read without synchronization.
+ */
+static uint8_t* zen_SequentialAllocator_claim(zen_SequentialAllocator_t* allocator,
+    int32_t minimumSize, int32_t preferredSize, int32_t* claimedSize) {
+    zen_Chunk_t* holes = allocator->m_holes->m_chunks;
+    int32_t holeCount = allocator->m_holes->m_size;
+
+    uint8_t* free = __atomic_load_n(&allocator->m_free, __ATOMIC_RELAXED);
+    uint8_t* start;
+    int32_t size;
+    do {
+        start = free;
+        uint8_t* limit = allocator->m_limit;
+
+        /* Skip the holes which leave too little space before them. */
+        int32_t i;
+        for (i = 0; i < holeCount; i++) {
+            if (holes[i].m_end <= start) {
+                continue;
+            }
+            if ((holes[i].m_start - start) >= minimumSize) {
+                limit = holes[i].m_start;
+                break;
+            }
+            start = holes[i].m_end;
+        }
+
+        intptr_t available = limit - start;
+        if (available < minimumSize) {
+            return NULL;
+        }
+        size = (available < preferredSize)? (int32_t)available : preferredSize;
+    }
+    while (!__atomic_compare_exchange_n(&allocator->m_free, &free, start + size,
+        true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    *claimedSize = size;
+    return start;
+}
+
+/* Allocate an object outside the specified buffer. The object is recorded as
+ * a chunk of its own.
+ */
+static uint8_t* zen_SequentialAllocator_allocateDirectly(zen_SequentialAllocator_t* allocator,
+    zen_AllocationBuffer_t* buffer, int32_t size) {
+    int32_t claimedSize;
+    uint8_t* result = zen_SequentialAllocator_claim(allocator, size, size, &claimedSize);
+    if (result != NULL) {
+        memset(result, 0, size);
+        zen_ChunkArray_add(buffer->m_chunks, result, result + size);
+    }
+    return result;
+}
+
+uint8_t* zen_SequentialAllocator_allocate(zen_SequentialAllocator_t* allocator,
     int32_t headerSize, int32_t bodySize) {
     jtk_Assert_assertObject(allocator, "The specified allocator is null.");
 
-    int8_t* result = NULL;
-    int32_t requestSize = headerSize + bodySize;
-    int8_t* newFree = allocator->m_free + requestSize;
-    
-    /* Make sure that when the free pointer is bumped, it does not exceed the
-     * limitation of the memory chunk the allocator is assigned.
+    int32_t size = headerSize + bodySize;
+    zen_AllocationBuffer_t* buffer = allocator->m_sharedAllocationBuffer;
+
+    jtk_Mutex_lock(allocator->m_allocationBuffersMutex);
+    uint8_t* result = zen_AllocationBuffer_allocate(buffer, size);
+    if (result == NULL) {
+        result = zen_SequentialAllocator_allocateFromBuffer(allocator, buffer, size);
+    }
+    jtk_Mutex_unlock(allocator->m_allocationBuffersMutex);
+
+    return result;
+}
+
+uint8_t* zen_SequentialAllocator_allocateFromBuffer(zen_SequentialAllocator_t* allocator,
+    zen_AllocationBuffer_t* buffer, int32_t size) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    buffer->m_allocatedBytes += size;
+
+    /* A large object, or an object which does not fit in a buffer that still
+     * has plenty of free space, is allocated outside the buffer. Retiring the
+     * buffer would waste its free space.
      */
-    if (newFree <= buffer->m_limit) {
-        result = allocator->m_free;
-        /* Bump the free pointer to indicate the new free region. */
-        buffer->m_free = newFree;
-        
-        xjtk_Logger_debug(JTK_SEQUENTIAL_ALLOCATOR, "Successfully allocated memory. (requestSize = %d, headerSize = %d, bodySize = %d)",
-        requestSize, headerSize, bodySize);
+    intptr_t remaining = buffer->m_limit - buffer->m_free;
+    if ((size >= buffer->m_size) || (remaining > (buffer->m_size / ZEN_ALLOCATION_BUFFER_WASTE_FACTOR))) {
+        return zen_SequentialAllocator_allocateDirectly(allocator, buffer, size);
     }
-    else {
-        xjtk_Logger_debug(JTK_SEQUENTIAL_ALLOCATOR, "Failed to allocate memory. (requestSize = %d, headerSize = %d, bodySize = %d)",
-        requestSize, headerSize, bodySize);
+
+    /* A thread which refills its buffer too often between two collections
+     * receives larger chunks right away, rather than at the next collection.
+     */
+    if ((++buffer->m_refillCount > ZEN_ALLOCATION_BUFFER_TARGET_REFILLS) &&
+        (buffer->m_size < ZEN_ALLOCATION_BUFFER_MAXIMUM_SIZE)) {
+        buffer->m_size *= 2;
+        buffer->m_refillCount = 0;
     }
-    
-    return result;
-}
\ No newline at end of file
+
+    int32_t claimedSize;
+    uint8_t* chunk = zen_SequentialAllocator_claim(allocator, size, buffer->m_size,
+        &claimedSize);
+    if (chunk == NULL) {
+        return NULL;
+    }
+
+    /* The objects are allocated from cleared memory. Clearing the whole chunk
+     * at once is cheaper than clearing each object.
+     */
+    memset(chunk, 0, claimedSize);
+    buffer->m_allocatedBytes += claimedSize - size;
+
+    zen_AllocationBuffer_retire(buffer);
+    buffer->m_currentChunk = zen_ChunkArray_add(buffer->m_chunks, chunk, chunk + claimedSize);
+    buffer->m_start = chunk;
+    buffer->m_free = chunk + size;
+    buffer->m_limit = chunk + claimedSize;
+
+    return chunk;
+}
+
+/* Allocation Buffer */
+
+zen_AllocationBuffer_t* zen_SequentialAllocator_makeAllocationBuffer(
+    zen_SequentialAllocator_t* allocator) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+
+    zen_AllocationBuffer_t* buffer = zen_AllocationBuffer_new();
+
+    jtk_Mutex_lock(allocator->m_allocationBuffersMutex);
+    buffer->m_next = allocator->m_allocationBuffers;
+    allocator->m_allocationBuffers = buffer;
+    jtk_Mutex_unlock(allocator->m_allocationBuffersMutex);
+
+    return buffer;
+}
+
+void zen_SequentialAllocator_mergeAllocationBuffer(zen_SequentialAllocator_t* allocator,
+    zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    zen_AllocationBuffer_retire(buffer);
+
+    jtk_Mutex_lock(allocator->m_allocationBuffersMutex);
+    zen_AllocationBuffer_t** link = &allocator->m_allocationBuffers;
+    while (*link != NULL) {
+        if (*link == buffer) {
+            *link = buffer->m_next;
+            break;
+        }
+        link = &(*link)->m_next;
+    }
+    /* The objects allocated by the terminating thread remain until the next
+     * collection. Therefore, the chunks are handed over to the shared buffer.
+     */
+    zen_ChunkArray_addAll(allocator->m_sharedAllocationBuffer->m_chunks, buffer->m_chunks);
+    jtk_Mutex_unlock(allocator->m_allocationBuffersMutex);
+
+    zen_AllocationBuffer_delete(buffer);
+}
+
+/* Chunks */
+
+void zen_SequentialAllocator_getChunks(zen_SequentialAllocator_t* allocator,
+    zen_ChunkArray_t* chunks) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+    jtk_Assert_assertObject(chunks, "The specified chunk array is null.");
+
+    zen_AllocationBuffer_t* buffer = allocator->m_allocationBuffers;
+    while (buffer != NULL) {
+        zen_ChunkArray_addAll(chunks, buffer->m_chunks);
+        buffer = buffer->m_next;
+    }
+    zen_ChunkArray_addAll(chunks, allocator->m_holes);
+}
+
+/* Reset */
+
+void zen_SequentialAllocator_reset(zen_SequentialAllocator_t* allocator) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+
+    zen_AllocationBuffer_t* buffer = allocator->m_allocationBuffers;
+    while (buffer != NULL) {
+        zen_AllocationBuffer_retire(buffer);
+        zen_AllocationBuffer_adapt(buffer);
+        zen_ChunkArray_clear(buffer->m_chunks);
+        buffer = buffer->m_next;
+    }
+    zen_ChunkArray_clear(allocator->m_holes);
+    allocator->m_free = allocator->m_start;
+}
+
+/* Retire */
+
+void zen_SequentialAllocator_retireAllocationBuffers(zen_SequentialAllocator_t* allocator) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+
+    zen_AllocationBuffer_t* buffer = allocator->m_allocationBuffers;
+    while (buffer != NULL) {
+        zen_AllocationBuffer_retire(buffer);
+        buffer = buffer->m_next;
+    }
+}
@@ -0,0 +1,332 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <string.h>
+#include <time.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/collector/ConcurrentMarker.h>
+
+/*******************************************************************************
+ * ConcurrentMarker                                                            *
+ *******************************************************************************/
+
+static void zen_ConcurrentMarker_markRoot(zen_RootVisitor_t* visitor, zen_Object_t** root);
+static void zen_ConcurrentMarker_markAmbiguousRoot(zen_RootVisitor_t* visitor, uintptr_t value);
+static void* zen_ConcurrentMarker_run(void* argument);
+
+/* Constructor */
+
+zen_ConcurrentMarker_t* zen_ConcurrentMarker_new(zen_NewGeneration_t* newGeneration,
+    zen_OldGeneration_t* oldGeneration) {
+    jtk_Assert_assertObject(newGeneration, "The specified new generation is null.");
+    jtk_Assert_assertObject(oldGeneration, "The specified old generation is null.");
+
+    zen_ConcurrentMarker_t* marker = jtk_Memory_allocate(zen_ConcurrentMarker_t, 1);
+    marker->m_newGeneration = newGeneration;
+    marker->m_oldGeneration = oldGeneration;
+    marker->m_satbQueue = zen_SatbQueue_new();
+    marker->m_markingVisitor.m_visitRoot = zen_ConcurrentMarker_markRoot;
+    marker->m_markingVisitor.m_visitAmbiguousRoot = zen_ConcurrentMarker_markAmbiguousRoot;
+    marker->m_markingVisitor.m_context = marker;
+    marker->m_youngChunks = zen_ChunkArray_new();
+    marker->m_markStack = jtk_Memory_allocate(zen_Object_t*,
+        ZEN_CONCURRENT_MARKER_DEFAULT_MARK_STACK_CAPACITY);
+    marker->m_markStackSize = 0;
+    marker->m_markStackCapacity = ZEN_CONCURRENT_MARKER_DEFAULT_MARK_STACK_CAPACITY;
+    marker->m_state = ZEN_CONCURRENT_MARKER_STATE_IDLE;
+    marker->m_enabled = false;
+    marker->m_initiatingOccupancy = ZEN_CONCURRENT_MARKER_DEFAULT_INITIATING_OCCUPANCY;
+    marker->m_threadStarted = false;
+    marker->m_terminated = false;
+    pthread_mutex_init(&marker->m_mutex, NULL);
+    pthread_cond_init(&marker->m_condition, NULL);
+    marker->m_pauseRequestCount = 0;
+    marker->m_cycleCount = 0;
+    marker->m_initialMarkDuration = 0;
+    marker->m_concurrentDuration = 0;
+    marker->m_remarkDuration = 0;
+
+    return marker;
+}
+
+/* Destructor */
+
+void zen_ConcurrentMarker_delete(zen_ConcurrentMarker_t* marker) {
+    jtk_Assert_assertObject(marker, "The specified marker is null.");
+
+    pthread_mutex_lock(&marker->m_mutex);
+    marker->m_terminated = true;
+    pthread_cond_broadcast(&marker->m_condition);
+    pthread_mutex_unlock(&marker->m_mutex);
+    if (marker->m_threadStarted) {
+        pthread_join(marker->m_thread, NULL);
+    }
+
+    pthread_cond_destroy(&marker->m_condition);
+    pthread_mutex_destroy(&marker->m_mutex);
+    jtk_Memory_deallocate(marker->m_markStack);
+    zen_ChunkArray_delete(marker->m_youngChunks);
+    zen_SatbQueue_delete(marker->m_satbQueue);
+    jtk_Memory_deallocate(marker);
+}
+
+/* Time */
+
+static inline uint64_t zen_ConcurrentMarker_getTime() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((uint64_t)time.tv_sec * 1000000000ULL) + (uint64_t)time.tv_nsec;
+}
+
+/* Mark */
+
+static void zen_ConcurrentMarker_push(zen_ConcurrentMarker_t* marker, zen_Object_t* object) {
+    if (marker->m_markStackSize == marker->m_markStackCapacity) {
+        int32_t capacity = marker->m_markStackCapacity * 2;
+        zen_Object_t** stack = jtk_Memory_allocate(zen_Object_t*, capacity);
+        memcpy(stack, marker->m_markStack, sizeof (zen_Object_t*) * marker->m_markStackSize);
+        jtk_Memory_deallocate(marker->m_markStack);
+        marker->m_markStack = stack;
+        marker->m_markStackCapacity = capacity;
+    }
+    marker->m_markStack[marker->m_markStackSize++] = object;
+}
+
+/* Only the marker sets the mark bits during a cycle. The other threads never
+ * modify the flags of the objects in the old generation, or the large object
+ * space. A large object is scanned only if it is an array of references.
+ *
+ * The references to the new generation are never dereferenced, because a
+ * reference logged by the barrier may be stale after a minor collection.
+ */
+static inline void zen_ConcurrentMarker_mark(zen_ConcurrentMarker_t* marker, zen_Object_t* object) {
+    if (object == NULL) {
+        return;
+    }
+
+    if (zen_OldGeneration_contains(marker->m_oldGeneration, object)) {
+        if ((object->m_flags & ZEN_OBJECT_FLAG_MARKED) == 0) {
+            object->m_flags |= ZEN_OBJECT_FLAG_MARKED;
+            zen_ConcurrentMarker_push(marker, object);
+        }
+    }
+    else if (!zen_NewGeneration_contains(marker->m_newGeneration, object) &&
+        ((object->m_flags & (ZEN_OBJECT_FLAG_LARGE | ZEN_OBJECT_FLAG_MARKED)) == ZEN_OBJECT_FLAG_LARGE)) {
+        object->m_flags |= ZEN_OBJECT_FLAG_MARKED;
+        if ((object->m_flags & ZEN_OBJECT_FLAG_REFERENCE_ARRAY) != 0) {
+            zen_ConcurrentMarker_push(marker, object);
+        }
+    }
+}
+
+/* The fields may be modified by the other threads while they are scanned.
+ * Whichever value is read, the overwritten value is logged by the barrier.
+ */
+static void zen_ConcurrentMarker_markReferences(zen_ConcurrentMarker_t* marker,
+    zen_Object_t* object) {
+    int32_t count;
+    zen_Reference_t* references = zen_Object_getReferences(object, &count);
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        zen_ConcurrentMarker_mark(marker,
+            zen_Reference_decode(__atomic_load_n(&references[i], __ATOMIC_RELAXED)));
+    }
+}
+
+/* The objects of the new generation are not traced. Therefore, every object
+ * in the new generation is treated as a root.
+ */
+static void zen_ConcurrentMarker_markYoungObjects(zen_ConcurrentMarker_t* marker) {
+    zen_ChunkArray_t* chunks = marker->m_youngChunks;
+    zen_ChunkArray_clear(chunks);
+    zen_NewGeneration_getChunks(marker->m_newGeneration, chunks);
+
+    int32_t i;
+    for (i = 0; i < chunks->m_size; i++) {
+        uint8_t* current = chunks->m_chunks[i].m_start;
+        while (current < chunks->m_chunks[i].m_end) {
+            zen_Object_t* object = (zen_Object_t*)current;
+            current += object->m_size;
+            zen_ConcurrentMarker_markReferences(marker, object);
+        }
+    }
+}
+
+/* Mark the objects logged in a completed buffer. Returns false if no buffer
+ * was complete.
+ */
+static bool zen_ConcurrentMarker_markLoggedObjects(zen_ConcurrentMarker_t* marker) {
+    zen_SatbBuffer_t* buffer = zen_SatbQueue_poll(marker->m_satbQueue);
+    if (buffer == NULL) {
+        return false;
+    }
+
+    /* A logged reference into the new generation may be stale, but it is
+     * never mistaken for an object in the old generation.
+     */
+    int32_t i;
+    for (i = 0; i < buffer->m_size; i++) {
+        zen_ConcurrentMarker_mark(marker, buffer->m_references[i]);
+    }
+    zen_SatbBuffer_delete(buffer);
+    return true;
+}
+
+/* Scan a batch of objects. Returns false if no object remains to be scanned. */
+static bool zen_ConcurrentMarker_step(zen_ConcurrentMarker_t* marker) {
+    bool logged = zen_ConcurrentMarker_markLoggedObjects(marker);
+
+    int32_t i;
+    for (i = 0; (i < ZEN_CONCURRENT_MARKER_BATCH_SIZE) && (marker->m_markStackSize > 0); i++) {
+        zen_Object_t* object = marker->m_markStack[--marker->m_markStackSize];
+        zen_ConcurrentMarker_markReferences(marker, object);
+    }
+    return logged || (marker->m_markStackSize > 0);
+}
+
+/* Thread */
+
+static void* zen_ConcurrentMarker_run(void* argument) {
+    zen_ConcurrentMarker_t* marker = (zen_ConcurrentMarker_t*)argument;
+
+    pthread_mutex_lock(&marker->m_mutex);
+    while (!marker->m_terminated) {
+        if ((__atomic_load_n(&marker->m_state, __ATOMIC_ACQUIRE) != ZEN_CONCURRENT_MARKER_STATE_MARKING) ||
+            (__atomic_load_n(&marker->m_pauseRequestCount, __ATOMIC_ACQUIRE) > 0)) {
+            pthread_cond_wait(&marker->m_condition, &marker->m_mutex);
+            continue;
+        }
+
+        uint64_t start = zen_ConcurrentMarker_getTime();
+        bool pending = zen_ConcurrentMarker_step(marker);
+        marker->m_concurrentDuration += zen_ConcurrentMarker_getTime() - start;
+        if (!pending) {
+            __atomic_store_n(&marker->m_state, ZEN_CONCURRENT_MARKER_STATE_COMPLETED,
+                __ATOMIC_RELEASE);
+        }
+    }
+    pthread_mutex_unlock(&marker->m_mutex);
+
+    return NULL;
+}
+
+/* Pause */
+
+void zen_ConcurrentMarker_pause(zen_ConcurrentMarker_t* marker) {
+    jtk_Assert_assertObject(marker, "The specified marker is null.");
+
+    /* The request is visible to the marker before it finishes its batch. */
+    __atomic_add_fetch(&marker->m_pauseRequestCount, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_lock(&marker->m_mutex);
+}
+
+/* Remark */
+
+void zen_ConcurrentMarker_remark(zen_ConcurrentMarker_t* marker,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context) {
+    jtk_Assert_assertObject(marker, "The specified marker is null.");
+
+    zen_ConcurrentMarker_pause(marker);
+    uint64_t start = zen_ConcurrentMarker_getTime();
+
+    zen_SatbQueue_flushAll(marker->m_satbQueue);
+    enumerateRoots(context, &marker->m_markingVisitor);
+    zen_ConcurrentMarker_markYoungObjects(marker);
+    while (zen_ConcurrentMarker_step(marker)) {
+    }
+
+    zen_SatbQueue_setActive(marker->m_satbQueue, false);
+    marker->m_oldGeneration->m_promotionFlags = 0;
+    __atomic_store_n(&marker->m_state, ZEN_CONCURRENT_MARKER_STATE_IDLE, __ATOMIC_RELEASE);
+
+    marker->m_remarkDuration = zen_ConcurrentMarker_getTime() - start;
+    zen_ConcurrentMarker_resume(marker);
+}
+
+/* Resume */
+
+void zen_ConcurrentMarker_resume(zen_ConcurrentMarker_t* marker) {
+    jtk_Assert_assertObject(marker, "The specified marker is null.");
+
+    __atomic_sub_fetch(&marker->m_pauseRequestCount, 1, __ATOMIC_SEQ_CST);
+    pthread_cond_broadcast(&marker->m_condition);
+    pthread_mutex_unlock(&marker->m_mutex);
+}
+
+/* Start */
+
+bool zen_ConcurrentMarker_shouldStart(zen_ConcurrentMarker_t* marker) {
+    jtk_Assert_assertObject(marker, "The specified marker is null.");
+
+    zen_Region_t* whiteRegion = marker->m_oldGeneration->m_whiteRegion;
+    int64_t used = zen_OldGeneration_getUsedSize(marker->m_oldGeneration);
+    int64_t capacity = whiteRegion->m_limit - whiteRegion->m_start;
+    return marker->m_enabled && !zen_ConcurrentMarker_isMarking(marker) &&
+        ((used * 100) >= (capacity * marker->m_initiatingOccupancy));
+}
+
+void zen_ConcurrentMarker_start(zen_ConcurrentMarker_t* marker,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context) {
+    jtk_Assert_assertObject(marker, "The specified marker is null.");
+
+    /* If the background thread cannot be started, the objects are traced in
+     * the pause of the next major collection.
+     */
+    if (!marker->m_threadStarted) {
+        marker->m_threadStarted = pthread_create(&marker->m_thread, NULL,
+            zen_ConcurrentMarker_run, marker) == 0;
+    }
+
+    zen_ConcurrentMarker_pause(marker);
+    uint64_t start = zen_ConcurrentMarker_getTime();
+
+    marker->m_markStackSize = 0;
+    marker->m_concurrentDuration = 0;
+    zen_SatbQueue_setActive(marker->m_satbQueue, true);
+    marker->m_oldGeneration->m_promotionFlags = ZEN_OBJECT_FLAG_MARKED;
+    enumerateRoots(context, &marker->m_markingVisitor);
+    zen_ConcurrentMarker_markYoungObjects(marker);
+    __atomic_store_n(&marker->m_state, ZEN_CONCURRENT_MARKER_STATE_MARKING, __ATOMIC_RELEASE);
+    marker->m_cycleCount++;
+
+    marker->m_initialMarkDuration = zen_ConcurrentMarker_getTime() - start;
+    zen_ConcurrentMarker_resume(marker);
+}
+
+/* Root Visitor */
+
+static void zen_ConcurrentMarker_markRoot(zen_RootVisitor_t* visitor, zen_Object_t** root) {
+    zen_ConcurrentMarker_t* marker = (zen_ConcurrentMarker_t*)visitor->m_context;
+    zen_ConcurrentMarker_mark(marker, *root);
+}
+
+/* An object referenced ambiguously is marked and pinned. */
+static void zen_ConcurrentMarker_markAmbiguousRoot(zen_RootVisitor_t* visitor, uintptr_t value) {
+    zen_ConcurrentMarker_t* marker = (zen_ConcurrentMarker_t*)visitor->m_context;
+    if (zen_OldGeneration_isObject(marker->m_oldGeneration, (uint8_t*)value)) {
+        zen_Object_t* object = (zen_Object_t*)value;
+        object->m_flags |= ZEN_OBJECT_FLAG_PINNED;
+        zen_ConcurrentMarker_mark(marker, object);
+    }
+    else if (zen_LargeObjectSpace_isObject(marker->m_oldGeneration->m_largeObjectSpace,
+        (uint8_t*)value)) {
+        zen_ConcurrentMarker_mark(marker, (zen_Object_t*)value);
+    }
+}
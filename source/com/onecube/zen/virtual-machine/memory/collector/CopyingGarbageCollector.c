@@ -0,0 +1,503 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <string.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/collector/CopyingGarbageCollector.h>
+
+/*******************************************************************************
+ * CopyingGarbageCollector                                                     *
+ *******************************************************************************/
+
+static void zen_CopyingGarbageCollector_pin(zen_RootVisitor_t* visitor, uintptr_t value);
+static void zen_CopyingGarbageCollector_evacuateRoot(zen_RootVisitor_t* visitor, zen_Object_t** root);
+static void zen_CopyingGarbageCollector_ignoreRoot(zen_RootVisitor_t* visitor, zen_Object_t** root);
+static void zen_CopyingGarbageCollector_ignoreAmbiguousRoot(zen_RootVisitor_t* visitor, uintptr_t value);
+
+/* Constructor */
+
+zen_CopyingGarbageCollector_t* zen_CopyingGarbageCollector_new(
+    zen_NewGeneration_t* newGeneration, zen_OldGeneration_t* oldGeneration) {
+    jtk_Assert_assertObject(newGeneration, "The specified new generation is null.");
+    jtk_Assert_assertObject(oldGeneration, "The specified old generation is null.");
+
+    zen_CopyingGarbageCollector_t* collector = jtk_Memory_allocate(zen_CopyingGarbageCollector_t, 1);
+    collector->m_newGeneration = newGeneration;
+    collector->m_oldGeneration = oldGeneration;
+    collector->m_tenuringThreshold = ZEN_COPYING_GARBAGE_COLLECTOR_DEFAULT_TENURING_THRESHOLD;
+    collector->m_pinningVisitor.m_visitRoot = zen_CopyingGarbageCollector_ignoreRoot;
+    collector->m_pinningVisitor.m_visitAmbiguousRoot = zen_CopyingGarbageCollector_pin;
+    collector->m_pinningVisitor.m_context = collector;
+    collector->m_evacuatingVisitor.m_visitRoot = zen_CopyingGarbageCollector_evacuateRoot;
+    collector->m_evacuatingVisitor.m_visitAmbiguousRoot = zen_CopyingGarbageCollector_ignoreAmbiguousRoot;
+    collector->m_evacuatingVisitor.m_context = collector;
+    collector->m_fromChunks = zen_ChunkArray_new();
+    collector->m_middlePins = zen_ChunkArray_new();
+    collector->m_leftPins = zen_ChunkArray_new();
+    collector->m_rightChunks = zen_ChunkArray_new();
+    collector->m_rightFree = NULL;
+    collector->m_rightLimit = NULL;
+    collector->m_rightHoleIndex = 0;
+    collector->m_scanChunkIndex = 0;
+    collector->m_scanPointer = NULL;
+    collector->m_promotionScanPointer = NULL;
+    collector->m_promotedCells = zen_ChunkArray_new();
+    collector->m_promotedCellIndex = 0;
+    collector->m_collectionCount = 0;
+    collector->m_copiedBytes = 0;
+    collector->m_promotedBytes = 0;
+    collector->m_scannedCardCount = 0;
+
+    return collector;
+}
+
+/* Destructor */
+
+void zen_CopyingGarbageCollector_delete(zen_CopyingGarbageCollector_t* collector) {
+    jtk_Assert_assertObject(collector, "The specified collector is null.");
+
+    zen_ChunkArray_delete(collector->m_promotedCells);
+    zen_ChunkArray_delete(collector->m_rightChunks);
+    zen_ChunkArray_delete(collector->m_leftPins);
+    zen_ChunkArray_delete(collector->m_middlePins);
+    zen_ChunkArray_delete(collector->m_fromChunks);
+    jtk_Memory_deallocate(collector);
+}
+
+/* From Space */
+
+/* The middle and left regions are collected. The objects elsewhere, including
+ * the holes in the right region, are neither moved nor reclaimed.
+ */
+static inline bool zen_CopyingGarbageCollector_isInFromSpace(
+    zen_CopyingGarbageCollector_t* collector, const void* address) {
+    return zen_Region_contains(collector->m_newGeneration->m_middleRegion, address) ||
+        zen_Region_contains(collector->m_newGeneration->m_leftRegion, address);
+}
+
+/* Copy */
+
+/* Allocate space in the right region, skipping the holes. A new chunk begins
+ * after each hole. Returns null if the right region is exhausted.
+ */
+static uint8_t* zen_CopyingGarbageCollector_allocateInRightRegion(
+    zen_CopyingGarbageCollector_t* collector, int32_t size) {
+    zen_ChunkArray_t* holes = collector->m_newGeneration->m_rightHoles;
+    while ((collector->m_rightLimit - collector->m_rightFree) < size) {
+        if (collector->m_rightHoleIndex >= holes->m_size) {
+            return NULL;
+        }
+
+        zen_Chunk_t* hole = &holes->m_chunks[collector->m_rightHoleIndex++];
+        collector->m_rightFree = hole->m_end;
+        collector->m_rightLimit = (collector->m_rightHoleIndex < holes->m_size)?
+            holes->m_chunks[collector->m_rightHoleIndex].m_start :
+            collector->m_newGeneration->m_rightRegion->m_limit;
+        zen_ChunkArray_add(collector->m_rightChunks, collector->m_rightFree,
+            collector->m_rightFree);
+    }
+
+    uint8_t* result = collector->m_rightFree;
+    collector->m_rightFree += size;
+    collector->m_rightChunks->m_chunks[collector->m_rightChunks->m_size - 1].m_end =
+        collector->m_rightFree;
+    return result;
+}
+
+static zen_Object_t* zen_CopyingGarbageCollector_copy(zen_CopyingGarbageCollector_t* collector,
+    zen_Object_t* object) {
+    int32_t size = object->m_size;
+    int32_t age = zen_Object_getAge(object);
+
+    uint8_t* target = NULL;
+    if (age < collector->m_tenuringThreshold) {
+        target = zen_CopyingGarbageCollector_allocateInRightRegion(collector, size);
+    }
+
+    int32_t copySize = size;
+    int32_t promotionFlags = 0;
+    if (target != NULL) {
+        collector->m_copiedBytes += size;
+    }
+    else {
+        /* The collection began only after ensuring that the old generation
+         * can absorb the whole new generation.
+         */
+        zen_OldGeneration_t* oldGeneration = collector->m_oldGeneration;
+        uint8_t* free = oldGeneration->m_free;
+        copySize = zen_OldGeneration_alignSize(size);
+        target = zen_OldGeneration_allocate(oldGeneration, copySize);
+        if (target < free) {
+            /* The object was promoted into a free cell. */
+            zen_ChunkArray_add(collector->m_promotedCells, target, target + copySize);
+        }
+        collector->m_promotedBytes += copySize;
+        promotionFlags = collector->m_oldGeneration->m_promotionFlags;
+    }
+
+    zen_Object_t* copy = (zen_Object_t*)target;
+    memcpy(copy, object, size);
+    copy->m_size = copySize;
+    copy->m_flags |= promotionFlags;
+    if (age < ZEN_OBJECT_MAXIMUM_AGE) {
+        zen_Object_setAge(copy, age + 1);
+    }
+    zen_Object_forward(object, copy);
+
+    return copy;
+}
+
+/* Evacuate */
+
+/* Returns the address of the specified object after the collection. */
+static inline zen_Object_t* zen_CopyingGarbageCollector_evacuate(zen_CopyingGarbageCollector_t* collector,
+    zen_Object_t* object) {
+    if ((object != NULL) && zen_CopyingGarbageCollector_isInFromSpace(collector, object)) {
+        if (zen_Object_isForwarded(object)) {
+            object = zen_Object_getForwardingAddress(object);
+        }
+        else if ((object->m_flags & ZEN_OBJECT_FLAG_PINNED) == 0) {
+            object = zen_CopyingGarbageCollector_copy(collector, object);
+        }
+    }
+    return object;
+}
+
+/* Scan */
+
+/* Evacuate the objects referenced by the fields of the specified object.
+ * Returns true if the object still refers to the new generation afterwards.
+ */
+static bool zen_CopyingGarbageCollector_scanObject(zen_CopyingGarbageCollector_t* collector,
+    zen_Object_t* object) {
+    int32_t count;
+    zen_Reference_t* references = zen_Object_getReferences(object, &count);
+
+    bool young = false;
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        zen_Object_t* referent = zen_Reference_load(&references[i]);
+        zen_Object_t* target = zen_CopyingGarbageCollector_evacuate(collector, referent);
+        if (target != referent) {
+            zen_Reference_store(&references[i], target);
+        }
+        young |= (target != NULL) &&
+            zen_NewGeneration_contains(collector->m_newGeneration, target);
+    }
+    return young;
+}
+
+static void zen_CopyingGarbageCollector_scanChunks(zen_CopyingGarbageCollector_t* collector,
+    zen_ChunkArray_t* chunks) {
+    int32_t i;
+    for (i = 0; i < chunks->m_size; i++) {
+        zen_CopyingGarbageCollector_scanObject(collector,
+            (zen_Object_t*)chunks->m_chunks[i].m_start);
+    }
+}
+
+/* Scan the copied and promoted objects, until no object remains unscanned.
+ * Scanning an object may copy more objects, which are scanned in turn.
+ */
+static void zen_CopyingGarbageCollector_scan(zen_CopyingGarbageCollector_t* collector) {
+    zen_ChunkArray_t* chunks = collector->m_rightChunks;
+    zen_OldGeneration_t* oldGeneration = collector->m_oldGeneration;
+
+    bool scanned;
+    do {
+        scanned = false;
+
+        /* The array of chunks may grow while an object is being scanned.
+         * Therefore, the current chunk is reloaded on every iteration.
+         */
+        while (true) {
+            zen_Chunk_t* chunk = &chunks->m_chunks[collector->m_scanChunkIndex];
+            if (collector->m_scanPointer < chunk->m_end) {
+                zen_Object_t* object = (zen_Object_t*)collector->m_scanPointer;
+                collector->m_scanPointer += object->m_size;
+                zen_CopyingGarbageCollector_scanObject(collector, object);
+                scanned = true;
+            }
+            else if ((collector->m_scanChunkIndex + 1) < chunks->m_size) {
+                collector->m_scanChunkIndex++;
+                collector->m_scanPointer = chunks->m_chunks[collector->m_scanChunkIndex].m_start;
+            }
+            else {
+                break;
+            }
+        }
+
+        /* A promoted object which still refers to the new generation is
+         * remembered in the card table.
+         */
+        while (collector->m_promotionScanPointer < oldGeneration->m_free) {
+            zen_Object_t* object = (zen_Object_t*)collector->m_promotionScanPointer;
+            collector->m_promotionScanPointer += object->m_size;
+            if (zen_CopyingGarbageCollector_scanObject(collector, object)) {
+                zen_CardTable_markObject(oldGeneration->m_cardTable, object);
+            }
+            scanned = true;
+        }
+
+        zen_ChunkArray_t* promotedCells = collector->m_promotedCells;
+        while (collector->m_promotedCellIndex < promotedCells->m_size) {
+            zen_Object_t* object = (zen_Object_t*)
+                promotedCells->m_chunks[collector->m_promotedCellIndex++].m_start;
+            if (zen_CopyingGarbageCollector_scanObject(collector, object)) {
+                zen_CardTable_markObject(oldGeneration->m_cardTable, object);
+            }
+            scanned = true;
+        }
+    }
+    while (scanned);
+}
+
+/* Scan the objects whose headers lie in the dirty cards of the old
+ * generation. The objects promoted by the current collection, which begin at
+ * the specified limit, are scanned separately. Each dirty card is cleaned, and
+ * dirtied again only if one of its objects still refers to the new generation.
+ * Therefore, the cards which no longer remember anything are dropped.
+ */
+static void zen_CopyingGarbageCollector_scanCards(zen_CopyingGarbageCollector_t* collector,
+    uint8_t* limit) {
+    zen_CardTable_t* cardTable = collector->m_oldGeneration->m_cardTable;
+    int32_t size = zen_CardTable_getIndex(cardTable, limit - 1) + 1;
+    int32_t i;
+    for (i = 0; i < size; i++) {
+        if (cardTable->m_cards[i] == ZEN_CARD_TABLE_CARD_CLEAN) {
+            continue;
+        }
+        cardTable->m_cards[i] = ZEN_CARD_TABLE_CARD_CLEAN;
+        collector->m_scannedCardCount++;
+
+        uint8_t* current = zen_CardTable_getFirstObject(cardTable, i);
+        uint8_t* end = zen_CardTable_getCardStart(cardTable, i + 1);
+        if (end > limit) {
+            end = limit;
+        }
+
+        bool young = false;
+        while ((current != NULL) && (current < end)) {
+            zen_Object_t* object = (zen_Object_t*)current;
+            current += object->m_size;
+            young |= zen_CopyingGarbageCollector_scanObject(collector, object);
+        }
+
+        if (young) {
+            cardTable->m_cards[i] = ZEN_CARD_TABLE_CARD_DIRTY;
+        }
+    }
+}
+
+/* Scan the arrays of references in the large object space. They are not
+ * covered by the card table. Therefore, every one of them is scanned.
+ */
+static void zen_CopyingGarbageCollector_scanLargeObjects(zen_CopyingGarbageCollector_t* collector) {
+    zen_LargeObjectSpace_t* largeObjectSpace = collector->m_oldGeneration->m_largeObjectSpace;
+    int32_t i;
+    for (i = 0; i < largeObjectSpace->m_size; i++) {
+        zen_Object_t* object = (zen_Object_t*)largeObjectSpace->m_objects[i];
+        if ((object->m_flags & ZEN_OBJECT_FLAG_REFERENCE_ARRAY) != 0) {
+            zen_CopyingGarbageCollector_scanObject(collector, object);
+        }
+    }
+}
+
+/* Root Visitor */
+
+/* Pin the object which starts at the specified address, if any. The objects of
+ * the chunk which contains the address are walked from the start of the
+ * chunk. Therefore, a value which points inside an object, or to the free
+ * space, is rejected.
+ */
+static void zen_CopyingGarbageCollector_pin(zen_RootVisitor_t* visitor, uintptr_t value) {
+    zen_CopyingGarbageCollector_t* collector = (zen_CopyingGarbageCollector_t*)visitor->m_context;
+    uint8_t* address = (uint8_t*)value;
+
+    if (((value & (ZEN_ALLOCATION_BUFFER_ALIGNMENT - 1)) != 0) ||
+        !zen_CopyingGarbageCollector_isInFromSpace(collector, address)) {
+        return;
+    }
+
+    zen_Chunk_t* chunk = zen_ChunkArray_find(collector->m_fromChunks, address);
+    if (chunk == NULL) {
+        return;
+    }
+
+    uint8_t* current = chunk->m_start;
+    while (current < address) {
+        current += ((zen_Object_t*)current)->m_size;
+    }
+    if (current != address) {
+        return;
+    }
+
+    zen_Object_t* object = (zen_Object_t*)address;
+    if ((object->m_flags & ZEN_OBJECT_FLAG_PINNED) == 0) {
+        object->m_flags |= ZEN_OBJECT_FLAG_PINNED;
+        int32_t age = zen_Object_getAge(object);
+        if (age < ZEN_OBJECT_MAXIMUM_AGE) {
+            zen_Object_setAge(object, age + 1);
+        }
+
+        zen_ChunkArray_t* pins =
+            zen_Region_contains(collector->m_newGeneration->m_middleRegion, address)?
+            collector->m_middlePins : collector->m_leftPins;
+        zen_ChunkArray_add(pins, address, address + object->m_size);
+    }
+}
+
+static void zen_CopyingGarbageCollector_evacuateRoot(zen_RootVisitor_t* visitor, zen_Object_t** root) {
+    zen_CopyingGarbageCollector_t* collector = (zen_CopyingGarbageCollector_t*)visitor->m_context;
+    *root = zen_CopyingGarbageCollector_evacuate(collector, *root);
+}
+
+static void zen_CopyingGarbageCollector_ignoreRoot(zen_RootVisitor_t* visitor, zen_Object_t** root) {
+}
+
+static void zen_CopyingGarbageCollector_ignoreAmbiguousRoot(zen_RootVisitor_t* visitor, uintptr_t value) {
+}
+
+/* Collect */
+
+static void zen_CopyingGarbageCollector_unpin(zen_ChunkArray_t* pins) {
+    int32_t i;
+    for (i = 0; i < pins->m_size; i++) {
+        zen_Object_t* object = (zen_Object_t*)pins->m_chunks[i].m_start;
+        object->m_flags &= ~ZEN_OBJECT_FLAG_PINNED;
+    }
+}
+
+/* Index the chunks of the middle and left regions, so that the ambiguous
+ * references can be verified. Empty chunks are dropped, so that the search
+ * never stops at a chunk which contains nothing.
+ */
+static void zen_CopyingGarbageCollector_indexFromSpace(zen_CopyingGarbageCollector_t* collector) {
+    zen_ChunkArray_t* chunks = collector->m_fromChunks;
+    zen_ChunkArray_clear(chunks);
+    zen_SequentialAllocator_getChunks(collector->m_newGeneration->m_allocator, chunks);
+    zen_ChunkArray_addAll(chunks, collector->m_newGeneration->m_leftChunks);
+
+    int32_t size = 0;
+    int32_t i;
+    for (i = 0; i < chunks->m_size; i++) {
+        if (chunks->m_chunks[i].m_start < chunks->m_chunks[i].m_end) {
+            chunks->m_chunks[size++] = chunks->m_chunks[i];
+        }
+    }
+    chunks->m_size = size;
+    zen_ChunkArray_sort(chunks);
+}
+
+bool zen_CopyingGarbageCollector_collect(zen_CopyingGarbageCollector_t* collector,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context) {
+    jtk_Assert_assertObject(collector, "The specified collector is null.");
+
+    zen_NewGeneration_t* newGeneration = collector->m_newGeneration;
+    zen_OldGeneration_t* oldGeneration = collector->m_oldGeneration;
+    zen_SequentialAllocator_t* allocator = newGeneration->m_allocator;
+
+    /* The ends of the chunks are recorded when the buffers are retired. */
+    zen_SequentialAllocator_retireAllocationBuffers(allocator);
+    zen_CopyingGarbageCollector_indexFromSpace(collector);
+
+    /* In the worst case, every object in the middle and left regions is
+     * promoted. The alignment of the old generation adds at most half the
+     * size of the smallest object to each object.
+     */
+    intptr_t usedSize = 0;
+    int32_t i;
+    for (i = 0; i < collector->m_fromChunks->m_size; i++) {
+        zen_Chunk_t* chunk = &collector->m_fromChunks->m_chunks[i];
+        usedSize += chunk->m_end - chunk->m_start;
+    }
+    if (zen_OldGeneration_getAvailableSize(oldGeneration) < (usedSize + (usedSize >> 1))) {
+        return false;
+    }
+
+    collector->m_copiedBytes = 0;
+    collector->m_promotedBytes = 0;
+    collector->m_scannedCardCount = 0;
+
+    /* Pin the objects referenced ambiguously. It is done before any object is
+     * moved, because an ambiguous reference cannot be updated.
+     */
+    zen_ChunkArray_clear(collector->m_middlePins);
+    zen_ChunkArray_clear(collector->m_leftPins);
+    enumerateRoots(context, &collector->m_pinningVisitor);
+
+    /* Prepare the right region. The first chunk begins at the start of the
+     * region, or after the first hole.
+     */
+    zen_ChunkArray_t* rightHoles = newGeneration->m_rightHoles;
+    zen_ChunkArray_clear(collector->m_rightChunks);
+    collector->m_rightHoleIndex = 0;
+    collector->m_rightFree = newGeneration->m_rightRegion->m_start;
+    collector->m_rightLimit = (rightHoles->m_size > 0)? rightHoles->m_chunks[0].m_start :
+        newGeneration->m_rightRegion->m_limit;
+    zen_ChunkArray_add(collector->m_rightChunks, collector->m_rightFree, collector->m_rightFree);
+    collector->m_scanChunkIndex = 0;
+    collector->m_scanPointer = collector->m_rightFree;
+
+    /* The objects promoted by this collection are scanned from the current
+     * free pointer. The older objects are scanned only if their cards are
+     * dirty.
+     */
+    uint8_t* promotionStart = oldGeneration->m_free;
+    collector->m_promotionScanPointer = promotionStart;
+    zen_ChunkArray_clear(collector->m_promotedCells);
+    collector->m_promotedCellIndex = 0;
+    if (promotionStart > oldGeneration->m_whiteRegion->m_start) {
+        zen_CopyingGarbageCollector_scanCards(collector, promotionStart);
+    }
+    zen_CopyingGarbageCollector_scanLargeObjects(collector);
+
+    /* The objects which stay in place may refer to the objects which move. */
+    zen_CopyingGarbageCollector_scanChunks(collector, collector->m_middlePins);
+    zen_CopyingGarbageCollector_scanChunks(collector, collector->m_leftPins);
+    zen_CopyingGarbageCollector_scanChunks(collector, rightHoles);
+
+    enumerateRoots(context, &collector->m_evacuatingVisitor);
+    zen_CopyingGarbageCollector_scan(collector);
+
+    zen_CopyingGarbageCollector_unpin(collector->m_middlePins);
+    zen_CopyingGarbageCollector_unpin(collector->m_leftPins);
+
+    /* The pinned objects of the middle region become holes in the allocator. */
+    zen_SequentialAllocator_reset(allocator);
+    zen_ChunkArray_sort(collector->m_middlePins);
+    zen_ChunkArray_addAll(allocator->m_holes, collector->m_middlePins);
+
+    /* The right region, which becomes the left region, holds the copied
+     * objects and its holes. The left region, which becomes the right region,
+     * holds only the objects pinned in it.
+     */
+    zen_ChunkArray_t* leftChunks = newGeneration->m_leftChunks;
+    zen_ChunkArray_addAll(rightHoles, collector->m_rightChunks);
+    zen_ChunkArray_sort(rightHoles);
+    zen_ChunkArray_clear(leftChunks);
+    zen_ChunkArray_addAll(leftChunks, collector->m_leftPins);
+    zen_ChunkArray_sort(leftChunks);
+    zen_NewGeneration_swapSurvivorRegions(newGeneration);
+
+    collector->m_collectionCount++;
+
+    return true;
+}
@@ -0,0 +1,636 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionFlag.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/MarkCompactGarbageCollector.h>
+
+/*******************************************************************************
+ * MarkingWorker                                                               *
+ *******************************************************************************/
+
+static zen_MarkingWorker_t* zen_MarkingWorker_new(zen_MarkCompactGarbageCollector_t* collector,
+    int32_t index) {
+    zen_MarkingWorker_t* worker = jtk_Memory_allocate(zen_MarkingWorker_t, 1);
+    worker->m_collector = collector;
+    worker->m_deque = zen_WorkStealingDeque_new();
+    worker->m_index = index;
+    worker->m_duration = 0;
+    worker->m_scannedObjectCount = 0;
+    worker->m_stolenObjectCount = 0;
+
+    return worker;
+}
+
+static void zen_MarkingWorker_delete(zen_MarkingWorker_t* worker) {
+    zen_WorkStealingDeque_delete(worker->m_deque);
+    jtk_Memory_deallocate(worker);
+}
+
+/*******************************************************************************
+ * MarkCompactGarbageCollector                                                 *
+ *******************************************************************************/
+
+static void zen_MarkCompactGarbageCollector_markRoot(zen_RootVisitor_t* visitor, zen_Object_t** root);
+static void zen_MarkCompactGarbageCollector_markAmbiguousRoot(zen_RootVisitor_t* visitor, uintptr_t value);
+static void zen_MarkCompactGarbageCollector_updateRoot(zen_RootVisitor_t* visitor, zen_Object_t** root);
+static void zen_MarkCompactGarbageCollector_ignoreAmbiguousRoot(zen_RootVisitor_t* visitor, uintptr_t value);
+
+/* Constructor */
+
+zen_MarkCompactGarbageCollector_t* zen_MarkCompactGarbageCollector_new(
+    zen_NewGeneration_t* newGeneration, zen_OldGeneration_t* oldGeneration) {
+    jtk_Assert_assertObject(newGeneration, "The specified new generation is null.");
+    jtk_Assert_assertObject(oldGeneration, "The specified old generation is null.");
+
+    zen_MarkCompactGarbageCollector_t* collector = jtk_Memory_allocate(zen_MarkCompactGarbageCollector_t, 1);
+    collector->m_newGeneration = newGeneration;
+    collector->m_oldGeneration = oldGeneration;
+    collector->m_markingVisitor.m_visitRoot = zen_MarkCompactGarbageCollector_markRoot;
+    collector->m_markingVisitor.m_visitAmbiguousRoot = zen_MarkCompactGarbageCollector_markAmbiguousRoot;
+    collector->m_markingVisitor.m_context = collector;
+    collector->m_updatingVisitor.m_visitRoot = zen_MarkCompactGarbageCollector_updateRoot;
+    collector->m_updatingVisitor.m_visitAmbiguousRoot = zen_MarkCompactGarbageCollector_ignoreAmbiguousRoot;
+    collector->m_updatingVisitor.m_context = collector;
+    collector->m_youngChunks = zen_ChunkArray_new();
+    collector->m_workers = NULL;
+    collector->m_workerCount = 0;
+    collector->m_activeWorkerCount = 0;
+    collector->m_nextWorker = 0;
+    collector->m_markingDurations = NULL;
+    zen_MarkCompactGarbageCollector_setWorkerCount(collector,
+        ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_DEFAULT_WORKER_COUNT);
+    collector->m_cardAddresses = jtk_Memory_allocate(uint8_t*, oldGeneration->m_cardTable->m_size);
+    collector->m_densePrefixEnd = oldGeneration->m_whiteRegion->m_start;
+    collector->m_collectionCount = 0;
+    collector->m_markedBytes = 0;
+    collector->m_reclaimedBytes = 0;
+
+    return collector;
+}
+
+/* Destructor */
+
+void zen_MarkCompactGarbageCollector_delete(zen_MarkCompactGarbageCollector_t* collector) {
+    jtk_Assert_assertObject(collector, "The specified collector is null.");
+
+    int32_t i;
+    for (i = 0; i < collector->m_workerCount; i++) {
+        zen_MarkingWorker_delete(collector->m_workers[i]);
+    }
+    jtk_Memory_deallocate(collector->m_workers);
+    jtk_Memory_deallocate(collector->m_markingDurations);
+    jtk_Memory_deallocate(collector->m_cardAddresses);
+    zen_ChunkArray_delete(collector->m_youngChunks);
+    jtk_Memory_deallocate(collector);
+}
+
+/* Mark */
+
+static inline uint64_t zen_MarkCompactGarbageCollector_getTime() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((uint64_t)time.tv_sec * 1000000000ULL) + (uint64_t)time.tv_nsec;
+}
+
+/* Set the mark bit of the specified object. Returns the flags of the object,
+ * if this thread set the mark bit, and zero otherwise. The mark bit is set
+ * with a compare and swap, rather than an atomic or. A thread which loses the
+ * race does not write the flags, which the winner may be reading already.
+ */
+static inline int32_t zen_MarkCompactGarbageCollector_setMarked(zen_Object_t* object) {
+    int32_t flags = __atomic_load_n(&object->m_flags, __ATOMIC_RELAXED);
+    while ((flags & ZEN_OBJECT_FLAG_MARKED) == 0) {
+        if (__atomic_compare_exchange_n(&object->m_flags, &flags, flags | ZEN_OBJECT_FLAG_MARKED,
+            true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return flags | ZEN_OBJECT_FLAG_MARKED;
+        }
+    }
+    return 0;
+}
+
+/* Mark the specified object and push it to the deque of the specified worker.
+ * The mark bit is set atomically, so that only the worker which sets it scans
+ * the object. A large object is scanned only if it is an array of references.
+ */
+static inline void zen_MarkCompactGarbageCollector_mark(zen_MarkCompactGarbageCollector_t* collector,
+    zen_MarkingWorker_t* worker, zen_Object_t* object) {
+    if (object == NULL) {
+        return;
+    }
+
+    if (zen_OldGeneration_contains(collector->m_oldGeneration, object)) {
+        if (zen_MarkCompactGarbageCollector_setMarked(object) != 0) {
+            zen_WorkStealingDeque_push(worker->m_deque, object);
+        }
+    }
+    else if (!zen_NewGeneration_contains(collector->m_newGeneration, object) &&
+        ((__atomic_load_n(&object->m_flags, __ATOMIC_RELAXED) & ZEN_OBJECT_FLAG_LARGE) != 0)) {
+        int32_t flags = zen_MarkCompactGarbageCollector_setMarked(object);
+        if ((flags & ZEN_OBJECT_FLAG_REFERENCE_ARRAY) != 0) {
+            zen_WorkStealingDeque_push(worker->m_deque, object);
+        }
+    }
+}
+
+static void zen_MarkCompactGarbageCollector_markReferences(zen_MarkCompactGarbageCollector_t* collector,
+    zen_MarkingWorker_t* worker, zen_Object_t* object) {
+    int32_t count;
+    zen_Reference_t* references = zen_Object_getReferences(object, &count);
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        zen_MarkCompactGarbageCollector_mark(collector, worker, zen_Reference_load(&references[i]));
+    }
+}
+
+/* The roots are marked before the workers start. Therefore, the deques of all
+ * the workers can be filled by the collecting thread.
+ */
+static inline zen_MarkingWorker_t* zen_MarkCompactGarbageCollector_getRootWorker(
+    zen_MarkCompactGarbageCollector_t* collector) {
+    zen_MarkingWorker_t* worker = collector->m_workers[collector->m_nextWorker];
+    collector->m_nextWorker = (collector->m_nextWorker + 1) % collector->m_workerCount;
+    return worker;
+}
+
+/* The objects of the new generation are not traced. Therefore, every object
+ * in the new generation is treated as a root.
+ */
+static void zen_MarkCompactGarbageCollector_markYoungObjects(
+    zen_MarkCompactGarbageCollector_t* collector) {
+    zen_ChunkArray_t* chunks = collector->m_youngChunks;
+    zen_ChunkArray_clear(chunks);
+    zen_NewGeneration_getChunks(collector->m_newGeneration, chunks);
+
+    int32_t i;
+    for (i = 0; i < chunks->m_size; i++) {
+        uint8_t* current = chunks->m_chunks[i].m_start;
+        while (current < chunks->m_chunks[i].m_end) {
+            zen_Object_t* object = (zen_Object_t*)current;
+            current += object->m_size;
+            zen_MarkCompactGarbageCollector_markReferences(collector,
+                zen_MarkCompactGarbageCollector_getRootWorker(collector), object);
+        }
+    }
+}
+
+/* Steal an object from the deques of the other workers, starting with the
+ * worker which follows the specified worker.
+ */
+static zen_Object_t* zen_MarkCompactGarbageCollector_steal(zen_MarkCompactGarbageCollector_t* collector,
+    zen_MarkingWorker_t* worker) {
+    int32_t i;
+    for (i = 1; i < collector->m_workerCount; i++) {
+        zen_MarkingWorker_t* victim = collector->m_workers[(worker->m_index + i) % collector->m_workerCount];
+        zen_Object_t* object = zen_WorkStealingDeque_steal(victim->m_deque);
+        if (object != NULL) {
+            worker->m_stolenObjectCount++;
+            return object;
+        }
+    }
+    return NULL;
+}
+
+static bool zen_MarkCompactGarbageCollector_hasWork(zen_MarkCompactGarbageCollector_t* collector) {
+    int32_t i;
+    for (i = 0; i < collector->m_workerCount; i++) {
+        if (!zen_WorkStealingDeque_isEmpty(collector->m_workers[i]->m_deque)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* A worker offers to terminate when its deque is empty and it failed to steal
+ * an object. An idle worker holds no objects, and only an active worker pushes
+ * objects to its deque. Therefore, once every worker is idle, every deque is
+ * empty and remains so. An idle worker which sees an object in a deque becomes
+ * active again before it attempts to steal the object. Returns true if the
+ * marking phase has terminated.
+ */
+static bool zen_MarkCompactGarbageCollector_offerTermination(
+    zen_MarkCompactGarbageCollector_t* collector) {
+    __atomic_sub_fetch(&collector->m_activeWorkerCount, 1, __ATOMIC_SEQ_CST);
+    while (true) {
+        if (__atomic_load_n(&collector->m_activeWorkerCount, __ATOMIC_SEQ_CST) == 0) {
+            return true;
+        }
+        if (zen_MarkCompactGarbageCollector_hasWork(collector)) {
+            __atomic_add_fetch(&collector->m_activeWorkerCount, 1, __ATOMIC_SEQ_CST);
+            return false;
+        }
+        sched_yield();
+    }
+}
+
+/* Scan the marked objects, until every deque is empty. */
+static void zen_MarkCompactGarbageCollector_runWorker(zen_MarkingWorker_t* worker) {
+    zen_MarkCompactGarbageCollector_t* collector = worker->m_collector;
+    uint64_t start = zen_MarkCompactGarbageCollector_getTime();
+    while (true) {
+        zen_Object_t* object;
+        while ((object = zen_WorkStealingDeque_pop(worker->m_deque)) != NULL) {
+            zen_MarkCompactGarbageCollector_markReferences(collector, worker, object);
+            worker->m_scannedObjectCount++;
+        }
+
+        object = zen_MarkCompactGarbageCollector_steal(collector, worker);
+        if (object != NULL) {
+            zen_MarkCompactGarbageCollector_markReferences(collector, worker, object);
+            worker->m_scannedObjectCount++;
+        }
+        else if (zen_MarkCompactGarbageCollector_offerTermination(collector)) {
+            break;
+        }
+    }
+    worker->m_duration = zen_MarkCompactGarbageCollector_getTime() - start;
+}
+
+static void* zen_MarkCompactGarbageCollector_runWorkerThread(void* argument) {
+    zen_MarkCompactGarbageCollector_runWorker((zen_MarkingWorker_t*)argument);
+    return NULL;
+}
+
+/* Trace the objects marked from the roots with all the workers. */
+static void zen_MarkCompactGarbageCollector_traceObjects(zen_MarkCompactGarbageCollector_t* collector) {
+    zen_MarkingWorker_t* mainWorker = collector->m_workers[0];
+    bool started[ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_MAXIMUM_WORKER_COUNT];
+    collector->m_activeWorkerCount = collector->m_workerCount;
+
+    int32_t i;
+    for (i = 1; i < collector->m_workerCount; i++) {
+        zen_MarkingWorker_t* worker = collector->m_workers[i];
+        started[i] = pthread_create(&worker->m_thread, NULL,
+            zen_MarkCompactGarbageCollector_runWorkerThread, worker) == 0;
+        if (!started[i]) {
+            /* The objects of a worker which failed to start are handed over to
+             * the first worker, which has not started yet, before the worker
+             * becomes idle.
+             */
+            zen_Object_t* object;
+            while ((object = zen_WorkStealingDeque_pop(worker->m_deque)) != NULL) {
+                zen_WorkStealingDeque_push(mainWorker->m_deque, object);
+            }
+            worker->m_duration = 0;
+            __atomic_sub_fetch(&collector->m_activeWorkerCount, 1, __ATOMIC_SEQ_CST);
+        }
+    }
+
+    zen_MarkCompactGarbageCollector_runWorker(mainWorker);
+
+    for (i = 1; i < collector->m_workerCount; i++) {
+        if (started[i]) {
+            pthread_join(collector->m_workers[i]->m_thread, NULL);
+        }
+    }
+}
+
+/* Compute */
+
+static inline bool zen_MarkCompactGarbageCollector_isStationary(
+    zen_MarkCompactGarbageCollector_t* collector, zen_Object_t* object) {
+    return ((object->m_flags & ZEN_OBJECT_FLAG_PINNED) != 0) ||
+        ((uint8_t*)object < collector->m_densePrefixEnd);
+}
+
+/* The dense prefix ends at the first marked object where the dead objects
+ * before it exceed the permitted waste. The objects before it are not moved.
+ */
+static void zen_MarkCompactGarbageCollector_computeDensePrefix(
+    zen_MarkCompactGarbageCollector_t* collector, int32_t flags) {
+    uint8_t* start = collector->m_oldGeneration->m_whiteRegion->m_start;
+    uint8_t* end = collector->m_oldGeneration->m_free;
+    if ((flags & ZEN_GARBAGE_COLLECTION_FLAG_SQUEEZE) != 0) {
+        collector->m_densePrefixEnd = start;
+        return;
+    }
+
+    intptr_t deadSize = 0;
+    uint8_t* current = start;
+    while (current < end) {
+        zen_Object_t* object = (zen_Object_t*)current;
+        if ((object->m_flags & ZEN_OBJECT_FLAG_MARKED) != 0) {
+            if ((deadSize << ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_DENSE_PREFIX_WASTE_SHIFT) >
+                (current - start)) {
+                break;
+            }
+        }
+        else {
+            deadSize += object->m_size;
+        }
+        current += object->m_size;
+    }
+    collector->m_densePrefixEnd = current;
+}
+
+/* Slide the marked objects towards the start of the white region, without
+ * moving them yet. The compaction address reached at the first object of
+ * each card is recorded. Returns the end of the compacted objects.
+ */
+static uint8_t* zen_MarkCompactGarbageCollector_computeAddresses(
+    zen_MarkCompactGarbageCollector_t* collector) {
+    zen_CardTable_t* cardTable = collector->m_oldGeneration->m_cardTable;
+    uint8_t* end = collector->m_oldGeneration->m_free;
+    uint8_t* free = collector->m_oldGeneration->m_whiteRegion->m_start;
+    uint8_t* current = free;
+    collector->m_markedBytes = 0;
+    while (current < end) {
+        zen_Object_t* object = (zen_Object_t*)current;
+        int32_t index = zen_CardTable_getIndex(cardTable, current);
+        if (zen_CardTable_getFirstObject(cardTable, index) == current) {
+            collector->m_cardAddresses[index] = free;
+        }
+
+        if ((object->m_flags & ZEN_OBJECT_FLAG_MARKED) != 0) {
+            free = zen_MarkCompactGarbageCollector_isStationary(collector, object)?
+                (current + object->m_size) : (free + object->m_size);
+            collector->m_markedBytes += object->m_size;
+        }
+        current += object->m_size;
+    }
+    return free;
+}
+
+/* Derive the new address of the specified object from the compaction address
+ * of its card, by walking the objects which precede it in the card.
+ */
+static zen_Object_t* zen_MarkCompactGarbageCollector_getNewAddress(
+    zen_MarkCompactGarbageCollector_t* collector, zen_Object_t* object) {
+    if (!zen_OldGeneration_contains(collector->m_oldGeneration, object) ||
+        zen_MarkCompactGarbageCollector_isStationary(collector, object)) {
+        return object;
+    }
+
+    zen_CardTable_t* cardTable = collector->m_oldGeneration->m_cardTable;
+    int32_t index = zen_CardTable_getIndex(cardTable, object);
+    uint8_t* current = zen_CardTable_getFirstObject(cardTable, index);
+    uint8_t* free = collector->m_cardAddresses[index];
+    while (current < (uint8_t*)object) {
+        zen_Object_t* other = (zen_Object_t*)current;
+        if ((other->m_flags & ZEN_OBJECT_FLAG_MARKED) != 0) {
+            free = zen_MarkCompactGarbageCollector_isStationary(collector, other)?
+                (current + other->m_size) : (free + other->m_size);
+        }
+        current += other->m_size;
+    }
+    return (zen_Object_t*)free;
+}
+
+/* Update */
+
+static void zen_MarkCompactGarbageCollector_updateReferences(
+    zen_MarkCompactGarbageCollector_t* collector, zen_Object_t* object) {
+    int32_t count;
+    zen_Reference_t* references = zen_Object_getReferences(object, &count);
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        zen_Object_t* referent = zen_Reference_load(&references[i]);
+        if (referent != NULL) {
+            zen_Reference_store(&references[i],
+                zen_MarkCompactGarbageCollector_getNewAddress(collector, referent));
+        }
+    }
+}
+
+static void zen_MarkCompactGarbageCollector_updateHeap(zen_MarkCompactGarbageCollector_t* collector) {
+    zen_ChunkArray_t* chunks = collector->m_youngChunks;
+    int32_t i;
+    for (i = 0; i < chunks->m_size; i++) {
+        uint8_t* current = chunks->m_chunks[i].m_start;
+        while (current < chunks->m_chunks[i].m_end) {
+            zen_Object_t* object = (zen_Object_t*)current;
+            current += object->m_size;
+            zen_MarkCompactGarbageCollector_updateReferences(collector, object);
+        }
+    }
+
+    uint8_t* end = collector->m_oldGeneration->m_free;
+    uint8_t* current = collector->m_oldGeneration->m_whiteRegion->m_start;
+    while (current < end) {
+        zen_Object_t* object = (zen_Object_t*)current;
+        current += object->m_size;
+        if ((object->m_flags & ZEN_OBJECT_FLAG_MARKED) != 0) {
+            zen_MarkCompactGarbageCollector_updateReferences(collector, object);
+        }
+    }
+
+    /* The large objects are not moved, but the arrays of references among
+     * them may refer to the objects which are.
+     */
+    zen_LargeObjectSpace_t* largeObjectSpace = collector->m_oldGeneration->m_largeObjectSpace;
+    for (i = 0; i < largeObjectSpace->m_size; i++) {
+        zen_Object_t* object = (zen_Object_t*)largeObjectSpace->m_objects[i];
+        if ((object->m_flags & (ZEN_OBJECT_FLAG_MARKED | ZEN_OBJECT_FLAG_REFERENCE_ARRAY)) ==
+            (ZEN_OBJECT_FLAG_MARKED | ZEN_OBJECT_FLAG_REFERENCE_ARRAY)) {
+            zen_MarkCompactGarbageCollector_updateReferences(collector, object);
+        }
+    }
+}
+
+/* Move */
+
+/* Move the marked objects to their new addresses, in the order of their
+ * addresses. An object never moves past the start of the object that follows
+ * it, therefore, the header of the next object is intact until it is visited.
+ */
+static void zen_MarkCompactGarbageCollector_moveObjects(zen_MarkCompactGarbageCollector_t* collector) {
+    uint8_t* end = collector->m_oldGeneration->m_free;
+    uint8_t* free = collector->m_oldGeneration->m_whiteRegion->m_start;
+    uint8_t* current = free;
+    while (current < end) {
+        zen_Object_t* object = (zen_Object_t*)current;
+        int32_t size = object->m_size;
+        if ((object->m_flags & ZEN_OBJECT_FLAG_MARKED) != 0) {
+            uint8_t* target = free;
+            if (zen_MarkCompactGarbageCollector_isStationary(collector, object)) {
+                if (free < current) {
+                    zen_Object_fill(free, current - free);
+                }
+                target = current;
+            }
+            else if (target != current) {
+                memmove(target, current, size);
+            }
+            ((zen_Object_t*)target)->m_flags &= ~(ZEN_OBJECT_FLAG_MARKED | ZEN_OBJECT_FLAG_PINNED);
+            free = target + size;
+        }
+        current += size;
+    }
+}
+
+/* Rebuild the card table for the compacted white region. The cards of the
+ * objects which refer to the new generation are dirtied.
+ */
+static void zen_MarkCompactGarbageCollector_rebuildCardTable(
+    zen_MarkCompactGarbageCollector_t* collector) {
+    zen_CardTable_t* cardTable = collector->m_oldGeneration->m_cardTable;
+    zen_CardTable_clear(cardTable);
+
+    uint8_t* end = collector->m_oldGeneration->m_free;
+    uint8_t* current = collector->m_oldGeneration->m_whiteRegion->m_start;
+    while (current < end) {
+        zen_Object_t* object = (zen_Object_t*)current;
+        zen_CardTable_recordObject(cardTable, object);
+
+        int32_t count;
+        zen_Reference_t* references = zen_Object_getReferences(object, &count);
+        int32_t i;
+        for (i = 0; i < count; i++) {
+            zen_Object_t* referent = zen_Reference_load(&references[i]);
+            if ((referent != NULL) &&
+                zen_NewGeneration_contains(collector->m_newGeneration, referent)) {
+                zen_CardTable_markObject(cardTable, object);
+                break;
+            }
+        }
+
+        current += object->m_size;
+    }
+}
+
+/* Root Visitor */
+
+static void zen_MarkCompactGarbageCollector_markRoot(zen_RootVisitor_t* visitor, zen_Object_t** root) {
+    zen_MarkCompactGarbageCollector_t* collector = (zen_MarkCompactGarbageCollector_t*)visitor->m_context;
+    zen_MarkCompactGarbageCollector_mark(collector,
+        zen_MarkCompactGarbageCollector_getRootWorker(collector), *root);
+}
+
+/* An object referenced ambiguously is marked and pinned. */
+static void zen_MarkCompactGarbageCollector_markAmbiguousRoot(zen_RootVisitor_t* visitor, uintptr_t value) {
+    zen_MarkCompactGarbageCollector_t* collector = (zen_MarkCompactGarbageCollector_t*)visitor->m_context;
+    if (zen_OldGeneration_isObject(collector->m_oldGeneration, (uint8_t*)value)) {
+        zen_Object_t* object = (zen_Object_t*)value;
+        object->m_flags |= ZEN_OBJECT_FLAG_PINNED;
+        zen_MarkCompactGarbageCollector_mark(collector,
+            zen_MarkCompactGarbageCollector_getRootWorker(collector), object);
+    }
+    else if (zen_LargeObjectSpace_isObject(collector->m_oldGeneration->m_largeObjectSpace,
+        (uint8_t*)value)) {
+        zen_MarkCompactGarbageCollector_mark(collector,
+            zen_MarkCompactGarbageCollector_getRootWorker(collector), (zen_Object_t*)value);
+    }
+}
+
+static void zen_MarkCompactGarbageCollector_updateRoot(zen_RootVisitor_t* visitor, zen_Object_t** root) {
+    zen_MarkCompactGarbageCollector_t* collector = (zen_MarkCompactGarbageCollector_t*)visitor->m_context;
+    if (*root != NULL) {
+        *root = zen_MarkCompactGarbageCollector_getNewAddress(collector, *root);
+    }
+}
+
+static void zen_MarkCompactGarbageCollector_ignoreAmbiguousRoot(zen_RootVisitor_t* visitor, uintptr_t value) {
+}
+
+/* Collect */
+
+void zen_MarkCompactGarbageCollector_collect(zen_MarkCompactGarbageCollector_t* collector,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context,
+    int32_t flags) {
+    jtk_Assert_assertObject(collector, "The specified collector is null.");
+
+    /* Mark */
+    int32_t i;
+    for (i = 0; i < collector->m_workerCount; i++) {
+        zen_MarkingWorker_t* worker = collector->m_workers[i];
+        zen_WorkStealingDeque_clear(worker->m_deque);
+        worker->m_scannedObjectCount = 0;
+        worker->m_stolenObjectCount = 0;
+    }
+    collector->m_nextWorker = 0;
+    enumerateRoots(context, &collector->m_markingVisitor);
+    zen_MarkCompactGarbageCollector_markYoungObjects(collector);
+    zen_MarkCompactGarbageCollector_traceObjects(collector);
+    for (i = 0; i < collector->m_workerCount; i++) {
+        collector->m_markingDurations[i] = collector->m_workers[i]->m_duration;
+    }
+
+    zen_MarkCompactGarbageCollector_compact(collector, enumerateRoots, context, flags);
+}
+
+/* Compact */
+
+void zen_MarkCompactGarbageCollector_compact(zen_MarkCompactGarbageCollector_t* collector,
+    zen_RootVisitor_EnumerateRootsFunction_t enumerateRoots, void* context,
+    int32_t flags) {
+    jtk_Assert_assertObject(collector, "The specified collector is null.");
+
+    zen_OldGeneration_t* oldGeneration = collector->m_oldGeneration;
+    intptr_t usedSize = zen_OldGeneration_getUsedSize(oldGeneration);
+
+    /* The new generation may have changed since the objects were marked. */
+    zen_ChunkArray_clear(collector->m_youngChunks);
+    zen_NewGeneration_getChunks(collector->m_newGeneration, collector->m_youngChunks);
+
+    /* Compute the new addresses. */
+    zen_MarkCompactGarbageCollector_computeDensePrefix(collector, flags);
+    uint8_t* free = zen_MarkCompactGarbageCollector_computeAddresses(collector);
+
+    /* Update the references, while the objects are still in place. */
+    enumerateRoots(context, &collector->m_updatingVisitor);
+    zen_MarkCompactGarbageCollector_updateHeap(collector);
+
+    /* Move */
+    zen_MarkCompactGarbageCollector_moveObjects(collector);
+    oldGeneration->m_free = free;
+
+    /* Coalesce the gaps left in the dense prefix and around the pinned
+     * objects into free cells.
+     */
+    zen_OldGeneration_sweep(oldGeneration);
+    collector->m_reclaimedBytes = usedSize - zen_OldGeneration_getUsedSize(oldGeneration);
+
+    /* The large objects which were not marked are unmapped. */
+    collector->m_reclaimedBytes += zen_LargeObjectSpace_sweep(oldGeneration->m_largeObjectSpace);
+    zen_MarkCompactGarbageCollector_rebuildCardTable(collector);
+
+    collector->m_collectionCount++;
+}
+
+/* Worker Count */
+
+void zen_MarkCompactGarbageCollector_setWorkerCount(zen_MarkCompactGarbageCollector_t* collector,
+    int32_t workerCount) {
+    jtk_Assert_assertObject(collector, "The specified collector is null.");
+    jtk_Assert_assertTrue((workerCount >= 1) &&
+        (workerCount <= ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_MAXIMUM_WORKER_COUNT),
+        "The specified worker count is invalid.");
+
+    if (collector->m_workers != NULL) {
+        int32_t i;
+        for (i = 0; i < collector->m_workerCount; i++) {
+            zen_MarkingWorker_delete(collector->m_workers[i]);
+        }
+        jtk_Memory_deallocate(collector->m_workers);
+        jtk_Memory_deallocate(collector->m_markingDurations);
+    }
+
+    collector->m_workers = jtk_Memory_allocate(zen_MarkingWorker_t*, workerCount);
+    int32_t i;
+    for (i = 0; i < workerCount; i++) {
+        collector->m_workers[i] = zen_MarkingWorker_new(collector, i);
+    }
+    collector->m_workerCount = workerCount;
+    collector->m_markingDurations = jtk_Memory_allocate(uint64_t, workerCount);
+    collector->m_nextWorker = 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <time.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/collector/Safepoint.h>
+
+/*******************************************************************************
+ * Safepoint                                                                   *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_Safepoint_t* zen_Safepoint_new() {
+    zen_Safepoint_t* safepoint = jtk_Memory_allocate(zen_Safepoint_t, 1);
+    safepoint->m_requested = 0;
+    safepoint->m_runningCount = 0;
+    safepoint->m_threadCount = 0;
+    safepoint->m_requestCount = 0;
+    safepoint->m_synchronizationDuration = 0;
+    pthread_mutex_init(&safepoint->m_mutex, NULL);
+    pthread_cond_init(&safepoint->m_stoppedCondition, NULL);
+    pthread_cond_init(&safepoint->m_releasedCondition, NULL);
+
+    return safepoint;
+}
+
+/* Destructor */
+
+void zen_Safepoint_delete(zen_Safepoint_t* safepoint) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    pthread_cond_destroy(&safepoint->m_releasedCondition);
+    pthread_cond_destroy(&safepoint->m_stoppedCondition);
+    pthread_mutex_destroy(&safepoint->m_mutex);
+    jtk_Memory_deallocate(safepoint);
+}
+
+/* Attach */
+
+void zen_Safepoint_attach(zen_Safepoint_t* safepoint) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    pthread_mutex_lock(&safepoint->m_mutex);
+    while (__atomic_load_n(&safepoint->m_requested, __ATOMIC_SEQ_CST) != 0) {
+        pthread_cond_wait(&safepoint->m_releasedCondition, &safepoint->m_mutex);
+    }
+    safepoint->m_threadCount++;
+    __atomic_add_fetch(&safepoint->m_runningCount, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&safepoint->m_mutex);
+}
+
+void zen_Safepoint_detach(zen_Safepoint_t* safepoint) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    pthread_mutex_lock(&safepoint->m_mutex);
+    safepoint->m_threadCount--;
+    __atomic_sub_fetch(&safepoint->m_runningCount, 1, __ATOMIC_SEQ_CST);
+    pthread_cond_broadcast(&safepoint->m_stoppedCondition);
+    pthread_cond_broadcast(&safepoint->m_releasedCondition);
+    pthread_mutex_unlock(&safepoint->m_mutex);
+}
+
+/* Poll */
+
+void zen_Safepoint_block(zen_Safepoint_t* safepoint) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    zen_Safepoint_enterSafeRegion(safepoint);
+    zen_Safepoint_leaveSafeRegion(safepoint);
+}
+
+/* Safe Region */
+
+void zen_Safepoint_enterSafeRegion(zen_Safepoint_t* safepoint) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    __atomic_sub_fetch(&safepoint->m_runningCount, 1, __ATOMIC_SEQ_CST);
+
+    /* The requester may be waiting for this thread. The signal is sent while
+     * the mutex is held, so that it is not lost between the requester reading
+     * the count and waiting.
+     */
+    if (__atomic_load_n(&safepoint->m_requested, __ATOMIC_SEQ_CST) != 0) {
+        pthread_mutex_lock(&safepoint->m_mutex);
+        pthread_cond_broadcast(&safepoint->m_stoppedCondition);
+        pthread_mutex_unlock(&safepoint->m_mutex);
+    }
+}
+
+void zen_Safepoint_leaveSafeRegion(zen_Safepoint_t* safepoint) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    while (true) {
+        __atomic_add_fetch(&safepoint->m_runningCount, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&safepoint->m_requested, __ATOMIC_SEQ_CST) == 0) {
+            break;
+        }
+
+        /* A safepoint is in progress. Step back into the safe region, and wait
+         * until the safepoint is released.
+         */
+        zen_Safepoint_enterSafeRegion(safepoint);
+        pthread_mutex_lock(&safepoint->m_mutex);
+        while (__atomic_load_n(&safepoint->m_requested, __ATOMIC_SEQ_CST) != 0) {
+            pthread_cond_wait(&safepoint->m_releasedCondition, &safepoint->m_mutex);
+        }
+        pthread_mutex_unlock(&safepoint->m_mutex);
+    }
+}
+
+/* Request */
+
+static uint64_t zen_Safepoint_getTime() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((uint64_t)time.tv_sec * 1000000000ULL) + (uint64_t)time.tv_nsec;
+}
+
+void zen_Safepoint_request(zen_Safepoint_t* safepoint) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    pthread_mutex_lock(&safepoint->m_mutex);
+    while (__atomic_load_n(&safepoint->m_requested, __ATOMIC_SEQ_CST) != 0) {
+        pthread_cond_wait(&safepoint->m_releasedCondition, &safepoint->m_mutex);
+    }
+
+    uint64_t start = zen_Safepoint_getTime();
+    __atomic_store_n(&safepoint->m_requested, 1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&safepoint->m_runningCount, __ATOMIC_SEQ_CST) > 0) {
+        pthread_cond_wait(&safepoint->m_stoppedCondition, &safepoint->m_mutex);
+    }
+    safepoint->m_requestCount++;
+    safepoint->m_synchronizationDuration = zen_Safepoint_getTime() - start;
+    pthread_mutex_unlock(&safepoint->m_mutex);
+}
+
+void zen_Safepoint_release(zen_Safepoint_t* safepoint) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    pthread_mutex_lock(&safepoint->m_mutex);
+    __atomic_store_n(&safepoint->m_requested, 0, __ATOMIC_SEQ_CST);
+    pthread_cond_broadcast(&safepoint->m_releasedCondition);
+    pthread_mutex_unlock(&safepoint->m_mutex);
+}
+
+/* Wait */
+
+void zen_Safepoint_waitForThreads(zen_Safepoint_t* safepoint, int32_t threadCount) {
+    jtk_Assert_assertObject(safepoint, "The specified safepoint is null.");
+
+    pthread_mutex_lock(&safepoint->m_mutex);
+    while (safepoint->m_threadCount > threadCount) {
+        pthread_cond_wait(&safepoint->m_releasedCondition, &safepoint->m_mutex);
+    }
+    pthread_mutex_unlock(&safepoint->m_mutex);
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/collector/SatbQueue.h>
+
+/*******************************************************************************
+ * SatbBuffer                                                                  *
+ *******************************************************************************/
+
+static zen_SatbBuffer_t* zen_SatbBuffer_new() {
+    zen_SatbBuffer_t* buffer = jtk_Memory_allocate(zen_SatbBuffer_t, 1);
+    buffer->m_references = jtk_Memory_allocate(zen_Object_t*, ZEN_SATB_BUFFER_CAPACITY);
+    buffer->m_size = 0;
+    buffer->m_next = NULL;
+
+    return buffer;
+}
+
+/* Destructor */
+
+void zen_SatbBuffer_delete(zen_SatbBuffer_t* buffer) {
+    jtk_Assert_assertObject(buffer, "The specified buffer is null.");
+
+    jtk_Memory_deallocate(buffer->m_references);
+    jtk_Memory_deallocate(buffer);
+}
+
+/*******************************************************************************
+ * SatbQueue                                                                   *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_SatbQueue_t* zen_SatbQueue_new() {
+    zen_SatbQueue_t* queue = jtk_Memory_allocate(zen_SatbQueue_t, 1);
+    queue->m_active = false;
+    queue->m_threadBuffers = NULL;
+    queue->m_completedBuffers = NULL;
+    queue->m_mutex = jtk_Mutex_new();
+
+    return queue;
+}
+
+/* Destructor */
+
+void zen_SatbQueue_delete(zen_SatbQueue_t* queue) {
+    jtk_Assert_assertObject(queue, "The specified queue is null.");
+
+    zen_SatbQueue_setActive(queue, false);
+    jtk_Mutex_delete(queue->m_mutex);
+    jtk_Memory_deallocate(queue);
+}
+
+/* Active */
+
+void zen_SatbQueue_setActive(zen_SatbQueue_t* queue, bool active) {
+    jtk_Assert_assertObject(queue, "The specified queue is null.");
+
+    if (!active) {
+        zen_SatbBuffer_t* buffer;
+        while ((buffer = zen_SatbQueue_poll(queue)) != NULL) {
+            zen_SatbBuffer_delete(buffer);
+        }
+
+        jtk_Mutex_lock(queue->m_mutex);
+        for (buffer = queue->m_threadBuffers; buffer != NULL; buffer = buffer->m_next) {
+            buffer->m_size = 0;
+        }
+        jtk_Mutex_unlock(queue->m_mutex);
+    }
+    queue->m_active = active;
+}
+
+/* Buffer */
+
+zen_SatbBuffer_t* zen_SatbQueue_makeBuffer(zen_SatbQueue_t* queue) {
+    jtk_Assert_assertObject(queue, "The specified queue is null.");
+
+    zen_SatbBuffer_t* buffer = zen_SatbBuffer_new();
+    jtk_Mutex_lock(queue->m_mutex);
+    buffer->m_next = queue->m_threadBuffers;
+    queue->m_threadBuffers = buffer;
+    jtk_Mutex_unlock(queue->m_mutex);
+
+    return buffer;
+}
+
+void zen_SatbQueue_mergeBuffer(zen_SatbQueue_t* queue, zen_SatbBuffer_t* buffer) {
+    jtk_Assert_assertObject(queue, "The specified queue is null.");
+    jtk_Assert_assertObject(buffer, "The specified buffer is null.");
+
+    if (buffer->m_size > 0) {
+        zen_SatbQueue_flushBuffer(queue, buffer);
+    }
+
+    jtk_Mutex_lock(queue->m_mutex);
+    zen_SatbBuffer_t** link = &queue->m_threadBuffers;
+    while (*link != buffer) {
+        link = &(*link)->m_next;
+    }
+    *link = buffer->m_next;
+    jtk_Mutex_unlock(queue->m_mutex);
+
+    zen_SatbBuffer_delete(buffer);
+}
+
+/* Flush */
+
+/* The logged references are moved to a new buffer, which joins the completed
+ * buffers. The thread buffer remains in its list.
+ */
+static void zen_SatbQueue_complete(zen_SatbQueue_t* queue, zen_SatbBuffer_t* buffer) {
+    zen_SatbBuffer_t* completed = jtk_Memory_allocate(zen_SatbBuffer_t, 1);
+    completed->m_references = buffer->m_references;
+    completed->m_size = buffer->m_size;
+    completed->m_next = queue->m_completedBuffers;
+    queue->m_completedBuffers = completed;
+
+    buffer->m_references = jtk_Memory_allocate(zen_Object_t*, ZEN_SATB_BUFFER_CAPACITY);
+    buffer->m_size = 0;
+}
+
+void zen_SatbQueue_flushBuffer(zen_SatbQueue_t* queue, zen_SatbBuffer_t* buffer) {
+    jtk_Assert_assertObject(queue, "The specified queue is null.");
+    jtk_Assert_assertObject(buffer, "The specified buffer is null.");
+
+    jtk_Mutex_lock(queue->m_mutex);
+    zen_SatbQueue_complete(queue, buffer);
+    jtk_Mutex_unlock(queue->m_mutex);
+}
+
+void zen_SatbQueue_flushAll(zen_SatbQueue_t* queue) {
+    jtk_Assert_assertObject(queue, "The specified queue is null.");
+
+    jtk_Mutex_lock(queue->m_mutex);
+    zen_SatbBuffer_t* buffer;
+    for (buffer = queue->m_threadBuffers; buffer != NULL; buffer = buffer->m_next) {
+        if (buffer->m_size > 0) {
+            zen_SatbQueue_complete(queue, buffer);
+        }
+    }
+    jtk_Mutex_unlock(queue->m_mutex);
+}
+
+/* Poll */
+
+zen_SatbBuffer_t* zen_SatbQueue_poll(zen_SatbQueue_t* queue) {
+    jtk_Assert_assertObject(queue, "The specified queue is null.");
+
+    jtk_Mutex_lock(queue->m_mutex);
+    zen_SatbBuffer_t* result = queue->m_completedBuffers;
+    if (result != NULL) {
+        queue->m_completedBuffers = result->m_next;
+        result->m_next = NULL;
+    }
+    jtk_Mutex_unlock(queue->m_mutex);
+
+    return result;
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/collector/WorkStealingDeque.h>
+
+/*******************************************************************************
+ * WorkStealingDequeArray                                                      *
+ *******************************************************************************/
+
+static zen_WorkStealingDequeArray_t* zen_WorkStealingDequeArray_new(int64_t capacity,
+    zen_WorkStealingDequeArray_t* previous) {
+    zen_WorkStealingDequeArray_t* array = jtk_Memory_allocate(zen_WorkStealingDequeArray_t, 1);
+    array->m_elements = jtk_Memory_allocate(zen_Object_t*, capacity);
+    array->m_capacity = capacity;
+    array->m_previous = previous;
+
+    return array;
+}
+
+static void zen_WorkStealingDequeArray_delete(zen_WorkStealingDequeArray_t* array) {
+    jtk_Memory_deallocate(array->m_elements);
+    jtk_Memory_deallocate(array);
+}
+
+static inline zen_Object_t* zen_WorkStealingDequeArray_get(zen_WorkStealingDequeArray_t* array,
+    int64_t index) {
+    return __atomic_load_n(&array->m_elements[index & (array->m_capacity - 1)], __ATOMIC_RELAXED);
+}
+
+static inline void zen_WorkStealingDequeArray_set(zen_WorkStealingDequeArray_t* array,
+    int64_t index, zen_Object_t* object) {
+    __atomic_store_n(&array->m_elements[index & (array->m_capacity - 1)], object, __ATOMIC_RELAXED);
+}
+
+/*******************************************************************************
+ * WorkStealingDeque                                                           *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_WorkStealingDeque_t* zen_WorkStealingDeque_new() {
+    zen_WorkStealingDeque_t* deque = jtk_Memory_allocate(zen_WorkStealingDeque_t, 1);
+    deque->m_top = 0;
+    deque->m_bottom = 0;
+    deque->m_array = zen_WorkStealingDequeArray_new(ZEN_WORK_STEALING_DEQUE_DEFAULT_CAPACITY, NULL);
+
+    return deque;
+}
+
+/* Destructor */
+
+void zen_WorkStealingDeque_delete(zen_WorkStealingDeque_t* deque) {
+    jtk_Assert_assertObject(deque, "The specified deque is null.");
+
+    zen_WorkStealingDequeArray_t* array = deque->m_array;
+    while (array != NULL) {
+        zen_WorkStealingDequeArray_t* previous = array->m_previous;
+        zen_WorkStealingDequeArray_delete(array);
+        array = previous;
+    }
+    jtk_Memory_deallocate(deque);
+}
+
+/* Clear */
+
+void zen_WorkStealingDeque_clear(zen_WorkStealingDeque_t* deque) {
+    jtk_Assert_assertObject(deque, "The specified deque is null.");
+
+    zen_WorkStealingDequeArray_t* array = deque->m_array->m_previous;
+    while (array != NULL) {
+        zen_WorkStealingDequeArray_t* previous = array->m_previous;
+        zen_WorkStealingDequeArray_delete(array);
+        array = previous;
+    }
+    deque->m_array->m_previous = NULL;
+    deque->m_top = 0;
+    deque->m_bottom = 0;
+}
+
+/* Empty */
+
+bool zen_WorkStealingDeque_isEmpty(zen_WorkStealingDeque_t* deque) {
+    int64_t top = __atomic_load_n(&deque->m_top, __ATOMIC_ACQUIRE);
+    int64_t bottom = __atomic_load_n(&deque->m_bottom, __ATOMIC_ACQUIRE);
+    return bottom <= top;
+}
+
+/* Grow */
+
+/* Replace the array with one twice as large. The objects between the top and
+ * the bottom keep their indexes.
+ */
+static zen_WorkStealingDequeArray_t* zen_WorkStealingDeque_grow(zen_WorkStealingDeque_t* deque,
+    zen_WorkStealingDequeArray_t* array, int64_t top, int64_t bottom) {
+    zen_WorkStealingDequeArray_t* result = zen_WorkStealingDequeArray_new(
+        array->m_capacity * 2, array);
+    int64_t i;
+    for (i = top; i < bottom; i++) {
+        zen_WorkStealingDequeArray_set(result, i, zen_WorkStealingDequeArray_get(array, i));
+    }
+    __atomic_store_n(&deque->m_array, result, __ATOMIC_RELEASE);
+
+    return result;
+}
+
+/* Pop */
+
+zen_Object_t* zen_WorkStealingDeque_pop(zen_WorkStealingDeque_t* deque) {
+    int64_t bottom = __atomic_load_n(&deque->m_bottom, __ATOMIC_RELAXED) - 1;
+    zen_WorkStealingDequeArray_t* array = __atomic_load_n(&deque->m_array, __ATOMIC_RELAXED);
+    __atomic_store_n(&deque->m_bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t top = __atomic_load_n(&deque->m_top, __ATOMIC_RELAXED);
+
+    zen_Object_t* result = NULL;
+    if (top <= bottom) {
+        result = zen_WorkStealingDequeArray_get(array, bottom);
+        if (top == bottom) {
+            /* The last object is contended by the thieves. */
+            if (!__atomic_compare_exchange_n(&deque->m_top, &top, top + 1, false,
+                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+                result = NULL;
+            }
+            __atomic_store_n(&deque->m_bottom, bottom + 1, __ATOMIC_RELAXED);
+        }
+    }
+    else {
+        __atomic_store_n(&deque->m_bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+    return result;
+}
+
+/* Push */
+
+void zen_WorkStealingDeque_push(zen_WorkStealingDeque_t* deque, zen_Object_t* object) {
+    int64_t bottom = __atomic_load_n(&deque->m_bottom, __ATOMIC_RELAXED);
+    int64_t top = __atomic_load_n(&deque->m_top, __ATOMIC_ACQUIRE);
+    zen_WorkStealingDequeArray_t* array = __atomic_load_n(&deque->m_array, __ATOMIC_RELAXED);
+    if ((bottom - top) > (array->m_capacity - 1)) {
+        array = zen_WorkStealingDeque_grow(deque, array, top, bottom);
+    }
+    /* The release store publishes the object, and everything written before
+     * it was pushed, to the thieves which read the bottom with acquire.
+     */
+    zen_WorkStealingDequeArray_set(array, bottom, object);
+    __atomic_store_n(&deque->m_bottom, bottom + 1, __ATOMIC_RELEASE);
+}
+
+/* Steal */
+
+zen_Object_t* zen_WorkStealingDeque_steal(zen_WorkStealingDeque_t* deque) {
+    int64_t top = __atomic_load_n(&deque->m_top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t bottom = __atomic_load_n(&deque->m_bottom, __ATOMIC_ACQUIRE);
+
+    zen_Object_t* result = NULL;
+    if (top < bottom) {
+        zen_WorkStealingDequeArray_t* array = __atomic_load_n(&deque->m_array, __ATOMIC_ACQUIRE);
+        result = zen_WorkStealingDequeArray_get(array, top);
+        if (!__atomic_compare_exchange_n(&deque->m_top, &top, top + 1, false,
+            __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            /* Another thread removed the object first. */
+            result = NULL;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/Arena.h>
+
+/*******************************************************************************
+ * Arena                                                                       *
+ *******************************************************************************/
+
+/* Chunk */
+
+/* The memory of a chunk is cleared when it is allocated, and never reused.
+ * Therefore, the allocations need not clear it again.
+ */
+static void zen_Arena_addChunk(zen_Arena_t* arena, int32_t size) {
+    if (size < ZEN_ARENA_MINIMUM_CHUNK_SIZE) {
+        size = ZEN_ARENA_MINIMUM_CHUNK_SIZE;
+    }
+    zen_ArenaChunk_t* chunk = (zen_ArenaChunk_t*)jtk_Memory_allocate(uint8_t,
+        sizeof (zen_ArenaChunk_t) + size);
+    chunk->m_next = arena->m_chunks;
+    chunk->m_limit = chunk->m_bytes + size;
+
+    arena->m_chunks = chunk;
+    arena->m_free = chunk->m_bytes;
+    arena->m_limit = chunk->m_limit;
+}
+
+/* Constructor */
+
+zen_Arena_t* zen_Arena_new(int32_t capacity) {
+    jtk_Assert_assertTrue(capacity >= 0, "The specified capacity is invalid.");
+
+    zen_Arena_t* arena = jtk_Memory_allocate(zen_Arena_t, 1);
+    arena->m_chunks = NULL;
+    arena->m_chunkSize = (capacity + 7) & ~7;
+    arena->m_size = 0;
+    arena->m_previous = NULL;
+    arena->m_next = NULL;
+    zen_Arena_addChunk(arena, arena->m_chunkSize);
+
+    return arena;
+}
+
+/* Destructor */
+
+void zen_Arena_delete(zen_Arena_t* arena) {
+    jtk_Assert_assertObject(arena, "The specified arena is null.");
+
+    zen_ArenaChunk_t* chunk = arena->m_chunks;
+    while (chunk != NULL) {
+        zen_ArenaChunk_t* next = chunk->m_next;
+        jtk_Memory_deallocate(chunk);
+        chunk = next;
+    }
+    jtk_Memory_deallocate(arena);
+}
+
+/* Allocate */
+
+/* A chunk which cannot satisfy an allocation is abandoned with its free bytes. */
+void* zen_Arena_allocate0(zen_Arena_t* arena, int32_t size) {
+    jtk_Assert_assertObject(arena, "The specified arena is null.");
+    jtk_Assert_assertTrue(size >= 0, "The specified size is invalid.");
+
+    int32_t alignedSize = (size + 7) & ~7;
+    if ((arena->m_limit - arena->m_free) < alignedSize) {
+        zen_Arena_addChunk(arena, (alignedSize > arena->m_chunkSize)?
+            alignedSize : arena->m_chunkSize);
+    }
+
+    uint8_t* result = arena->m_free;
+    arena->m_free += alignedSize;
+    arena->m_size += alignedSize;
+
+    return result;
+}
+
+/* Contains */
+
+bool zen_Arena_contains(zen_Arena_t* arena, const void* address) {
+    jtk_Assert_assertObject(arena, "The specified arena is null.");
+
+    const uint8_t* address0 = (const uint8_t*)address;
+    zen_ArenaChunk_t* chunk;
+    for (chunk = arena->m_chunks; chunk != NULL; chunk = chunk->m_next) {
+        if ((address0 >= chunk->m_bytes) && (address0 < chunk->m_limit)) {
+            return true;
+        }
+    }
+    return false;
+}
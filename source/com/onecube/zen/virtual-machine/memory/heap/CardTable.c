@@ -0,0 +1,65 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <string.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/CardTable.h>
+
+/*******************************************************************************
+ * CardTable                                                                   *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_CardTable_t* zen_CardTable_new(uint8_t* start, uint8_t* limit) {
+    jtk_Assert_assertTrue(start < limit, "The specified range is invalid.");
+
+    int32_t size = (int32_t)(((limit - start) + (ZEN_CARD_TABLE_CARD_SIZE - 1)) >>
+        ZEN_CARD_TABLE_CARD_SHIFT);
+
+    zen_CardTable_t* table = jtk_Memory_allocate(zen_CardTable_t, 1);
+    table->m_cards = jtk_Memory_allocate(uint8_t, size);
+    table->m_firstObjects = jtk_Memory_allocate(uint8_t, size);
+    table->m_start = start;
+    table->m_limit = limit;
+    table->m_size = size;
+    zen_CardTable_clear(table);
+
+    return table;
+}
+
+/* Destructor */
+
+void zen_CardTable_delete(zen_CardTable_t* table) {
+    jtk_Assert_assertObject(table, "The specified card table is null.");
+
+    jtk_Memory_deallocate(table->m_firstObjects);
+    jtk_Memory_deallocate(table->m_cards);
+    jtk_Memory_deallocate(table);
+}
+
+/* Clear */
+
+void zen_CardTable_clear(zen_CardTable_t* table) {
+    jtk_Assert_assertObject(table, "The specified card table is null.");
+
+    memset(table->m_cards, ZEN_CARD_TABLE_CARD_CLEAN, table->m_size);
+    memset(table->m_firstObjects, ZEN_CARD_TABLE_NO_OBJECT, table->m_size);
+}
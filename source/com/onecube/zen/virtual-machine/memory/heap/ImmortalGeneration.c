@@ -0,0 +1,117 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/ImmortalGeneration.h>
+
+/*******************************************************************************
+ * ImmortalGeneration                                                          *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_ImmortalGeneration_t* zen_ImmortalGeneration_new(zen_ReservedSpace_t* reservedSpace,
+    int32_t size) {
+    zen_ImmortalGeneration_t* generation = jtk_Memory_allocate(zen_ImmortalGeneration_t, 1);
+    generation->m_region = zen_Region_new(reservedSpace, size);
+    generation->m_free = generation->m_region->m_start;
+    generation->m_arenas = NULL;
+    generation->m_mutex = jtk_Mutex_new();
+
+    return generation;
+}
+
+/* Destructor */
+
+void zen_ImmortalGeneration_delete(zen_ImmortalGeneration_t* generation) {
+    jtk_Assert_assertObject(generation, "The specified immortal generation is null.");
+
+    /* The arenas of the entity files which were never unloaded. */
+    zen_Arena_t* arena = generation->m_arenas;
+    while (arena != NULL) {
+        zen_Arena_t* next = arena->m_next;
+        zen_Arena_delete(arena);
+        arena = next;
+    }
+
+    jtk_Mutex_delete(generation->m_mutex);
+    zen_Region_delete(generation->m_region);
+    jtk_Memory_deallocate(generation);
+}
+
+/* Allocate */
+
+/* The memory of the region is never reused, therefore, it is still clear when
+ * it is allocated.
+ */
+uint8_t* zen_ImmortalGeneration_allocate(zen_ImmortalGeneration_t* generation, int32_t size) {
+    jtk_Assert_assertObject(generation, "The specified immortal generation is null.");
+    jtk_Assert_assertTrue(size > 0, "The specified size is invalid.");
+
+    int32_t alignedSize = (size + 7) & ~7;
+    uint8_t* result = NULL;
+
+    jtk_Mutex_lock(generation->m_mutex);
+    if ((generation->m_region->m_limit - generation->m_free) >= alignedSize) {
+        result = generation->m_free;
+        generation->m_free += alignedSize;
+    }
+    jtk_Mutex_unlock(generation->m_mutex);
+
+    return result;
+}
+
+/* Arena */
+
+zen_Arena_t* zen_ImmortalGeneration_newArena(zen_ImmortalGeneration_t* generation,
+    int32_t capacity) {
+    jtk_Assert_assertObject(generation, "The specified immortal generation is null.");
+
+    zen_Arena_t* arena = zen_Arena_new(capacity);
+
+    jtk_Mutex_lock(generation->m_mutex);
+    arena->m_next = generation->m_arenas;
+    if (generation->m_arenas != NULL) {
+        generation->m_arenas->m_previous = arena;
+    }
+    generation->m_arenas = arena;
+    jtk_Mutex_unlock(generation->m_mutex);
+
+    return arena;
+}
+
+void zen_ImmortalGeneration_deleteArena(zen_ImmortalGeneration_t* generation,
+    zen_Arena_t* arena) {
+    jtk_Assert_assertObject(generation, "The specified immortal generation is null.");
+    jtk_Assert_assertObject(arena, "The specified arena is null.");
+
+    jtk_Mutex_lock(generation->m_mutex);
+    if (arena->m_previous != NULL) {
+        arena->m_previous->m_next = arena->m_next;
+    }
+    else {
+        generation->m_arenas = arena->m_next;
+    }
+    if (arena->m_next != NULL) {
+        arena->m_next->m_previous = arena->m_previous;
+    }
+    jtk_Mutex_unlock(generation->m_mutex);
+
+    zen_Arena_delete(arena);
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/LargeObjectSpace.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+/*******************************************************************************
+ * LargeObjectSpace                                                            *
+ *******************************************************************************/
+
+#define ZEN_LARGE_OBJECT_SPACE_INITIAL_CAPACITY 16
+
+/* Mapping Size */
+
+static inline intptr_t zen_LargeObjectSpace_getMappingSize(zen_LargeObjectSpace_t* space,
+    int32_t size) {
+    return ((intptr_t)size + (space->m_pageSize - 1)) & ~((intptr_t)space->m_pageSize - 1);
+}
+
+/* Constructor */
+
+zen_LargeObjectSpace_t* zen_LargeObjectSpace_new(zen_ReservedSpace_t* reservedSpace,
+    intptr_t maximumSize) {
+    jtk_Assert_assertTrue(maximumSize > 0, "The specified maximum size is invalid.");
+
+    zen_LargeObjectSpace_t* space = jtk_Memory_allocate(zen_LargeObjectSpace_t, 1);
+    space->m_objects = jtk_Memory_allocate(uint8_t*, ZEN_LARGE_OBJECT_SPACE_INITIAL_CAPACITY);
+    space->m_size = 0;
+    space->m_capacity = ZEN_LARGE_OBJECT_SPACE_INITIAL_CAPACITY;
+    space->m_threshold = ZEN_LARGE_OBJECT_SPACE_DEFAULT_THRESHOLD;
+    space->m_pageSize = (int32_t)sysconf(_SC_PAGESIZE);
+    space->m_mappedSize = 0;
+    space->m_maximumSize = maximumSize;
+    space->m_reservedSpace = reservedSpace;
+    space->m_start = NULL;
+    space->m_limit = NULL;
+    if (reservedSpace != NULL) {
+        int64_t rangeSize = zen_LargeObjectSpace_getRangeSize(maximumSize);
+        space->m_start = zen_ReservedSpace_take(reservedSpace, rangeSize);
+        jtk_Assert_assertObject(space->m_start, "The large object space cannot be reserved.");
+        space->m_limit = space->m_start + rangeSize;
+    }
+    space->m_mutex = jtk_Mutex_new();
+
+    return space;
+}
+
+/* Destructor */
+
+void zen_LargeObjectSpace_delete(zen_LargeObjectSpace_t* space) {
+    jtk_Assert_assertObject(space, "The specified large object space is null.");
+
+    if (space->m_reservedSpace == NULL) {
+        int32_t i;
+        for (i = 0; i < space->m_size; i++) {
+            uint8_t* object = space->m_objects[i];
+            munmap(object, zen_LargeObjectSpace_getMappingSize(space, ((zen_Object_t*)object)->m_size));
+        }
+    }
+    jtk_Mutex_delete(space->m_mutex);
+    jtk_Memory_deallocate(space->m_objects);
+    jtk_Memory_deallocate(space);
+}
+
+/* Search */
+
+/* Returns the index of the first object whose address is not less than the
+ * specified address.
+ */
+static int32_t zen_LargeObjectSpace_search(zen_LargeObjectSpace_t* space, const uint8_t* address) {
+    int32_t leftIndex = 0;
+    int32_t rightIndex = space->m_size;
+    while (leftIndex < rightIndex) {
+        int32_t middleIndex = (int32_t)((uint32_t)(leftIndex + rightIndex) >> 1);
+        if (space->m_objects[middleIndex] < address) {
+            leftIndex = middleIndex + 1;
+        }
+        else {
+            rightIndex = middleIndex;
+        }
+    }
+    return leftIndex;
+}
+
+/* Map */
+
+/* Returns the first gap in the range of the space which can hold a mapping of
+ * the specified size, or null if there is none. The objects are sorted by
+ * address, therefore, the gaps are visited in order.
+ */
+static uint8_t* zen_LargeObjectSpace_findGap(zen_LargeObjectSpace_t* space,
+    intptr_t mappingSize) {
+    uint8_t* current = space->m_start;
+    int32_t i;
+    for (i = 0; i < space->m_size; i++) {
+        uint8_t* object = space->m_objects[i];
+        if ((object - current) >= mappingSize) {
+            break;
+        }
+        current = object + zen_LargeObjectSpace_getMappingSize(space, ((zen_Object_t*)object)->m_size);
+    }
+    return ((space->m_limit - current) >= mappingSize)? current : NULL;
+}
+
+static uint8_t* zen_LargeObjectSpace_map(zen_LargeObjectSpace_t* space, intptr_t mappingSize) {
+    uint8_t* result = NULL;
+    if (space->m_reservedSpace != NULL) {
+        uint8_t* gap = zen_LargeObjectSpace_findGap(space, mappingSize);
+        if ((gap != NULL) && zen_ReservedSpace_commit(space->m_reservedSpace, gap, mappingSize)) {
+            result = gap;
+        }
+    }
+    else {
+        void* mapping = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping != MAP_FAILED) {
+            result = (uint8_t*)mapping;
+        }
+    }
+    return result;
+}
+
+static void zen_LargeObjectSpace_unmap(zen_LargeObjectSpace_t* space, uint8_t* object,
+    intptr_t mappingSize) {
+    if (space->m_reservedSpace != NULL) {
+        zen_ReservedSpace_uncommit(space->m_reservedSpace, object, mappingSize);
+    }
+    else {
+        munmap(object, mappingSize);
+    }
+}
+
+/* Allocate */
+
+uint8_t* zen_LargeObjectSpace_allocate(zen_LargeObjectSpace_t* space, int32_t size) {
+    jtk_Assert_assertObject(space, "The specified large object space is null.");
+    jtk_Assert_assertTrue(size > 0, "The specified size is invalid.");
+
+    intptr_t mappingSize = zen_LargeObjectSpace_getMappingSize(space, size);
+    uint8_t* result = NULL;
+
+    jtk_Mutex_lock(space->m_mutex);
+    if ((space->m_mappedSize + mappingSize) <= space->m_maximumSize) {
+        result = zen_LargeObjectSpace_map(space, mappingSize);
+        if (result != NULL) {
+            /* The gaps between the objects are found from their sizes.
+             * Therefore, the size is recorded before the lock is released,
+             * although the caller initializes the header again.
+             */
+            ((zen_Object_t*)result)->m_size = size;
+
+            if (space->m_size == space->m_capacity) {
+                int32_t capacity = space->m_capacity * 2;
+                uint8_t** objects = jtk_Memory_allocate(uint8_t*, capacity);
+                memcpy(objects, space->m_objects, sizeof (uint8_t*) * space->m_size);
+                jtk_Memory_deallocate(space->m_objects);
+                space->m_objects = objects;
+                space->m_capacity = capacity;
+            }
+            int32_t index = zen_LargeObjectSpace_search(space, result);
+            memmove(space->m_objects + index + 1, space->m_objects + index,
+                sizeof (uint8_t*) * (space->m_size - index));
+            space->m_objects[index] = result;
+            space->m_size++;
+            space->m_mappedSize += mappingSize;
+        }
+    }
+    jtk_Mutex_unlock(space->m_mutex);
+
+    return result;
+}
+
+/* Object */
+
+bool zen_LargeObjectSpace_isObject(zen_LargeObjectSpace_t* space, const uint8_t* address) {
+    int32_t index = zen_LargeObjectSpace_search(space, address);
+    return (index < space->m_size) && (space->m_objects[index] == address);
+}
+
+/* Sweep */
+
+intptr_t zen_LargeObjectSpace_sweep(zen_LargeObjectSpace_t* space) {
+    jtk_Assert_assertObject(space, "The specified large object space is null.");
+
+    intptr_t reclaimedSize = 0;
+    int32_t size = 0;
+    int32_t i;
+    for (i = 0; i < space->m_size; i++) {
+        zen_Object_t* object = (zen_Object_t*)space->m_objects[i];
+        if ((object->m_flags & ZEN_OBJECT_FLAG_MARKED) != 0) {
+            object->m_flags &= ~(ZEN_OBJECT_FLAG_MARKED | ZEN_OBJECT_FLAG_PINNED);
+            space->m_objects[size++] = (uint8_t*)object;
+        }
+        else {
+            intptr_t mappingSize = zen_LargeObjectSpace_getMappingSize(space, object->m_size);
+            zen_LargeObjectSpace_unmap(space, (uint8_t*)object, mappingSize);
+            reclaimedSize += mappingSize;
+        }
+    }
+    space->m_size = size;
+    space->m_mappedSize -= reclaimedSize;
+
+    return reclaimedSize;
+}
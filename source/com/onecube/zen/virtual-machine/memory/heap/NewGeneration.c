@@ -0,0 +1,80 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/NewGeneration.h>
+
+/*******************************************************************************
+ * NewGeneration                                                               *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_NewGeneration_t* zen_NewGeneration_new(zen_ReservedSpace_t* reservedSpace,
+    int32_t middleRegionSize, int32_t survivorRegionSize) {
+    zen_NewGeneration_t* generation = jtk_Memory_allocate(zen_NewGeneration_t, 1);
+    generation->m_leftRegion = zen_Region_new(reservedSpace, survivorRegionSize);
+    generation->m_middleRegion = zen_Region_new(reservedSpace, middleRegionSize);
+    generation->m_rightRegion = zen_Region_new(reservedSpace, survivorRegionSize);
+    generation->m_leftChunks = zen_ChunkArray_new();
+    generation->m_rightHoles = zen_ChunkArray_new();
+    generation->m_allocator = zen_SequentialAllocator_new(
+        generation->m_middleRegion->m_start, generation->m_middleRegion->m_limit);
+
+    return generation;
+}
+
+/* Destructor */
+
+void zen_NewGeneration_delete(zen_NewGeneration_t* generation) {
+    jtk_Assert_assertObject(generation, "The specified new generation is null.");
+
+    zen_SequentialAllocator_delete(generation->m_allocator);
+    zen_ChunkArray_delete(generation->m_rightHoles);
+    zen_ChunkArray_delete(generation->m_leftChunks);
+    zen_Region_delete(generation->m_rightRegion);
+    zen_Region_delete(generation->m_middleRegion);
+    zen_Region_delete(generation->m_leftRegion);
+    jtk_Memory_deallocate(generation);
+}
+
+/* Chunks */
+
+void zen_NewGeneration_getChunks(zen_NewGeneration_t* generation, zen_ChunkArray_t* chunks) {
+    jtk_Assert_assertObject(generation, "The specified new generation is null.");
+
+    zen_SequentialAllocator_retireAllocationBuffers(generation->m_allocator);
+    zen_SequentialAllocator_getChunks(generation->m_allocator, chunks);
+    zen_ChunkArray_addAll(chunks, generation->m_leftChunks);
+    zen_ChunkArray_addAll(chunks, generation->m_rightHoles);
+}
+
+/* Swap */
+
+void zen_NewGeneration_swapSurvivorRegions(zen_NewGeneration_t* generation) {
+    jtk_Assert_assertObject(generation, "The specified new generation is null.");
+
+    zen_Region_t* region = generation->m_leftRegion;
+    generation->m_leftRegion = generation->m_rightRegion;
+    generation->m_rightRegion = region;
+
+    zen_ChunkArray_t* chunks = generation->m_leftChunks;
+    generation->m_leftChunks = generation->m_rightHoles;
+    generation->m_rightHoles = chunks;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+/*******************************************************************************
+ * OldGeneration                                                               *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_OldGeneration_t* zen_OldGeneration_new(zen_ReservedSpace_t* reservedSpace,
+    int32_t whiteRegionSize) {
+    zen_OldGeneration_t* generation = jtk_Memory_allocate(zen_OldGeneration_t, 1);
+    generation->m_whiteRegion = zen_Region_new(reservedSpace, whiteRegionSize);
+    jtk_Assert_assertTrue(((uintptr_t)generation->m_whiteRegion->m_start &
+        (ZEN_OLD_GENERATION_ALIGNMENT - 1)) == 0, "The white region is misaligned.");
+    generation->m_largeObjectSpace = zen_LargeObjectSpace_new(reservedSpace,
+        ZEN_LARGE_OBJECT_SPACE_DEFAULT_MAXIMUM_SIZE);
+    generation->m_allocator = zen_SegregatedFitsAllocator_new();
+    generation->m_free = generation->m_whiteRegion->m_start;
+    generation->m_cardTable = zen_CardTable_new(generation->m_whiteRegion->m_start,
+        generation->m_whiteRegion->m_limit);
+    generation->m_promotionFlags = 0;
+
+    return generation;
+}
+
+/* Destructor */
+
+void zen_OldGeneration_delete(zen_OldGeneration_t* generation) {
+    jtk_Assert_assertObject(generation, "The specified old generation is null.");
+
+    zen_LargeObjectSpace_delete(generation->m_largeObjectSpace);
+    zen_SegregatedFitsAllocator_delete(generation->m_allocator);
+    zen_CardTable_delete(generation->m_cardTable);
+    zen_Region_delete(generation->m_whiteRegion);
+    jtk_Memory_deallocate(generation);
+}
+
+/* Object */
+
+bool zen_OldGeneration_isObject(zen_OldGeneration_t* generation, const uint8_t* address) {
+    zen_CardTable_t* cardTable = generation->m_cardTable;
+    if (!zen_OldGeneration_contains(generation, address) ||
+        (((address - cardTable->m_start) & (ZEN_OLD_GENERATION_ALIGNMENT - 1)) != 0)) {
+        return false;
+    }
+
+    uint8_t* current = NULL;
+    int32_t index;
+    for (index = zen_CardTable_getIndex(cardTable, address); index >= 0; index--) {
+        current = zen_CardTable_getFirstObject(cardTable, index);
+        if ((current != NULL) && (current <= address)) {
+            break;
+        }
+    }
+    if (index < 0) {
+        return false;
+    }
+
+    while (current < address) {
+        current += ((zen_Object_t*)current)->m_size;
+    }
+    return current == address;
+}
+
+/* Sweep */
+
+void zen_OldGeneration_sweep(zen_OldGeneration_t* generation) {
+    jtk_Assert_assertObject(generation, "The specified old generation is null.");
+
+    generation->m_free = zen_SegregatedFitsAllocator_sweep(generation->m_allocator,
+        generation->m_whiteRegion->m_start, generation->m_free);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/Region.h>
+
+/*******************************************************************************
+ * Region                                                                      *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_Region_t* zen_Region_new(zen_ReservedSpace_t* reservedSpace, int32_t size) {
+    jtk_Assert_assertTrue(size > 0, "The specified region size is invalid.");
+
+    zen_Region_t* region = jtk_Memory_allocate(zen_Region_t, 1);
+    if (reservedSpace != NULL) {
+        region->m_start = zen_ReservedSpace_take(reservedSpace, size);
+        jtk_Assert_assertTrue((region->m_start != NULL) &&
+            zen_ReservedSpace_commit(reservedSpace, region->m_start, size),
+            "The region cannot be committed.");
+    }
+    else {
+        region->m_start = jtk_Memory_allocate(uint8_t, size);
+    }
+    region->m_limit = region->m_start + size;
+    region->m_reservedSpace = reservedSpace;
+
+    return region;
+}
+
+/* Destructor */
+
+void zen_Region_delete(zen_Region_t* region) {
+    jtk_Assert_assertObject(region, "The specified region is null.");
+
+    /* The memory taken from a reserved space is released along with it. */
+    if (region->m_reservedSpace == NULL) {
+        jtk_Memory_deallocate(region->m_start);
+    }
+    jtk_Memory_deallocate(region);
+}
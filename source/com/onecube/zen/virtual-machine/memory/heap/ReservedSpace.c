@@ -0,0 +1,94 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <sys/mman.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/ReservedSpace.h>
+
+/*******************************************************************************
+ * ReservedSpace                                                               *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_ReservedSpace_t* zen_ReservedSpace_new(int64_t size) {
+    jtk_Assert_assertTrue(size > 0, "The specified size is invalid.");
+
+    size = zen_ReservedSpace_align(size);
+    /* The range is neither accessible nor backed by the swap space, until it
+     * is committed.
+     */
+    void* mapping = mmap(NULL, (size_t)size, PROT_NONE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    jtk_Assert_assertTrue(mapping != MAP_FAILED, "The heap cannot be reserved.");
+
+    zen_ReservedSpace_t* space = jtk_Memory_allocate(zen_ReservedSpace_t, 1);
+    space->m_start = (uint8_t*)mapping;
+    space->m_limit = space->m_start + size;
+    space->m_top = space->m_start;
+
+    return space;
+}
+
+/* Destructor */
+
+void zen_ReservedSpace_delete(zen_ReservedSpace_t* space) {
+    jtk_Assert_assertObject(space, "The specified reserved space is null.");
+
+    munmap(space->m_start, (size_t)(space->m_limit - space->m_start));
+    jtk_Memory_deallocate(space);
+}
+
+/* Take */
+
+uint8_t* zen_ReservedSpace_take(zen_ReservedSpace_t* space, int64_t size) {
+    jtk_Assert_assertObject(space, "The specified reserved space is null.");
+    jtk_Assert_assertTrue(size > 0, "The specified size is invalid.");
+
+    size = zen_ReservedSpace_align(size);
+    uint8_t* result = NULL;
+    if ((space->m_limit - space->m_top) >= size) {
+        result = space->m_top;
+        space->m_top += size;
+    }
+    return result;
+}
+
+/* Commit */
+
+bool zen_ReservedSpace_commit(zen_ReservedSpace_t* space, uint8_t* start, int64_t size) {
+    jtk_Assert_assertObject(space, "The specified reserved space is null.");
+    jtk_Assert_assertTrue(zen_ReservedSpace_contains(space, start) &&
+        ((start + size) <= space->m_limit), "The specified range is invalid.");
+
+    return mprotect(start, (size_t)size, PROT_READ | PROT_WRITE) == 0;
+}
+
+/* A fresh mapping replaces the pages of the range, therefore, the memory is
+ * released and cleared, while the range remains reserved.
+ */
+void zen_ReservedSpace_uncommit(zen_ReservedSpace_t* space, uint8_t* start, int64_t size) {
+    jtk_Assert_assertObject(space, "The specified reserved space is null.");
+    jtk_Assert_assertTrue(zen_ReservedSpace_contains(space, start) &&
+        ((start + size) <= space->m_limit), "The specified range is invalid.");
+
+    mmap(start, (size_t)size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE |
+        MAP_FIXED, -1, 0);
+}
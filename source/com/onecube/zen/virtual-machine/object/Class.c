@@ -21,8 +21,11 @@
 #include <jtk/collection/list/DoublyLinkedList.h>
 
 #include <com/onecube/zen/virtual-machine/object/Class.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+#include <com/onecube/zen/virtual-machine/feb/EntityFlag.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolClass.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolUtf8.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/RootVisitor.h>
 
 
 #warning "Move this function to String.c"
@@ -43,12 +46,23 @@ jtk_CString_t* jtk_CString_append(jtk_CString_t* string1, jtk_CString_t* string2
 zen_Class_t* zen_Class_newFromEntityFile(zen_EntityFile_t* entityFile) {
     jtk_ObjectAdapter_t* stringObjectAdapter = jtk_StringObjectAdapter_getInstance();
 
-    zen_Class_t* class0 = jtk_Memory_allocate(zen_Class_t, 1);
+    /* The class is allocated in the arena of its entity file, along with its
+     * functions, fields, and tables.
+     */
+    zen_Class_t* class0 = zen_Arena_allocate(entityFile->m_arena, zen_Class_t, 1);
     class0->m_entityFile = entityFile;
     class0->m_functions = jtk_HashMap_newEx(stringObjectAdapter, NULL,
         JTK_HASH_MAP_DEFAULT_CAPACITY, JTK_HASH_MAP_DEFAULT_LOAD_FACTOR);
     class0->m_fields = jtk_HashMap_newEx(stringObjectAdapter, NULL,
         JTK_HASH_MAP_DEFAULT_CAPACITY, JTK_HASH_MAP_DEFAULT_LOAD_FACTOR);
+    class0->m_superclasses = NULL;
+    class0->m_superclassCount = 0;
+    class0->m_primarySuperclasses = NULL;
+    class0->m_depth = -1;
+    class0->m_vtable = NULL;
+    class0->m_vtableSize = 0;
+    class0->m_interfaceTables = NULL;
+    class0->m_interfaceTableCount = 0;
 
     zen_Class_initialize(class0, entityFile);
 
@@ -85,10 +99,23 @@ void zen_Class_delete(zen_Class_t* class0) {
     }
     jtk_Iterator_delete(fieldIterator);
     
+    /* The inline caches are created lazily by the threads which execute the
+     * class. Therefore, they are allocated outside the arena.
+     */
+    int32_t constantPoolSize = class0->m_entityFile->m_constantPool->m_size;
+    int32_t i;
+    for (i = 1; i <= constantPoolSize; i++) {
+        if (class0->m_inlineCaches[i] != NULL) {
+            zen_InlineCache_delete(class0->m_inlineCaches[i]);
+        }
+    }
+
+    /* The class itself, the side tables, and the dispatch tables are freed
+     * along with the arena of the entity file.
+     */
     jtk_HashMap_delete(class0->m_functions);
     jtk_HashMap_delete(class0->m_fields);
     jtk_CString_delete(class0->m_descriptor);
-    jtk_Memory_deallocate(class0);
 }
 
 // Entity File
@@ -97,6 +124,12 @@ zen_EntityFile_t* zen_Class_getEntityFile(zen_Class_t* class0) {
     return class0->m_entityFile;
 }
 
+// Field
+
+zen_Field_t* zen_Class_getField(zen_Class_t* class0, jtk_CString_t* name) {
+    return (zen_Field_t*)jtk_HashMap_getValue(class0->m_fields, name);
+}
+
 // Function
 
 zen_Function_t* zen_Class_getStaticFunction(zen_Class_t* class0, jtk_CString_t* name,
@@ -114,18 +147,31 @@ zen_Function_t* zen_Class_getInstanceFunction(zen_Class_t* class0, jtk_CString_t
     jtk_CString_t* key = jtk_CString_append(name, descriptor);
     zen_Function_t* function = jtk_HashMap_getValue(class0->m_functions, key);
     jtk_CString_delete(key);
-    
+
+    /* An inherited function is searched in the superclasses, in the order of
+     * their declaration.
+     */
+    int32_t i;
+    for (i = 0; (function == NULL) && (i < class0->m_superclassCount); i++) {
+        function = zen_Class_getInstanceFunction(class0->m_superclasses[i], name, descriptor);
+    }
+
     // TODO: Filter for instance function.
     return function;
 }
 
 // Initialize
 
+/* Maps a field size of 1, 2, 4 or 8 bytes to 0, 1, 2 or 3, respectively. */
+static int32_t zen_Class_getSizeClass(int32_t size) {
+    return (size == 8)? 3 : ((size == 4)? 2 : ((size == 2)? 1 : 0));
+}
+
 void zen_Class_initialize(zen_Class_t* class0, zen_EntityFile_t* entityFile) {
     jtk_Assert_assertObject(class0, "The specified class is null.");
     jtk_Assert_assertObject(entityFile, "The specified entity file is null.");
 
-    zen_ClassEntity_t* entity = (zen_ClassEntity_t*)entityFile->m_entity;
+    zen_ClassEntity_t* entity = &entityFile->m_entity;
     zen_ConstantPool_t* constantPool = entityFile->m_constantPool;
 
     zen_ConstantPoolClass_t* classEntry =
@@ -135,14 +181,123 @@ void zen_Class_initialize(zen_Class_t* class0, zen_EntityFile_t* entityFile) {
 
     class0->m_descriptor = jtk_CString_newEx(descriptorEntry->m_bytes, descriptorEntry->m_length);
 
+    /* The constant pool entries are resolved lazily, when the instructions
+     * which refer to them are executed for the first time. The entries begin
+     * at index 1, therefore, the tables hold one slot more than the entries.
+     */
+    int32_t constantPoolSize = constantPool->m_size + 1;
+    class0->m_resolvedEntries = zen_Arena_allocate(entityFile->m_arena, void*, constantPoolSize);
+    class0->m_inlineCaches = zen_Arena_allocate(entityFile->m_arena, zen_InlineCache_t*,
+        constantPoolSize);
+    int32_t k;
+    for (k = 0; k < constantPoolSize; k++) {
+        class0->m_resolvedEntries[k] = NULL;
+        class0->m_inlineCaches[k] = NULL;
+    }
+
+    /* The instance fields are laid out once, here. The references come first,
+     * so that the collector finds them without consulting the fields. The
+     * remaining fields are sorted by their sizes, in decreasing order. Every
+     * field is then naturally aligned, with at most one gap after the
+     * references.
+     *
+     * The first pass counts the bytes occupied by the fields of each size, and
+     * the second pass assigns the offsets.
+     */
     int32_t i;
     int32_t fieldCount = entity->m_fieldCount;
+    zen_Field_t** instanceFields = jtk_Memory_allocate(zen_Field_t*, fieldCount);
+    int32_t instanceFieldCount = 0;
+    int32_t referenceFieldCount = 0;
+    zen_Field_t** staticFields = jtk_Memory_allocate(zen_Field_t*, fieldCount);
+    int32_t staticFieldCount = 0;
+    int32_t staticReferenceFieldCount = 0;
+    int32_t sizes[4] = { 0, 0, 0, 0 };
     for (i = 0; i < fieldCount; i++) {
         zen_FieldEntity_t* fieldEntity = (zen_FieldEntity_t*)entity->m_fields[i];
         zen_Field_t* field = zen_Field_newFromFieldEntity(class0, fieldEntity);
         jtk_HashMap_put(class0->m_fields, field->m_name, field);
+
+        if ((fieldEntity->m_flags & ZEN_ENTITY_FLAG_STATIC) == 0) {
+            instanceFields[instanceFieldCount++] = field;
+            if (zen_Field_isReference(field)) {
+                referenceFieldCount++;
+            }
+            else {
+                int32_t size = zen_Field_getSizeOfType(field->m_type);
+                sizes[zen_Class_getSizeClass(size)] += size;
+            }
+        }
+        else {
+            staticFields[staticFieldCount++] = field;
+            if (zen_Field_isReference(field)) {
+                staticReferenceFieldCount++;
+            }
+        }
     }
 
+    /* The offsets where the fields of each size begin. When the references
+     * are compressed, they may end at a 32-bit boundary. The gap before the
+     * 64-bit fields is then filled with a 32-bit field, if any.
+     */
+    int32_t offsets[4];
+    int32_t referenceEnd = sizeof (zen_Object_t) + (referenceFieldCount * sizeof (zen_Reference_t));
+    int32_t gapOffset = -1;
+    offsets[3] = referenceEnd;
+    if (((referenceEnd & 7) != 0) && (sizes[3] > 0)) {
+        offsets[3] = (referenceEnd + 7) & ~7;
+        if (sizes[2] > 0) {
+            gapOffset = referenceEnd;
+            sizes[2] -= 4;
+        }
+    }
+    offsets[2] = offsets[3] + sizes[3];
+    offsets[1] = offsets[2] + sizes[2];
+    offsets[0] = offsets[1] + sizes[1];
+    int32_t end = offsets[0] + sizes[0];
+    int32_t referenceOffset = sizeof (zen_Object_t);
+
+    for (i = 0; i < instanceFieldCount; i++) {
+        zen_Field_t* field = instanceFields[i];
+        if (zen_Field_isReference(field)) {
+            field->m_offset = referenceOffset;
+            referenceOffset += sizeof (zen_Reference_t);
+        }
+        else {
+            int32_t size = zen_Field_getSizeOfType(field->m_type);
+            int32_t sizeClass = zen_Class_getSizeClass(size);
+            if ((sizeClass == 2) && (gapOffset >= 0)) {
+                field->m_offset = gapOffset;
+                gapOffset = -1;
+            }
+            else {
+                field->m_offset = offsets[sizeClass];
+                offsets[sizeClass] += size;
+            }
+        }
+    }
+    jtk_Memory_deallocate(instanceFields);
+
+    /* The instances are allocated at 64-bit boundaries. */
+    class0->m_instanceSize = (end + 7) & ~7;
+    class0->m_referenceFieldCount = referenceFieldCount;
+
+    /* The static fields occupy one slot each, with the references first, so
+     * that the collector visits them without consulting the fields.
+     */
+    class0->m_staticFields = (staticFieldCount > 0)?
+        zen_Arena_allocate(entityFile->m_arena, zen_Slot_t, staticFieldCount) : NULL;
+    class0->m_staticFieldCount = staticFieldCount;
+    class0->m_staticReferenceFieldCount = staticReferenceFieldCount;
+    int32_t referenceIndex = 0;
+    int32_t valueIndex = staticReferenceFieldCount;
+    for (i = 0; i < staticFieldCount; i++) {
+        zen_Field_t* field = staticFields[i];
+        field->m_index = zen_Field_isReference(field)? referenceIndex++ : valueIndex++;
+        class0->m_staticFields[field->m_index].m_long = 0;
+    }
+    jtk_Memory_deallocate(staticFields);
+
     int32_t j;
     int32_t functionCount = entity->m_functionCount;
     for (j = 0; j < functionCount; j++) {
@@ -152,4 +307,145 @@ void zen_Class_initialize(zen_Class_t* class0, zen_EntityFile_t* entityFile) {
         jtk_CString_t* key = jtk_CString_append(function->m_name, function->m_descriptor);
         jtk_HashMap_put(class0->m_functions, key, function);
     }
-}
\ No newline at end of file
+}
+
+// Link
+
+static bool zen_Class_hasSameSelector(zen_Function_t* function1, zen_Function_t* function2) {
+    return jtk_CString_equals(function1->m_name->m_value, function1->m_name->m_size,
+            function2->m_name->m_value, function2->m_name->m_size) &&
+        jtk_CString_equals(function1->m_descriptor->m_value, function1->m_descriptor->m_size,
+            function2->m_descriptor->m_value, function2->m_descriptor->m_size);
+}
+
+/* Returns the index of the slot whose function has the same name and
+ * descriptor as the specified function, or -1.
+ */
+static int32_t zen_Class_findSlot(zen_Function_t** vtable, int32_t size,
+    zen_Function_t* function) {
+    int32_t i;
+    for (i = 0; i < size; i++) {
+        if (zen_Class_hasSameSelector(vtable[i], function)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool zen_Class_isPrimarySuperclass(zen_Class_t* class0, zen_Class_t* superclass) {
+    return (superclass->m_depth <= class0->m_depth) &&
+        (class0->m_primarySuperclasses[superclass->m_depth] == superclass);
+}
+
+void zen_Class_link(zen_Class_t* class0, zen_Class_t** superclasses,
+    int32_t superclassCount) {
+    jtk_Assert_assertObject(class0, "The specified class is null.");
+
+    class0->m_superclasses = superclasses;
+    class0->m_superclassCount = superclassCount;
+
+    /* The chain of primary superclasses is extended by this class. */
+    zen_Class_t* primarySuperclass = (superclassCount > 0)? superclasses[0] : NULL;
+    int32_t depth = (primarySuperclass != NULL)? (primarySuperclass->m_depth + 1) : 0;
+    zen_Arena_t* arena = class0->m_entityFile->m_arena;
+    class0->m_primarySuperclasses = zen_Arena_allocate(arena, zen_Class_t*, depth + 1);
+    int32_t i;
+    for (i = 0; i < depth; i++) {
+        class0->m_primarySuperclasses[i] = primarySuperclass->m_primarySuperclasses[i];
+    }
+    class0->m_primarySuperclasses[depth] = class0;
+    class0->m_depth = depth;
+
+    /* The virtual function table begins as a copy of the table of the primary
+     * superclass. An instance function either overrides an inherited slot, or
+     * is appended to the table. The slots are assigned once, here.
+     */
+    int32_t inheritedSize = (primarySuperclass != NULL)? primarySuperclass->m_vtableSize : 0;
+    int32_t capacity = inheritedSize + jtk_HashMap_getSize(class0->m_functions);
+    zen_Function_t** vtable = zen_Arena_allocate(arena, zen_Function_t*, capacity + 1);
+    for (i = 0; i < inheritedSize; i++) {
+        vtable[i] = primarySuperclass->m_vtable[i];
+    }
+    int32_t size = inheritedSize;
+
+    jtk_Iterator_t* functionIterator = jtk_HashMap_getValueIterator(class0->m_functions);
+    while (jtk_Iterator_hasNext(functionIterator)) {
+        zen_Function_t* function = (zen_Function_t*)jtk_Iterator_getNext(functionIterator);
+        if ((function->m_functionEntity->m_flags & ZEN_ENTITY_FLAG_STATIC) == 0) {
+            int32_t slot = zen_Class_findSlot(vtable, inheritedSize, function);
+            if (slot < 0) {
+                slot = size++;
+            }
+            vtable[slot] = function;
+            function->m_vtableIndex = slot;
+        }
+    }
+    jtk_Iterator_delete(functionIterator);
+
+    class0->m_vtable = vtable;
+    class0->m_vtableSize = size;
+
+    /* Every superclass which does not lie on the chain of primary superclasses
+     * receives an interface table. They include the secondary superclasses,
+     * their primary superclasses, and the superclasses which the superclasses
+     * already hold interface tables for.
+     */
+    int32_t candidateCount = 0;
+    for (i = 0; i < superclassCount; i++) {
+        candidateCount += superclasses[i]->m_depth + 1 + superclasses[i]->m_interfaceTableCount;
+    }
+    zen_Class_t** candidates = jtk_Memory_allocate(zen_Class_t*, candidateCount + 1);
+    int32_t tableCount = 0;
+    for (i = 0; i < superclassCount; i++) {
+        zen_Class_t* superclass = superclasses[i];
+        int32_t chainLength = superclass->m_depth + 1;
+        int32_t j;
+        for (j = 0; j < chainLength + superclass->m_interfaceTableCount; j++) {
+            zen_Class_t* candidate = (j < chainLength)? superclass->m_primarySuperclasses[j] :
+                superclass->m_interfaceTables[j - chainLength].m_superclass;
+            if (zen_Class_isPrimarySuperclass(class0, candidate)) {
+                continue;
+            }
+
+            int32_t k;
+            for (k = 0; (k < tableCount) && (candidates[k] != candidate); k++) {
+            }
+            if (k == tableCount) {
+                candidates[tableCount++] = candidate;
+            }
+        }
+    }
+
+    class0->m_interfaceTables = (tableCount > 0)?
+        zen_Arena_allocate(arena, zen_InterfaceTable_t, tableCount) : NULL;
+    class0->m_interfaceTableCount = tableCount;
+    for (i = 0; i < tableCount; i++) {
+        zen_Class_t* superclass = candidates[i];
+        zen_Function_t** functions = zen_Arena_allocate(arena, zen_Function_t*,
+            superclass->m_vtableSize + 1);
+        int32_t j;
+        for (j = 0; j < superclass->m_vtableSize; j++) {
+            /* A function which this class does not override is inherited from
+             * the superclass.
+             */
+            zen_Function_t* function = superclass->m_vtable[j];
+            int32_t slot = zen_Class_findSlot(vtable, size, function);
+            functions[j] = (slot >= 0)? vtable[slot] : function;
+        }
+        class0->m_interfaceTables[i].m_superclass = superclass;
+        class0->m_interfaceTables[i].m_functions = functions;
+    }
+    jtk_Memory_deallocate(candidates);
+}
+
+// Roots
+
+void zen_Class_visitRoots(zen_Class_t* class0, zen_RootVisitor_t* visitor) {
+    jtk_Assert_assertObject(class0, "The specified class is null.");
+    jtk_Assert_assertObject(visitor, "The specified visitor is null.");
+
+    int32_t i;
+    for (i = 0; i < class0->m_staticReferenceFieldCount; i++) {
+        visitor->m_visitRoot(visitor, (zen_Object_t**)&class0->m_staticFields[i].m_reference);
+    }
+}
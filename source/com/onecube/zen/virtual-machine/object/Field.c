@@ -28,14 +28,20 @@
 zen_Field_t* zen_Field_newFromFieldEntity(zen_Class_t* class0,
     zen_FieldEntity_t* fieldEntity) {
     zen_ConstantPool_t* constantPool = class0->m_entityFile->m_constantPool;
-    zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[fieldEntity->m_nameIndex];
-    zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[fieldEntity->m_descriptorIndex];
+    zen_ConstantPoolUtf8_t* nameEntry = (zen_ConstantPoolUtf8_t*)constantPool->m_entries[fieldEntity->m_nameIndex];
+    zen_ConstantPoolUtf8_t* descriptorEntry = (zen_ConstantPoolUtf8_t*)constantPool->m_entries[fieldEntity->m_descriptorIndex];
 
-    zen_Field_t* field = jtk_Memory_allocate(zen_Field_t, 1);
+    zen_Field_t* field = zen_Arena_allocate(class0->m_entityFile->m_arena, zen_Field_t, 1);
     field->m_name = jtk_CString_newEx(nameEntry->m_bytes, nameEntry->m_length);
     field->m_descriptor = jtk_CString_newEx(descriptorEntry->m_bytes, descriptorEntry->m_length);
     field->m_class = class0;
 
+    /* Class types begin with '(' and array types begin with '@'. */
+    uint8_t type = descriptorEntry->m_bytes[0];
+    field->m_type = ((type == '(') || (type == '@'))? 'a' : type;
+    field->m_offset = -1;
+    field->m_index = -1;
+
     return field;
 }
 
@@ -44,7 +50,6 @@ zen_Field_t* zen_Field_newFromFieldEntity(zen_Class_t* class0,
 void zen_Field_delete(zen_Field_t* field) {
     jtk_CString_delete(field->m_name);
     jtk_CString_delete(field->m_descriptor);
-    jtk_Memory_deallocate(field);
 
 }
 
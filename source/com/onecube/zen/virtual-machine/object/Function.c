@@ -17,6 +17,9 @@
 // Tuesday, March 26, 2019
 
 #include <com/onecube/zen/virtual-machine/feb/EntityFlag.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/Attribute.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/PredefinedAttribute.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolUtf8.h>
 #include <com/onecube/zen/virtual-machine/object/Function.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
 
@@ -24,20 +27,143 @@
  * Function                                                                    *
  *******************************************************************************/
 
+/* The identifier assigned to the next function that is loaded. Zero is never
+ * assigned.
+ */
+static uint32_t zen_Function_nextId = 1;
+
+/* Search in a linear fashion for the attribute with the specified name in the
+ * specified function.
+ */
+zen_Attribute_t* zen_Function_findAttribute(zen_FunctionEntity_t* functionEntity,
+    zen_ConstantPool_t* constantPool, const uint8_t* name, int32_t size) {
+    int32_t limit = functionEntity->m_attributeTable.m_size;
+    int32_t i;
+    for (i = 0; i < limit; i++) {
+        zen_Attribute_t* attribute = functionEntity->m_attributeTable.m_attributes[i];
+        /* Unrecognized attributes are represented as null. */
+        if (attribute != NULL) {
+            zen_ConstantPoolUtf8_t* nameEntry =
+                (zen_ConstantPoolUtf8_t*)constantPool->m_entries[attribute->m_nameIndex];
+
+            if (jtk_CString_equals(nameEntry->m_bytes, nameEntry->m_length,
+                name, size)) {
+                return attribute;
+            }
+        }
+    }
+    return NULL;
+}
+
+/* It is recommended that the compilers generate instruction attribute as the
+ * first attribute for functions in general.
+ */
+zen_InstructionAttribute_t* zen_Function_findInstructionAttribute(
+    zen_FunctionEntity_t* functionEntity, zen_ConstantPool_t* constantPool) {
+    return (zen_InstructionAttribute_t*)zen_Function_findAttribute(functionEntity,
+        constantPool, ZEN_PREDEFINED_ATTRIBUTE_INSTRUCTION,
+        ZEN_PREDEFINED_ATTRIBUTE_INSTRUCTION_SIZE);
+}
+
+zen_StackMapTableAttribute_t* zen_Function_findStackMapTableAttribute(
+    zen_FunctionEntity_t* functionEntity, zen_ConstantPool_t* constantPool) {
+    return (zen_StackMapTableAttribute_t*)zen_Function_findAttribute(functionEntity,
+        constantPool, ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE,
+        ZEN_PREDEFINED_ATTRIBUTE_STACK_MAP_TABLE_SIZE);
+}
+
+/* Count the number of local variable slots occupied by the parameters
+ * described by the specified function descriptor. The parameters follow the
+ * colon which terminates the return type. A descriptor without parameters
+ * ends with 'v'.
+ *
+ * Every parameter occupies exactly one slot, irrespective of its type.
+ */
+int32_t zen_Function_countParameterSlots(const uint8_t* descriptor, int32_t size) {
+    int32_t result = 0;
+
+    int32_t i = 0;
+    while ((i < size) && (descriptor[i] != ':')) {
+        i++;
+    }
+    i++;
+
+    while (i < size) {
+        uint8_t type = descriptor[i];
+        switch (type) {
+            case 'z':
+            case 'b':
+            case 's':
+            case 'c':
+            case 'i':
+            case 'l':
+            case 'f':
+            case 'd': {
+                result += 1;
+                i++;
+                break;
+            }
+
+            case '@': {
+                /* An array is a reference, regardless of its component type. */
+                while ((i < size) && (descriptor[i] == '@')) {
+                    i++;
+                }
+                if ((i < size) && (descriptor[i] == '(')) {
+                    while ((i < size) && (descriptor[i] != ')')) {
+                        i++;
+                    }
+                }
+                i++;
+                result += 1;
+                break;
+            }
+
+            case '(': {
+                while ((i < size) && (descriptor[i] != ')')) {
+                    i++;
+                }
+                i++;
+                result += 1;
+                break;
+            }
+
+            default: {
+                /* The 'v' type indicates that there are no parameters. */
+                i++;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
 // Constructor
 
 zen_Function_t* zen_Function_newFromFunctionEntity(zen_Class_t* class0,
     zen_FunctionEntity_t* functionEntity) {
     zen_ConstantPool_t* constantPool = class0->m_entityFile->m_constantPool;
-    zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[functionEntity->m_nameIndex];
-    zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[functionEntity->m_descriptorIndex];
+    zen_ConstantPoolUtf8_t* nameEntry = (zen_ConstantPoolUtf8_t*)constantPool->m_entries[functionEntity->m_nameIndex];
+    zen_ConstantPoolUtf8_t* descriptorEntry = (zen_ConstantPoolUtf8_t*)constantPool->m_entries[functionEntity->m_descriptorIndex];
 
-    zen_Function_t* function = jtk_Memory_allocate(zen_Function_t, 1);
+    zen_Function_t* function = zen_Arena_allocate(class0->m_entityFile->m_arena, zen_Function_t, 1);
     function->m_name = jtk_CString_newEx(nameEntry->m_bytes, nameEntry->m_length);
     function->m_descriptor = jtk_CString_newEx(descriptorEntry->m_bytes, descriptorEntry->m_length);
     function->m_class = class0;
     function->m_flags = 0;
     function->m_functionEntity = functionEntity;
+    function->m_id = zen_Function_nextId++;
+    function->m_vtableIndex = -1;
+    function->m_instructionAttribute = zen_Function_findInstructionAttribute(
+        functionEntity, constantPool);
+    function->m_stackMapTable = zen_Function_findStackMapTableAttribute(
+        functionEntity, constantPool);
+    function->m_parameterSlotCount = zen_Function_countParameterSlots(
+        descriptorEntry->m_bytes, descriptorEntry->m_length);
+    function->m_invocationCount = 0;
+    function->m_backEdgeCount = 0;
+    function->m_compiledCode = NULL;
 
     return function;
 }
@@ -45,9 +171,19 @@ zen_Function_t* zen_Function_newFromFunctionEntity(zen_Class_t* class0,
 // Destructor
 
 void zen_Function_delete(zen_Function_t* function) {
+    if (function->m_compiledCode != NULL) {
+        zen_CompiledCode_delete(function->m_compiledCode);
+    }
+    /* The instructions may be decoded lazily by the threads which execute the
+     * function. Therefore, the records are allocated outside the arena.
+     */
+    zen_InstructionAttribute_t* instructionAttribute = function->m_instructionAttribute;
+    if ((instructionAttribute != NULL) && (instructionAttribute->m_decodedInstructions != NULL)) {
+        jtk_Memory_deallocate(instructionAttribute->m_decodedInstructions);
+        instructionAttribute->m_decodedInstructions = NULL;
+    }
     jtk_CString_delete(function->m_name);
     jtk_CString_delete(function->m_descriptor);
-    jtk_Memory_deallocate(function);
 }
 
 // Class
@@ -72,4 +208,22 @@ jtk_CString_t* zen_Function_getName(zen_Function_t* function) {
 
 bool zen_Function_isNative(zen_Function_t* function) {
     return (function->m_functionEntity->m_flags & ZEN_ENTITY_FLAG_NATIVE) != 0;
+}
+
+// Instruction Attribute
+
+zen_InstructionAttribute_t* zen_Function_getInstructionAttribute(zen_Function_t* function) {
+    return function->m_instructionAttribute;
+}
+
+// Stack Map Table Attribute
+
+zen_StackMapTableAttribute_t* zen_Function_getStackMapTableAttribute(zen_Function_t* function) {
+    return function->m_stackMapTable;
+}
+
+// Parameter
+
+int32_t zen_Function_getParameterSlotCount(zen_Function_t* function) {
+    return function->m_parameterSlotCount;
 }
\ No newline at end of file
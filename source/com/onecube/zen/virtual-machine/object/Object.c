@@ -23,5 +23,49 @@
  *******************************************************************************/
 
 zen_Class_t* zen_Object_getClass(zen_Object_t* object) {
-    return NULL;
+    return object->m_class;
+}
+
+/* Reference */
+
+#ifdef ZEN_COMPRESSED_REFERENCES
+uintptr_t zen_Reference_base = 0;
+#endif
+
+/* Hash Code */
+
+/* The hash codes are drawn from a Weyl sequence, which spreads consecutive
+ * values across all the bits.
+ */
+static uint32_t zen_Object_hashSeed = 0;
+
+int32_t zen_Object_getHashCode(zen_Object_t* object) {
+    int32_t flags = __atomic_load_n(&object->m_flags, __ATOMIC_RELAXED);
+    int32_t hashCode = (int32_t)(((uint32_t)flags & ZEN_OBJECT_HASH_MASK) >> ZEN_OBJECT_HASH_SHIFT);
+    if (hashCode == 0) {
+        uint32_t seed = __atomic_add_fetch(&zen_Object_hashSeed, 0x9E3779B9U, __ATOMIC_RELAXED);
+        int32_t newHashCode = (int32_t)(seed >> (32 - 20));
+        if (newHashCode == 0) {
+            newHashCode = 1;
+        }
+
+        /* The marker may set the flags of the object concurrently. The first
+         * hash code installed wins.
+         */
+        int32_t newFlags;
+        do {
+            hashCode = (int32_t)(((uint32_t)flags & ZEN_OBJECT_HASH_MASK) >> ZEN_OBJECT_HASH_SHIFT);
+            if (hashCode != 0) {
+                break;
+            }
+            newFlags = flags | (int32_t)((uint32_t)newHashCode << ZEN_OBJECT_HASH_SHIFT);
+        }
+        while (!__atomic_compare_exchange_n(&object->m_flags, &flags, newFlags,
+            false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+        if (hashCode == 0) {
+            hashCode = newHashCode;
+        }
+    }
+    return hashCode;
 }
\ No newline at end of file
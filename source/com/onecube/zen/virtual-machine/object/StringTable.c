@@ -0,0 +1,120 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/object/StringTable.h>
+
+/*******************************************************************************
+ * StringTable                                                                 *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_StringTable_t* zen_StringTable_new(zen_ImmortalGeneration_t* immortalGeneration) {
+    jtk_Assert_assertObject(immortalGeneration, "The specified immortal generation is null.");
+
+    zen_StringTable_t* table = jtk_Memory_allocate(zen_StringTable_t, 1);
+    table->m_strings = jtk_Memory_allocate(zen_String_t*, ZEN_STRING_TABLE_INITIAL_CAPACITY);
+    table->m_size = 0;
+    table->m_capacity = ZEN_STRING_TABLE_INITIAL_CAPACITY;
+    table->m_immortalGeneration = immortalGeneration;
+    table->m_mutex = jtk_Mutex_new();
+
+    return table;
+}
+
+/* Destructor */
+
+void zen_StringTable_delete(zen_StringTable_t* table) {
+    jtk_Assert_assertObject(table, "The specified string table is null.");
+
+    jtk_Mutex_delete(table->m_mutex);
+    jtk_Memory_deallocate(table->m_strings);
+    jtk_Memory_deallocate(table);
+}
+
+/* Grow */
+
+/* The strings are reinserted at the slots indicated by their hash codes, which
+ * are recorded in the strings themselves.
+ */
+static void zen_StringTable_grow(zen_StringTable_t* table) {
+    int32_t capacity = table->m_capacity * 2;
+    int32_t mask = capacity - 1;
+    zen_String_t** strings = jtk_Memory_allocate(zen_String_t*, capacity);
+    int32_t i;
+    for (i = 0; i < table->m_capacity; i++) {
+        zen_String_t* string = table->m_strings[i];
+        if (string != NULL) {
+            int32_t index = string->m_hashCode & mask;
+            while (strings[index] != NULL) {
+                index = (index + 1) & mask;
+            }
+            strings[index] = string;
+        }
+    }
+    jtk_Memory_deallocate(table->m_strings);
+    table->m_strings = strings;
+    table->m_capacity = capacity;
+}
+
+/* Intern */
+
+zen_String_t* zen_StringTable_intern(zen_StringTable_t* table, const uint8_t* bytes,
+    int32_t size) {
+    jtk_Assert_assertObject(table, "The specified string table is null.");
+    jtk_Assert_assertTrue(size >= 0, "The specified size is invalid.");
+
+    int32_t hashCode = zen_String_hash(bytes, size);
+
+    jtk_Mutex_lock(table->m_mutex);
+    int32_t mask = table->m_capacity - 1;
+    int32_t index = hashCode & mask;
+    zen_String_t* result;
+    while ((result = table->m_strings[index]) != NULL) {
+        if (zen_String_equals(result, bytes, size, hashCode)) {
+            break;
+        }
+        index = (index + 1) & mask;
+    }
+
+    if (result == NULL) {
+        /* The bytes are followed by a terminating null. */
+        int32_t objectSize = (int32_t)((sizeof (zen_String_t) + size + 1 + 7) & ~7);
+        result = (zen_String_t*)zen_ImmortalGeneration_allocate(
+            table->m_immortalGeneration, objectSize);
+        if (result != NULL) {
+            result->m_header.m_class = NULL;
+            result->m_header.m_size = objectSize;
+            result->m_header.m_flags = 0;
+            result->m_size = size;
+            result->m_hashCode = hashCode;
+            memcpy(result->m_value, bytes, size);
+
+            table->m_strings[index] = result;
+            table->m_size++;
+            if ((table->m_size * 2) > table->m_capacity) {
+                zen_StringTable_grow(table);
+            }
+        }
+    }
+    jtk_Mutex_unlock(table->m_mutex);
+
+    return result;
+}
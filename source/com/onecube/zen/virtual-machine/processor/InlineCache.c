@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+#include <com/onecube/zen/virtual-machine/processor/InlineCache.h>
+
+/*******************************************************************************
+ * InlineCache                                                                 *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_InlineCache_t* zen_InlineCache_new() {
+    zen_InlineCache_t* inlineCache = jtk_Memory_allocate(zen_InlineCache_t, 1);
+    int32_t i;
+    for (i = 0; i < ZEN_INLINE_CACHE_CAPACITY; i++) {
+        inlineCache->m_classes[i] = NULL;
+        inlineCache->m_functions[i] = NULL;
+    }
+    inlineCache->m_size = 0;
+    inlineCache->m_megamorphic = false;
+
+    return inlineCache;
+}
+
+/* Destructor */
+
+void zen_InlineCache_delete(zen_InlineCache_t* inlineCache) {
+    jtk_Assert_assertObject(inlineCache, "The specified inline cache is null.");
+
+    jtk_Memory_deallocate(inlineCache);
+}
+
+/* Update */
+
+void zen_InlineCache_update(zen_InlineCache_t* inlineCache, zen_Class_t* class0,
+    zen_Function_t* function) {
+    jtk_Assert_assertObject(inlineCache, "The specified inline cache is null.");
+
+    /* The size is checked before it is incremented, so that a megamorphic
+     * call site does not increment it on every invocation.
+     */
+    int32_t index = __atomic_load_n(&inlineCache->m_size, __ATOMIC_RELAXED);
+    if (index < ZEN_INLINE_CACHE_CAPACITY) {
+        index = __atomic_fetch_add(&inlineCache->m_size, 1, __ATOMIC_RELAXED);
+    }
+
+    if (index < ZEN_INLINE_CACHE_CAPACITY) {
+        /* The entry belongs to this thread. The function is stored before the
+         * class is published.
+         */
+        inlineCache->m_functions[index] = function;
+        __atomic_store_n(&inlineCache->m_classes[index], class0, __ATOMIC_RELEASE);
+    }
+    else {
+        __atomic_store_n(&inlineCache->m_megamorphic, true, __ATOMIC_RELAXED);
+    }
+}
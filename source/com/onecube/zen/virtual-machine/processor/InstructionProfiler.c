@@ -0,0 +1,158 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <stdlib.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+#include <com/onecube/zen/virtual-machine/feb/Instruction.h>
+#include <com/onecube/zen/virtual-machine/processor/InstructionProfiler.h>
+
+/*******************************************************************************
+ * InstructionProfiler                                                         *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_InstructionProfiler_t* zen_InstructionProfiler_new() {
+    zen_InstructionProfiler_t* profiler = jtk_Memory_allocate(zen_InstructionProfiler_t, 1);
+    profiler->m_entries = jtk_Memory_allocate(zen_InstructionProfilerEntry_t,
+        ZEN_INSTRUCTION_PROFILER_CAPACITY);
+    profiler->m_size = 0;
+    profiler->m_window = 0;
+    profiler->m_windowSize = 0;
+    profiler->m_dispatchCount = 0;
+    profiler->m_droppedCount = 0;
+
+    return profiler;
+}
+
+/* Destructor */
+
+void zen_InstructionProfiler_delete(zen_InstructionProfiler_t* profiler) {
+    jtk_Assert_assertObject(profiler, "The specified instruction profiler is null.");
+
+    jtk_Memory_deallocate(profiler->m_entries);
+    jtk_Memory_deallocate(profiler);
+}
+
+/* Record */
+
+/* The entries are stored in an open addressing hash table with linear
+ * probing. The entries are never removed.
+ */
+static void zen_InstructionProfiler_count(zen_InstructionProfiler_t* profiler,
+    uint32_t sequence, int32_t length) {
+    uint32_t hash = (sequence * 2654435761U) ^ (uint32_t)length;
+    int32_t mask = ZEN_INSTRUCTION_PROFILER_CAPACITY - 1;
+    int32_t index = (int32_t)(hash & mask);
+
+    while (true) {
+        zen_InstructionProfilerEntry_t* entry = &profiler->m_entries[index];
+        if ((entry->m_sequence == sequence) && (entry->m_length == length)) {
+            entry->m_count++;
+            break;
+        }
+
+        if (entry->m_length == 0) {
+            /* Keep at least one entry unused, so that the probing terminates. */
+            if (profiler->m_size == (ZEN_INSTRUCTION_PROFILER_CAPACITY - 1)) {
+                profiler->m_droppedCount++;
+            }
+            else {
+                entry->m_sequence = sequence;
+                entry->m_length = length;
+                entry->m_count = 1;
+                profiler->m_size++;
+            }
+            break;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+void zen_InstructionProfiler_record(zen_InstructionProfiler_t* profiler, uint8_t byteCode) {
+    jtk_Assert_assertObject(profiler, "The specified instruction profiler is null.");
+
+    profiler->m_dispatchCount++;
+    profiler->m_window = (profiler->m_window << 8) | byteCode;
+    if (profiler->m_windowSize < ZEN_INSTRUCTION_PROFILER_MAX_SEQUENCE_LENGTH) {
+        profiler->m_windowSize++;
+    }
+
+    int32_t length;
+    for (length = 2; length <= profiler->m_windowSize; length++) {
+        uint32_t sequence = (length == 4)? profiler->m_window :
+            (profiler->m_window & ((1U << (length * 8)) - 1));
+        zen_InstructionProfiler_count(profiler, sequence, length);
+    }
+}
+
+/* Write */
+
+static int zen_InstructionProfiler_compareEntries(const void* entry1, const void* entry2) {
+    uint64_t count1 = ((const zen_InstructionProfilerEntry_t*)entry1)->m_count;
+    uint64_t count2 = ((const zen_InstructionProfilerEntry_t*)entry2)->m_count;
+
+    return (count1 < count2)? 1 : ((count1 > count2)? -1 : 0);
+}
+
+void zen_InstructionProfiler_write(zen_InstructionProfiler_t* profiler, FILE* stream) {
+    jtk_Assert_assertObject(profiler, "The specified instruction profiler is null.");
+    jtk_Assert_assertObject(stream, "The specified stream is null.");
+
+    /* The hash table is left intact, so that the profiler can continue
+     * counting afterwards.
+     */
+    zen_InstructionProfilerEntry_t* entries = jtk_Memory_allocate(zen_InstructionProfilerEntry_t,
+        profiler->m_size);
+    int32_t size = 0;
+    int32_t i;
+    for (i = 0; i < ZEN_INSTRUCTION_PROFILER_CAPACITY; i++) {
+        if (profiler->m_entries[i].m_length != 0) {
+            entries[size++] = profiler->m_entries[i];
+        }
+    }
+    qsort(entries, size, sizeof (zen_InstructionProfilerEntry_t),
+        zen_InstructionProfiler_compareEntries);
+
+    fprintf(stream, "[profile] %llu dispatches, %d sequences, %llu dropped\n",
+        (unsigned long long)profiler->m_dispatchCount, size,
+        (unsigned long long)profiler->m_droppedCount);
+    for (i = 0; i < size; i++) {
+        zen_InstructionProfilerEntry_t* entry = &entries[i];
+        fprintf(stream, "%12llu ", (unsigned long long)entry->m_count);
+
+        int32_t j;
+        for (j = entry->m_length - 1; j >= 0; j--) {
+            uint8_t byteCode = (uint8_t)(entry->m_sequence >> (j * 8));
+            if (byteCode <= ZEN_BYTE_CODE_WIDE) {
+                fprintf(stream, " %s", zen_Instruction_getInstance((zen_ByteCode_t)byteCode)->m_text);
+            }
+            else {
+                /* Superinstructions are internal to the virtual machine. */
+                fprintf(stream, " super_%d", byteCode);
+            }
+        }
+        fprintf(stream, "\n");
+    }
+
+    jtk_Memory_deallocate(entries);
+}
@@ -24,6 +24,8 @@
 #include <com/onecube/zen/virtual-machine/VirtualMachine.h>
 #include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPool.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolClass.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolField.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolFunction.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolInteger.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolLong.h>
@@ -33,8 +35,12 @@
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolUtf8.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolTag.h>
 #include <com/onecube/zen/virtual-machine/feb/Entity.h>
+#include <com/onecube/zen/virtual-machine/feb/PrimitiveType.h>
+#include <com/onecube/zen/virtual-machine/feb/SwitchInstruction.h>
+#include <com/onecube/zen/virtual-machine/loader/InstructionDecoder.h>
 #include <com/onecube/zen/virtual-machine/object/Object.h>
 #include <com/onecube/zen/virtual-machine/processor/Interpreter.h>
+#include <com/onecube/zen/virtual-machine/processor/Superinstruction.h>
 #include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
 
 /* The interpreter is the heart of the virtual machine. */
@@ -44,6 +50,530 @@
 
 const uint8_t* ZEN_INTERPRETER_TAG = "com.onecube.zen.virtual-machine.processor.Interpreter";
 
+/*******************************************************************************
+ * Dispatch                                                                    *
+ *******************************************************************************/
+
+/* The interpreter supports two dispatch engines, which are selected at build
+ * time.
+ *
+ * By default, every instruction is dispatched through a single `switch`
+ * statement within the primary loop. This is portable, but all the handlers
+ * share one indirect branch, which the branch predictor cannot learn.
+ *
+ * When ZEN_INTERPRETER_THREADED_DISPATCH is defined, and the compiler supports
+ * labels as values, every handler ends by fetching the next instruction and
+ * jumping directly to its handler through a table of label addresses. Each
+ * handler therefore has its own indirect branch. The `switch` statement is
+ * still used to dispatch the very first instruction of a function.
+ */
+
+#if defined(ZEN_INTERPRETER_THREADED_DISPATCH) && !defined(__GNUC__)
+    #warning "Labels as values are not supported by the compiler. Falling back to switch dispatch."
+    #undef ZEN_INTERPRETER_THREADED_DISPATCH
+#endif
+
+/* When ZEN_INTERPRETER_PREDECODE is also defined, the interpreter runs over
+ * the decoded instructions built when the function was loaded. Every record
+ * holds the address of its handler, so the next handler is reached without
+ * indexing the handler table, and its operands are read from the record.
+ *
+ * The build enables ZEN_INTERPRETER_PREDECODE only along with threaded
+ * dispatch, because the loader decodes the instructions for every translation
+ * unit, not just this one.
+ */
+
+#if defined(ZEN_INTERPRETER_PREDECODE) && !defined(ZEN_INTERPRETER_THREADED_DISPATCH)
+    #error "Decoded instructions require threaded dispatch, which the compiler does not support."
+#endif
+
+#ifdef ZEN_INTERPRETER_THREADED_DISPATCH
+
+#define ZEN_INTERPRETER_LABEL(byteCode) zen_Interpreter_handle_##byteCode
+
+#define ZEN_INTERPRETER_CASE(byteCode) case byteCode: ZEN_INTERPRETER_LABEL(byteCode)
+
+#define ZEN_INTERPRETER_DEFAULT() default: zen_Interpreter_handleUnknown
+
+/* Fetch the next instruction and jump to its handler. The instruction stream
+ * is checked for exhaustion here, just like the primary loop of the switch
+ * dispatch does.
+ */
+#ifdef ZEN_INTERPRETER_PREDECODE
+
+#define ZEN_INTERPRETER_NEXT() \
+    do { \
+        instruction = ZEN_INTERPRETER_FETCH(); \
+        ZEN_INTERPRETER_TRACE_INSTRUCTION(); \
+        ZEN_INTERPRETER_PROFILE_INSTRUCTION(); \
+        goto *record->m_handler; \
+    } \
+    while (false)
+
+#else
+
+#define ZEN_INTERPRETER_NEXT() \
+    do { \
+        instruction = ZEN_INTERPRETER_FETCH(); \
+        ZEN_INTERPRETER_TRACE_INSTRUCTION(); \
+        ZEN_INTERPRETER_PROFILE_INSTRUCTION(); \
+        goto *dispatchTable[instruction]; \
+    } \
+    while (false)
+
+#endif
+
+#else
+
+#define ZEN_INTERPRETER_CASE(byteCode) case byteCode
+
+#define ZEN_INTERPRETER_DEFAULT() default
+
+#define ZEN_INTERPRETER_NEXT() break
+
+#endif
+
+/*******************************************************************************
+ * Debug                                                                       *
+ *******************************************************************************/
+
+/* Every handler describes the instruction it executed. The arguments of these
+ * messages, such as the names of the current function and class, are costly
+ * to evaluate. Therefore, the messages are compiled to nothing, including
+ * their arguments. The instructions executed by the interpreter are recorded
+ * by the trace instead, when ZEN_INTERPRETER_TRACE is defined at build time.
+ */
+
+#define xjtk_Logger_debug(logger, tag, ...)
+
+/*******************************************************************************
+ * Trace                                                                       *
+ *******************************************************************************/
+
+/* When ZEN_INTERPRETER_TRACE is defined at build time, the interpreter records
+ * every instruction it dispatches in the trace of the current processor thread.
+ * A record captures the instruction, its offset, the depth of the operand stack
+ * and the identifier of the current function. Otherwise, no code is generated.
+ */
+
+#ifdef ZEN_INTERPRETER_TRACE
+
+#define ZEN_INTERPRETER_TRACE_INSTRUCTION() \
+    zen_InterpreterTrace_record(trace, instruction, ip - 1, ZEN_INTERPRETER_STACK_SIZE(), \
+        currentStackFrame->m_function->m_id)
+
+#else
+
+#define ZEN_INTERPRETER_TRACE_INSTRUCTION()
+
+#endif
+
+/*******************************************************************************
+ * Profile                                                                     *
+ *******************************************************************************/
+
+/* When ZEN_INTERPRETER_PROFILE is defined at build time, the interpreter counts
+ * the sequences of instructions it dispatches with the instruction profiler of
+ * the current processor thread. Otherwise, no code is generated.
+ */
+
+#ifdef ZEN_INTERPRETER_PROFILE
+
+#define ZEN_INTERPRETER_PROFILE_INSTRUCTION() \
+    zen_InstructionProfiler_record(profiler, instruction)
+
+#else
+
+#define ZEN_INTERPRETER_PROFILE_INSTRUCTION()
+
+#endif
+
+/*******************************************************************************
+ * Compilation                                                                 *
+ *******************************************************************************/
+
+/* When ZEN_JIT is defined at build time, the interpreter counts the invocations
+ * of every function and the backward branches taken within it. When either
+ * counter reaches its threshold, the function is translated to machine code by
+ * the template compiler.
+ *
+ * The compiled code shares the current stack frame with the interpreter. The
+ * interpreter enters it when a function is invoked, when a branch jumps
+ * backwards, and when a callee returns. The compiled code runs until it
+ * reaches an instruction it does not implement, and hands the offset of that
+ * instruction back to the interpreter. Otherwise, no code is generated.
+ */
+
+#ifdef ZEN_JIT
+
+/* Two threads may compile the same function at once. The code published first
+ * is kept, and the code of the other is left unused in the code cache. The
+ * compiled code is published only after it is complete.
+ */
+static void zen_Interpreter_compile(zen_Interpreter_t* interpreter, zen_Function_t* function) {
+    zen_TemplateCompiler_t* compiler = interpreter->m_virtualMachine->m_compiler;
+    if ((compiler != NULL) && (function->m_compiledCode == NULL) &&
+        (function->m_instructionAttribute != NULL)) {
+        zen_CompiledCode_t* compiledCode = zen_TemplateCompiler_compile(compiler,
+            function->m_instructionAttribute);
+        zen_CompiledCode_t* expected = NULL;
+        __atomic_compare_exchange_n(&function->m_compiledCode, &expected, compiledCode,
+            false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    }
+}
+
+/* The top of the operand stack is copied, so that the stackTop register is
+ * never spilled to memory.
+ *
+ * The compiled code exits when a safepoint is requested during a loop. The
+ * interpreter blocks on its behalf, before the instruction at which the code
+ * exited. The position after the offset identifies the stack map entry of
+ * that instruction.
+ */
+#define ZEN_INTERPRETER_RUN_COMPILED_CODE() \
+    do { \
+        zen_CompiledCode_t* compiledCode = currentStackFrame->m_function->m_compiledCode; \
+        if (compiledCode != NULL) { \
+            zen_Slot_t* compiledStackTop = stackTop; \
+            ip = zen_CompiledCode_run(compiledCode, locals, &compiledStackTop, ip); \
+            stackTop = compiledStackTop; \
+            ZEN_INTERPRETER_POLL_SAFEPOINT(ip + 1); \
+        } \
+    } \
+    while (false)
+
+#define ZEN_INTERPRETER_ENTER_FUNCTION() \
+    do { \
+        zen_Function_t* currentFunction = currentStackFrame->m_function; \
+        if (++currentFunction->m_invocationCount == ZEN_JIT_INVOCATION_THRESHOLD) { \
+            zen_Interpreter_compile(interpreter, currentFunction); \
+        } \
+        ZEN_INTERPRETER_RUN_COMPILED_CODE(); \
+    } \
+    while (false)
+
+#define ZEN_INTERPRETER_BACK_EDGE() \
+    do { \
+        zen_Function_t* currentFunction = currentStackFrame->m_function; \
+        if (++currentFunction->m_backEdgeCount == ZEN_JIT_BACK_EDGE_THRESHOLD) { \
+            zen_Interpreter_compile(interpreter, currentFunction); \
+        } \
+        ZEN_INTERPRETER_RUN_COMPILED_CODE(); \
+    } \
+    while (false)
+
+#else
+
+#define ZEN_INTERPRETER_RUN_COMPILED_CODE()
+#define ZEN_INTERPRETER_ENTER_FUNCTION()
+#define ZEN_INTERPRETER_BACK_EDGE()
+
+#endif
+
+/*******************************************************************************
+ * Registers                                                                   *
+ *******************************************************************************/
+
+/* The state of the current stack frame that almost every instruction touches,
+ * namely, the instruction pointer, the base of the instructions, the top of the
+ * operand stack, and the base of the local variable array, is cached in local
+ * variables of zen_Interpreter_interpret(). This allows the compiler to keep
+ * them in machine registers, instead of chasing the invocation stack and the
+ * stack frame on every operand read.
+ *
+ * The registers are spilled to the stack frame only when the interpreter leaves
+ * the current frame, that is, when a function is invoked, a function returns,
+ * or an exception is thrown. They are reloaded from the stack frame that
+ * becomes current afterwards.
+ */
+
+#ifdef ZEN_INTERPRETER_PREDECODE
+
+/* The handlers are bound when a function is executed for the first time. The
+ * first record is bound last, because it indicates whether the records are
+ * bound. A function whose instructions were not decoded when it was loaded is
+ * decoded here.
+ */
+static zen_DecodedInstruction_t* zen_Interpreter_bindDecodedInstructions(
+    zen_StackFrame_t* stackFrame, const void** dispatchTable) {
+    zen_InstructionAttribute_t* instructionAttribute = stackFrame->m_instructionAttribute;
+    zen_DecodedInstruction_t* decodedInstructions = instructionAttribute->m_decodedInstructions;
+    if (decodedInstructions == NULL) {
+        decodedInstructions = zen_InstructionDecoder_decode(instructionAttribute,
+            stackFrame->m_class->m_entityFile->m_constantPool);
+    }
+
+    int32_t i;
+    for (i = instructionAttribute->m_instructionLength; i >= 0; i--) {
+        decodedInstructions[i].m_handler = dispatchTable[decodedInstructions[i].m_byteCode];
+    }
+
+    return decodedInstructions;
+}
+
+#define ZEN_INTERPRETER_LOAD_DECODED_INSTRUCTIONS() \
+    do { \
+        decodedInstructions = currentStackFrame->m_instructionAttribute->m_decodedInstructions; \
+        if ((decodedInstructions == NULL) || (decodedInstructions[0].m_handler == NULL)) { \
+            decodedInstructions = zen_Interpreter_bindDecodedInstructions(currentStackFrame, \
+                dispatchTable); \
+        } \
+    } \
+    while (false)
+
+#else
+
+#define ZEN_INTERPRETER_LOAD_DECODED_INSTRUCTIONS()
+
+#endif
+
+#define ZEN_INTERPRETER_LOAD_REGISTERS() \
+    do { \
+        instructions = currentStackFrame->m_instructionAttribute->m_instructions; \
+        ZEN_INTERPRETER_LOAD_INSTRUCTION_LENGTH(); \
+        ip = currentStackFrame->m_ip; \
+        stackBase = currentStackFrame->m_operandStack.m_values; \
+        stackTop = stackBase + currentStackFrame->m_operandStack.m_size; \
+        locals = currentStackFrame->m_localVariableArray.m_values; \
+        ZEN_INTERPRETER_LOAD_DECODED_INSTRUCTIONS(); \
+    } \
+    while (false)
+
+#define ZEN_INTERPRETER_SAVE_REGISTERS() \
+    do { \
+        currentStackFrame->m_ip = ip; \
+        currentStackFrame->m_operandStack.m_size = (int32_t)(stackTop - stackBase); \
+    } \
+    while (false)
+
+/* Safepoints
+ *
+ * The thread polls the safepoint on every backward branch and return, so that
+ * a loop or a chain of calls cannot hold up the collector for long. The
+ * instruction pointer saved in the stack frame identifies the stack map entry
+ * of the polling instruction. The stack frames are walked by the collector,
+ * therefore, the registers are reloaded after the thread resumes.
+ */
+#define ZEN_INTERPRETER_POLL_SAFEPOINT(position) \
+    do { \
+        if (zen_Safepoint_isRequested(safepoint)) { \
+            int32_t savedIp = ip; \
+            ip = (position); \
+            ZEN_INTERPRETER_SAVE_REGISTERS(); \
+            zen_Safepoint_block(safepoint); \
+            ip = savedIp; \
+        } \
+    } \
+    while (false)
+
+/* The write barrier must follow every store of a reference into an object.
+ * It dirties the card of the object, if the object belongs to the old
+ * generation, so that the next minor collection scans it.
+ */
+#define ZEN_INTERPRETER_WRITE_BARRIER(object) \
+    zen_CardTable_markObject(cardTable, (object))
+
+/* The pre-write barrier must precede every store of a reference into an
+ * object. While the old generation is marked concurrently, it logs the
+ * reference which is about to be overwritten, so that the marker traces every
+ * object which was reachable when the marking began.
+ */
+#define ZEN_INTERPRETER_PRE_WRITE_BARRIER(field) \
+    do { \
+        if (satbQueue->m_active) { \
+            zen_Object_t* previous = zen_Reference_load(field); \
+            if (previous != NULL) { \
+                zen_SatbQueue_enqueue(satbQueue, satbBuffer, previous); \
+            } \
+        } \
+    } \
+    while (false)
+
+/* The objects are allocated from the thread local allocation buffer. When it
+ * is exhausted, the memory manager refills it, which may trigger a garbage
+ * collection. Therefore, the registers are saved before the slow path, so that
+ * the collector sees the current operand stack.
+ */
+#define ZEN_INTERPRETER_ALLOCATE(result, size) \
+    do { \
+        result = (zen_Object_t*)zen_AllocationBuffer_allocate(allocationBuffer, size); \
+        if (result == NULL) { \
+            ZEN_INTERPRETER_SAVE_REGISTERS(); \
+            result = (zen_Object_t*)zen_MemoryManager_allocateFromBuffer( \
+                interpreter->m_memoryManager, allocationBuffer, size); \
+        } \
+    } \
+    while (false)
+
+/* Fetch
+ *
+ * A function which runs off the end of its instruction stream returns to its
+ * caller, as if a `return` instruction was encountered.
+ *
+ * Temporary fix. In reality, the return instruction should be provided.
+ */
+
+#ifdef ZEN_INTERPRETER_PREDECODE
+
+/* The records of the last byte, and the offset past the end, describe the
+ * `return` instruction. Therefore, the length of the instructions is not
+ * required.
+ */
+#define ZEN_INTERPRETER_LOAD_INSTRUCTION_LENGTH()
+
+#define ZEN_INTERPRETER_FETCH() \
+    (record = &decodedInstructions[ip++], record->m_byteCode)
+
+#else
+
+#define ZEN_INTERPRETER_LOAD_INSTRUCTION_LENGTH() \
+    instructionLength = currentStackFrame->m_instructionAttribute->m_instructionLength
+
+#define ZEN_INTERPRETER_FETCH() \
+    (((ip + 1) >= instructionLength)? ZEN_BYTE_CODE_RETURN : instructions[ip++])
+
+#endif
+
+/* Read */
+
+#define ZEN_INTERPRETER_READ_BYTE() \
+    (instructions[ip++])
+
+#define ZEN_INTERPRETER_READ_SHORT() \
+    (ip += 2, (uint16_t)((instructions[ip - 2] << 8) | instructions[ip - 1]))
+
+/* Operand
+ *
+ * When the instructions are decoded, the operand of the current instruction is
+ * read from its record. The instruction pointer still moves past the operand
+ * bytes.
+ */
+
+#ifdef ZEN_INTERPRETER_PREDECODE
+
+#define ZEN_INTERPRETER_READ_BYTE_OPERAND() \
+    (ip += 1, record->m_operand)
+
+#define ZEN_INTERPRETER_READ_SHORT_OPERAND() \
+    (ip += 2, record->m_operand)
+
+#else
+
+#define ZEN_INTERPRETER_READ_BYTE_OPERAND() ZEN_INTERPRETER_READ_BYTE()
+
+#define ZEN_INTERPRETER_READ_SHORT_OPERAND() ZEN_INTERPRETER_READ_SHORT()
+
+#endif
+
+/* Branch
+ *
+ * Transfers the control to the target of the branch instruction at the
+ * specified offset. The operand of a branch is relative to the first byte of
+ * the branch instruction. When the instructions are decoded, the absolute
+ * target is read from the record instead.
+ */
+
+#ifdef ZEN_INTERPRETER_PREDECODE
+
+#define ZEN_INTERPRETER_BRANCH_FROM(origin) \
+    do { \
+        int32_t branchOrigin = (origin); \
+        int32_t branchTarget = decodedInstructions[branchOrigin].m_target; \
+        if (branchTarget <= branchOrigin) { \
+            ZEN_INTERPRETER_POLL_SAFEPOINT(branchOrigin + 1); \
+            ip = branchTarget; \
+            ZEN_INTERPRETER_BACK_EDGE(); \
+        } \
+        else { \
+            ip = branchTarget; \
+        } \
+    } \
+    while (false)
+
+#else
+
+#define ZEN_INTERPRETER_BRANCH_FROM(origin) \
+    do { \
+        int32_t branchOrigin = (origin); \
+        int16_t offset = (int16_t)((instructions[branchOrigin + 1] << 8) | \
+            instructions[branchOrigin + 2]); \
+        if (offset <= 0) { \
+            ZEN_INTERPRETER_POLL_SAFEPOINT(branchOrigin + 1); \
+            ip = branchOrigin + offset; \
+            ZEN_INTERPRETER_BACK_EDGE(); \
+        } \
+        else { \
+            ip = branchOrigin + offset; \
+        } \
+    } \
+    while (false)
+
+#endif
+
+/* Transfers the control to the target of the current branch instruction. */
+#define ZEN_INTERPRETER_BRANCH() ZEN_INTERPRETER_BRANCH_FROM(ip - 1)
+
+/* Transfers the control to the specified offset, relative to the instruction
+ * at the specified origin. The switch instructions read their offsets from
+ * the tables that follow them.
+ */
+#define ZEN_INTERPRETER_BRANCH_BY(origin, offset) \
+    do { \
+        int32_t branchOrigin = (origin); \
+        int32_t branchOffset = (offset); \
+        if (branchOffset <= 0) { \
+            ZEN_INTERPRETER_POLL_SAFEPOINT(branchOrigin + 1); \
+            ip = branchOrigin + branchOffset; \
+            ZEN_INTERPRETER_BACK_EDGE(); \
+        } \
+        else { \
+            ip = branchOrigin + branchOffset; \
+        } \
+    } \
+    while (false)
+
+/* Operand Stack
+ *
+ * Every value occupies exactly one slot on the operand stack, irrespective of
+ * its type. The layout of the values is identical to the one used by the
+ * OperandStack class.
+ */
+
+#define ZEN_INTERPRETER_STACK_SIZE() ((int32_t)(stackTop - stackBase))
+
+#define ZEN_INTERPRETER_PUSH_INTEGER(value) ((stackTop++)->m_integer = (int32_t)(value))
+#define ZEN_INTERPRETER_PUSH_LONG(value) ((stackTop++)->m_long = (int64_t)(value))
+#define ZEN_INTERPRETER_PUSH_FLOAT(value) ((stackTop++)->m_float = (float)(value))
+#define ZEN_INTERPRETER_PUSH_DOUBLE(value) ((stackTop++)->m_double = (double)(value))
+#define ZEN_INTERPRETER_PUSH_REFERENCE(value) ((stackTop++)->m_reference = (uintptr_t)(value))
+
+#define ZEN_INTERPRETER_POP_INTEGER() ((--stackTop)->m_integer)
+#define ZEN_INTERPRETER_POP_LONG() ((--stackTop)->m_long)
+#define ZEN_INTERPRETER_POP_FLOAT() ((--stackTop)->m_float)
+#define ZEN_INTERPRETER_POP_DOUBLE() ((--stackTop)->m_double)
+#define ZEN_INTERPRETER_POP_REFERENCE() ((--stackTop)->m_reference)
+
+#define ZEN_INTERPRETER_PEEK_REFERENCE() (stackTop[-1].m_reference)
+
+/* Local Variable Array
+ *
+ * Every local variable occupies exactly one slot in the local variable array,
+ * irrespective of its type. The layout of the values is identical to the one
+ * used by the LocalVariableArray class.
+ */
+
+#define ZEN_INTERPRETER_GET_LOCAL_INTEGER(index) (locals[(index)].m_integer)
+#define ZEN_INTERPRETER_GET_LOCAL_LONG(index) (locals[(index)].m_long)
+#define ZEN_INTERPRETER_GET_LOCAL_FLOAT(index) (locals[(index)].m_float)
+#define ZEN_INTERPRETER_GET_LOCAL_DOUBLE(index) (locals[(index)].m_double)
+#define ZEN_INTERPRETER_GET_LOCAL_REFERENCE(index) (locals[(index)].m_reference)
+
+#define ZEN_INTERPRETER_SET_LOCAL_INTEGER(index, value) (locals[(index)].m_integer = (int32_t)(value))
+#define ZEN_INTERPRETER_SET_LOCAL_LONG(index, value) (locals[(index)].m_long = (int64_t)(value))
+#define ZEN_INTERPRETER_SET_LOCAL_FLOAT(index, value) (locals[(index)].m_float = (float)(value))
+#define ZEN_INTERPRETER_SET_LOCAL_DOUBLE(index, value) (locals[(index)].m_double = (double)(value))
+#define ZEN_INTERPRETER_SET_LOCAL_REFERENCE(index, value) (locals[(index)].m_reference = (uintptr_t)(value))
+
 /*******************************************************************************
  * BootstrapClass                                                              *
  *******************************************************************************/
@@ -51,26 +581,30 @@ const uint8_t* ZEN_INTERPRETER_TAG = "com.onecube.zen.virtual-machine.processor.
 const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_INVALID_CAST_EXCEPTION = "zen.core.InvalidCastException";
 const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_DIVISION_BY_ZERO_EXCEPTION = "zen.core.DivisionByZeroException";
 const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_NULL_POINTER_EXCEPTION = "zen.core.NullPointerException";
+const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_INVALID_ARRAY_SIZE_EXCEPTION = "zen.core.InvalidArraySizeException";
+const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_INVALID_ARRAY_INDEX_EXCEPTION = "zen.core.InvalidArrayIndexException";
+const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_OUT_OF_MEMORY_ERROR = "zen.core.OutOfMemoryError";
+const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_CLASS_EXCEPTION = "zen.core.UnknownClassException";
+const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_FUNCTION_EXCEPTION = "zen.core.UnknownFunctionException";
+const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_FIELD_EXCEPTION = "zen.core.UnknownFieldException";
+const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_VERIFICATION_ERROR = "zen.core.VerificationError";
 
 /*******************************************************************************
  * Interpreter                                                                 *
  *******************************************************************************/
 
-xjtk_Logger_debug(void* logger, const uint8_t* tag, const uint8_t* message, ...) {
-}
-
 /* Constructor */
 
 zen_Interpreter_t* zen_Interpreter_new(zen_MemoryManager_t* manager,
     zen_VirtualMachine_t* virtualMachine, zen_ProcessorThread_t* processorThread) {
-    // jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
 
     zen_Interpreter_t* interpreter = jtk_Memory_allocate(zen_Interpreter_t, 1);
     interpreter->m_counter = -1;
-    interpreter->m_invocationStack = zen_InvocationStack_new();
     interpreter->m_processorThread = processorThread;
     interpreter->m_logger = NULL;
     interpreter->m_virtualMachine = virtualMachine;
+    interpreter->m_memoryManager = manager;
 
     return interpreter;
 }
@@ -80,14 +614,7 @@ zen_Interpreter_t* zen_Interpreter_new(zen_MemoryManager_t* manager,
 void zen_Interpreter_delete(zen_Interpreter_t* interpreter) {
     jtk_Assert_assertObject(interpreter, "The specified interpreter is null.");
 
-    jtk_Iterator_t* iterator = zen_InvocationStack_getIterator(interpreter->m_invocationStack);
-    while (jtk_Iterator_hasNext(iterator)) {
-        zen_StackFrame_t* stackFrame = (zen_StackFrame_t*)jtk_Iterator_getNext(iterator);
-        zen_StackFrame_delete(stackFrame);
-    }
-    jtk_Iterator_delete(iterator);
-
-    zen_InvocationStack_delete(interpreter->m_invocationStack);
+    /* The stack frames belong to the invocation stack of the processor thread. */
     jtk_Memory_deallocate(interpreter);
 }
 
@@ -127,191 +654,602 @@ bool zen_Interpreter_hasExceptionHandler(zen_Interpreter_t* interpreter, zen_Sta
     return false;
 }
 
+/* Allocate
+ *
+ * Objects are allocated from the allocation buffer of the current thread. On
+ * the fast path, the allocation is a pointer bump without any synchronization.
+ * The memory manager is consulted only when the buffer is exhausted.
+ */
+
+/* The sizes of the components of primitive arrays, indexed by
+ * `zen_PrimitiveType_t`.
+ */
+static const int32_t zen_Interpreter_componentSizes[] = {
+    1, /* ZEN_PRIMITIVE_TYPE_BOOLEAN */
+    2, /* ZEN_PRIMITIVE_TYPE_CHARACTER */
+    1, /* ZEN_PRIMITIVE_TYPE_INTEGER_8 */
+    2, /* ZEN_PRIMITIVE_TYPE_INTEGER_16 */
+    4, /* ZEN_PRIMITIVE_TYPE_INTEGER_32 */
+    8, /* ZEN_PRIMITIVE_TYPE_INTEGER_64 */
+    4, /* ZEN_PRIMITIVE_TYPE_DECIMAL_32 */
+    8  /* ZEN_PRIMITIVE_TYPE_DECIMAL_64 */
+};
+
+/* Resolve
+ *
+ * The constant pool entries are resolved lazily, when an instruction refers to
+ * them for the first time. The result is recorded in the side table of the
+ * class which owns the constant pool. Thereafter, resolving the same entry
+ * costs a load and a null check, instead of allocating the name and the
+ * descriptor and looking them up in a hash map.
+ *
+ * An entry which cannot be resolved is not recorded. The instruction which
+ * refers to it throws a linkage exception, and the entry is resolved again
+ * when the instruction is executed the next time.
+ */
+
+zen_Class_t* zen_Interpreter_resolveClass(zen_Interpreter_t* interpreter,
+    zen_Class_t* class0, uint16_t index) {
+    zen_Class_t* result = (zen_Class_t*)class0->m_resolvedEntries[index];
+    if (result == NULL) {
+        zen_ConstantPool_t* constantPool = class0->m_entityFile->m_constantPool;
+        zen_ConstantPoolClass_t* classEntry =
+            (zen_ConstantPoolClass_t*)constantPool->m_entries[index];
+        zen_ConstantPoolUtf8_t* nameEntry = (zen_ConstantPoolUtf8_t*)constantPool->m_entries[classEntry->m_nameIndex];
+
+        /* More often than not, a class refers to itself. */
+        if (jtk_CString_equals(nameEntry->m_bytes, nameEntry->m_length,
+            class0->m_descriptor->m_value, class0->m_descriptor->m_size)) {
+            result = class0;
+        }
+        else {
+            jtk_CString_t* descriptor = jtk_CString_newEx(nameEntry->m_bytes, nameEntry->m_length);
+            result = zen_VirtualMachine_getClass(interpreter->m_virtualMachine, descriptor->m_value);
+            jtk_CString_delete(descriptor);
+        }
+
+        if (result != NULL) {
+            class0->m_resolvedEntries[index] = result;
+        }
+    }
+    return result;
+}
+
+/* The string constants are interned, so that the equal constants of all the
+ * classes share one immortal string. The bytes of the constant pool are hashed
+ * in place, and copied only if the string was not interned before.
+ */
+zen_Object_t* zen_Interpreter_resolveString(zen_Interpreter_t* interpreter,
+    zen_Class_t* class0, uint16_t index) {
+    zen_Object_t* result = (zen_Object_t*)class0->m_resolvedEntries[index];
+    if (result == NULL) {
+        zen_ConstantPool_t* constantPool = class0->m_entityFile->m_constantPool;
+        zen_ConstantPoolString_t* stringEntry =
+            (zen_ConstantPoolString_t*)constantPool->m_entries[index];
+        zen_ConstantPoolUtf8_t* utf8Entry =
+            (zen_ConstantPoolUtf8_t*)constantPool->m_entries[stringEntry->m_stringIndex];
+
+        result = (zen_Object_t*)zen_StringTable_intern(
+            interpreter->m_virtualMachine->m_stringTable, utf8Entry->m_bytes,
+            utf8Entry->m_length);
+
+        class0->m_resolvedEntries[index] = result;
+    }
+    return result;
+}
+
+/* The function is searched only in the class that the function entry refers
+ * to. A function of the current class with the same name and descriptor does
+ * not shadow it.
+ */
+zen_Function_t* zen_Interpreter_resolveFunction(zen_Interpreter_t* interpreter,
+    zen_Class_t* class0, uint16_t index, bool instance) {
+    zen_Function_t* result = (zen_Function_t*)class0->m_resolvedEntries[index];
+    if (result == NULL) {
+        zen_ConstantPool_t* constantPool = class0->m_entityFile->m_constantPool;
+        zen_ConstantPoolFunction_t* functionEntry =
+            (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
+        zen_ConstantPoolUtf8_t* nameEntry = (zen_ConstantPoolUtf8_t*)constantPool->m_entries[functionEntry->m_nameIndex];
+        zen_ConstantPoolUtf8_t* descriptorEntry = (zen_ConstantPoolUtf8_t*)constantPool->m_entries[functionEntry->m_descriptorIndex];
+
+        zen_Class_t* targetClass = zen_Interpreter_resolveClass(interpreter,
+            class0, functionEntry->m_classIndex);
+        if (targetClass != NULL) {
+            jtk_CString_t* name = jtk_CString_newEx(nameEntry->m_bytes, nameEntry->m_length);
+            jtk_CString_t* descriptor = jtk_CString_newEx(descriptorEntry->m_bytes, descriptorEntry->m_length);
+
+            result = instance?
+                zen_Class_getInstanceFunction(targetClass, name, descriptor) :
+                zen_Class_getStaticFunction(targetClass, name, descriptor);
+
+            jtk_CString_delete(name);
+            jtk_CString_delete(descriptor);
+        }
+
+        if (result != NULL) {
+            class0->m_resolvedEntries[index] = result;
+        }
+    }
+    return result;
+}
+
+zen_Field_t* zen_Interpreter_resolveField(zen_Interpreter_t* interpreter,
+    zen_Class_t* class0, uint16_t index) {
+    zen_Field_t* result = (zen_Field_t*)class0->m_resolvedEntries[index];
+    if (result == NULL) {
+        zen_ConstantPool_t* constantPool = class0->m_entityFile->m_constantPool;
+        zen_ConstantPoolField_t* fieldEntry =
+            (zen_ConstantPoolField_t*)constantPool->m_entries[index];
+        zen_ConstantPoolUtf8_t* nameEntry = (zen_ConstantPoolUtf8_t*)constantPool->m_entries[fieldEntry->m_nameIndex];
+
+        zen_Class_t* targetClass = zen_Interpreter_resolveClass(interpreter,
+            class0, fieldEntry->m_classIndex);
+        if (targetClass != NULL) {
+            jtk_CString_t* name = jtk_CString_newEx(nameEntry->m_bytes, nameEntry->m_length);
+            result = zen_Class_getField(targetClass, name);
+            jtk_CString_delete(name);
+        }
+
+        if (result != NULL) {
+            class0->m_resolvedEntries[index] = result;
+        }
+    }
+    return result;
+}
+
+/* Dispatch Virtual Function
+ *
+ * Find the override of the specified function in the class of the receiver.
+ * This is the slow path of the `invoke_virtual` instruction, which is taken
+ * when the inline cache misses. The override is loaded from the virtual
+ * function table, or the interface table, of the class at the index which
+ * was assigned to the function when its class was linked.
+ */
+zen_Function_t* zen_Interpreter_dispatchVirtualFunction(zen_Interpreter_t* interpreter,
+    zen_Function_t* function, zen_Class_t* objectClass) {
+    zen_Function_t* result = function;
+    if ((objectClass != NULL) && (objectClass != function->m_class)) {
+        result = zen_Class_dispatch(objectClass, function);
+    }
+    return result;
+}
+
 /* Interpret */
 
 void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
     jtk_Assert_assertObject(interpreter, "The specified interpreter is null.");
 
-    zen_StackFrame_t* currentStackFrame = zen_InvocationStack_peekStackFrame(interpreter->m_invocationStack);
+#ifdef ZEN_INTERPRETER_THREADED_DISPATCH
+    /* The handler table is indexed by byte codes, exactly like
+     * zen_Instruction_instructions. The superinstructions follow the
+     * instruction set. Byte codes without a handler are dispatched to the
+     * unknown instruction handler.
+     */
+    static const void* dispatchTable[256] = {
+        [0 ... 255] = &&zen_Interpreter_handleUnknown,
+
+        [ZEN_BYTE_CODE_NOP] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_NOP),
+        [ZEN_BYTE_CODE_ADD_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_ADD_I),
+        [ZEN_BYTE_CODE_ADD_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_ADD_L),
+        [ZEN_BYTE_CODE_ADD_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_ADD_F),
+        [ZEN_BYTE_CODE_ADD_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_ADD_D),
+        [ZEN_BYTE_CODE_AND_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_AND_I),
+        [ZEN_BYTE_CODE_AND_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_AND_L),
+        [ZEN_BYTE_CODE_OR_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_OR_I),
+        [ZEN_BYTE_CODE_OR_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_OR_L),
+        [ZEN_BYTE_CODE_SHIFT_LEFT_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SHIFT_LEFT_I),
+        [ZEN_BYTE_CODE_SHIFT_LEFT_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SHIFT_LEFT_L),
+        [ZEN_BYTE_CODE_SHIFT_RIGHT_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SHIFT_RIGHT_I),
+        [ZEN_BYTE_CODE_SHIFT_RIGHT_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SHIFT_RIGHT_L),
+        [ZEN_BYTE_CODE_SHIFT_RIGHT_UI] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SHIFT_RIGHT_UI),
+        [ZEN_BYTE_CODE_SHIFT_RIGHT_UL] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SHIFT_RIGHT_UL),
+        [ZEN_BYTE_CODE_XOR_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_XOR_I),
+        [ZEN_BYTE_CODE_XOR_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_XOR_L),
+        [ZEN_BYTE_CODE_CAST_ITL] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_ITL),
+        [ZEN_BYTE_CODE_CAST_ITF] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_ITF),
+        [ZEN_BYTE_CODE_CAST_ITD] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_ITD),
+        [ZEN_BYTE_CODE_CAST_LTI] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_LTI),
+        [ZEN_BYTE_CODE_CAST_LTF] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_LTF),
+        [ZEN_BYTE_CODE_CAST_LTD] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_LTD),
+        [ZEN_BYTE_CODE_CAST_FTI] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_FTI),
+        [ZEN_BYTE_CODE_CAST_FTL] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_FTL),
+        [ZEN_BYTE_CODE_CAST_FTD] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_FTD),
+        [ZEN_BYTE_CODE_CAST_DTI] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_DTI),
+        [ZEN_BYTE_CODE_CAST_DTL] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_DTL),
+        [ZEN_BYTE_CODE_CAST_DTF] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_DTF),
+        [ZEN_BYTE_CODE_CAST_ITB] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_ITB),
+        [ZEN_BYTE_CODE_CAST_ITC] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_ITC),
+        [ZEN_BYTE_CODE_CAST_ITS] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CAST_ITS),
+        [ZEN_BYTE_CODE_CHECK_CAST] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_CHECK_CAST),
+        [ZEN_BYTE_CODE_COMPARE_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_COMPARE_L),
+        [ZEN_BYTE_CODE_COMPARE_LT_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_COMPARE_LT_F),
+        [ZEN_BYTE_CODE_COMPARE_GT_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_COMPARE_GT_F),
+        [ZEN_BYTE_CODE_COMPARE_LT_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_COMPARE_LT_D),
+        [ZEN_BYTE_CODE_COMPARE_GT_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_COMPARE_GT_D),
+        [ZEN_BYTE_CODE_DIVIDE_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DIVIDE_I),
+        [ZEN_BYTE_CODE_DIVIDE_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DIVIDE_L),
+        [ZEN_BYTE_CODE_DIVIDE_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DIVIDE_F),
+        [ZEN_BYTE_CODE_DIVIDE_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DIVIDE_D),
+        [ZEN_BYTE_CODE_DUPLICATE] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DUPLICATE),
+        [ZEN_BYTE_CODE_DUPLICATE_X1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DUPLICATE_X1),
+        [ZEN_BYTE_CODE_DUPLICATE_X2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DUPLICATE_X2),
+        [ZEN_BYTE_CODE_DUPLICATE2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DUPLICATE2),
+        [ZEN_BYTE_CODE_DUPLICATE2_X1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DUPLICATE2_X1),
+        [ZEN_BYTE_CODE_DUPLICATE2_X2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_DUPLICATE2_X2),
+        [ZEN_BYTE_CODE_JUMP_EQ0_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_EQ0_I),
+        [ZEN_BYTE_CODE_JUMP_NE0_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_NE0_I),
+        [ZEN_BYTE_CODE_JUMP_LT0_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_LT0_I),
+        [ZEN_BYTE_CODE_JUMP_GT0_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_GT0_I),
+        [ZEN_BYTE_CODE_JUMP_LE0_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_LE0_I),
+        [ZEN_BYTE_CODE_JUMP_GE0_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_GE0_I),
+        [ZEN_BYTE_CODE_JUMP_EQ_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_EQ_I),
+        [ZEN_BYTE_CODE_JUMP_NE_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_NE_I),
+        [ZEN_BYTE_CODE_JUMP_LT_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_LT_I),
+        [ZEN_BYTE_CODE_JUMP_GT_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_GT_I),
+        [ZEN_BYTE_CODE_JUMP_LE_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_LE_I),
+        [ZEN_BYTE_CODE_JUMP_GE_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_GE_I),
+        [ZEN_BYTE_CODE_JUMP_EQ_A] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_EQ_A),
+        [ZEN_BYTE_CODE_JUMP_NE_A] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_NE_A),
+        [ZEN_BYTE_CODE_JUMP_EQN_A] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_EQN_A),
+        [ZEN_BYTE_CODE_JUMP_NEN_A] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP_NEN_A),
+        [ZEN_BYTE_CODE_INCREMENT_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_INCREMENT_I),
+        [ZEN_BYTE_CODE_INVOKE_SPECIAL] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_INVOKE_SPECIAL),
+        [ZEN_BYTE_CODE_INVOKE_VIRTUAL] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_INVOKE_VIRTUAL),
+        [ZEN_BYTE_CODE_INVOKE_DYNAMIC] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_INVOKE_DYNAMIC),
+        [ZEN_BYTE_CODE_INVOKE_STATIC] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_INVOKE_STATIC),
+        [ZEN_BYTE_CODE_JUMP] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_JUMP),
+        [ZEN_BYTE_CODE_LOAD_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_I),
+        [ZEN_BYTE_CODE_LOAD_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_L),
+        [ZEN_BYTE_CODE_LOAD_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_F),
+        [ZEN_BYTE_CODE_LOAD_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_D),
+        [ZEN_BYTE_CODE_LOAD_A] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_A),
+        [ZEN_BYTE_CODE_LOAD_I0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_I0),
+        [ZEN_BYTE_CODE_LOAD_I1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_I1),
+        [ZEN_BYTE_CODE_LOAD_I2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_I2),
+        [ZEN_BYTE_CODE_LOAD_I3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_I3),
+        [ZEN_BYTE_CODE_LOAD_L0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_L0),
+        [ZEN_BYTE_CODE_LOAD_L1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_L1),
+        [ZEN_BYTE_CODE_LOAD_L2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_L2),
+        [ZEN_BYTE_CODE_LOAD_L3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_L3),
+        [ZEN_BYTE_CODE_LOAD_F0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_F0),
+        [ZEN_BYTE_CODE_LOAD_F1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_F1),
+        [ZEN_BYTE_CODE_LOAD_F2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_F2),
+        [ZEN_BYTE_CODE_LOAD_F3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_F3),
+        [ZEN_BYTE_CODE_LOAD_D0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_D0),
+        [ZEN_BYTE_CODE_LOAD_D1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_D1),
+        [ZEN_BYTE_CODE_LOAD_D2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_D2),
+        [ZEN_BYTE_CODE_LOAD_D3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_D3),
+        [ZEN_BYTE_CODE_LOAD_A0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_A0),
+        [ZEN_BYTE_CODE_LOAD_A1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_A1),
+        [ZEN_BYTE_CODE_LOAD_A2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_A2),
+        [ZEN_BYTE_CODE_LOAD_A3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_A3),
+        [ZEN_BYTE_CODE_LOAD_AB] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_AB),
+        [ZEN_BYTE_CODE_LOAD_AC] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_AC),
+        [ZEN_BYTE_CODE_LOAD_AS] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_AS),
+        [ZEN_BYTE_CODE_LOAD_AI] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_AI),
+        [ZEN_BYTE_CODE_LOAD_AL] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_AL),
+        [ZEN_BYTE_CODE_LOAD_AF] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_AF),
+        [ZEN_BYTE_CODE_LOAD_AD] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_AD),
+        [ZEN_BYTE_CODE_LOAD_AA] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_AA),
+        [ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD),
+        [ZEN_BYTE_CODE_LOAD_STATIC_FIELD] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_STATIC_FIELD),
+        [ZEN_BYTE_CODE_LOAD_CPR] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_CPR),
+        [ZEN_BYTE_CODE_LOAD_ARRAY_SIZE] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_LOAD_ARRAY_SIZE),
+        [ZEN_BYTE_CODE_MODULO_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_MODULO_I),
+        [ZEN_BYTE_CODE_MODULO_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_MODULO_L),
+        [ZEN_BYTE_CODE_MODULO_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_MODULO_F),
+        [ZEN_BYTE_CODE_MODULO_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_MODULO_D),
+        [ZEN_BYTE_CODE_MULTIPLY_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_MULTIPLY_I),
+        [ZEN_BYTE_CODE_MULTIPLY_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_MULTIPLY_L),
+        [ZEN_BYTE_CODE_MULTIPLY_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_MULTIPLY_F),
+        [ZEN_BYTE_CODE_MULTIPLY_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_MULTIPLY_D),
+        [ZEN_BYTE_CODE_NEGATE_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_NEGATE_I),
+        [ZEN_BYTE_CODE_NEGATE_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_NEGATE_L),
+        [ZEN_BYTE_CODE_NEGATE_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_NEGATE_F),
+        [ZEN_BYTE_CODE_NEGATE_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_NEGATE_D),
+        [ZEN_BYTE_CODE_NEW] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_NEW),
+        [ZEN_BYTE_CODE_NEW_ARRAY] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_NEW_ARRAY),
+        [ZEN_BYTE_CODE_NEW_ARRAY_A] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_NEW_ARRAY_A),
+        [ZEN_BYTE_CODE_NEW_ARRAY_AN] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_NEW_ARRAY_AN),
+        [ZEN_BYTE_CODE_POP] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_POP),
+        [ZEN_BYTE_CODE_POP2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_POP2),
+        [ZEN_BYTE_CODE_PUSH_NULL] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_NULL),
+        [ZEN_BYTE_CODE_PUSH_IN1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_IN1),
+        [ZEN_BYTE_CODE_PUSH_I0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_I0),
+        [ZEN_BYTE_CODE_PUSH_I1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_I1),
+        [ZEN_BYTE_CODE_PUSH_I2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_I2),
+        [ZEN_BYTE_CODE_PUSH_I3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_I3),
+        [ZEN_BYTE_CODE_PUSH_I4] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_I4),
+        [ZEN_BYTE_CODE_PUSH_I5] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_I5),
+        [ZEN_BYTE_CODE_PUSH_L0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_L0),
+        [ZEN_BYTE_CODE_PUSH_L1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_L1),
+        [ZEN_BYTE_CODE_PUSH_L2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_L2),
+        [ZEN_BYTE_CODE_PUSH_F0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_F0),
+        [ZEN_BYTE_CODE_PUSH_F1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_F1),
+        [ZEN_BYTE_CODE_PUSH_F2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_F2),
+        [ZEN_BYTE_CODE_PUSH_D0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_D0),
+        [ZEN_BYTE_CODE_PUSH_D1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_D1),
+        [ZEN_BYTE_CODE_PUSH_D2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_D2),
+        [ZEN_BYTE_CODE_PUSH_B] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_B),
+        [ZEN_BYTE_CODE_PUSH_S] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_PUSH_S),
+        [ZEN_BYTE_CODE_RETURN] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_RETURN),
+        [ZEN_BYTE_CODE_RETURN_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_RETURN_I),
+        [ZEN_BYTE_CODE_RETURN_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_RETURN_L),
+        [ZEN_BYTE_CODE_RETURN_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_RETURN_F),
+        [ZEN_BYTE_CODE_RETURN_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_RETURN_D),
+        [ZEN_BYTE_CODE_RETURN_A] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_RETURN_A),
+        [ZEN_BYTE_CODE_RTTI] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_RTTI),
+        [ZEN_BYTE_CODE_STORE_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_I),
+        [ZEN_BYTE_CODE_STORE_I0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_I0),
+        [ZEN_BYTE_CODE_STORE_I1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_I1),
+        [ZEN_BYTE_CODE_STORE_I2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_I2),
+        [ZEN_BYTE_CODE_STORE_I3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_I3),
+        [ZEN_BYTE_CODE_STORE_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_L),
+        [ZEN_BYTE_CODE_STORE_L0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_L0),
+        [ZEN_BYTE_CODE_STORE_L1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_L1),
+        [ZEN_BYTE_CODE_STORE_L2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_L2),
+        [ZEN_BYTE_CODE_STORE_L3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_L3),
+        [ZEN_BYTE_CODE_STORE_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_F),
+        [ZEN_BYTE_CODE_STORE_F0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_F0),
+        [ZEN_BYTE_CODE_STORE_F1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_F1),
+        [ZEN_BYTE_CODE_STORE_F2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_F2),
+        [ZEN_BYTE_CODE_STORE_F3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_F3),
+        [ZEN_BYTE_CODE_STORE_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_D),
+        [ZEN_BYTE_CODE_STORE_D0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_D0),
+        [ZEN_BYTE_CODE_STORE_D1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_D1),
+        [ZEN_BYTE_CODE_STORE_D2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_D2),
+        [ZEN_BYTE_CODE_STORE_D3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_D3),
+        [ZEN_BYTE_CODE_STORE_A] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_A),
+        [ZEN_BYTE_CODE_STORE_A0] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_A0),
+        [ZEN_BYTE_CODE_STORE_A1] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_A1),
+        [ZEN_BYTE_CODE_STORE_A2] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_A2),
+        [ZEN_BYTE_CODE_STORE_A3] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_A3),
+        [ZEN_BYTE_CODE_STORE_AB] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_AB),
+        [ZEN_BYTE_CODE_STORE_AC] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_AC),
+        [ZEN_BYTE_CODE_STORE_AS] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_AS),
+        [ZEN_BYTE_CODE_STORE_AI] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_AI),
+        [ZEN_BYTE_CODE_STORE_AL] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_AL),
+        [ZEN_BYTE_CODE_STORE_AF] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_AF),
+        [ZEN_BYTE_CODE_STORE_AD] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_AD),
+        [ZEN_BYTE_CODE_STORE_AA] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_AA),
+        [ZEN_BYTE_CODE_STORE_STATIC_FIELD] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_STATIC_FIELD),
+        [ZEN_BYTE_CODE_STORE_INSTANCE_FIELD] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_STORE_INSTANCE_FIELD),
+        [ZEN_BYTE_CODE_SUBTRACT_I] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SUBTRACT_I),
+        [ZEN_BYTE_CODE_SUBTRACT_L] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SUBTRACT_L),
+        [ZEN_BYTE_CODE_SUBTRACT_F] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SUBTRACT_F),
+        [ZEN_BYTE_CODE_SUBTRACT_D] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SUBTRACT_D),
+        [ZEN_BYTE_CODE_SWAP] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SWAP),
+        [ZEN_BYTE_CODE_SWITCH_TABLE] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SWITCH_TABLE),
+        [ZEN_BYTE_CODE_SWITCH_SEARCH] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_SWITCH_SEARCH),
+        [ZEN_BYTE_CODE_THROW] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_THROW),
+        [ZEN_BYTE_CODE_WIDE] = &&ZEN_INTERPRETER_LABEL(ZEN_BYTE_CODE_WIDE),
+
+        [ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I] = &&ZEN_INTERPRETER_LABEL(ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I),
+        [ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_ADD_I_STORE_I] = &&ZEN_INTERPRETER_LABEL(ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_ADD_I_STORE_I),
+        [ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_JUMP_LT_I] = &&ZEN_INTERPRETER_LABEL(ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_JUMP_LT_I),
+        [ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_ADD_I_STORE_I] = &&ZEN_INTERPRETER_LABEL(ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_ADD_I_STORE_I),
+        [ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_JUMP_LT_I] = &&ZEN_INTERPRETER_LABEL(ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_JUMP_LT_I),
+        [ZEN_SUPERINSTRUCTION_LOAD_A_LOAD_A] = &&ZEN_INTERPRETER_LABEL(ZEN_SUPERINSTRUCTION_LOAD_A_LOAD_A),
+    };
+#endif
+
+    zen_InvocationStack_t* invocationStack = interpreter->m_processorThread->m_invocationStack;
+    zen_StackFrame_t* currentStackFrame = zen_InvocationStack_peekStackFrame(invocationStack);
+    /* The functions invoked by the current function are interpreted in the same
+     * loop. The loop terminates when the stack frame, on which the loop was
+     * entered, returns.
+     */
+    zen_StackFrame_t* entryStackFrame = currentStackFrame;
     uint32_t flags = 0;
-    while (true) {
-        // TODO: Check if the instruction stream is exhausted.
-        zen_InstructionAttribute_t* instructionAttribute = currentStackFrame->m_instructionAttribute;
-
-        // Temporary fix. In reality, the return instruction should be provided. */
-        if ((currentStackFrame->m_ip + 1) >= instructionAttribute->m_instructionLength) {
-            break;
-        }
-
+    /* The exception which is being thrown, while the stack frames are searched
+     * for its handler.
+     */
+    zen_Object_t* exception = NULL;
+    interpreter->m_processorThread->m_exception = NULL;
+    uint8_t instruction;
+
+    /* Registers */
+    uint8_t* instructions;
+#ifndef ZEN_INTERPRETER_PREDECODE
+    int32_t instructionLength;
+#endif
+    int32_t ip;
+    zen_Slot_t* stackBase;
+    zen_Slot_t* stackTop;
+    zen_Slot_t* locals;
+#ifdef ZEN_INTERPRETER_PREDECODE
+    zen_DecodedInstruction_t* decodedInstructions;
+    /* The record of the current instruction. */
+    zen_DecodedInstruction_t* record;
+#endif
+
+    zen_AllocationBuffer_t* allocationBuffer = interpreter->m_processorThread->m_allocationBuffer;
+    zen_CardTable_t* cardTable = interpreter->m_memoryManager->m_oldGeneration->m_cardTable;
+    zen_SatbQueue_t* satbQueue = interpreter->m_memoryManager->m_concurrentMarker->m_satbQueue;
+    zen_SatbBuffer_t* satbBuffer = interpreter->m_processorThread->m_satbBuffer;
+    zen_Safepoint_t* safepoint = interpreter->m_processorThread->m_safepoint;
+
+#ifdef ZEN_INTERPRETER_TRACE
+    zen_InterpreterTrace_t* trace = interpreter->m_processorThread->m_trace;
+#endif
+#ifdef ZEN_INTERPRETER_PROFILE
+    zen_InstructionProfiler_t* profiler = interpreter->m_processorThread->m_profiler;
+#endif
+
+    ZEN_INTERPRETER_LOAD_REGISTERS();
+    ZEN_INTERPRETER_ENTER_FUNCTION();
 
-        uint8_t instruction = instructionAttribute->m_instructions[currentStackFrame->m_ip++];
+    while (true) {
+        instruction = ZEN_INTERPRETER_FETCH();
+        ZEN_INTERPRETER_TRACE_INSTRUCTION();
+        ZEN_INTERPRETER_PROFILE_INSTRUCTION();
 
         xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Fetched instruction... (instruction pointer = %d, instruction = 0x%X, function = %s -> %s)",
-            currentStackFrame->m_ip, instruction, zen_Interpreter_getCurrentFunctionName(interpreter),
+            ip, instruction, zen_Interpreter_getCurrentFunctionName(interpreter),
             zen_Interpreter_getCurrentClassName(interpreter));
 
         switch (instruction) {
 
             /* No Operation */
 
-            case ZEN_BYTE_CODE_NOP: { /* nop */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NOP): { /* nop */
                 /* Perform no operation. */
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `nop` (No operation was performed.)");
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Add */
 
-            case ZEN_BYTE_CODE_ADD_I: { /* add_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_ADD_I): { /* add_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Add the operands. Push the result on the operand stack. */
                 int32_t result = operand1 + operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `add_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_ADD_L: { /* add_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_ADD_L): { /* add_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Add the operands. Push the result on the operand stack. */
                 int64_t result = operand1 + operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `add_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_ADD_F: { /* add_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_ADD_F): { /* add_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Add the operands. Push the result on the operand stack. */
                 float result = operand1 + operand2;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `add_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_ADD_D: { /* add_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_ADD_D): { /* add_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Add the operands. Push the result on the operand stack. */
                 float result = operand1 + operand2;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `add_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Bitwise AND */
 
-            case ZEN_BYTE_CODE_AND_I: { /* and_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_AND_I): { /* and_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Perform bitwise AND on the operands. Push the result on the
                  * operand stack.
                  */
                 int32_t result = operand1 & operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `and_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_AND_L: { /* and_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_AND_L): { /* and_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Perform bitwise AND on the operands. Push the result on the
                  * operand stack.
                  */
                 int64_t result = operand1 & operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `and_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Bitwise OR */
 
-            case ZEN_BYTE_CODE_OR_I: { /* or_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_OR_I): { /* or_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Perform bitwise OR on the operands. Push the result on the
                  * operand stack.
                  */
                 int32_t result = operand1 | operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `or_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_OR_L: { /* or_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_OR_L): { /* or_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Perform bitwise OR on the operands. Push the result on the
                  * operand stack.
                  */
                 int64_t result = operand1 | operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `or_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Bitwise Shift */
 
-            case ZEN_BYTE_CODE_SHIFT_LEFT_I: { /* shift_left_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_LEFT_I): { /* shift_left_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Shift the least significant bit (LSB) of the first operand
                  * towards left, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -321,20 +1259,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int32_t result = operand1 << (operand2 & 0x1F);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `shift_left_l` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_LEFT_L: { /* shift_left_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_LEFT_L): { /* shift_left_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Shift the least significant bit (LSB) of the first operand
                  * towards left, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -344,20 +1282,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int64_t result = operand1 << (operand2 & 0x3FL);
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `shift_left_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_RIGHT_I: { /* shift_right_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_RIGHT_I): { /* shift_right_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Shift the most significant bit (MSB) of the first operand
                  * towards right, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -367,20 +1305,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int32_t result = operand1 >> (operand2 & 0x1F);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `shift_right_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_RIGHT_L: { /* shift_right_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_RIGHT_L): { /* shift_right_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Shift the most significant bit (MSB) of the first operand
                  * towards right, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -390,20 +1328,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int64_t result = operand1 >> (operand2 & 0x3FL);
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `shift_right_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_RIGHT_UI: { /* shift_right_ui */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_RIGHT_UI): { /* shift_right_ui */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                uint32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                uint32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Shift the most significant bit (MSB) of the first operand
                  * towards right, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -413,20 +1351,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int32_t result = operand1 >> (operand2 & 0x1F);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `shift_right_ui` (operand1 = %u, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_RIGHT_UL: { /* shift_right_ul */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_RIGHT_UL): { /* shift_right_ul */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                uint64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                uint64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Shift the most significant bit (MSB) of the first operand
                  * towards right, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -436,289 +1374,292 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int64_t result = operand1 >> (operand2 & 0x3FL);
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `shift_right_ul` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Bitwise XOR */
 
-            case ZEN_BYTE_CODE_XOR_I: { /* xor_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_XOR_I): { /* xor_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Perform bitwise XOR on the operands. Push the result on the
                  * operand stack.
                  */
                 int32_t result = operand1 ^ operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `xor_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_XOR_L: { /* xor_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_XOR_L): { /* xor_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Perform bitwise XOR on the operands. Push the result on the
                  * operand stack.
                  */
                 int64_t result = operand1 ^ operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `xor_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Cast */
 
-            case ZEN_BYTE_CODE_CAST_ITL: { /* cast_itl */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITL): { /* cast_itl */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 64-bit integer. Push
                  * the result on the operand stack.
                  */
                 int64_t result = (int64_t)operand;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_itl` (operand = %d, result = %l, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITF: { /* cast_itf */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITF): { /* cast_itf */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 32-bit decimal. Push
                  * the result on the operand stack.
                  */
                 float result = (float)operand;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_itf` (operand = %d, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITD: { /* cast_itd */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITD): { /* cast_itd */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 64-bit decimal. Push
                  * the result on the operand stack.
                  */
                 double result = (double)operand;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_itd` (operand = %d, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_LTI: { /* cast_lti */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_LTI): { /* cast_lti */
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Cast the operand from 64-bit integer to 32-bit integer. Push
                  * the result on the operand stack.
                  */
                 int32_t result = (int32_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_lti` (operand = %l, result = %i, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_LTF: { /* cast_ltf */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_LTF): { /* cast_ltf */
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Cast the operand from 64-bit integer to 32-bit decimal. Push
                  * the result on the operand stack.
                  */
                 float result = (float)operand;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_ltf` (operand = %l, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_LTD: { /* cast_ltd */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_LTD): { /* cast_ltd */
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Cast the operand from 64-bit integer to 64-bit decimal. Push
                  * the result on the operand stack.
                  */
                 double result = (double)operand;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_ltd` (operand = %l, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_FTI: { /* cast_fti */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_FTI): { /* cast_fti */
                 /* Retrieve the operand from the operand stack. */
-                float operand = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand = ZEN_INTERPRETER_POP_FLOAT();
                 /* Cast the operand from 32-bit decimal to 32-bit integer. Push
                  * the result on the operand stack.
                  */
                 int32_t result = (int32_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_fti` (operand = %f, result = %d, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_FTL: { /* cast_ftl */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_FTL): { /* cast_ftl */
                 /* Retrieve the operand from the operand stack. */
-                float operand = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand = ZEN_INTERPRETER_POP_FLOAT();
                 /* Cast the operand from 32-bit decimal to 64-bit integer. Push
                  * the result on the operand stack.
                  */
                 int64_t result = (int64_t)operand;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_ftl` (operand = %f, result = %l, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_FTD: { /* cast_ftd */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_FTD): { /* cast_ftd */
                 /* Retrieve the operand from the operand stack. */
-                float operand = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand = ZEN_INTERPRETER_POP_FLOAT();
                 /* Cast the operand from 32-bit decimal to 64-bit decimal. Push
                  * the result on the operand stack.
                  */
                 double result = (double)operand;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_ftd` (operand = %f, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_DTI: { /* cast_dti */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_DTI): { /* cast_dti */
                 /* Retrieve the operand from the operand stack. */
-                double operand = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Cast the operand from 64-bit decimal to 32-bit integer. Push
                  * the result on the operand stack.
                  */
                 int32_t result = (int32_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_dti` (operand = %f, result = %i, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_DTL: { /* cast_dtl */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_DTL): { /* cast_dtl */
                 /* Retrieve the operand from the operand stack. */
-                double operand = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Cast the operand from 64-bit decimal to 64-bit integer. Push
                  * the result on the operand stack.
                  */
                 int64_t result = (int64_t)operand;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_dtl` (operand = %f, result = %l, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_DTF: { /* cast_dtf */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_DTF): { /* cast_dtf */
                 /* Retrieve the operand from the operand stack. */
-                double operand = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Cast the operand from 64-bit decimal to 32-bit decimal. Push
                  * the result on the operand stack.
                  */
                 float result = (float)operand;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_dtf` (operand = %f, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITB: { /* cast_itb */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITB): { /* cast_itb */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 8-bit integer. Push
                  * the result on the operand stack.
                  */
                 int8_t result = (int8_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_itb` (operand = %d, result = %d, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITC: { /* cast_itc */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITC): { /* cast_itc */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITS: { /* cast_its */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITS): { /* cast_its */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 16-bit integer. Push
                  * the result on the operand stack.
                  */
                 int16_t result = (int16_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `cast_its` (operand = %d, result = %d, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Check Cast */
 
-            case ZEN_BYTE_CODE_CHECK_CAST: { /* check_cast */
-                uint16_t index = zen_Interpreter_readShort(interpreter);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CHECK_CAST): { /* check_cast */
+                /* The operand is the index of the target class. The cast is
+                 * not checked yet, therefore, the operand is skipped.
+                 */
+                ip += 2;
 /*
-                zen_Object_t* object = zen_OperandStack_peekReference(currentStackFrame->m_operandStack);
+                zen_Object_t* object = ZEN_INTERPRETER_PEEK_REFERENCE();
                 if (object != NULL) {
                     zen_Class_t* targetClass = NULL; //zen_ConstantPool_resolveClass(constantPool, function, index);
                     if (jtk_ProcessorThread_hasException(thread)) {
@@ -739,18 +1680,18 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 //xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `check_cast` (operand = 0x%X, result = 0x%X, operand stack = %d)",
-                //    object, object, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                //    object, object, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Compare */
 
-            case ZEN_BYTE_CODE_COMPARE_L: { /* compare_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_L): { /* compare_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -760,20 +1701,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  *    operand.
                  */
                 int32_t result = (operand1 > operand2)? 1 : ((operand1 == operand2)? 0 : -1);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `compare_l` (operand1 = %l, operand2 = %l, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_COMPARE_LT_F: { /* compare_lt_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_LT_F): { /* compare_lt_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -799,20 +1740,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     // jtk_Logger_error(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Control should not reach here!");
                 }
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `compare_lt_f` (operand1 = %f, operand2 = %f, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_COMPARE_GT_F: { /* compare_gt_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_GT_F): { /* compare_gt_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -838,20 +1779,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     // jtk_Logger_error(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Control should not reach here!");
                 }
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `compare_gt_f` (operand1 = %f, operand2 = %f, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_COMPARE_LT_D: { /* compare_lt_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_LT_D): { /* compare_lt_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -877,20 +1818,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     // jtk_Logger_error(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Control should not reach here!");
                 }
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `compare_lt_d` (operand1 = %f, operand2 = %f, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_COMPARE_GT_D: { /* compare_gt_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_GT_D): { /* compare_gt_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -916,188 +1857,222 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     // jtk_Logger_error(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Control should not reach here!");
                 }
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `compare_gt_f` (operand1 = %f, operand2 = %f, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Divide */
 
-            case ZEN_BYTE_CODE_DIVIDE_I: { /* divide_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DIVIDE_I): { /* divide_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand2 == 0) {
                     /* Throw an instance of the zen.core.DivisionByZeroException class. */
-                    zen_Object_t* exception = zen_Interpreter_makeException(interpreter,
+                    exception = zen_Interpreter_makeException(interpreter,
                         ZEN_BOOTSTRAP_CLASS_ZEN_CORE_DIVISION_BY_ZERO_EXCEPTION);
                     // jtk_ProcessorThread_setException(thread, exception);
 
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
                     goto exceptionHandler;
                 }
 
                 /* Divide the operands. Push the result on the operand stack. */
                 int32_t result = operand1 / operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `divide_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_DIVIDE_L: { /* divide_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DIVIDE_L): { /* divide_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
 
                 if (operand2 == 0L) {
                     /* Throw an instance of the zen.core.DivisionByZeroException class. */
-                    zen_Object_t* exception = zen_Interpreter_makeException(interpreter,
+                    exception = zen_Interpreter_makeException(interpreter,
                         ZEN_BOOTSTRAP_CLASS_ZEN_CORE_DIVISION_BY_ZERO_EXCEPTION);
                     // jtk_ProcessorThread_setException(thread, exception);
 
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
                     goto exceptionHandler;
                 }
 
                 /* Divide the operands. Push the result on the operand stack. */
                 int64_t result = operand1 / operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `divide_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_DIVIDE_F: { /* divide_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DIVIDE_F): { /* divide_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Divide the operands. Push the result on the operand stack. */
                 float result = operand1 / operand2;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `divide_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_DIVIDE_D: { /* divide_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DIVIDE_D): { /* divide_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Divide the operands. Push the result on the operand stack. */
                 double result = operand1 / operand2;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `divide_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Duplicate */
 
-            case ZEN_BYTE_CODE_DUPLICATE: { /* duplicate */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE): { /* duplicate */
                 /* Duplicate the operand on top of the stack. */
-                zen_OperandStack_duplicate(currentStackFrame->m_operandStack);
+                stackTop[0] = stackTop[-1];
+                stackTop++;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `duplicate` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE_X1: { /* duplicate_x1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE_X1): { /* duplicate_x1 */
                 /* Duplicate the operand on top of the stack and insert it beneath the second
                  * operand.
                  */
-                zen_OperandStack_duplicateX1(currentStackFrame->m_operandStack);
+                zen_Slot_t value1 = stackTop[-1];
+                zen_Slot_t value2 = stackTop[-2];
+                stackTop[-2] = value1;
+                stackTop[-1] = value2;
+                stackTop[0] = value1;
+                stackTop++;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `duplicate_x1` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE_X2: { /* duplicate_x2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE_X2): { /* duplicate_x2 */
                 /* Duplicate the operand on top of the stack and insert it beneath the third
                  * operand.
                  */
-                zen_OperandStack_duplicateX2(currentStackFrame->m_operandStack);
+                zen_Slot_t value1 = stackTop[-1];
+                zen_Slot_t value2 = stackTop[-2];
+                zen_Slot_t value3 = stackTop[-3];
+                stackTop[-3] = value1;
+                stackTop[-2] = value3;
+                stackTop[-1] = value2;
+                stackTop[0] = value1;
+                stackTop++;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `duplicate_x2` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE2: { /* duplicate2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE2): { /* duplicate2 */
                 /* Duplicate the second operand from the top of the operand stack. */
-                zen_OperandStack_duplicate2(currentStackFrame->m_operandStack);
+                stackTop[0] = stackTop[-2];
+                stackTop[1] = stackTop[-1];
+                stackTop += 2;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `duplicate2` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE2_X1: { /* duplicate2_x1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE2_X1): { /* duplicate2_x1 */
                 /* Duplicate the second operand from the top of the operand stack.
                  * Insert the duplicate beneath the third item.
                  */
-                zen_OperandStack_duplicate2X1(currentStackFrame->m_operandStack);
+                zen_Slot_t value1 = stackTop[-1];
+                zen_Slot_t value2 = stackTop[-2];
+                zen_Slot_t value3 = stackTop[-3];
+                stackTop[-3] = value2;
+                stackTop[-2] = value1;
+                stackTop[-1] = value3;
+                stackTop[0] = value2;
+                stackTop[1] = value1;
+                stackTop += 2;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `duplicate2_x1` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE2_X2: { /* duplicate2_x2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE2_X2): { /* duplicate2_x2 */
                 /* Duplicate the second operand from the top of the operand stack.
                  * Insert the duplicate beneath the fourth item.
                  */
-                zen_OperandStack_duplicate2X2(currentStackFrame->m_operandStack);
+                zen_Slot_t value1 = stackTop[-1];
+                zen_Slot_t value2 = stackTop[-2];
+                zen_Slot_t value3 = stackTop[-3];
+                zen_Slot_t value4 = stackTop[-4];
+                stackTop[-4] = value2;
+                stackTop[-3] = value1;
+                stackTop[-2] = value4;
+                stackTop[-1] = value3;
+                stackTop[0] = value2;
+                stackTop[1] = value1;
+                stackTop += 2;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `duplicate2_x2` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Jump */
 
-            case ZEN_BYTE_CODE_JUMP_EQ0_I: { /* jump_eq0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_EQ0_I): { /* jump_eq0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand == 0) {
-                    uint16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is %d, expected 0. Branch ignored.",
                         operand);
@@ -1106,20 +2081,19 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_eq0_i` (operand = %d, expected = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_NE0_I: { /* jump_ne0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_NE0_I): { /* jump_ne0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand != 0) {
-                    uint16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is %d, expected integer value other than 0. Branch ignored.",
                         operand);
@@ -1127,20 +2101,19 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_ne0_i` (operand = %d, expected != 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_LT0_I: { /* jump_lt0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_LT0_I): { /* jump_lt0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand < 0) {
-                    uint16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is %d, expected integer value lesser than 0. Branch ignored.",
                         operand);
@@ -1148,20 +2121,19 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_lt0_i` (operand = %d, expected < 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_GT0_I: { /* jump_gt0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_GT0_I): { /* jump_gt0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand > 0) {
-                    uint16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is %d, expected integer value greater than 0. Branch ignored.",
                         operand);
@@ -1169,20 +2141,19 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_gt0_i` (operand = %d, expected > 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_LE0_I: { /* jump_le0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_LE0_I): { /* jump_le0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand <= 0) {
-                    uint16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is %d, expected integer value lesser than or equal to 0. Branch ignored.",
                         operand);
@@ -1190,20 +2161,19 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_le0_i` (operand = %d, expected <= 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_GE0_I: { /* jump_ge0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_GE0_I): { /* jump_ge0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand >= 0) {
-                    uint16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is %d, expected integer value greater than or equal to 0. Branch ignored.",
                         operand);
@@ -1211,26 +2181,25 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_ge0_i` (operand = %d, expected >= 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_EQ_I: { /* jump_eq_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_EQ_I): { /* jump_eq_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 == operand2) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are equal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
-                        operand1, operand2, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are equal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, target = %d)",
+                        operand1, operand2, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are unequal. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1238,26 +2207,25 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_eq_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_NE_I: { /* jump_ne_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_NE_I): { /* jump_ne_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 != operand2) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are unequal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
-                        operand1, operand2, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are unequal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, target = %d)",
+                        operand1, operand2, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are equal. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1265,26 +2233,25 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_ne_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_LT_I: { /* jump_lt_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_LT_I): { /* jump_lt_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 < operand2) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is lesser than operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
-                        operand1, operand2, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is lesser than operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, target = %d)",
+                        operand1, operand2, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is not lesser than operand2. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1292,26 +2259,25 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_lt_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_GT_I: { /* jump_gt_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_GT_I): { /* jump_gt_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 > operand2) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is greater than operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
-                        operand1, operand2, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is greater than operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, target = %d)",
+                        operand1, operand2, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is not greater than operand2. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1319,26 +2285,25 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_gt_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_LE_I: { /* jump_le_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_LE_I): { /* jump_le_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 <= operand2) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is lesser than or equal to operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
-                        operand1, operand2, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is lesser than or equal to operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, target = %d)",
+                        operand1, operand2, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is not lesser than or equal to operand2. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1346,26 +2311,25 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_le_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_GE_I: { /* jump_ge_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_GE_I): { /* jump_ge_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 >= operand2) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is greater than or equal to operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
-                        operand1, operand2, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is greater than or equal to operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, target = %d)",
+                        operand1, operand2, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "operand1 is not greater than or equal to operand2. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1373,26 +2337,25 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_ge_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_EQ_A: { /* jump_eq_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_EQ_A): { /* jump_eq_a */
                 /* Retrieve the second operand from the operand stack. */
-                uintptr_t operand2 = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand2 = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Retrieve the first operand from the operand stack. */
-                uintptr_t operand1 = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand1 = ZEN_INTERPRETER_POP_REFERENCE();
 
                 if (operand1 == operand2) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are equal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = 0x%X, operand2 = 0x%X, offset = %d)",
-                        operand1, operand2, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are equal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = 0x%X, operand2 = 0x%X, target = %d)",
+                        operand1, operand2, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are unequal. Branch ignored. (operand1 = 0x%X, operand2 = 0x%X)",
                         operand1, operand2);
@@ -1400,26 +2363,25 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_eq_a` (operand1 = 0x%X, operand2 = 0x%X, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_NE_A: { /* jump_ne_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_NE_A): { /* jump_ne_a */
                 /* Retrieve the second operand from the operand stack. */
-                uintptr_t operand2 = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand2 = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Retrieve the first operand from the operand stack. */
-                uintptr_t operand1 = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand1 = ZEN_INTERPRETER_POP_REFERENCE();
 
                 if (operand1 != operand2) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are unequal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = 0x%X, operand2 = 0x%X, offset = %d)",
-                        operand1, operand2, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are unequal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = 0x%X, operand2 = 0x%X, target = %d)",
+                        operand1, operand2, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operands are equal. Branch ignored. (operand1 = 0x%X, operand2 = 0x%X)",
                         operand1, operand2);
@@ -1427,24 +2389,23 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_ne_a` (operand1 = 0x%X, operand2 = 0x%X, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_EQN_A: { /* jump_eqn_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_EQN_A): { /* jump_eqn_a */
                 /* Retrieve the first operand from the operand stack. */
-                uintptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
 
                 if (operand == ZEN_INTERPRETER_NULL_REFERENCE) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is equal to null. Branch acknowledged, program counter adjusted accordingly.  (operand = 0x%X, offset = %d)",
-                        operand, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is equal to null. Branch acknowledged, program counter adjusted accordingly.  (operand = 0x%X, target = %d)",
+                        operand, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is not equal to null. Branch ignored. (operand = 0x%X)",
                         operand);
@@ -1452,24 +2413,23 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_eqn_a` (operand = 0x%X, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_JUMP_NEN_A: { /* jump_nen_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_NEN_A): { /* jump_nen_a */
                 /* Retrieve the first operand from the operand stack. */
-                uintptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
 
                 if (operand != ZEN_INTERPRETER_NULL_REFERENCE) {
-                    int16_t offset = zen_Interpreter_readShort(interpreter);
-                    currentStackFrame->m_ip += offset - 3;
+                    ZEN_INTERPRETER_BRANCH();
 
-                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is not equal to null. Branch acknowledged, program counter adjusted accordingly.  (operand = 0x%X, offset = %d)",
-                        operand, offset);
+                    xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is not equal to null. Branch acknowledged, program counter adjusted accordingly.  (operand = 0x%X, target = %d)",
+                        operand, ip);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Operand is equal to null. Branch ignored. (operand = 0x%X)",
                         operand);
@@ -1477,284 +2437,326 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump_nen_a` (operand = 0x%X, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Increment */
 
-            case ZEN_BYTE_CODE_INCREMENT_I: { /* increment_i */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INCREMENT_I): { /* increment_i */
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Invoke */
 
-            case ZEN_BYTE_CODE_INVOKE_SPECIAL: { /* invoke_special */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INVOKE_SPECIAL): { /* invoke_special */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_INVOKE_VIRTUAL: { /* invoke_virtual */
-                uint16_t index = zen_Interpreter_readShort(interpreter);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INVOKE_VIRTUAL): { /* invoke_virtual */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT_OPERAND();
 
-                zen_Function_t* targetFunction = NULL; /*zen_ConstantPool_resolveFunctionObject(
-                    currentClass->m_constantPool, index);*/
+                zen_Class_t* currentClass = currentStackFrame->m_class;
+                zen_Function_t* function = zen_Interpreter_resolveFunction(interpreter,
+                    currentClass, index, true);
+
+                if (function != NULL) {
+                    /* The receiver lies beneath the arguments on the operand stack. */
+                    zen_Object_t* object = (zen_Object_t*)stackTop[
+                        -(function->m_parameterSlotCount + 1)].m_reference;
 
-                if (targetFunction != NULL) {
-                    zen_Class_t* targetClass = NULL; // zen_Function_getClass(function);
+                    if (object == NULL) {
+                        /* Throw an instance of the zen.core.NullPointerException class. */
+                        exception = zen_Interpreter_makeException(interpreter,
+                            ZEN_BOOTSTRAP_CLASS_ZEN_CORE_NULL_POINTER_EXCEPTION);
+
+                        ZEN_INTERPRETER_SAVE_REGISTERS();
+                        goto exceptionHandler;
+                    }
 
-                    zen_Object_t* object = (zen_Object_t*)zen_OperandStack_peekReference(currentStackFrame->m_operandStack);
                     zen_Class_t* objectClass = zen_Object_getClass(object);
 
-                    if (targetClass != objectClass) {
-                        const uint8_t* functionName = zen_Function_getName(targetFunction);
-                        const uint8_t* functionDescriptor = zen_Function_getDescriptor(targetFunction);
+                    /* In the steady state, a monomorphic call site costs a single
+                     * comparison of the receiver class.
+                     */
+                    zen_InlineCache_t* inlineCache = __atomic_load_n(
+                        &currentClass->m_inlineCaches[index], __ATOMIC_ACQUIRE);
+                    if (inlineCache == NULL) {
+                        /* Two threads may create the inline cache at once. The
+                         * cache published first is kept.
+                         */
+                        zen_InlineCache_t* expected = NULL;
+                        inlineCache = zen_InlineCache_new();
+                        if (!__atomic_compare_exchange_n(&currentClass->m_inlineCaches[index],
+                            &expected, inlineCache, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                            zen_InlineCache_delete(inlineCache);
+                            inlineCache = expected;
+                        }
+                    }
 
-                        /* TODO: The resolution of the virtual function should not fail. */
-                        targetFunction = zen_Class_getInstanceFunction(objectClass, functionName,
-                            functionDescriptor);
+                    zen_Function_t* targetFunction = zen_InlineCache_lookup(inlineCache, objectClass);
+                    if (targetFunction == NULL) {
+                        targetFunction = zen_Interpreter_dispatchVirtualFunction(interpreter,
+                            function, objectClass);
+                        zen_InlineCache_update(inlineCache, objectClass, targetFunction);
                     }
 
                     if (zen_Function_isNative(targetFunction)) {
-                        zen_Interpreter_invokeNativeFunction(interpreter, targetClass, targetFunction, currentStackFrame->m_operandStack);
+                        /* The native function runs in a safe region. Therefore, it
+                         * should not access the heap.
+                         */
+                        ZEN_INTERPRETER_SAVE_REGISTERS();
+                        zen_Safepoint_enterSafeRegion(safepoint);
+                        zen_Interpreter_invokeNativeFunction(interpreter, targetFunction->m_class,
+                            targetFunction, &currentStackFrame->m_operandStack);
+                        zen_Safepoint_leaveSafeRegion(safepoint);
+                        ZEN_INTERPRETER_LOAD_REGISTERS();
                     }
                     else {
-                        // currentFrame = ...;
-                        // code = ...;
-
+                        /* The receiver and the arguments on the operand stack of the
+                         * caller become the parameters of the callee in place.
+                         */
+                        ZEN_INTERPRETER_SAVE_REGISTERS();
+                        currentStackFrame = zen_InvocationStack_pushStackFrame(invocationStack,
+                            targetFunction, targetFunction->m_parameterSlotCount + 1);
+                        ZEN_INTERPRETER_LOAD_REGISTERS();
+                        ZEN_INTERPRETER_ENTER_FUNCTION();
                     }
                 }
                 else {
-                    /* TODO: Throw an instance of the UnknownFunctionException class. */
+                    /* Throw an instance of the zen.core.UnknownFunctionException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_FUNCTION_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
                 }
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_INVOKE_DYNAMIC: { /* invoke_dynamic */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INVOKE_DYNAMIC): { /* invoke_dynamic */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_INVOKE_STATIC: { /* invoke_static */
-                uint16_t index = zen_Interpreter_readShort(interpreter);
-
-                zen_EntityFile_t* entityFile = currentStackFrame->m_class->m_entityFile;
-                zen_ConstantPool_t* constantPool = entityFile->m_constantPool;
-                zen_ConstantPoolFunction_t* functionEntry =
-                    (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
-                zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[functionEntry->m_nameIndex];
-                zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[functionEntry->m_descriptorIndex];
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INVOKE_STATIC): { /* invoke_static */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT_OPERAND();
 
-                jtk_CString_t* name = jtk_CString_newEx(nameEntry->m_bytes, nameEntry->m_length);
-                jtk_CString_t* descriptor = jtk_CString_newEx(descriptorEntry->m_bytes, descriptorEntry->m_length);
-
-                zen_Function_t* function = zen_Class_getStaticFunction(currentStackFrame->m_class,
-                    name, descriptor);
-
-                jtk_CString_delete(name);
-                jtk_CString_delete(descriptor);
+                zen_Function_t* function = zen_Interpreter_resolveFunction(interpreter,
+                    currentStackFrame->m_class, index, false);
 
                 if (function != NULL) {
                     // zen_Interpreter_handleClassInitialization(interpreter, class0);
 
-                    void* argument1 = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-                    void* argument0 = !zen_OperandStack_isEmpty(currentStackFrame->m_operandStack)?
-                        zen_OperandStack_popReference(currentStackFrame->m_operandStack) : NULL;
+                    if (zen_Function_isNative(function)) {
+                        void* argument1 = (void*)ZEN_INTERPRETER_POP_REFERENCE();
+                        void* argument0 = (stackTop != stackBase)?
+                            (void*)ZEN_INTERPRETER_POP_REFERENCE() : NULL;
 
-                    jtk_Array_t* arguments = jtk_Array_new(2);
-                    jtk_Array_setValue(arguments, 0, argument0);
-                    jtk_Array_setValue(arguments, 1, argument1);
+                        jtk_Array_t* arguments = jtk_Array_new(2);
+                        jtk_Array_setValue(arguments, 0, argument0);
+                        jtk_Array_setValue(arguments, 1, argument1);
 
-                    zen_Interpreter_invokeStaticFunction(interpreter, function, arguments);
+                        /* The native function runs in a safe region. */
+                        ZEN_INTERPRETER_SAVE_REGISTERS();
+                        zen_Safepoint_enterSafeRegion(safepoint);
+                        zen_Interpreter_invokeStaticFunction(interpreter, function, arguments);
+                        zen_Safepoint_leaveSafeRegion(safepoint);
+                        ZEN_INTERPRETER_LOAD_REGISTERS();
 
-                    jtk_Array_delete(arguments);
+                        jtk_Array_delete(arguments);
+                    }
+                    else {
+                        /* The arguments on the operand stack of the caller become
+                         * the parameters of the callee in place. The callee is
+                         * interpreted in the current loop, without recursion.
+                         */
+                        ZEN_INTERPRETER_SAVE_REGISTERS();
+                        currentStackFrame = zen_InvocationStack_pushStackFrame(invocationStack,
+                            function, function->m_parameterSlotCount);
+                        ZEN_INTERPRETER_LOAD_REGISTERS();
+                        ZEN_INTERPRETER_ENTER_FUNCTION();
+                    }
                 }
                 else {
-                    /* TODO: Throw an instance of the UnknownFunctionException class. */
+                    /* Throw an instance of the zen.core.UnknownFunctionException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_FUNCTION_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
                 }
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Jump */
 
-            case ZEN_BYTE_CODE_JUMP: { /* jump */
-                int16_t offset = zen_Interpreter_readShort(interpreter);
-                currentStackFrame->m_ip += offset - 3;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP): { /* jump */
+                ZEN_INTERPRETER_BRANCH();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
-                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump` (offset = %d)",
-                    offset);
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `jump` (target = %d)",
+                    ip);
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Load */
 
-            case ZEN_BYTE_CODE_LOAD_I: { /* load_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I): { /* load_i */
                 /* Read the index of the local variable to load. */
-                uint8_t index = zen_Interpreter_readByte(interpreter);
+                uint8_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
 
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * the specified index.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_i` (index = %d, result = %d, operand stack = %d)",
-                    index, value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_L: { /* load_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L): { /* load_l */
                 /* Read the index of the local variable to load. */
-                int32_t index = zen_Interpreter_readByte(interpreter);
+                int32_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
 
-                /* Retrieve the 32-bit integer value stored in the local variable at
-                 * the specified index. It represents the low-part of the 64-bit
-                 * integer value.
-                 */
-                int32_t lowPart = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index);
-                /* Retrieve the 32-bit integer value stored in the local variable at
-                 * the specified index. It represents the high-part of the 64-bit
-                 * integer value.
+                /* Retrieve the 64-bit integer value stored in the local variable at
+                 * the specified index.
                  */
-                int32_t highPart = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index + 1);
-                /* Push the retrieved values on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, highPart);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, lowPart);
+                int64_t value = ZEN_INTERPRETER_GET_LOCAL_LONG(index);
+
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_LONG(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
-                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_l` (index = %d, high part = %d, low part = %d, operand stack = %d)",
-                    index, highPart, lowPart, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_l` (index = %d, result = %l, operand stack = %d)",
+                    index, value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F: { /* load_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F): { /* load_f */
                 /* Read the index of the local variable to load. */
-                int32_t index = zen_Interpreter_readByte(interpreter);
+                int32_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
 
                 /* Retrieve the bit pattern of the 32-bit decimal value stored
                  * in the local variable at the specified index.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index);
                 /* Push the retrieved bit pattern of the value on the operand
                  * stack.
                  */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_f` (index = %d, result = 0x%X, operand stack = %d)",
-                    index, value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D: { /* load_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D): { /* load_d */
                 /* Read the index of the local variable to load. */
-                int32_t index = zen_Interpreter_readByte(interpreter);
+                int32_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
 
-                /* Retrieve the 32-bit integer value stored in the local variable at
-                 * the specified index. It represents the low-part of the bit pattern
-                 * of the 64-bit decimal value.
-                 */
-                int32_t lowPart = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index);
-                /* Retrieve the 32-bit integer value stored in the local variable at
-                 * the specified index. It represents the high-part of the bit pattern
-                 * of the 64-bit decimal value.
+                /* Retrieve the 64-bit decimal value stored in the local variable at
+                 * the specified index.
                  */
-                int32_t highPart = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index + 1);
-                /* Push the retrieved values on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, highPart);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, lowPart);
+                double value = ZEN_INTERPRETER_GET_LOCAL_DOUBLE(index);
+
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
-                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_d` (index = %d, high part = 0x%X, low part = 0x%X, operand stack = %d)",
-                    index, highPart, lowPart, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_d` (index = %d, result = %f, operand stack = %d)",
+                    index, value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A: { /* load_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A): { /* load_a */
                 /* Read the index of the local variable to load. */
-                uint8_t index = zen_Interpreter_readByte(interpreter);
+                uint8_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
 
                 /* Retrieve the object reference stored in the local variable at
                  * the specified index.
                  */
-                intptr_t reference = zen_LocalVariableArray_getReference(currentStackFrame->m_localVariableArray, index);
+                intptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(index);
                 /* Push the retrieved reference on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_a` (index = %d, result = 0x%X, operand stack = %d)",
-                    index, reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, reference, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_I0: { /* load_i0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I0): { /* load_i0 */
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * index 0.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, 0);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_i0` (index = 0, result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_I1: { /* load_i1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I1): { /* load_i1 */
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * index 1.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, 1);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_i1` (index = 1, result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_I2: { /* load_i2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I2): { /* load_i2 */
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * index 2.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, 2);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_i2` (index = 2, result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_I3: { /* load_i3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I3): { /* load_i3 */
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * index 3.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, 3);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_i3` (index = 3, result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* When copying 64-bit integer values, the high and low parts can be retrieved
@@ -1771,292 +2773,394 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
              * and bring about consistency in the code.
              */
 
-            case ZEN_BYTE_CODE_LOAD_L0: { /* load_l0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L0): { /* load_l0 */
                 /* Retrieve the 64-bit integer value stored in the local variable at
                  * index 0.
                  */
-                int64_t value = zen_LocalVariableArray_getLong(currentStackFrame->m_localVariableArray, 0);
+                int64_t value = ZEN_INTERPRETER_GET_LOCAL_LONG(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_LONG(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_l0` (index = 0, result = %l, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_L1: { /* load_l1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L1): { /* load_l1 */
                 /* Retrieve the 64-bit integer value stored in the local variable at
                  * index 1.
                  */
-                int64_t value = zen_LocalVariableArray_getLong(currentStackFrame->m_localVariableArray, 1);
+                int64_t value = ZEN_INTERPRETER_GET_LOCAL_LONG(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_LONG(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_l1` (index = 1, result = %l, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_L2: { /* load_l2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L2): { /* load_l2 */
                 /* Retrieve the 64-bit integer value stored in the local variable at
                  * index 2.
                  */
-                int64_t value = zen_LocalVariableArray_getLong(currentStackFrame->m_localVariableArray, 2);
+                int64_t value = ZEN_INTERPRETER_GET_LOCAL_LONG(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_LONG(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_l2` (index = 2, result = %l, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_L3: { /* load_l3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L3): { /* load_l3 */
                 /* Retrieve the 64-bit integer value stored in the local variable at
                  * index 3.
                  */
-                int64_t value = zen_LocalVariableArray_getLong(currentStackFrame->m_localVariableArray, 3);
+                int64_t value = ZEN_INTERPRETER_GET_LOCAL_LONG(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_LONG(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_l3` (index = 3, result = %l, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F0: { /* load_f0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F0): { /* load_f0 */
                 /* Retrieve the 32-bit decimal value stored in the local variable
                  * at index 0.
                  */
-                float value = zen_LocalVariableArray_getFloat(currentStackFrame->m_localVariableArray, 0);
+                float value = ZEN_INTERPRETER_GET_LOCAL_FLOAT(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_f0` (index = 0, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F1: { /* load_f1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F1): { /* load_f1 */
                 /* Retrieve the 32-bit decimal value stored in the local variable
                  * at index 1.
                  */
-                float value = zen_LocalVariableArray_getFloat(currentStackFrame->m_localVariableArray, 1);
+                float value = ZEN_INTERPRETER_GET_LOCAL_FLOAT(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_f1` (index = 1, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F2: { /* load_f2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F2): { /* load_f2 */
                 /* Retrieve the 32-bit decimal value stored in the local variable
                  * at index 2.
                  */
-                float value = zen_LocalVariableArray_getFloat(currentStackFrame->m_localVariableArray, 2);
+                float value = ZEN_INTERPRETER_GET_LOCAL_FLOAT(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_f2` (index = 2, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F3: { /* load_f3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F3): { /* load_f3 */
                 /* Retrieve the 32-bit decimal value stored in the local variable
                  * at index 3.
                  */
-                float value = zen_LocalVariableArray_getFloat(currentStackFrame->m_localVariableArray, 3);
+                float value = ZEN_INTERPRETER_GET_LOCAL_FLOAT(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_f3` (index = 3, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D0: { /* load_d0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D0): { /* load_d0 */
                 /* Retrieve the 64-bit decimal value stored in the local variable at
                  * index 0.
                  */
-                double value = zen_LocalVariableArray_getDouble(currentStackFrame->m_localVariableArray, 0);
+                double value = ZEN_INTERPRETER_GET_LOCAL_DOUBLE(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_d0` (index = 0, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D1: { /* load_d1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D1): { /* load_d1 */
                 /* Retrieve the 64-bit decimal value stored in the local variable at
                  * index 1.
                  */
-                double value = zen_LocalVariableArray_getDouble(currentStackFrame->m_localVariableArray, 1);
+                double value = ZEN_INTERPRETER_GET_LOCAL_DOUBLE(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_d1` (index = 1, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D2: { /* load_d2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D2): { /* load_d2 */
                 /* Retrieve the 64-bit decimal value stored in the local variable at
                  * index 2.
                  */
-                double value = zen_LocalVariableArray_getDouble(currentStackFrame->m_localVariableArray, 2);
+                double value = ZEN_INTERPRETER_GET_LOCAL_DOUBLE(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_d2` (index = 2, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D3: { /* load_d3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D3): { /* load_d3 */
                 /* Retrieve the 64-bit decimal value stored in the local variable at
                  * index 3.
                  */
-                double value = zen_LocalVariableArray_getDouble(currentStackFrame->m_localVariableArray, 3);
+                double value = ZEN_INTERPRETER_GET_LOCAL_DOUBLE(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_d3` (index = 3, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A0: { /* load_a0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A0): { /* load_a0 */
                 /* Retrieve the reference of an object stored in the local variable
                  * at index 0.
                  */
-                intptr_t reference = zen_LocalVariableArray_getReference(
-                    currentStackFrame->m_localVariableArray, 0);
+                intptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_a0` (index = 0, result = 0x%X, operand stack = %d)",
-                    reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    reference, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A1: { /* load_a1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A1): { /* load_a1 */
                 /* Retrieve the reference of an object stored in the local variable
                  * at index 1.
                  */
-                intptr_t reference = zen_LocalVariableArray_getReference(
-                    currentStackFrame->m_localVariableArray, 1);
+                intptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_a1` (index = 1, result = 0x%X, operand stack = %d)",
-                    reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    reference, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A2: { /* load_a2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A2): { /* load_a2 */
                 /* Retrieve the reference of an object stored in the local variable
                  * at index 2.
                  */
-                intptr_t reference = zen_LocalVariableArray_getReference(
-                    currentStackFrame->m_localVariableArray, 2);
+                intptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_a2` (index = 2, result = 0x%X, operand stack = %d)",
-                    reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    reference, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A3: { /* load_a3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A3): { /* load_a3 */
                 /* Retrieve the reference of an object stored in the local variable
                  * at index 3.
                  */
-                intptr_t reference = zen_LocalVariableArray_getReference(
-                    currentStackFrame->m_localVariableArray, 3);
+                intptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_a3` (index = 3, result = 0x%X, operand stack = %d)",
-                    reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    reference, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AB: { /* load_ab */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AB): { /* load_ab */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AC: { /* load_ac */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AC): { /* load_ac */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AS: { /* load_as */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AS): { /* load_as */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AI: { /* load_ai */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AI): { /* load_ai */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AL: { /* load_al */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AL): { /* load_al */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AF: { /* load_af */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AF): { /* load_af */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AD: { /* load_ad */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AD): { /* load_ad */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AA: { /* load_aa */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AA): { /* load_aa */
+                /* Retrieve the index and the array from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+
+                if (array == NULL) {
+                    /* Throw an instance of the zen.core.NullPointerException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_NULL_POINTER_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                /* A negative index is rejected by the unsigned comparison. */
+                if ((uint32_t)index >= (uint32_t)zen_Object_getArrayLength(array)) {
+                    /* Throw an instance of the zen.core.InvalidArrayIndexException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_INVALID_ARRAY_INDEX_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                zen_Reference_t* elements = (zen_Reference_t*)((uint8_t*)array + ZEN_OBJECT_ARRAY_HEADER_SIZE);
+                zen_Object_t* result = zen_Reference_load(&elements[index]);
+                ZEN_INTERPRETER_PUSH_REFERENCE(result);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_aa` (array = 0x%X, index = %d, result = 0x%X, operand stack = %d)",
+                    array, index, result, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD: { /* load_instance_field */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD): { /* load_instance_field */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT_OPERAND();
+                zen_Object_t* object = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+
+                if (object == NULL) {
+                    /* Throw an instance of the zen.core.NullPointerException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_NULL_POINTER_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                /* The field is resolved when the instruction is executed for
+                 * the first time. Thereafter, the field is read at its offset.
+                 */
+                zen_Field_t* field = zen_Interpreter_resolveField(interpreter,
+                    currentStackFrame->m_class, index);
+                if ((field == NULL) || (field->m_offset < 0)) {
+                    /* Throw an instance of the zen.core.UnknownFieldException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_FIELD_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                uint8_t* address = (uint8_t*)object + field->m_offset;
+                switch (field->m_type) {
+                    case 'z': ZEN_INTERPRETER_PUSH_INTEGER(*(uint8_t*)address); break;
+                    case 'b': ZEN_INTERPRETER_PUSH_INTEGER(*(int8_t*)address); break;
+                    case 'c': ZEN_INTERPRETER_PUSH_INTEGER(*(uint16_t*)address); break;
+                    case 's': ZEN_INTERPRETER_PUSH_INTEGER(*(int16_t*)address); break;
+                    case 'i': ZEN_INTERPRETER_PUSH_INTEGER(*(int32_t*)address); break;
+                    case 'l': ZEN_INTERPRETER_PUSH_LONG(*(int64_t*)address); break;
+                    case 'f': ZEN_INTERPRETER_PUSH_FLOAT(*(float*)address); break;
+                    case 'd': ZEN_INTERPRETER_PUSH_DOUBLE(*(double*)address); break;
+                    default: ZEN_INTERPRETER_PUSH_REFERENCE(zen_Reference_load((zen_Reference_t*)address)); break;
+                }
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_instance_field` (index = %d, object = 0x%X, offset = %d, operand stack = %d)",
+                    index, object, field->m_offset, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_STATIC_FIELD: { /* load_static_field */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_STATIC_FIELD): { /* load_static_field */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT_OPERAND();
+
+                zen_Field_t* field = zen_Interpreter_resolveField(interpreter,
+                    currentStackFrame->m_class, index);
+                if ((field == NULL) || (field->m_index < 0)) {
+                    /* Throw an instance of the zen.core.UnknownFieldException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_FIELD_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                /* A static field occupies a slot, irrespective of its type. */
+                *(stackTop++) = field->m_class->m_staticFields[field->m_index];
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `load_static_field` (index = %d, field = %d, operand stack = %d)",
+                    index, field->m_index, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_CPR: { /* load_cpr */
-                int32_t index = zen_Interpreter_readByte(interpreter);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_CPR): { /* load_cpr */
+#ifdef ZEN_INTERPRETER_PREDECODE
+                /* The numeric constants were resolved when the instruction was
+                 * decoded.
+                 */
+                if ((record->m_flags & ZEN_DECODED_INSTRUCTION_FLAG_CONSTANT) != 0) {
+                    ip += 1;
+                    *(stackTop++) = record->m_constant;
+
+                    ZEN_INTERPRETER_NEXT();
+                }
+#endif
+
+                int32_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
 
                 zen_EntityFile_t* entityFile = currentStackFrame->m_class->m_entityFile;
                 zen_ConstantPool_t* constantPool = entityFile->m_constantPool;
@@ -2065,7 +3169,7 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     case ZEN_CONSTANT_POOL_TAG_INTEGER: {
                         zen_ConstantPoolInteger_t* constantPoolInteger = (zen_ConstantPoolInteger_t*)entry;
                         int32_t value = zen_ConstantPoolInteger_getValue(constantPoolInteger);
-                        zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                        ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                         break;
                     }
@@ -2073,7 +3177,7 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     case ZEN_CONSTANT_POOL_TAG_LONG: {
                         zen_ConstantPoolLong_t* constantPoolLong = (zen_ConstantPoolLong_t*)entry;
                         int64_t value = zen_ConstantPoolLong_getValue(constantPoolLong);
-                        zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                        ZEN_INTERPRETER_PUSH_LONG(value);
 
                         break;
                     }
@@ -2081,7 +3185,7 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     case ZEN_CONSTANT_POOL_TAG_FLOAT: {
                         zen_ConstantPoolFloat_t* constantPoolFloat = (zen_ConstantPoolFloat_t*)entry;
                         float value = zen_ConstantPoolFloat_getValue(constantPoolFloat);
-                        zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                        ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                         break;
                     }
@@ -2089,17 +3193,19 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     case ZEN_CONSTANT_POOL_TAG_DOUBLE: {
                         zen_ConstantPoolDouble_t* constantPoolDouble = (zen_ConstantPoolDouble_t*)entry;
                         double value = zen_ConstantPoolDouble_getValue(constantPoolDouble);
-                        zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                        ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                         break;
                     }
 
                     case ZEN_CONSTANT_POOL_TAG_STRING: {
-                        zen_ConstantPoolString_t* constantPoolString = (zen_ConstantPoolString_t*)entry;
-                        zen_ConstantPoolUtf8_t* constantPoolUtf8 =
-                            (zen_ConstantPoolString_t*)constantPool->m_entries[constantPoolString->m_stringIndex];
-                        jtk_CString_t* value = jtk_CString_newEx(constantPoolUtf8->m_bytes, constantPoolUtf8->m_length);
-                        zen_OperandStack_pushReference(currentStackFrame->m_operandStack, value);
+                        /* The string is interned when the instruction is
+                         * executed for the first time. Thereafter, it is
+                         * loaded from the resolved entries of the class.
+                         */
+                        zen_Object_t* value = zen_Interpreter_resolveString(interpreter,
+                            currentStackFrame->m_class, index);
+                        ZEN_INTERPRETER_PUSH_REFERENCE(value);
 
                         break;
                     }
@@ -2109,20 +3215,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     }
                 }
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_LOAD_ARRAY_SIZE: { /* load_array_size */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_ARRAY_SIZE): { /* load_array_size */
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Modulo */
 
-            case ZEN_BYTE_CODE_MODULO_I: { /* modulo_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MODULO_I): { /* modulo_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand2 == 0) {
                     /* TODO: Throw an instance of the zen.core.DivisionByZeroException class. */
@@ -2132,20 +3238,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * on the operand stack.
                  */
                 int32_t result = operand1 % operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `modulo_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_MODULO_L: { /* modulo_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MODULO_L): { /* modulo_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
 
                 if (operand2 == 0L) {
                     /* TODO: Throw an instance of the zen.core.DivisionByZeroException class. */
@@ -2155,485 +3261,692 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * on the operand stack.
                  */
                 int64_t result = operand1 % operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `modulo_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_MODULO_F: { /* modulo_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MODULO_F): { /* modulo_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Divide the operands to evaluate the remainder. Push the result
                  * on the operand stack.
                  */
                 float result = jtk_Math_modulo_f(operand1, operand2);
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `modulo_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_MODULO_D: { /* modulo_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MODULO_D): { /* modulo_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Divide the operands to evaluate the remainder. Push the result
                  * on the operand stack.
                  */
                 double result = jtk_Math_modulo_d(operand1, operand2);
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `modulo_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Multiply */
 
-            case ZEN_BYTE_CODE_MULTIPLY_I: { /* multiply_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MULTIPLY_I): { /* multiply_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Multiply the operands. Push the result on the operand stack. */
                 int32_t result = operand1 * operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `multiply_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_MULTIPLY_L: { /* multiply_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MULTIPLY_L): { /* multiply_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Multiply the operands. Push the result on the operand stack. */
                 int64_t result = operand1 * operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `multiply_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_MULTIPLY_F: { /* multiply_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MULTIPLY_F): { /* multiply_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Multiply the operands. Push the result on the operand stack. */
                 float result = operand1 * operand2;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `multiply_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_MULTIPLY_D: { /* multiply_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MULTIPLY_D): { /* multiply_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Multiply the operands. Push the result on the operand stack. */
                 double result = operand1 * operand2;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `multiply_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Negate */
 
-            case ZEN_BYTE_CODE_NEGATE_I: { /* negate_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEGATE_I): { /* negate_i */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Negate the operand. Push the result on the operand stack. */
                 int32_t result = -operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `negate_i` (operand = %d, result = %d, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_NEGATE_L: { /* negate_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEGATE_L): { /* negate_l */
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Negate the operand. Push the result on the operand stack. */
                 int64_t result = -operand;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `negate_l` (operand = %l, result = %l, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_NEGATE_F: { /* negate_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEGATE_F): { /* negate_f */
                 /* Retrieve the operand from the operand stack. */
-                float operand = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand = ZEN_INTERPRETER_POP_FLOAT();
                 /* Negate the operand. Push the result on the operand stack. */
                 float result = -operand;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `negate_f` (operand = %f, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_NEGATE_D: { /* negate_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEGATE_D): { /* negate_d */
                 /* Retrieve the operand from the operand stack. */
-                double operand = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Negate the operand. Push the result on the operand stack. */
                 double result = -operand;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `negate_d` (operand = %f, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* New */
 
-            case ZEN_BYTE_CODE_NEW: { /* new */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEW): { /* new */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT_OPERAND();
+                zen_Class_t* class0 = zen_Interpreter_resolveClass(interpreter,
+                    currentStackFrame->m_class, index);
+                if (class0 == NULL) {
+                    /* Throw an instance of the zen.core.UnknownClassException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_CLASS_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                zen_Object_t* object;
+                ZEN_INTERPRETER_ALLOCATE(object, class0->m_instanceSize);
+                if (object == NULL) {
+                    /* Throw an instance of the zen.core.OutOfMemoryError class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_OUT_OF_MEMORY_ERROR);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+                object->m_class = class0;
+                object->m_size = class0->m_instanceSize;
+                ZEN_INTERPRETER_PUSH_REFERENCE(object);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `new` (index = %d, size = %d, result = 0x%X, operand stack = %d)",
+                    index, class0->m_instanceSize, object, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_NEW_ARRAY: { /* new_array */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEW_ARRAY): { /* new_array */
+                uint8_t type = ZEN_INTERPRETER_READ_BYTE_OPERAND();
+                int32_t length = ZEN_INTERPRETER_POP_INTEGER();
+
+                /* The verifier rejects an unknown component type. However, a
+                 * function which fails the verification is still loaded.
+                 */
+                if (type > ZEN_PRIMITIVE_TYPE_DECIMAL_64) {
+                    /* Throw an instance of the zen.core.VerificationError class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_VERIFICATION_ERROR);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                if (length < 0) {
+                    /* Throw an instance of the zen.core.InvalidArraySizeException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_INVALID_ARRAY_SIZE_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                /* The size is computed in 64-bits, so that large arrays do not
+                 * overflow it.
+                 */
+                int64_t size = ZEN_OBJECT_ARRAY_HEADER_SIZE +
+                    (int64_t)length * zen_Interpreter_componentSizes[type];
+                size = (size + 7) & ~(int64_t)7;
+
+                /* A large array is allocated in the large object space, where
+                 * it is never copied by the collectors. The space initializes
+                 * the header.
+                 */
+                zen_Object_t* array = NULL;
+                if (size <= INT32_MAX) {
+                    if (zen_MemoryManager_isLargeObjectSize(interpreter->m_memoryManager, size)) {
+                        ZEN_INTERPRETER_SAVE_REGISTERS();
+                        array = (zen_Object_t*)zen_MemoryManager_allocateLargeObject(
+                            interpreter->m_memoryManager, (int32_t)size, ZEN_OBJECT_FLAG_ARRAY);
+                    }
+                    else {
+                        ZEN_INTERPRETER_ALLOCATE(array, (int32_t)size);
+                        if (array != NULL) {
+                            array->m_class = NULL;
+                            array->m_size = (int32_t)size;
+                            array->m_flags = ZEN_OBJECT_FLAG_ARRAY;
+                        }
+                    }
+                }
+                if (array == NULL) {
+                    /* Throw an instance of the zen.core.OutOfMemoryError class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_OUT_OF_MEMORY_ERROR);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+                *(int32_t*)(array + 1) = length;
+                ZEN_INTERPRETER_PUSH_REFERENCE(array);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `new_array` (type = %d, length = %d, result = 0x%X, operand stack = %d)",
+                    type, length, array, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
+            }
+
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEW_ARRAY_A): { /* new_array_a */
+                /* The component type is not recorded in the array yet.
+                 * Therefore, the operand, which is the index of the constant
+                 * pool entry, is skipped without resolving the entry.
+                 */
+                ip += 2;
+                int32_t length = ZEN_INTERPRETER_POP_INTEGER();
+
+                if (length < 0) {
+                    /* Throw an instance of the zen.core.InvalidArraySizeException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_INVALID_ARRAY_SIZE_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                int64_t size = ZEN_OBJECT_ARRAY_HEADER_SIZE +
+                    (int64_t)length * sizeof (zen_Reference_t);
+                size = (size + 7) & ~(int64_t)7;
+
+                /* A large array is allocated in the large object space, like
+                 * the primitive arrays. The minor collector scans it for the
+                 * references to the new generation.
+                 */
+                zen_Object_t* array = NULL;
+                if (size <= INT32_MAX) {
+                    if (zen_MemoryManager_isLargeObjectSize(interpreter->m_memoryManager, size)) {
+                        ZEN_INTERPRETER_SAVE_REGISTERS();
+                        array = (zen_Object_t*)zen_MemoryManager_allocateLargeObject(
+                            interpreter->m_memoryManager, (int32_t)size,
+                            ZEN_OBJECT_FLAG_ARRAY | ZEN_OBJECT_FLAG_REFERENCE_ARRAY);
+                    }
+                    else {
+                        ZEN_INTERPRETER_ALLOCATE(array, (int32_t)size);
+                        if (array != NULL) {
+                            array->m_class = NULL;
+                            array->m_size = (int32_t)size;
+                            array->m_flags = ZEN_OBJECT_FLAG_ARRAY | ZEN_OBJECT_FLAG_REFERENCE_ARRAY;
+                        }
+                    }
+                }
+                if (array == NULL) {
+                    /* Throw an instance of the zen.core.OutOfMemoryError class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_OUT_OF_MEMORY_ERROR);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+                *(int32_t*)(array + 1) = length;
+                ZEN_INTERPRETER_PUSH_REFERENCE(array);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `new_array_a` (index = %d, length = %d, result = 0x%X, operand stack = %d)",
+                    index, length, array, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_NEW_ARRAY_AN: { /* new_array_an */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEW_ARRAY_AN): { /* new_array_an */
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Pop */
 
-            case ZEN_BYTE_CODE_POP: { /* pop */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_POP): { /* pop */
                 /* Discard the operand on top of the operand stack. */
-                zen_OperandStack_pop(currentStackFrame->m_operandStack);
+                (void)ZEN_INTERPRETER_POP_INTEGER();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `pop` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_POP2: { /* pop2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_POP2): { /* pop2 */
                 /* Discard the first two operands on top of the operand stack. */
-                zen_OperandStack_popEx(currentStackFrame->m_operandStack, 2);
+                stackTop -= 2;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `pop2` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Push */
 
-            case ZEN_BYTE_CODE_PUSH_NULL: { /* push_null */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_NULL): { /* push_null */
                 /* Push an integer value of 0, which represents the null reference,
                  * on the operand stack.
                  */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, NULL);
+                ZEN_INTERPRETER_PUSH_REFERENCE(NULL);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_null` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_IN1: { /* push_in1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_IN1): { /* push_in1 */
                 /* Push a 32-bit integer value of -1 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, -1);
+                ZEN_INTERPRETER_PUSH_INTEGER(-1);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_in1` (result = -1, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I0: { /* push_i0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I0): { /* push_i0 */
                 /* Push a 32-bit integer value of 0 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 0);
+                ZEN_INTERPRETER_PUSH_INTEGER(0);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_i0` (result = 0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I1: { /* push_i1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I1): { /* push_i1 */
                 /* Push a 32-bit integer value of 1 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 1);
+                ZEN_INTERPRETER_PUSH_INTEGER(1);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_i1` (result = 1, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I2: { /* push_i2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I2): { /* push_i2 */
                 /* Push a 32-bit integer value of 2 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 2);
+                ZEN_INTERPRETER_PUSH_INTEGER(2);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_i2` (result = 2, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I3: { /* push_i3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I3): { /* push_i3 */
                 /* Push a 32-bit integer value of 3 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 3);
+                ZEN_INTERPRETER_PUSH_INTEGER(3);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_i3` (result = 3, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I4: { /* push_i4 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I4): { /* push_i4 */
                 /* Push a 32-bit integer value of 4 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 4);
+                ZEN_INTERPRETER_PUSH_INTEGER(4);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_i4` (result = 4, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I5: { /* push_i5 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I5): { /* push_i5 */
                 /* Push a 32-bit integer value of 5 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 5);
+                ZEN_INTERPRETER_PUSH_INTEGER(5);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_i5` (result = 5, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_L0: { /* push_l0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_L0): { /* push_l0 */
                 /* Push a 64-bit integer value of 0 on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, 0L);
+                ZEN_INTERPRETER_PUSH_LONG(0L);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_l0` (result = 0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_L1: { /* push_l1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_L1): { /* push_l1 */
                 /* Push a 64-bit integer value of 1 on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, 1L);
+                ZEN_INTERPRETER_PUSH_LONG(1L);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_l1` (result = 1, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_L2: { /* push_l2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_L2): { /* push_l2 */
                 /* Push a 64-bit integer value of 2 on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, 2L);
+                ZEN_INTERPRETER_PUSH_LONG(2L);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_l2` (result = 2, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_F0: { /* push_f0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_F0): { /* push_f0 */
                 /* Push a 32-bit decimal value of 0.0 on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, 0.0f);
+                ZEN_INTERPRETER_PUSH_FLOAT(0.0f);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_f0` (result = 0.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_F1: { /* push_f1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_F1): { /* push_f1 */
                 /* Push a 32-bit decimal value of 1.0 on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, 1.0f);
+                ZEN_INTERPRETER_PUSH_FLOAT(1.0f);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_f1` (result = 1.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_F2: { /* push_f2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_F2): { /* push_f2 */
                 /* Push a 32-bit decimal value of 2.0 on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, 2.0f);
+                ZEN_INTERPRETER_PUSH_FLOAT(2.0f);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_f2` (result = 2.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_D0: { /* push_d0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_D0): { /* push_d0 */
                 /* Push a 64-bit decimal value of 0.0 on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, 0.0);
+                ZEN_INTERPRETER_PUSH_DOUBLE(0.0);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_d0` (result = 0.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_D1: { /* push_d1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_D1): { /* push_d1 */
                 /* Push a 64-bit decimal value of 1.0 on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, 1.0);
+                ZEN_INTERPRETER_PUSH_DOUBLE(1.0);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_d1` (result = 1.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_D2: { /* push_d2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_D2): { /* push_d2 */
                 /* Push a 64-bit decimal value of 2.0 on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, 2.0);
+                ZEN_INTERPRETER_PUSH_DOUBLE(2.0);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_d2` (result = 2.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_B: { /* push_b */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_B): { /* push_b */
                 /* Read the 8-bit integer value to push on the stack. */
-                int8_t value = zen_Interpreter_readByte(interpreter);
+                int8_t value = ZEN_INTERPRETER_READ_BYTE_OPERAND();
                 /* Push the 8-bit integer value on the stack. It is extended to
                  * a 32-bit integer; zeroes are used as padding.
                  */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, (int32_t)value);
+                ZEN_INTERPRETER_PUSH_INTEGER((int32_t)value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_b` (result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_PUSH_S: { /* push_s */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_S): { /* push_s */
                 /* Read the 16-bit integer value to push on the stack. */
-                int16_t value = zen_Interpreter_readShort(interpreter);
+                int16_t value = ZEN_INTERPRETER_READ_SHORT_OPERAND();
                 /* Push the 16-bit integer value on the stack. It is extended to
                  * a 32-bit integer; zeroes are used as padding.
                  */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, (int32_t)value);
+                ZEN_INTERPRETER_PUSH_INTEGER((int32_t)value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `push_s` (result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Return */
 
-            case ZEN_BYTE_CODE_RETURN: { /* return */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN): { /* return */
+                ZEN_INTERPRETER_POLL_SAFEPOINT(ip);
+
                 /* The currently executing function is returning to the caller.
                  * Therefore, pop the current stack frame.
                  */
-                currentStackFrame = zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
+                bool entry = (currentStackFrame == entryStackFrame);
+                currentStackFrame = zen_InvocationStack_popStackFrame(invocationStack);
+                if (currentStackFrame == NULL) {
+                    return;
+                }
+                /* The registers now belong to the caller. */
+                ZEN_INTERPRETER_LOAD_REGISTERS();
+
+                /* The function on which the loop was entered has returned. */
+                if (entry) {
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    return;
+                }
+
+                /* Resume the compiled code of the caller, if any. */
+                ZEN_INTERPRETER_RUN_COMPILED_CODE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `return` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_RETURN_I: { /* return_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_I): { /* return_i */
+                ZEN_INTERPRETER_POLL_SAFEPOINT(ip);
+
                 /* Retrieve the operand from the operand stack. */
-                int32_t returnValue = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t returnValue = ZEN_INTERPRETER_POP_INTEGER();
 
                 /* The currently executing function is returning to the caller.
                  * Therefore, pop the current stack frame.
                  */
-                currentStackFrame = zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
+                bool entry = (currentStackFrame == entryStackFrame);
+                currentStackFrame = zen_InvocationStack_popStackFrame(invocationStack);
+                if (currentStackFrame == NULL) {
+                    return;
+                }
+                /* The registers now belong to the caller. */
+                ZEN_INTERPRETER_LOAD_REGISTERS();
 
                 /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, returnValue);
+                ZEN_INTERPRETER_PUSH_INTEGER(returnValue);
+
+                /* The function on which the loop was entered has returned. */
+                if (entry) {
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    return;
+                }
+
+                /* Resume the compiled code of the caller, if any. */
+                ZEN_INTERPRETER_RUN_COMPILED_CODE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `return_i` (operand = %d, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    returnValue, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_RETURN_L: { /* return_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_L): { /* return_l */
+                ZEN_INTERPRETER_POLL_SAFEPOINT(ip);
+
                 /* Retrieve the operand from the operand stack. */
-                int64_t returnValue = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t returnValue = ZEN_INTERPRETER_POP_LONG();
 
                 /* The currently executing function is returning to the caller.
                  * Therefore, pop the current stack frame.
                  */
-                currentStackFrame = zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
+                bool entry = (currentStackFrame == entryStackFrame);
+                currentStackFrame = zen_InvocationStack_popStackFrame(invocationStack);
+                if (currentStackFrame == NULL) {
+                    return;
+                }
+                /* The registers now belong to the caller. */
+                ZEN_INTERPRETER_LOAD_REGISTERS();
 
                 /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, returnValue);
+                ZEN_INTERPRETER_PUSH_LONG(returnValue);
+
+                /* The function on which the loop was entered has returned. */
+                if (entry) {
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    return;
+                }
+
+                /* Resume the compiled code of the caller, if any. */
+                ZEN_INTERPRETER_RUN_COMPILED_CODE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `return_l` (operand = %l, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    returnValue, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* NOTE: The return_f and return_d instructions are implemented in terms of
@@ -2644,151 +3957,202 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
              * stack stores decimal values as integers.
              */
 
-            case ZEN_BYTE_CODE_RETURN_F: { /* return_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_F): { /* return_f */
+                ZEN_INTERPRETER_POLL_SAFEPOINT(ip);
+
                 /* Retrieve the operand from the operand stack. */
-                int32_t returnValue = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t returnValue = ZEN_INTERPRETER_POP_INTEGER();
 
                 /* The currently executing function is returning to the caller.
                  * Therefore, pop the current stack frame.
                  */
-                currentStackFrame = zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
+                bool entry = (currentStackFrame == entryStackFrame);
+                currentStackFrame = zen_InvocationStack_popStackFrame(invocationStack);
+                if (currentStackFrame == NULL) {
+                    return;
+                }
+                /* The registers now belong to the caller. */
+                ZEN_INTERPRETER_LOAD_REGISTERS();
 
                 /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, returnValue);
+                ZEN_INTERPRETER_PUSH_INTEGER(returnValue);
+
+                /* The function on which the loop was entered has returned. */
+                if (entry) {
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    return;
+                }
+
+                /* Resume the compiled code of the caller, if any. */
+                ZEN_INTERPRETER_RUN_COMPILED_CODE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `return_f` (operand = 0x%X, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    returnValue, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_RETURN_D: { /* return_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_D): { /* return_d */
+                ZEN_INTERPRETER_POLL_SAFEPOINT(ip);
+
                 /* Retrieve the operand from the operand stack. */
-                int64_t returnValue = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t returnValue = ZEN_INTERPRETER_POP_LONG();
 
                 /* The currently executing function is returning to the caller.
                  * Therefore, pop the current stack frame.
                  */
-                currentStackFrame = zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
+                bool entry = (currentStackFrame == entryStackFrame);
+                currentStackFrame = zen_InvocationStack_popStackFrame(invocationStack);
+                if (currentStackFrame == NULL) {
+                    return;
+                }
+                /* The registers now belong to the caller. */
+                ZEN_INTERPRETER_LOAD_REGISTERS();
 
                 /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, returnValue);
+                ZEN_INTERPRETER_PUSH_LONG(returnValue);
+
+                /* The function on which the loop was entered has returned. */
+                if (entry) {
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    return;
+                }
+
+                /* Resume the compiled code of the caller, if any. */
+                ZEN_INTERPRETER_RUN_COMPILED_CODE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `return_d` (operand = 0x%X, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    returnValue, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_RETURN_A: { /* return_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_A): { /* return_a */
+                ZEN_INTERPRETER_POLL_SAFEPOINT(ip);
+
                 /* Retrieve the operand from the operand stack. */
-                intptr_t returnValue = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t returnValue = ZEN_INTERPRETER_POP_REFERENCE();
 
                 /* The currently executing function is returning to the caller.
                  * Therefore, pop the current stack frame.
                  */
-                currentStackFrame = zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
+                bool entry = (currentStackFrame == entryStackFrame);
+                currentStackFrame = zen_InvocationStack_popStackFrame(invocationStack);
+                if (currentStackFrame == NULL) {
+                    return;
+                }
+                /* The registers now belong to the caller. */
+                ZEN_INTERPRETER_LOAD_REGISTERS();
 
                 /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, returnValue);
+                ZEN_INTERPRETER_PUSH_REFERENCE(returnValue);
+
+                /* The function on which the loop was entered has returned. */
+                if (entry) {
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    return;
+                }
+
+                /* Resume the compiled code of the caller, if any. */
+                ZEN_INTERPRETER_RUN_COMPILED_CODE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `return_a` (operand = 0x%X, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    returnValue, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* RTTI */
 
-            case ZEN_BYTE_CODE_RTTI: { /* rtti */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RTTI): { /* rtti */
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Store */
 
-            case ZEN_BYTE_CODE_STORE_I: { /* store_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I): { /* store_i */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = zen_Interpreter_readByte(interpreter);
+                uint8_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_i` (operand = %d, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_I0: { /* store_i0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I0): { /* store_i0 */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operand in the local variable at index 0. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_i0` (operand = %d, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_I1: { /* store_i1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I1): { /* store_i1 */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operand in the local variable at index 1. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_i1` (operand = %d, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_I2: { /* store_i2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I2): { /* store_i2 */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operand in the local variable at index 2. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_i2` (operand = %d, index = 2, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_I3: { /* store_i3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I3): { /* store_i3 */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operand in the local variable at index 3. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_i3` (operand = %d, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_L: { /* store_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L): { /* store_l */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = zen_Interpreter_readByte(interpreter);
+                uint8_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_l` (operand = %d, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* NOTE: The order in which the high and low parts are stored should
@@ -2796,140 +4160,140 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
              *       loaded.
              */
 
-            case ZEN_BYTE_CODE_STORE_L0: { /* store_l0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L0): { /* store_l0 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the 64-bit integer.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the 64-bit integer.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 0.
                  *
                  * A 64-bit integer value occupies two indexes in the local variable
                  * array. The high part is stored at index 0. The low part is stored
                  * in the subsequent index, that is 1.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 0, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(0, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 0. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_l0` (operand = %l, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_L1: { /* store_l1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L1): { /* store_l1 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the 64-bit integer.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the 64-bit integer.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 1.
                  *
                  * A 64-bit integer value occupies two indexes in the local variable
                  * array. The high part is stored at index 1. The low part is stored
                  * in the subsequent index, that is 2.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 1. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_l1` (operand = %l, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_L2: { /* store_l2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L2): { /* store_l2 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the 64-bit integer.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the 64-bit integer.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 2.
                  *
                  * A 64-bit integer value occupies two indexes in the local variable
                  * array. The high part is stored at index 2. The low part is stored
                  * in the subsequent index, that is 3.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 2. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 2, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(2, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_l2` (operand = %l, index = 2, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_L3: { /* store_l3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L3): { /* store_l3 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the 64-bit integer.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the 64-bit integer.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 3.
                  *
                  * A 64-bit integer value occupies two indexes in the local variable
                  * array. The high part is stored at index 3. The low part is stored
                  * in the subsequent index, that is 4.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 4, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(4, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 3. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_l3` (operand = %l, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* NOTE: The store_f and store_d instructions are implemented in terms of
@@ -2941,88 +4305,88 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
              * array store decimal values as integers.
              */
 
-            case ZEN_BYTE_CODE_STORE_F: { /* store_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F): { /* store_f */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = zen_Interpreter_readByte(interpreter);
+                uint8_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_f` (operand = 0x%X, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_STACK_SIZE());
 
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_F0: { /* store_f0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F0): { /* store_f0 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the bit pattern of 32-bit decimal value.
                  */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved bit pattern of the 32-decimal value operand
                  * in the local variable at index 0.
                  */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_f0` (operand = %d, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_F1: { /* store_f1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F1): { /* store_f1 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the bit pattern of 32-bit decimal value.
                  */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved bit pattern of the 32-decimal value operand
                  * in the local variable at index 1.
                  */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_f1` (operand = %d, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_F2: { /* store_f2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F2): { /* store_f2 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the bit pattern of 32-bit decimal value.
                  */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved bit pattern of the 32-decimal value operand
                  * in the local variable at index 2.
                  */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_f2` (operand = %d, index = 2, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_F3: { /* store_f3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F3): { /* store_f3 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the bit pattern of 32-bit decimal value.
                  */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved bit pattern of the 32-decimal value operand
                  * in the local variable at index 3.
                  */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_f3` (operand = %d, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* NOTE: The order in which the high and low parts are stored should
@@ -3030,390 +4394,555 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
              *       loaded.
              */
 
-            case ZEN_BYTE_CODE_STORE_D: { /* store_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D): { /* store_d */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = zen_Interpreter_readByte(interpreter);
+                uint8_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_d` (operand = 0x%X, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_D0: { /* store_d0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D0): { /* store_d0 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 0.
                  *
                  * A 64-bit decimal value occupies two indexes in the local variable
                  * array. The high part is stored at index 0. The low part is stored
                  * in the subsequent index, that is 1.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 0, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(0, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 0. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_d0` (operand = %l, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_D1: { /* store_d1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D1): { /* store_d1 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 1.
                  *
                  * A 64-bit decimal value occupies two indexes in the local variable
                  * array. The high part is stored at index 1. The low part is stored
                  * in the subsequent index, that is 2.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 1. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_d1` (operand = %l, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_D2: { /* store_d2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D2): { /* store_d2 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 2.
                  *
                  * A 64-bit decimal value occupies two indexes in the local variable
                  * array. The high part is stored at index 2. The low part is stored
                  * in the subsequent index, that is 3.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, lowPart);
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
-                /* Store the retrieved operand in the local variable at index 0. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 0, operand);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
+                /* Store the retrieved operand in the local variable at index 2. */
+                ZEN_INTERPRETER_SET_LOCAL_LONG(2, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
-                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_d2` (operand = %l, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_d2` (operand = %l, index = 2, operand stack = %d)",
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_D3: { /* store_d3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D3): { /* store_d3 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 3.
                  *
                  * A 64-bit decimal value occupies two indexes in the local variable
                  * array. The high part is stored at index 3. The low part is stored
                  * in the subsequent index, that is 4.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 4, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(4, lowPart);
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 3. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_d3` (operand = %l, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_A: { /* store_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A): { /* store_a */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = zen_Interpreter_readByte(interpreter);
+                uint8_t index = ZEN_INTERPRETER_READ_BYTE_OPERAND();
                 /* Retrieve the operand from the operand stack. */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_a` (operand = 0x%X, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_A0: { /* store_a0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A0): { /* store_a0 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the address of an object.
                  */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Store the retrieved address of the object in the local variable
                  * at index 0.
                  */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_a0` (operand = 0x%X, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_A1: { /* store_a1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A1): { /* store_a1 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the address of an object.
                  */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Store the retrieved address of the object in the local variable
                  * at index 1.
                  */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_a1` (operand = 0x%X, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_A2: { /* store_a2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A2): { /* store_a2 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the address of an object.
                  */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Store the retrieved address of the object in the local variable
                  * at index 2.
                  */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, 2, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(2, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_a2` (operand = 0x%X, index = 2, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_A3: { /* store_a3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A3): { /* store_a3 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the address of an object.
                  */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Store the retrieved address of the object in the local variable
                  * at index 3.
                  */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_a3` (operand = 0x%X, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_AB: { /* store_ab */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AB): { /* store_ab */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_AC: { /* store_ac */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AC): { /* store_ac */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_AS: { /* store_as */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AS): { /* store_as */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_AI: { /* store_ai */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AI): { /* store_ai */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_AL: { /* store_al */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AL): { /* store_al */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_AF: { /* store_af */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AF): { /* store_af */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_AD: { /* store_ad */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AD): { /* store_ad */
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_AA: { /* store_aa */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AA): { /* store_aa */
+                /* Retrieve the value, the index and the array from the operand
+                 * stack.
+                 */
+                zen_Object_t* value = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+
+                if (array == NULL) {
+                    /* Throw an instance of the zen.core.NullPointerException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_NULL_POINTER_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                /* A negative index is rejected by the unsigned comparison. */
+                if ((uint32_t)index >= (uint32_t)zen_Object_getArrayLength(array)) {
+                    /* Throw an instance of the zen.core.InvalidArrayIndexException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_INVALID_ARRAY_INDEX_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                zen_Reference_t* elements = (zen_Reference_t*)((uint8_t*)array + ZEN_OBJECT_ARRAY_HEADER_SIZE);
+                ZEN_INTERPRETER_PRE_WRITE_BARRIER(&elements[index]);
+                zen_Reference_store(&elements[index], value);
+                ZEN_INTERPRETER_WRITE_BARRIER(array);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_aa` (array = 0x%X, index = %d, value = 0x%X, operand stack = %d)",
+                    array, index, value, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_STATIC_FIELD: { /* store_static_field */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_STATIC_FIELD): { /* store_static_field */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT_OPERAND();
+                /* Retrieve the value from the operand stack. */
+                zen_Slot_t value = *(--stackTop);
+
+                zen_Field_t* field = zen_Interpreter_resolveField(interpreter,
+                    currentStackFrame->m_class, index);
+                if ((field == NULL) || (field->m_index < 0)) {
+                    /* Throw an instance of the zen.core.UnknownFieldException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_FIELD_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                /* The static fields are stored outside the heap, and every
+                 * collection visits them as roots, both when the marking
+                 * begins and when it is finished. Therefore, like a store into
+                 * a local variable, the store requires neither of the write
+                 * barriers.
+                 */
+                field->m_class->m_staticFields[field->m_index] = value;
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_static_field` (index = %d, field = %d, operand stack = %d)",
+                    index, field->m_index, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_STORE_INSTANCE_FIELD: { /* store_instance_field */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_INSTANCE_FIELD): { /* store_instance_field */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT_OPERAND();
+                /* Retrieve the value and the object from the operand stack. */
+                zen_Slot_t value = *(--stackTop);
+                zen_Object_t* object = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+
+                if (object == NULL) {
+                    /* Throw an instance of the zen.core.NullPointerException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_NULL_POINTER_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                zen_Field_t* field = zen_Interpreter_resolveField(interpreter,
+                    currentStackFrame->m_class, index);
+                if ((field == NULL) || (field->m_offset < 0)) {
+                    /* Throw an instance of the zen.core.UnknownFieldException class. */
+                    exception = zen_Interpreter_makeException(interpreter,
+                        ZEN_BOOTSTRAP_CLASS_ZEN_CORE_UNKNOWN_FIELD_EXCEPTION);
+
+                    ZEN_INTERPRETER_SAVE_REGISTERS();
+                    goto exceptionHandler;
+                }
+
+                uint8_t* address = (uint8_t*)object + field->m_offset;
+                switch (field->m_type) {
+                    case 'z':
+                    case 'b': *(int8_t*)address = (int8_t)value.m_integer; break;
+                    case 'c':
+                    case 's': *(int16_t*)address = (int16_t)value.m_integer; break;
+                    case 'i': *(int32_t*)address = value.m_integer; break;
+                    case 'l': *(int64_t*)address = value.m_long; break;
+                    case 'f': *(float*)address = value.m_float; break;
+                    case 'd': *(double*)address = value.m_double; break;
+
+                    default: {
+                        /* The store of a reference is surrounded by both the
+                         * write barriers.
+                         */
+                        zen_Reference_t* reference = (zen_Reference_t*)address;
+                        ZEN_INTERPRETER_PRE_WRITE_BARRIER(reference);
+                        zen_Reference_store(reference, (zen_Object_t*)value.m_reference);
+                        ZEN_INTERPRETER_WRITE_BARRIER(object);
+                        break;
+                    }
+                }
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `store_instance_field` (index = %d, object = 0x%X, offset = %d, operand stack = %d)",
+                    index, object, field->m_offset, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Subtract */
 
-            case ZEN_BYTE_CODE_SUBTRACT_I: { /* subtract_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SUBTRACT_I): { /* subtract_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Subtract the operands. Push the result on the operand stack. */
                 int32_t result = operand1 - operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `subtract_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_SUBTRACT_L: { /* subtract_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SUBTRACT_L): { /* subtract_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Subtract the operands. Push the result on the operand stack. */
                 int64_t result = operand1 - operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `subtract_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_SUBTRACT_F: { /* subtract_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SUBTRACT_F): { /* subtract_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Subtract the operands. Push the result on the operand stack. */
                 float result = operand1 - operand2;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `subtract_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_SUBTRACT_D: { /* subtract_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SUBTRACT_D): { /* subtract_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Subtract the operands. Push the result on the operand stack. */
                 double result = operand1 - operand2;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `subtract_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Swap */
 
-            case ZEN_BYTE_CODE_SWAP: { /* swap */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SWAP): { /* swap */
                 /* Swap the two operands on top of the stack. */
-                zen_OperandStack_swap(currentStackFrame->m_operandStack);
+                zen_Slot_t value1 = stackTop[-1];
+                stackTop[-1] = stackTop[-2];
+                stackTop[-2] = value1;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `swap`");
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Switch */
 
-            case ZEN_BYTE_CODE_SWITCH_TABLE: { /* switch_table */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SWITCH_TABLE): { /* switch_table */
+                int32_t key = ZEN_INTERPRETER_POP_INTEGER();
+
+                int32_t origin = ip - 1;
+                const uint8_t* arguments = instructions + zen_SwitchInstruction_getArgumentIndex(origin);
+                int32_t low = zen_SwitchInstruction_readInteger(arguments + 4);
+                int32_t high = zen_SwitchInstruction_readInteger(arguments + 8);
+
+                /* A single unsigned comparison checks both the bounds of the
+                 * table. A key below `low` wraps around to a large index.
+                 */
+                uint32_t index = (uint32_t)key - (uint32_t)low;
+                int32_t offset = (index <= ((uint32_t)high - (uint32_t)low))?
+                    zen_SwitchInstruction_readInteger(arguments +
+                        ZEN_SWITCH_INSTRUCTION_TABLE_HEADER_SIZE + (index * 4)) :
+                    zen_SwitchInstruction_readInteger(arguments);
+                ZEN_INTERPRETER_BRANCH_BY(origin, offset);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `switch_table` (key = %d, target = %d, operand stack = %d)",
+                    key, ip, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
-            case ZEN_BYTE_CODE_SWITCH_SEARCH: { /* switch_search */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SWITCH_SEARCH): { /* switch_search */
+                int32_t key = ZEN_INTERPRETER_POP_INTEGER();
+
+                int32_t origin = ip - 1;
+                const uint8_t* arguments = instructions + zen_SwitchInstruction_getArgumentIndex(origin);
+                int32_t count = zen_SwitchInstruction_readInteger(arguments + 4);
+                const uint8_t* keys = arguments + ZEN_SWITCH_INSTRUCTION_SEARCH_HEADER_SIZE;
+
+                /* The offsets follow the keys, in the same order. */
+                int32_t index = zen_SwitchInstruction_search(keys, count, key);
+                int32_t offset = (index >= 0)?
+                    zen_SwitchInstruction_readInteger(keys + ((count + index) * 4)) :
+                    zen_SwitchInstruction_readInteger(arguments);
+                ZEN_INTERPRETER_BRANCH_BY(origin, offset);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `switch_search` (key = %d, target = %d, operand stack = %d)",
+                    key, ip, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Throw */
 
-            case ZEN_BYTE_CODE_THROW: { /* throw */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_THROW): { /* throw */
                 /* Retrieve the reference to the exception object from the operand stack. */
-                uintptr_t reference = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-
-                /* Retrieve the class of the exception object. */
-                zen_Object_t* exception = (zen_Object_t*)reference;
-                zen_Class_t* class0 = zen_Object_getClass(exception);
+                exception = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                ZEN_INTERPRETER_SAVE_REGISTERS();
 
+                /* The instructions which fail make their exception, save the
+                 * registers, and continue here.
+                 */
+            exceptionHandler:
                 /* Recursively search the stack trace for the most appropriate
                  * exception handler, nearest to the current stack frame.
                  * The search results in popping of the stack frames. Which goes
                  * to say, the currently executing function may terminate.
+                 * The search does not unwind the stack frames below the one on
+                 * which the loop was entered. They belong to the caller of
+                 * this loop.
                  */
-                do {
+                while (true) {
                     if (zen_Interpreter_hasExceptionHandler(interpreter, currentStackFrame)) {
+                        /* The registers now belong to the function with the suitable
+                         * exception handler.
+                         */
+                        ZEN_INTERPRETER_LOAD_REGISTERS();
+
                         /* Push the reference to the exception object on top of the operand
                          * stack belonging to the function with the suitable exception
                          * handler. This reference is required by the "catch clause".
                          */
-                        zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                        ZEN_INTERPRETER_PUSH_REFERENCE(exception);
+                        exception = NULL;
 
                         /* A suitable exception handler has been discovered. Terminate the search
                          * loop.
@@ -3424,34 +4953,33 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     /* A suitable exception handler was not found. Move to the previous stack
                      * frame and repeat.
                      */
-                    currentStackFrame = zen_InvocationStack_popStackFrame(interpreter->m_invocationStack);
+                    bool entry = (currentStackFrame == entryStackFrame);
+                    currentStackFrame = zen_InvocationStack_popStackFrame(invocationStack);
+                    if (entry) {
+                        /* The exception escapes the function on which the loop was
+                         * entered. The caller of this loop finds it on the thread.
+                         */
+                        interpreter->m_processorThread->m_exception = exception;
 
-                    exceptionHandler: {
+                        /* No exception handler has been discovered in the stack trace.
+                         * Invoke the thread level exception handler.
+                         */
+                        if (currentStackFrame == NULL) {
+                            zen_Interpreter_invokeThreadExceptionHandler(interpreter);
+                        }
+                        return;
                     }
                 }
-                while (currentStackFrame != NULL);
-
-                /* No exception handler has been discovered in the stack trace. Invoke the thread
-                 * level exception handler.
-                 */
-                if (currentStackFrame == NULL) {
-                    /* Invoking an exception handler function causes the interpreter to insert
-                     * a stack frame. The primary loop continues normally. It is terminated
-                     * when a `return` (includes the other variations, too) instruction is
-                     * encountered.
-                     */
-                    zen_Interpreter_invokeThreadExceptionHandler(interpreter);
-                }
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `throw`");
 
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
 
             /* Wide */
 
-            case ZEN_BYTE_CODE_WIDE: { /* wide */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_WIDE): { /* wide */
                 /* Flag the interpreter to switch to wide mode. Only certain instructions are
                  * supported in the wide mode.
                  */
@@ -3460,12 +4988,121 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 /* Log debugging information for assistance in debugging the interpreter. */
                 xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed instruction `wide`");
 
-                break;
+                ZEN_INTERPRETER_NEXT();
+            }
+
+            /* Superinstructions
+             *
+             * The arguments of the constituent instructions are read at their
+             * original offsets, relative to the first argument of the sequence.
+             * The byte codes of the constituent instructions are skipped.
+             */
+
+            ZEN_INTERPRETER_CASE(ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I): { /* load_i; load_i */
+                uint8_t index1 = instructions[ip];
+                uint8_t index2 = instructions[ip + 2];
+                ip += 3;
+
+                ZEN_INTERPRETER_PUSH_INTEGER(ZEN_INTERPRETER_GET_LOCAL_INTEGER(index1));
+                ZEN_INTERPRETER_PUSH_INTEGER(ZEN_INTERPRETER_GET_LOCAL_INTEGER(index2));
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed superinstruction `load_i; load_i` (index1 = %d, index2 = %d, operand stack = %d)",
+                    index1, index2, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
             }
 
-            default: {
+            ZEN_INTERPRETER_CASE(ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_ADD_I_STORE_I): { /* load_i; load_i; add_i; store_i */
+                uint8_t index1 = instructions[ip];
+                uint8_t index2 = instructions[ip + 2];
+                uint8_t index3 = instructions[ip + 5];
+                ip += 6;
+
+                /* The operands never touch the operand stack. */
+                int32_t result = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index1) +
+                    ZEN_INTERPRETER_GET_LOCAL_INTEGER(index2);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(index3, result);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed superinstruction `load_i; load_i; add_i; store_i` (index1 = %d, index2 = %d, index3 = %d, result = %d)",
+                    index1, index2, index3, result);
+
+                ZEN_INTERPRETER_NEXT();
+            }
+
+            ZEN_INTERPRETER_CASE(ZEN_SUPERINSTRUCTION_LOAD_I_LOAD_I_JUMP_LT_I): { /* load_i; load_i; jump_lt_i */
+                int32_t operand1 = ZEN_INTERPRETER_GET_LOCAL_INTEGER(instructions[ip]);
+                int32_t operand2 = ZEN_INTERPRETER_GET_LOCAL_INTEGER(instructions[ip + 2]);
+
+                if (operand1 < operand2) {
+                    /* The branch belongs to the `jump_lt_i` instruction. */
+                    ZEN_INTERPRETER_BRANCH_FROM(ip + 3);
+                }
+                else {
+                    ip += 6;
+                }
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed superinstruction `load_i; load_i; jump_lt_i` (operand1 = %d, operand2 = %d)",
+                    operand1, operand2);
+
+                ZEN_INTERPRETER_NEXT();
+            }
+
+            ZEN_INTERPRETER_CASE(ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_ADD_I_STORE_I): { /* load_i; push_iN; add_i; store_i */
+                uint8_t index1 = instructions[ip];
+                int32_t constant = ZEN_SUPERINSTRUCTION_PUSH_IN_VALUE(instructions[ip + 1]);
+                uint8_t index2 = instructions[ip + 4];
+                ip += 5;
+
+                int32_t result = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index1) + constant;
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(index2, result);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed superinstruction `load_i; push_iN; add_i; store_i` (index1 = %d, constant = %d, index2 = %d, result = %d)",
+                    index1, constant, index2, result);
+
+                ZEN_INTERPRETER_NEXT();
+            }
+
+            ZEN_INTERPRETER_CASE(ZEN_SUPERINSTRUCTION_LOAD_I_PUSH_IN_JUMP_LT_I): { /* load_i; push_iN; jump_lt_i */
+                int32_t operand1 = ZEN_INTERPRETER_GET_LOCAL_INTEGER(instructions[ip]);
+                int32_t operand2 = ZEN_SUPERINSTRUCTION_PUSH_IN_VALUE(instructions[ip + 1]);
+
+                if (operand1 < operand2) {
+                    /* The branch belongs to the `jump_lt_i` instruction. */
+                    ZEN_INTERPRETER_BRANCH_FROM(ip + 2);
+                }
+                else {
+                    ip += 5;
+                }
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed superinstruction `load_i; push_iN; jump_lt_i` (operand1 = %d, operand2 = %d)",
+                    operand1, operand2);
+
+                ZEN_INTERPRETER_NEXT();
+            }
+
+            ZEN_INTERPRETER_CASE(ZEN_SUPERINSTRUCTION_LOAD_A_LOAD_A): { /* load_a; load_a */
+                uint8_t index1 = instructions[ip];
+                uint8_t index2 = instructions[ip + 2];
+                ip += 3;
+
+                ZEN_INTERPRETER_PUSH_REFERENCE(ZEN_INTERPRETER_GET_LOCAL_REFERENCE(index1));
+                ZEN_INTERPRETER_PUSH_REFERENCE(ZEN_INTERPRETER_GET_LOCAL_REFERENCE(index2));
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                xjtk_Logger_debug(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Executed superinstruction `load_a; load_a` (index1 = %d, index2 = %d, operand stack = %d)",
+                    index1, index2, ZEN_INTERPRETER_STACK_SIZE());
+
+                ZEN_INTERPRETER_NEXT();
+            }
+
+            ZEN_INTERPRETER_DEFAULT(): {
                 fprintf(stderr, "[error] Unknown instruction `%X`\n", instruction);
-                break;
+                ZEN_INTERPRETER_NEXT();
             }
         }
     }
@@ -3482,9 +5119,7 @@ void zen_Interpreter_invokeNativeFunction(zen_Interpreter_t* interpreter,
 void zen_Interpreter_invokeStaticFunction(zen_Interpreter_t* interpreter,
     zen_Function_t* function, jtk_Array_t* arguments) {
 
-    zen_StackFrame_t* stackFrame = zen_StackFrame_new(function);
-    zen_InvocationStack_pushStackFrame(interpreter->m_invocationStack, stackFrame);
-
+    /* Native functions do not require a stack frame. */
     if (zen_Function_isNative(function)) {
         zen_NativeFunction_t* nativeFunction = zen_VirtualMachine_getNativeFunction(
             interpreter->m_virtualMachine, function->m_name, function->m_descriptor);
@@ -3497,6 +5132,20 @@ void zen_Interpreter_invokeStaticFunction(zen_Interpreter_t* interpreter,
         }
     }
     else {
+        zen_InvocationStack_t* invocationStack = interpreter->m_processorThread->m_invocationStack;
+        zen_StackFrame_t* stackFrame = zen_InvocationStack_pushStackFrame(invocationStack,
+            function, 0);
+
+        /* The arguments are references. They occupy the first local variables
+         * of the stack frame.
+         */
+        int32_t size = (arguments != NULL)? jtk_Array_getSize(arguments) : 0;
+        int32_t i;
+        for (i = 0; (i < size) && (i < stackFrame->m_localVariableArray.m_size); i++) {
+            stackFrame->m_localVariableArray.m_values[i].m_reference =
+                (uintptr_t)jtk_Array_getValue(arguments, i);
+        }
+
         zen_Interpreter_interpret(interpreter);
     }
 }
@@ -3504,8 +5153,8 @@ void zen_Interpreter_invokeStaticFunction(zen_Interpreter_t* interpreter,
 void zen_Interpreter_invokeStaticFunctionEx(zen_Interpreter_t* interpreter,
     zen_Function_t* function, jtk_VariableArguments_t variableArguments) {
 
-    zen_StackFrame_t* stackFrame = zen_StackFrame_new(function);
-    zen_InvocationStack_pushStackFrame(interpreter->m_invocationStack, stackFrame);
+    zen_InvocationStack_pushStackFrame(interpreter->m_processorThread->m_invocationStack,
+        function, 0);
     zen_Interpreter_interpret(interpreter);
 }
 
@@ -3513,31 +5162,3 @@ void zen_Interpreter_invokeStaticFunctionEx(zen_Interpreter_t* interpreter,
 
 void zen_Interpreter_invokeThreadExceptionHandler(zen_Interpreter_t* interpreter) {
 }
-
-/* Read */
-
-uint8_t zen_Interpreter_readByte(zen_Interpreter_t* interpreter) {
-    zen_StackFrame_t* currentStackFrame = zen_InvocationStack_peekStackFrame(interpreter->m_invocationStack);
-    zen_InstructionAttribute_t* instructionAttribute = currentStackFrame->m_instructionAttribute;
-
-    return instructionAttribute->m_instructions[currentStackFrame->m_ip++];
-}
-
-uint16_t zen_Interpreter_readShort(zen_Interpreter_t* interpreter) {
-zen_StackFrame_t* currentStackFrame = zen_InvocationStack_peekStackFrame(interpreter->m_invocationStack);
-    zen_InstructionAttribute_t* instructionAttribute = currentStackFrame->m_instructionAttribute;
-
-    uint8_t byte0 = instructionAttribute->m_instructions[currentStackFrame->m_ip++];
-    uint8_t byte1 = instructionAttribute->m_instructions[currentStackFrame->m_ip++];
-    return (byte0 << 8) | byte1;
-}
-
-
-
-
-
-
-uint8_t* zen_MemoryManager_allocateEx(zen_MemoryManager_t* manager, uint32_t size, zen_AlignmentConstraint_t alignment,
-    int32_t flags) {
-    return NULL;
-}
\ No newline at end of file
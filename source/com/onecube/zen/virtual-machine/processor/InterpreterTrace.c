@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+#include <com/onecube/zen/virtual-machine/processor/InterpreterTrace.h>
+
+/*******************************************************************************
+ * InterpreterTrace                                                            *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_InterpreterTrace_t* zen_InterpreterTrace_new() {
+    zen_InterpreterTrace_t* trace = jtk_Memory_allocate(zen_InterpreterTrace_t, 1);
+    trace->m_records = jtk_Memory_allocate(zen_InterpreterTraceRecord_t,
+        ZEN_INTERPRETER_TRACE_CAPACITY);
+    trace->m_count = 0;
+
+    return trace;
+}
+
+/* Destructor */
+
+void zen_InterpreterTrace_delete(zen_InterpreterTrace_t* trace) {
+    jtk_Assert_assertObject(trace, "The specified trace is null.");
+
+    jtk_Memory_deallocate(trace->m_records);
+    jtk_Memory_deallocate(trace);
+}
+
+/* Size */
+
+int32_t zen_InterpreterTrace_getSize(zen_InterpreterTrace_t* trace) {
+    jtk_Assert_assertObject(trace, "The specified trace is null.");
+
+    return (trace->m_count < ZEN_INTERPRETER_TRACE_CAPACITY)?
+        (int32_t)trace->m_count : ZEN_INTERPRETER_TRACE_CAPACITY;
+}
+
+/* Write */
+
+void zen_InterpreterTrace_write(zen_InterpreterTrace_t* trace, FILE* stream) {
+    jtk_Assert_assertObject(trace, "The specified trace is null.");
+    jtk_Assert_assertObject(stream, "The specified stream is null.");
+
+    int32_t size = zen_InterpreterTrace_getSize(trace);
+    /* When the ring buffer has wrapped around, the oldest record is the one
+     * that will be overwritten next.
+     */
+    int32_t first = (int32_t)((trace->m_count - size) & (ZEN_INTERPRETER_TRACE_CAPACITY - 1));
+    int32_t tail = ZEN_INTERPRETER_TRACE_CAPACITY - first;
+    if (tail > size) {
+        tail = size;
+    }
+
+    fwrite(trace->m_records + first, sizeof (zen_InterpreterTraceRecord_t), tail, stream);
+    fwrite(trace->m_records, sizeof (zen_InterpreterTraceRecord_t), size - tail, stream);
+}
@@ -16,8 +16,44 @@
 
 // Tuesday, March 26, 2019
 
+#include <jtk/core/Assert.h>
 #include <com/onecube/zen/virtual-machine/processor/InvocationStack.h>
 
+#include <string.h>
+
+/*******************************************************************************
+ * InvocationStackSegment                                                      *
+ *******************************************************************************/
+
+/* The number of slots occupied by the header of a stack frame. A slot is at
+ * least as wide as a pointer. Therefore, a stack frame which begins at a slot
+ * boundary is always aligned.
+ */
+#define ZEN_INVOCATION_STACK_FRAME_SLOT_COUNT \
+    ((int32_t)((sizeof (zen_StackFrame_t) + sizeof (zen_Slot_t) - 1) / sizeof (zen_Slot_t)))
+
+/* Constructor */
+
+zen_InvocationStackSegment_t* zen_InvocationStackSegment_new(int32_t capacity,
+    zen_InvocationStackSegment_t* previous) {
+    zen_InvocationStackSegment_t* segment = (zen_InvocationStackSegment_t*)jtk_Memory_allocate(
+        uint8_t, sizeof (zen_InvocationStackSegment_t) + (sizeof (zen_Slot_t) * capacity));
+    segment->m_previous = previous;
+    segment->m_next = NULL;
+    segment->m_limit = segment->m_slots + capacity;
+    segment->m_capacity = capacity;
+
+    return segment;
+}
+
+/* Destructor */
+
+void zen_InvocationStackSegment_delete(zen_InvocationStackSegment_t* segment) {
+    jtk_Assert_assertObject(segment, "The specified segment is null.");
+
+    jtk_Memory_deallocate(segment);
+}
+
 /*******************************************************************************
  * InvocationStack                                                             *
  *******************************************************************************/
@@ -26,7 +62,10 @@
 
 zen_InvocationStack_t* zen_InvocationStack_new() {
     zen_InvocationStack_t* invocationStack = jtk_Memory_allocate(zen_InvocationStack_t, 1);
-    invocationStack->m_stackFrames = jtk_DoublyLinkedList_new();
+    invocationStack->m_segment = zen_InvocationStackSegment_new(
+        ZEN_INVOCATION_STACK_SEGMENT_SIZE, NULL);
+    invocationStack->m_currentStackFrame = NULL;
+    invocationStack->m_depth = 0;
 
     return invocationStack;
 }
@@ -36,43 +75,171 @@ zen_InvocationStack_t* zen_InvocationStack_new() {
 void zen_InvocationStack_delete(zen_InvocationStack_t* invocationStack) {
     jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
 
-    jtk_DoublyLinkedList_delete(invocationStack->m_stackFrames);
+    /* Rewind to the first segment. The segments that follow the current
+     * segment are spare segments.
+     */
+    zen_InvocationStackSegment_t* segment = invocationStack->m_segment;
+    while (segment->m_previous != NULL) {
+        segment = segment->m_previous;
+    }
+
+    while (segment != NULL) {
+        zen_InvocationStackSegment_t* next = segment->m_next;
+        zen_InvocationStackSegment_delete(segment);
+        segment = next;
+    }
+
     jtk_Memory_deallocate(invocationStack);
 }
 
 /* Current Stack Frame */
 
 zen_StackFrame_t* zen_InvocationStack_getCurrentStackFrame(zen_InvocationStack_t* invocationStack) {
+    jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
+
+    return invocationStack->m_currentStackFrame;
 }
 
-/* Iterator */
+/* Depth */
 
-jtk_Iterator_t* zen_InvocationStack_getIterator(zen_InvocationStack_t* invocationStack) {
+int32_t zen_InvocationStack_getDepth(zen_InvocationStack_t* invocationStack) {
     jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
 
-    return jtk_DoublyLinkedList_getIterator(invocationStack->m_stackFrames);
+    return invocationStack->m_depth;
 }
 
-/* Push/Pop Stack Frame */
+/* Push/Peek/Pop Stack Frame */
 
-void zen_InvocationStack_pushStackFrame(zen_InvocationStack_t* invocationStack,
-    zen_StackFrame_t* stackFrame) {
+zen_StackFrame_t* zen_InvocationStack_pushStackFrame(zen_InvocationStack_t* invocationStack,
+    zen_Function_t* function, int32_t argumentSlotCount) {
     jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
-    jtk_Assert_assertObject(stackFrame, "The specified stack frame is null.");
-
-    jtk_DoublyLinkedList_addFirst(invocationStack->m_stackFrames, stackFrame);
+    jtk_Assert_assertObject(function, "The specified function is null.");
+
+    zen_StackFrame_t* caller = invocationStack->m_currentStackFrame;
+    zen_InstructionAttribute_t* instructionAttribute = function->m_instructionAttribute;
+
+    int32_t maxStackSize = 0;
+    int32_t localVariableCount = argumentSlotCount;
+    if (instructionAttribute != NULL) {
+        maxStackSize = instructionAttribute->m_maxStackSize;
+        if (instructionAttribute->m_localVariableCount > localVariableCount) {
+            localVariableCount = instructionAttribute->m_localVariableCount;
+        }
+    }
+
+    /* The local variables of the callee begin where the arguments on the
+     * operand stack of the caller begin. Without a caller, the local variables
+     * begin at the bottom of the current segment.
+     */
+    zen_Slot_t* arguments = NULL;
+    zen_Slot_t* base = invocationStack->m_segment->m_slots;
+    if (caller != NULL) {
+        jtk_Assert_assertTrue(caller->m_operandStack.m_size >= argumentSlotCount,
+            "The operand stack of the caller does not contain the arguments.");
+
+        caller->m_operandStack.m_size -= argumentSlotCount;
+        arguments = caller->m_operandStack.m_values + caller->m_operandStack.m_size;
+        base = arguments;
+    }
+    else {
+        jtk_Assert_assertTrue(argumentSlotCount == 0,
+            "The bottommost stack frame cannot receive arguments from the operand stack.");
+    }
+
+    int32_t requiredSlotCount = localVariableCount +
+        ZEN_INVOCATION_STACK_FRAME_SLOT_COUNT + maxStackSize;
+    if ((base + requiredSlotCount) > invocationStack->m_segment->m_limit) {
+        /* The current segment is exhausted. Continue in the next segment, reusing
+         * a spare segment when it is large enough.
+         */
+        zen_InvocationStackSegment_t* segment = invocationStack->m_segment;
+        zen_InvocationStackSegment_t* next = segment->m_next;
+        if ((next != NULL) && (next->m_capacity < requiredSlotCount)) {
+            /* The spare segments are discarded because they are too small. */
+            while (next != NULL) {
+                zen_InvocationStackSegment_t* temporary = next->m_next;
+                zen_InvocationStackSegment_delete(next);
+                next = temporary;
+            }
+            segment->m_next = NULL;
+        }
+
+        if (next == NULL) {
+            int32_t capacity = ZEN_INVOCATION_STACK_SEGMENT_SIZE;
+            if (capacity < requiredSlotCount) {
+                capacity = requiredSlotCount;
+            }
+            next = zen_InvocationStackSegment_new(capacity, segment);
+            segment->m_next = next;
+        }
+
+        /* The arguments cannot overlap across segments. Copy them to the
+         * bottom of the next segment.
+         */
+        if (argumentSlotCount > 0) {
+            memcpy(next->m_slots, arguments, sizeof (zen_Slot_t) * argumentSlotCount);
+        }
+        base = next->m_slots;
+        invocationStack->m_segment = next;
+    }
+
+    /* The compiler forces the initialization of the local variables. However,
+     * the garbage collector may scan the local variables before they are
+     * initialized. Therefore, the slots which do not hold arguments are
+     * cleared.
+     */
+    if (localVariableCount > argumentSlotCount) {
+        memset(base + argumentSlotCount, 0,
+            sizeof (zen_Slot_t) * (localVariableCount - argumentSlotCount));
+    }
+
+    zen_StackFrame_t* stackFrame = (zen_StackFrame_t*)(base + localVariableCount);
+    stackFrame->m_localVariableArray.m_values = base;
+    stackFrame->m_localVariableArray.m_size = localVariableCount;
+    stackFrame->m_operandStack.m_values = ((zen_Slot_t*)stackFrame) + ZEN_INVOCATION_STACK_FRAME_SLOT_COUNT;
+    stackFrame->m_operandStack.m_size = 0;
+    stackFrame->m_operandStack.m_capacity = maxStackSize;
+    stackFrame->m_class = function->m_class;
+    stackFrame->m_function = function;
+    stackFrame->m_instructionAttribute = instructionAttribute;
+    stackFrame->m_ip = 0;
+    stackFrame->m_previous = caller;
+
+    invocationStack->m_currentStackFrame = stackFrame;
+    invocationStack->m_depth++;
+
+    return stackFrame;
 }
 
 zen_StackFrame_t* zen_InvocationStack_peekStackFrame(zen_InvocationStack_t* invocationStack) {
     jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
 
-    return jtk_DoublyLinkedList_isEmpty(invocationStack->m_stackFrames)?
-        NULL : (zen_StackFrame_t*)jtk_DoublyLinkedList_getFirst(invocationStack->m_stackFrames);
+    return invocationStack->m_currentStackFrame;
 }
 
 zen_StackFrame_t* zen_InvocationStack_popStackFrame(zen_InvocationStack_t* invocationStack) {
-    jtk_Assert_assertTrue(!jtk_DoublyLinkedList_isEmpty(invocationStack->m_stackFrames),
+    jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
+    jtk_Assert_assertTrue(invocationStack->m_currentStackFrame != NULL,
         "The specified invocation stack is empty.");
 
-    return (zen_StackFrame_t*)jtk_DoublyLinkedList_getFirst(invocationStack->m_stackFrames);
+    zen_StackFrame_t* stackFrame = invocationStack->m_currentStackFrame;
+    zen_StackFrame_t* caller = stackFrame->m_previous;
+
+    /* When the callee was carved out at the bottom of a segment, the caller
+     * lives in the previous segment. The vacated segment is retained as a
+     * spare.
+     */
+    zen_InvocationStackSegment_t* segment = invocationStack->m_segment;
+    if ((caller != NULL) && (segment->m_previous != NULL) &&
+        (stackFrame->m_localVariableArray.m_values == segment->m_slots)) {
+        zen_Slot_t* slot = (zen_Slot_t*)caller;
+        if ((slot < segment->m_slots) || (slot >= segment->m_limit)) {
+            invocationStack->m_segment = segment->m_previous;
+        }
+    }
+
+    invocationStack->m_currentStackFrame = caller;
+    invocationStack->m_depth--;
+
+    return caller;
 }
\ No newline at end of file
@@ -23,21 +23,9 @@
  * LocalVariableArray                                                          *
  *******************************************************************************/
 
-#define ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT_1 1
-#define ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT_2 2
-#define ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT (sizeof (void*) <= 4)? \
-    ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT_1 : ((sizeof (void*) <= 8)? \
-    ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT_2 : zen_LocalVariableArray_referenceSlotCountError())
-
-int32_t zen_LocalVariableArray_referenceSlotCountError() {
-    fprintf(stderr, "[internal error] Pointer type occupies more than 8 bytes. A reference cannot occupy more than two slots in the local variable array.\n");
-    exit(0);
-
-    return -1;
-}
-
-/* The local variable array realises all its entries as 32-bit patterns.
- * Therefore, each entry is represented as `uint32_t`.
+/* Every local variable, irrespective of its type, occupies exactly one slot in
+ * the local variable array. Therefore, 64-bit values and references are stored
+ * and loaded in a single shot.
  */
 
 /* Constructor */
@@ -47,7 +35,7 @@ int32_t zen_LocalVariableArray_referenceSlotCountError() {
  */
 zen_LocalVariableArray_t* zen_LocalVariableArray_new(int32_t size) {
     zen_LocalVariableArray_t* localVariableArray = jtk_Memory_allocate(zen_LocalVariableArray_t, 1);
-    localVariableArray->m_values = (size > 0)? jtk_Memory_allocate(uint32_t, size) : NULL;
+    localVariableArray->m_values = (size > 0)? jtk_Memory_allocate(zen_Slot_t, size) : NULL;
     localVariableArray->m_size = size;
 
     return localVariableArray;
@@ -70,28 +58,17 @@ void zen_LocalVariableArray_delete(zen_LocalVariableArray_t* localVariableArray)
 double zen_LocalVariableArray_getDouble(zen_LocalVariableArray_t* localVariableArray,
     int32_t index) {
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
-    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index (high part) is invalid.");
-    jtk_Assert_assertTrue((index + 1 >= 0) && (index + 1 < localVariableArray->m_size), "The specified index (low part) is invalid.");
-
-    uint32_t highPart = localVariableArray->m_values[index];
-    uint32_t lowPart = localVariableArray->m_values[index + 1];
-    uint64_t result = (((uint64_t)highPart << 32) | lowPart);
+    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    return *((double*)(&result));
+    return localVariableArray->m_values[index].m_double;
 }
 
 void zen_LocalVariableArray_setDouble(zen_LocalVariableArray_t* localVariableArray,
     int32_t index, double value) {
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
-    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index (high part) is invalid.");
-    jtk_Assert_assertTrue((index + 1 >= 0) && (index + 1 < localVariableArray->m_size), "The specified index (low part) is invalid.");
-
-    uint64_t value0 = *((int64_t*)(&value));
-    uint32_t highPart = (uint32_t)((value0 & 0xFFFFFFFF00000000L) >> 32);
-    uint32_t lowPart = (uint32_t)(value0 & 0xFFFFFFFFL);
+    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    localVariableArray->m_values[index] = highPart;
-    localVariableArray->m_values[index + 1] = lowPart;
+    localVariableArray->m_values[index].m_double = value;
 }
 
 /* Float */
@@ -101,17 +78,15 @@ float zen_LocalVariableArray_getFloat(zen_LocalVariableArray_t* localVariableArr
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
     jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    uint32_t result = localVariableArray->m_values[index];
-
-    return *((float*)(&result));
+    return localVariableArray->m_values[index].m_float;
 }
 
 void zen_LocalVariableArray_setFloat(zen_LocalVariableArray_t* localVariableArray,
     int32_t index, float value) {
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
-    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index (high part) is invalid.");
+    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    localVariableArray->m_values[index] = *((uint32_t*)(&value));
+    localVariableArray->m_values[index].m_float = value;
 }
 
 /* Integer */
@@ -121,7 +96,7 @@ int32_t zen_LocalVariableArray_getInteger(zen_LocalVariableArray_t* localVariabl
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
     jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    return (int32_t)localVariableArray->m_values[index];
+    return localVariableArray->m_values[index].m_integer;
 }
 
 void zen_LocalVariableArray_setInteger(zen_LocalVariableArray_t* localVariableArray,
@@ -129,7 +104,7 @@ void zen_LocalVariableArray_setInteger(zen_LocalVariableArray_t* localVariableAr
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
     jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    localVariableArray->m_values[index] = value;
+    localVariableArray->m_values[index].m_integer = value;
 }
 
 /* Long */
@@ -137,26 +112,17 @@ void zen_LocalVariableArray_setInteger(zen_LocalVariableArray_t* localVariableAr
 int64_t zen_LocalVariableArray_getLong(zen_LocalVariableArray_t* localVariableArray,
     int32_t index) {
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
-    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index (high part) is invalid.");
-    jtk_Assert_assertTrue((index + 1 >= 0) && (index + 1 < localVariableArray->m_size), "The specified index (low part) is invalid.");
-
-    uint32_t highPart = localVariableArray->m_values[index];
-    uint32_t lowPart = localVariableArray->m_values[index + 1];
+    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    return (((uint64_t)highPart << 32) | lowPart);
+    return localVariableArray->m_values[index].m_long;
 }
 
 void zen_LocalVariableArray_setLong(zen_LocalVariableArray_t* localVariableArray,
     int32_t index, int64_t value) {
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
-    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index (high part) is invalid.");
-    jtk_Assert_assertTrue((index + 1 >= 0) && (index + 1 < localVariableArray->m_size), "The specified index (low part) is invalid.");
-
-    uint32_t highPart = (uint32_t)((value & 0xFFFFFFFF00000000L) >> 32);
-    uint32_t lowPart = (uint32_t)(value & 0xFFFFFFFFL);
+    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    localVariableArray->m_values[index] = highPart;
-    localVariableArray->m_values[index + 1] = lowPart;
+    localVariableArray->m_values[index].m_long = value;
 }
 
 /* Reference */
@@ -164,60 +130,18 @@ void zen_LocalVariableArray_setLong(zen_LocalVariableArray_t* localVariableArray
 uintptr_t zen_LocalVariableArray_getReference(zen_LocalVariableArray_t* localVariableArray,
     int32_t index) {
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
+    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    uintptr_t result = 0;
     /* A null reference is represented with the integer value of 0. */
-    switch (ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT) {
-        case ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT_1: {
-            jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
-
-            result = (uintptr_t)localVariableArray->m_values[index];
-
-            break;
-        }
-
-        case ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT_2: {
-            jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index (high part) is invalid.");
-            jtk_Assert_assertTrue((index + 1 >= 0) && (index + 1 < localVariableArray->m_size), "The specified index (low part) is invalid.");
-
-            uint32_t highPart = localVariableArray->m_values[index];
-            uint32_t lowPart = localVariableArray->m_values[index + 1];
-            result = (uintptr_t)(((uint64_t)highPart << 32) | lowPart);
-
-            break;
-        }
-    }
-
-    return result;
+    return localVariableArray->m_values[index].m_reference;
 }
 
-/* NOTE: This function is implemented with the assumption that the size of
- *       a given platform is lesser than or equal to eight bytes.
- */
 void zen_LocalVariableArray_setReference(zen_LocalVariableArray_t* localVariableArray,
     int32_t index, uintptr_t reference) {
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
+    jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
 
-    /* A null reference is represented with the integer value of 0. */
-    switch (ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT) {
-        case ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT_1: {
-            jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index is invalid.");
-
-            localVariableArray->m_values[index] = (uint32_t)reference;
-
-            break;
-        }
-
-        case ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT_2: {
-            jtk_Assert_assertTrue((index >= 0) && (index < localVariableArray->m_size), "The specified index (high part) is invalid.");
-            jtk_Assert_assertTrue((index + 1 >= 0) && (index + 1 < localVariableArray->m_size), "The specified index (low part) is invalid.");
-
-            localVariableArray->m_values[index] = (uint32_t)(((uint64_t)reference & 0xFFFFFFFF00000000L) >> 32);
-            localVariableArray->m_values[index + 1] = (uint32_t)((uint64_t)reference & 0xFFFFFFFFL);
-
-            break;
-        }
-    }
+    localVariableArray->m_values[index].m_reference = reference;
 }
 
 /* Size */
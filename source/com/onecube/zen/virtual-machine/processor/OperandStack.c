@@ -20,28 +20,20 @@
 
 #include <com/onecube/zen/virtual-machine/processor/OperandStack.h>
 
-#define ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_1 1
-#define ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_2 2
-#define ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT (sizeof (void*) <= 4)? \
-    ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_1 : ((sizeof (void*) <= 8)? \
-    ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_2 : zen_OperandStack_referenceSlotCountError())
-
-int32_t zen_OperandStack_referenceSlotCountError() {
-    fprintf(stderr, "[internal error] Pointer type occupies more than 8 bytes. A reference cannot occupy more than two slots in the operand stack.\n");
-    exit(0);
-
-    return -1;
-}
-
 /*******************************************************************************
  * OperandStack                                                                *
  *******************************************************************************/
 
+/* Every operand, irrespective of its type, occupies exactly one slot in the
+ * operand stack. Therefore, 64-bit values and references are stored and loaded
+ * in a single shot.
+ */
+
 /* Constructor */
 
 zen_OperandStack_t* zen_OperandStack_new(int32_t capacity) {
     zen_OperandStack_t* stack = jtk_Memory_allocate(zen_OperandStack_t, 1);
-    stack->m_values = (capacity > 0)? jtk_Memory_allocate(uint32_t, capacity) : NULL;
+    stack->m_values = (capacity > 0)? jtk_Memory_allocate(zen_Slot_t, capacity) : NULL;
     stack->m_size = 0;
     stack->m_capacity = capacity;
 
@@ -117,89 +109,62 @@ bool zen_OperandStack_isEmpty(zen_OperandStack_t* stack) {
 double zen_OperandStack_peekDouble(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 2 words.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
-    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 2), "Operand stack underflow");
-
-    int32_t lowPart = stack->m_values[stack->m_size - 1];
-    int32_t highPart = stack->m_values[stack->m_size - 2];
-    int64_t result = (((uint32_t)highPart << 32) | lowPart);
+    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    return *((double*)(&result));
+    return stack->m_values[stack->m_size - 1].m_double;
 }
 
 float zen_OperandStack_peekFloat(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 1 word.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
     jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    uint32_t result = stack->m_values[stack->m_size - 1];
-
-    return *((float*)(&result));
+    return stack->m_values[stack->m_size - 1].m_float;
 }
 
 int32_t zen_OperandStack_peekInteger(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 1 word.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
     jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    return stack->m_values[stack->m_size - 1];
+    return stack->m_values[stack->m_size - 1].m_integer;
 }
 
 int64_t zen_OperandStack_peekLong(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 2 words.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
-    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 2), "Operand stack underflow");
-
-    uint32_t lowPart = stack->m_values[stack->m_size - 1];
-    uint32_t highPart = stack->m_values[stack->m_size - 2];
+    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    return (((uint64_t)highPart << 32) | lowPart);
+    return stack->m_values[stack->m_size - 1].m_long;
 }
 
 uintptr_t zen_OperandStack_peekReference(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 2 words.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
-    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack,
-        ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT), "Operand stack underflow");
-
-    uintptr_t result = 0;
-        /* A null reference is represented with the integer value of 0. */
-    switch (ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT) {
-        case ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_1: {
-            result = (uintptr_t)stack->m_values[stack->m_size - 1];
-
-            break;
-        }
-
-        case ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_2: {
-            uint32_t lowPart = stack->m_values[stack->m_size - 1];
-            uint32_t highPart = stack->m_values[stack->m_size - 2];
-            result = (uintptr_t)(((uint64_t)highPart << 32) | lowPart);
-
-            break;
-        }
-    }
+    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    return result;
+    /* A null reference is represented with the integer value of 0. */
+    return stack->m_values[stack->m_size - 1].m_reference;
 }
 
 // Push
@@ -207,101 +172,74 @@ uintptr_t zen_OperandStack_peekReference(zen_OperandStack_t* stack) {
 void zen_OperandStack_pushDouble(zen_OperandStack_t* stack, double value) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 2 words.
+    /* Check whether the operand stack has, at least, 1 free slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
-    jtk_Assert_assertTrue(zen_OperandStack_isSpaceAvailable(stack, 2), "Operand stack overflow");
-
-    int64_t value0 = *((int64_t*)(&value));
-    int32_t highPart = (uint32_t)((value0 & 0xFFFFFFFF00000000L) >> 32);
-    int32_t lowPart = (uint32_t)(value0 & 0xFFFFFFFFL);
+    jtk_Assert_assertTrue(zen_OperandStack_isSpaceAvailable(stack, 1), "Operand stack overflow");
 
-    stack->m_values[stack->m_size++] = highPart;
-    stack->m_values[stack->m_size++] = lowPart;
+    stack->m_values[stack->m_size++].m_double = value;
 }
 
 void zen_OperandStack_pushFloat(zen_OperandStack_t* stack, float value) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 1 word.
+    /* Check whether the operand stack has, at least, 1 free slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
     jtk_Assert_assertTrue(zen_OperandStack_isSpaceAvailable(stack, 1), "Operand stack overflow");
 
-    stack->m_values[stack->m_size++] = *((uint32_t*)(&value));
+    stack->m_values[stack->m_size++].m_float = value;
 }
 
 void zen_OperandStack_pushInteger(zen_OperandStack_t* stack, int32_t value) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 1 word.
+    /* Check whether the operand stack has, at least, 1 free slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
     jtk_Assert_assertTrue(zen_OperandStack_isSpaceAvailable(stack, 1), "Operand stack overflow");
 
-    stack->m_values[stack->m_size++] = value;
+    stack->m_values[stack->m_size++].m_integer = value;
 }
 
 void zen_OperandStack_pushLong(zen_OperandStack_t* stack, int64_t value) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 2 words.
+    /* Check whether the operand stack has, at least, 1 free slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
-    jtk_Assert_assertTrue(zen_OperandStack_isSpaceAvailable(stack, 2), "Operand stack overflow");
-
-    int32_t highPart = (int32_t)((value & 0xFFFFFFFF00000000L) >> 32);
-    int32_t lowPart = (int32_t)(value & 0xFFFFFFFFL);
+    jtk_Assert_assertTrue(zen_OperandStack_isSpaceAvailable(stack, 1), "Operand stack overflow");
 
-    stack->m_values[stack->m_size++] = highPart;
-    stack->m_values[stack->m_size++] = lowPart;
+    stack->m_values[stack->m_size++].m_long = value;
 }
 
 void zen_OperandStack_pushNullReference(zen_OperandStack_t* stack) {
     zen_OperandStack_pushReference(stack, 0);
 }
 
-/* NOTE: This function is implemented with the assumption that the size of
- *       a given platform is lesser than or equal to eight bytes.
- */
 void zen_OperandStack_pushReference(zen_OperandStack_t* stack, uintptr_t reference) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT
-     * words.
+    /* Check whether the operand stack has, at least, 1 free slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
-    jtk_Assert_assertTrue(zen_OperandStack_isSpaceAvailable(stack,
-        ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT), "Operand stack overflow");
+    jtk_Assert_assertTrue(zen_OperandStack_isSpaceAvailable(stack, 1), "Operand stack overflow");
 
     /* A null reference is represented with the integer value of 0. */
-    switch (ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT) {
-        case ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_1: {
-            stack->m_values[stack->m_size++] = (uint32_t)reference;
-
-            break;
-        }
-
-        case ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_2: {
-            stack->m_values[stack->m_size++] = (uint32_t)(((uint64_t)reference & 0xFFFFFFFF00000000L) >> 32);
-            stack->m_values[stack->m_size++] = (uint32_t)((uint64_t)reference & 0xFFFFFFFFL);
-
-            break;
-        }
-    }
+    stack->m_values[stack->m_size++].m_reference = reference;
 }
 
 // Pop
 
-int32_t zen_OperandStack_pop(zen_OperandStack_t* stack) {
+zen_Slot_t zen_OperandStack_pop(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 1 word.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
@@ -310,105 +248,65 @@ int32_t zen_OperandStack_pop(zen_OperandStack_t* stack) {
     return stack->m_values[--stack->m_size];
 }
 
-int64_t zen_OperandStack_popEx(zen_OperandStack_t* stack) {
-    jtk_Assert_assertObject(stack, "The specified operand stack is null.");
-
-    /* Check whether the operand stack has, at least, 2 words.
-     *
-     * TODO: If there is a shortage, an exception should be raised.
-     */
-    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 2), "Operand stack underflow");
-
-    int32_t lowPart = stack->m_values[--stack->m_size];
-    int32_t highPart = stack->m_values[--stack->m_size];
-    return (((uint64_t)highPart << 32L) | lowPart);
-}
-
 double zen_OperandStack_popDouble(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 2 words.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
-    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 2), "Operand stack underflow");
-
-    uint32_t lowPart = stack->m_values[--stack->m_size];
-    uint32_t highPart = stack->m_values[--stack->m_size];
-    uint64_t result = (((uint64_t)highPart << 32L) | lowPart);
+    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    return *((double*)(&result));
+    return stack->m_values[--stack->m_size].m_double;
 }
 
 float zen_OperandStack_popFloat(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 1 word.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
     jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    uint32_t result = stack->m_values[--stack->m_size];
-
-    return *((float*)(&result));
+    return stack->m_values[--stack->m_size].m_float;
 }
 
 int32_t zen_OperandStack_popInteger(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 1 word.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
     jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    return stack->m_values[--stack->m_size];
+    return stack->m_values[--stack->m_size].m_integer;
 }
 
 int64_t zen_OperandStack_popLong(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 2 words.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
-    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 2), "Operand stack underflow");
+    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    int32_t lowPart = stack->m_values[--stack->m_size];
-    int32_t highPart = stack->m_values[--stack->m_size];
-    return (((uint64_t)highPart << 32L) | lowPart);
+    return stack->m_values[--stack->m_size].m_long;
 }
 
 uintptr_t zen_OperandStack_popReference(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 2 words.
+    /* Check whether the operand stack has, at least, 1 slot.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
-    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack,
-        ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT), "Operand stack underflow");
-
-    uintptr_t result = 0;
-        /* A null reference is represented with the integer value of 0. */
-    switch (ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT) {
-        case ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_1: {
-            result = (uintptr_t)stack->m_values[--stack->m_size];
-
-            break;
-        }
-
-        case ZEN_OPERAND_STACK_REFERENCE_SLOT_COUNT_2: {
-            uint32_t lowPart = stack->m_values[--stack->m_size];
-            uint32_t highPart = stack->m_values[--stack->m_size];
-            result = (uintptr_t)(((uint64_t)highPart << 32) | lowPart);
-
-            break;
-        }
-    }
+    jtk_Assert_assertTrue(zen_OperandStack_isAvailable(stack, 1), "Operand stack underflow");
 
-    return result;
+    /* A null reference is represented with the integer value of 0. */
+    return stack->m_values[--stack->m_size].m_reference;
 }
 
 /* Size */
@@ -432,7 +330,7 @@ bool zen_OperandStack_isSpaceAvailable(zen_OperandStack_t* stack, int32_t requir
 void zen_OperandStack_swap(zen_OperandStack_t* stack) {
     jtk_Assert_assertObject(stack, "The specified operand stack is null.");
 
-    /* Check whether the operand stack has, at least, 2 words.
+    /* Check whether the operand stack has, at least, 2 slots.
      *
      * TODO: If there is a shortage, an exception should be raised.
      */
@@ -440,7 +338,7 @@ void zen_OperandStack_swap(zen_OperandStack_t* stack) {
 
     int32_t index0 = stack->m_size - 1;
     int32_t index1 = stack->m_size - 2;
-    uint32_t temporary = stack->m_values[index0];
+    zen_Slot_t temporary = stack->m_values[index0];
     stack->m_values[index0] = stack->m_values[index1];
     stack->m_values[index1] = temporary;
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 17, 2026
+
+#include <jtk/core/Assert.h>
+#include <com/onecube/zen/virtual-machine/object/Function.h>
+#include <com/onecube/zen/virtual-machine/processor/ProcessorThread.h>
+
+/*******************************************************************************
+ * ProcessorThread                                                             *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_ProcessorThread_t* zen_ProcessorThread_new(zen_MemoryManager_t* memoryManager) {
+    jtk_Assert_assertObject(memoryManager, "The specified memory manager is null.");
+
+    zen_ProcessorThread_t* thread = jtk_Memory_allocate(zen_ProcessorThread_t, 1);
+    thread->m_invocationStack = zen_InvocationStack_new();
+#ifdef ZEN_INTERPRETER_TRACE
+    thread->m_trace = zen_InterpreterTrace_new();
+#else
+    thread->m_trace = NULL;
+#endif
+#ifdef ZEN_INTERPRETER_PROFILE
+    thread->m_profiler = zen_InstructionProfiler_new();
+#else
+    thread->m_profiler = NULL;
+#endif
+    thread->m_memoryManager = memoryManager;
+    thread->m_allocationBuffer = zen_MemoryManager_makeAllocationBuffer(memoryManager);
+    thread->m_satbBuffer = zen_MemoryManager_makeSatbBuffer(memoryManager);
+    thread->m_safepoint = memoryManager->m_safepoint;
+    zen_Safepoint_attach(thread->m_safepoint);
+    thread->m_exception = NULL;
+
+    return thread;
+}
+
+/* Destructor */
+
+void zen_ProcessorThread_delete(zen_ProcessorThread_t* thread) {
+    jtk_Assert_assertObject(thread, "The specified processor thread is null.");
+
+    zen_Safepoint_detach(thread->m_safepoint);
+    zen_MemoryManager_mergeSatbBuffer(thread->m_memoryManager, thread->m_satbBuffer);
+    zen_MemoryManager_mergeAllocationBuffer(thread->m_memoryManager, thread->m_allocationBuffer);
+    zen_InvocationStack_delete(thread->m_invocationStack);
+    if (thread->m_trace != NULL) {
+        /* Unlike the profile, the trace is written in its binary form.
+         * Therefore, it is written to a file instead of the standard error.
+         */
+        FILE* stream = fopen(ZEN_INTERPRETER_TRACE_FILE_NAME, "wb");
+        if (stream != NULL) {
+            zen_InterpreterTrace_write(thread->m_trace, stream);
+            fclose(stream);
+        }
+        zen_InterpreterTrace_delete(thread->m_trace);
+    }
+    if (thread->m_profiler != NULL) {
+        zen_InstructionProfiler_write(thread->m_profiler, stderr);
+        zen_InstructionProfiler_delete(thread->m_profiler);
+    }
+    jtk_Memory_deallocate(thread);
+}
+
+/* Roots */
+
+void zen_ProcessorThread_visitRoots(zen_ProcessorThread_t* thread,
+    zen_RootVisitor_t* visitor) {
+    jtk_Assert_assertObject(thread, "The specified processor thread is null.");
+    jtk_Assert_assertObject(visitor, "The specified visitor is null.");
+
+    zen_StackFrame_t* frame = thread->m_invocationStack->m_currentStackFrame;
+    while (frame != NULL) {
+        /* The stack map entry describes the frame before the instruction
+         * which is being executed. The instruction pointer was saved after
+         * the operands of the instruction were read, therefore, the entry
+         * is the last one before the instruction pointer.
+         */
+        zen_StackMapTableAttribute_t* stackMapTable = (frame->m_function != NULL)?
+            zen_Function_getStackMapTableAttribute(frame->m_function) : NULL;
+        zen_StackMapEntry_t* entry = (stackMapTable != NULL)?
+            zen_StackMapTableAttribute_find(stackMapTable, frame->m_ip) : NULL;
+        int32_t mappedLocalCount = (entry != NULL)? stackMapTable->m_localVariableCount : 0;
+        int32_t mappedOperandCount = (entry != NULL)? entry->m_operandCount : 0;
+
+        /* The slots described by the entry are visited precisely, the rest
+         * are visited as ambiguous roots.
+         */
+        zen_Slot_t* locals = frame->m_localVariableArray.m_values;
+        int32_t localCount = frame->m_localVariableArray.m_size;
+        int32_t i;
+        for (i = 0; i < localCount; i++) {
+            if (i >= mappedLocalCount) {
+                visitor->m_visitAmbiguousRoot(visitor, locals[i].m_reference);
+            }
+            else if (zen_StackMapEntry_isReference(entry, i)) {
+                visitor->m_visitRoot(visitor, (zen_Object_t**)&locals[i].m_reference);
+            }
+        }
+
+        zen_Slot_t* operands = frame->m_operandStack.m_values;
+        int32_t operandCount = frame->m_operandStack.m_size;
+        for (i = 0; i < operandCount; i++) {
+            if (i >= mappedOperandCount) {
+                visitor->m_visitAmbiguousRoot(visitor, operands[i].m_reference);
+            }
+            else if (zen_StackMapEntry_isReference(entry, mappedLocalCount + i)) {
+                visitor->m_visitRoot(visitor, (zen_Object_t**)&operands[i].m_reference);
+            }
+        }
+
+        frame = frame->m_previous;
+    }
+
+    if (thread->m_exception != NULL) {
+        visitor->m_visitRoot(visitor, &thread->m_exception);
+    }
+}
@@ -0,0 +1,327 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/feb/BinaryEntityFormat.h>
+#include <com/onecube/zen/virtual-machine/feb/EntityType.h>
+#include <com/onecube/zen/virtual-machine/feb/EntityFlag.h>
+#include <com/onecube/zen/virtual-machine/feb/attribute/PredefinedAttribute.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolTag.h>
+#include <com/onecube/zen/virtual-machine/loader/BinaryEntityParser.h>
+#include <com/onecube/zen/virtual-machine/processor/InvocationStack.h>
+
+/*******************************************************************************
+ * TestEntity                                                                  *
+ *******************************************************************************/
+
+/* Write */
+
+static void zen_TestEntity_writeByte(uint8_t** bytes, int32_t* size,
+    int32_t* capacity, uint8_t value) {
+    if (*size == *capacity) {
+        *capacity = (*capacity == 0)? 64 : (*capacity * 2);
+        *bytes = (uint8_t*)realloc(*bytes, *capacity);
+    }
+    (*bytes)[(*size)++] = value;
+}
+
+static void zen_TestEntity_writeShort(uint8_t** bytes, int32_t* size,
+    int32_t* capacity, uint16_t value) {
+    zen_TestEntity_writeByte(bytes, size, capacity, (value & 0xFF00) >> 8);
+    zen_TestEntity_writeByte(bytes, size, capacity, value & 0x00FF);
+}
+
+static void zen_TestEntity_writeInteger(uint8_t** bytes, int32_t* size,
+    int32_t* capacity, uint32_t value) {
+    zen_TestEntity_writeShort(bytes, size, capacity, (value & 0xFFFF0000) >> 16);
+    zen_TestEntity_writeShort(bytes, size, capacity, value & 0x0000FFFF);
+}
+
+static void zen_TestEntity_writeBytes(uint8_t** bytes, int32_t* size,
+    int32_t* capacity, const uint8_t* values, int32_t length) {
+    int32_t i;
+    for (i = 0; i < length; i++) {
+        zen_TestEntity_writeByte(bytes, size, capacity, values[i]);
+    }
+}
+
+#define zen_TestEntity_writeConstantPoolByte(entity, value) \
+    zen_TestEntity_writeByte(&(entity)->m_constantPool, &(entity)->m_constantPoolSize, \
+        &(entity)->m_constantPoolCapacity, (value))
+
+#define zen_TestEntity_writeConstantPoolShort(entity, value) \
+    zen_TestEntity_writeShort(&(entity)->m_constantPool, &(entity)->m_constantPoolSize, \
+        &(entity)->m_constantPoolCapacity, (value))
+
+#define zen_TestEntity_writeConstantPoolInteger(entity, value) \
+    zen_TestEntity_writeInteger(&(entity)->m_constantPool, &(entity)->m_constantPoolSize, \
+        &(entity)->m_constantPoolCapacity, (value))
+
+/* Constructor */
+
+zen_TestEntity_t* zen_TestEntity_new(const char* descriptor) {
+    zen_TestEntity_t* entity = (zen_TestEntity_t*)calloc(1, sizeof (zen_TestEntity_t));
+    entity->m_descriptor = descriptor;
+    entity->m_classIndex = zen_TestEntity_addClass(entity, descriptor);
+    entity->m_instructionIndex = zen_TestEntity_addUtf8(entity,
+        ZEN_PREDEFINED_ATTRIBUTE_INSTRUCTION);
+
+    /* The arguments are pushed on the operand stack of the driver. */
+    uint8_t driver[] = {
+        ZEN_BYTE_CODE_RETURN
+    };
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "driver", "v:v",
+        16, 0, driver, sizeof (driver));
+
+    return entity;
+}
+
+/* Destructor */
+
+void zen_TestEntity_delete(zen_TestEntity_t* entity) {
+    free(entity->m_constantPool);
+    free(entity->m_superclasses);
+    free(entity->m_fields);
+    free(entity->m_functions);
+    free(entity);
+}
+
+/* Constant Pool */
+
+uint16_t zen_TestEntity_addUtf8(zen_TestEntity_t* entity, const char* string) {
+    int32_t length = strlen(string);
+    zen_TestEntity_writeConstantPoolByte(entity, ZEN_CONSTANT_POOL_TAG_UTF8);
+    zen_TestEntity_writeConstantPoolShort(entity, length);
+    zen_TestEntity_writeBytes(&entity->m_constantPool, &entity->m_constantPoolSize,
+        &entity->m_constantPoolCapacity, (const uint8_t*)string, length);
+
+    return ++entity->m_constantPoolCount;
+}
+
+uint16_t zen_TestEntity_addInteger(zen_TestEntity_t* entity, int32_t value) {
+    zen_TestEntity_writeConstantPoolByte(entity, ZEN_CONSTANT_POOL_TAG_INTEGER);
+    zen_TestEntity_writeConstantPoolInteger(entity, (uint32_t)value);
+
+    return ++entity->m_constantPoolCount;
+}
+
+uint16_t zen_TestEntity_addClass(zen_TestEntity_t* entity, const char* descriptor) {
+    uint16_t nameIndex = zen_TestEntity_addUtf8(entity, descriptor);
+    zen_TestEntity_writeConstantPoolByte(entity, ZEN_CONSTANT_POOL_TAG_CLASS);
+    zen_TestEntity_writeConstantPoolShort(entity, nameIndex);
+
+    return ++entity->m_constantPoolCount;
+}
+
+/* The function and field entries share their layout. */
+static uint16_t zen_TestEntity_addMemberReference(zen_TestEntity_t* entity,
+    uint8_t tag, uint16_t classIndex, const char* name, const char* descriptor) {
+    uint16_t descriptorIndex = zen_TestEntity_addUtf8(entity, descriptor);
+    uint16_t nameIndex = zen_TestEntity_addUtf8(entity, name);
+    zen_TestEntity_writeConstantPoolByte(entity, tag);
+    zen_TestEntity_writeConstantPoolShort(entity, classIndex);
+    zen_TestEntity_writeConstantPoolShort(entity, descriptorIndex);
+    zen_TestEntity_writeConstantPoolShort(entity, nameIndex);
+
+    return ++entity->m_constantPoolCount;
+}
+
+uint16_t zen_TestEntity_addFunctionReference(zen_TestEntity_t* entity,
+    uint16_t classIndex, const char* name, const char* descriptor) {
+    return zen_TestEntity_addMemberReference(entity, ZEN_CONSTANT_POOL_TAG_FUNCTION,
+        classIndex, name, descriptor);
+}
+
+uint16_t zen_TestEntity_addFieldReference(zen_TestEntity_t* entity,
+    uint16_t classIndex, const char* name, const char* descriptor) {
+    return zen_TestEntity_addMemberReference(entity, ZEN_CONSTANT_POOL_TAG_FIELD,
+        classIndex, name, descriptor);
+}
+
+uint16_t zen_TestEntity_getClassIndex(zen_TestEntity_t* entity) {
+    return entity->m_classIndex;
+}
+
+/* Superclass */
+
+void zen_TestEntity_addSuperclass(zen_TestEntity_t* entity, const char* descriptor) {
+    uint16_t classIndex = zen_TestEntity_addClass(entity, descriptor);
+    zen_TestEntity_writeShort(&entity->m_superclasses, &entity->m_superclassesSize,
+        &entity->m_superclassesCapacity, classIndex);
+
+    entity->m_superclassCount++;
+}
+
+/* Field */
+
+void zen_TestEntity_addField(zen_TestEntity_t* entity, uint16_t flags,
+    const char* name, const char* descriptor) {
+    uint16_t nameIndex = zen_TestEntity_addUtf8(entity, name);
+    uint16_t descriptorIndex = zen_TestEntity_addUtf8(entity, descriptor);
+
+    uint8_t** bytes = &entity->m_fields;
+    int32_t* size = &entity->m_fieldsSize;
+    int32_t* capacity = &entity->m_fieldsCapacity;
+    zen_TestEntity_writeShort(bytes, size, capacity, flags);
+    zen_TestEntity_writeShort(bytes, size, capacity, nameIndex);
+    zen_TestEntity_writeShort(bytes, size, capacity, descriptorIndex);
+    /* The fields do not have any attributes. */
+    zen_TestEntity_writeShort(bytes, size, capacity, 0);
+
+    entity->m_fieldCount++;
+}
+
+/* Function */
+
+void zen_TestEntity_addFunction(zen_TestEntity_t* entity, uint16_t flags,
+    const char* name, const char* descriptor, uint16_t maxStackSize,
+    uint16_t localVariableCount, const uint8_t* instructions, int32_t length) {
+    uint16_t nameIndex = zen_TestEntity_addUtf8(entity, name);
+    uint16_t descriptorIndex = zen_TestEntity_addUtf8(entity, descriptor);
+
+    uint8_t** bytes = &entity->m_functions;
+    int32_t* size = &entity->m_functionsSize;
+    int32_t* capacity = &entity->m_functionsCapacity;
+    zen_TestEntity_writeShort(bytes, size, capacity, flags);
+    zen_TestEntity_writeShort(bytes, size, capacity, nameIndex);
+    zen_TestEntity_writeShort(bytes, size, capacity, descriptorIndex);
+
+    /* The instruction attribute is the only attribute of the function. It
+     * does not have any exception handlers. The interpreter never executes the
+     * last byte of a function, it returns instead. Therefore, the instructions
+     * are followed by a padding byte.
+     */
+    zen_TestEntity_writeShort(bytes, size, capacity, 1);
+    zen_TestEntity_writeShort(bytes, size, capacity, entity->m_instructionIndex);
+    zen_TestEntity_writeInteger(bytes, size, capacity, 2 + 2 + 4 + length + 1 + 2);
+    zen_TestEntity_writeShort(bytes, size, capacity, maxStackSize);
+    zen_TestEntity_writeShort(bytes, size, capacity, localVariableCount);
+    zen_TestEntity_writeInteger(bytes, size, capacity, length + 1);
+    zen_TestEntity_writeBytes(bytes, size, capacity, instructions, length);
+    zen_TestEntity_writeByte(bytes, size, capacity, ZEN_BYTE_CODE_RETURN);
+    zen_TestEntity_writeShort(bytes, size, capacity, 0);
+
+    entity->m_functionCount++;
+}
+
+/* Load */
+
+zen_Class_t* zen_TestEntity_load(zen_TestEntity_t* entity,
+    zen_VirtualMachine_t* virtualMachine) {
+    uint8_t* bytes = NULL;
+    int32_t size = 0;
+    int32_t capacity = 0;
+
+    zen_TestEntity_writeInteger(&bytes, &size, &capacity, ZEN_BINARY_ENTITY_FORMAT_MAGIC_NUMBER);
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, ZEN_BINARY_ENTITY_FORMAT_MAJOR_VERSION);
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, ZEN_BINARY_ENTITY_FORMAT_MINOR_VERSION);
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, 0);
+
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, entity->m_constantPoolCount);
+    zen_TestEntity_writeBytes(&bytes, &size, &capacity, entity->m_constantPool,
+        entity->m_constantPoolSize);
+
+    /* The class does not have any attributes. */
+    zen_TestEntity_writeByte(&bytes, &size, &capacity, ZEN_ENTITY_TYPE_CLASS);
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, 0);
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, entity->m_classIndex);
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, entity->m_superclassCount);
+    zen_TestEntity_writeBytes(&bytes, &size, &capacity, entity->m_superclasses,
+        entity->m_superclassesSize);
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, 0);
+
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, entity->m_fieldCount);
+    zen_TestEntity_writeBytes(&bytes, &size, &capacity, entity->m_fields,
+        entity->m_fieldsSize);
+
+    zen_TestEntity_writeShort(&bytes, &size, &capacity, entity->m_functionCount);
+    zen_TestEntity_writeBytes(&bytes, &size, &capacity, entity->m_functions,
+        entity->m_functionsSize);
+
+    /* The entity file is parsed exactly like the entity loader parses the
+     * files that it finds.
+     */
+    zen_EntityLoader_t* entityLoader = virtualMachine->m_entityLoader;
+    zen_Arena_t* arena = zen_ImmortalGeneration_newArena(
+        virtualMachine->m_memoryManager->m_immortalGeneration,
+        size * ZEN_ENTITY_LOADER_ARENA_SIZE_FACTOR);
+    zen_BinaryEntityParser_t* parser = zen_BinaryEntityParser_new(
+        entityLoader->m_attributeParseRules, arena, bytes, size);
+    zen_EntityFile_t* entityFile = zen_BinaryEntityParser_parse(parser, NULL);
+    zen_BinaryEntityParser_delete(parser);
+    free(bytes);
+
+    /* The class loader takes the ownership of the descriptor. */
+    jtk_CString_t* descriptor = jtk_CString_new((const uint8_t*)entity->m_descriptor);
+    return zen_ClassLoader_loadFromEntityFile(virtualMachine->m_classLoader,
+        descriptor, entityFile);
+}
+
+/* Invoke */
+
+zen_Slot_t zen_TestEntity_invoke(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, const char* name, const char* descriptor,
+    const zen_Slot_t* arguments, int32_t argumentCount) {
+    zen_Interpreter_t* interpreter = virtualMachine->m_interpreter;
+    zen_InvocationStack_t* invocationStack =
+        interpreter->m_processorThread->m_invocationStack;
+
+    jtk_CString_t* driverName = jtk_CString_new((const uint8_t*)"driver");
+    jtk_CString_t* driverDescriptor = jtk_CString_new((const uint8_t*)"v:v");
+    jtk_CString_t* functionName = jtk_CString_new((const uint8_t*)name);
+    jtk_CString_t* functionDescriptor = jtk_CString_new((const uint8_t*)descriptor);
+    zen_Function_t* driver = zen_Class_getStaticFunction(class0, driverName,
+        driverDescriptor);
+    zen_Function_t* function = zen_Class_getStaticFunction(class0, functionName,
+        functionDescriptor);
+    jtk_CString_delete(driverName);
+    jtk_CString_delete(driverDescriptor);
+    jtk_CString_delete(functionName);
+    jtk_CString_delete(functionDescriptor);
+
+    zen_Slot_t result;
+    result.m_long = 0;
+    if ((driver == NULL) || (function == NULL)) {
+        fprintf(stderr, "Cannot find the function %s%s.\n", name, descriptor);
+        return result;
+    }
+
+    /* The arguments become the local variables of the function in place. The
+     * value returned by the function is pushed on the operand stack of the
+     * driver, where the interpreter stops.
+     */
+    zen_StackFrame_t* driverFrame = zen_InvocationStack_pushStackFrame(
+        invocationStack, driver, 0);
+    int32_t i;
+    for (i = 0; i < argumentCount; i++) {
+        driverFrame->m_operandStack.m_values[driverFrame->m_operandStack.m_size++] =
+            arguments[i];
+    }
+    zen_InvocationStack_pushStackFrame(invocationStack, function, argumentCount);
+    zen_Interpreter_interpret(interpreter);
+
+    if (driverFrame->m_operandStack.m_size > 0) {
+        result = driverFrame->m_operandStack.m_values[driverFrame->m_operandStack.m_size - 1];
+    }
+    zen_InvocationStack_popStackFrame(invocationStack);
+
+    return result;
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_TEST_ENTITY_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_TEST_ENTITY_H
+
+#include <stdio.h>
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/VirtualMachine.h>
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
+#include <com/onecube/zen/virtual-machine/processor/Slot.h>
+
+/*******************************************************************************
+ * Test                                                                        *
+ *******************************************************************************/
+
+/**
+ * Reports the specified condition if it does not hold, and counts it in the
+ * specified failure counter. The test continues with the next check.
+ */
+#define ZEN_TEST_CHECK(failures, condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "%s:%d: Check failed: %s\n", __FILE__, __LINE__, #condition); \
+            (failures)++; \
+        } \
+    } \
+    while (false)
+
+/*******************************************************************************
+ * TestEntity                                                                  *
+ *******************************************************************************/
+
+/**
+ * Builds the binary entity of a single class in memory, so that the tests can
+ * load classes without a compiler. The constant pool entries are appended as
+ * they are requested, beginning at index 1. The fields and the functions are
+ * appended to the class entity in the order they are added.
+ *
+ * Every class receives a static function named {@code driver}, which does
+ * nothing but return. Its stack frame receives the arguments of, and the value
+ * returned by, the functions invoked with {@code zen_TestEntity_invoke()}.
+ *
+ * @class TestEntity
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_TestEntity_t {
+    uint8_t* m_constantPool;
+    int32_t m_constantPoolSize;
+    int32_t m_constantPoolCapacity;
+    uint16_t m_constantPoolCount;
+
+    uint8_t* m_superclasses;
+    int32_t m_superclassesSize;
+    int32_t m_superclassesCapacity;
+    uint16_t m_superclassCount;
+
+    uint8_t* m_fields;
+    int32_t m_fieldsSize;
+    int32_t m_fieldsCapacity;
+    uint16_t m_fieldCount;
+
+    uint8_t* m_functions;
+    int32_t m_functionsSize;
+    int32_t m_functionsCapacity;
+    uint16_t m_functionCount;
+
+    const char* m_descriptor;
+    uint16_t m_classIndex;
+    uint16_t m_instructionIndex;
+};
+
+/**
+ * @memberof TestEntity
+ */
+typedef struct zen_TestEntity_t zen_TestEntity_t;
+
+/* Constructor */
+
+/**
+ * @memberof TestEntity
+ */
+zen_TestEntity_t* zen_TestEntity_new(const char* descriptor);
+
+/* Destructor */
+
+/**
+ * @memberof TestEntity
+ */
+void zen_TestEntity_delete(zen_TestEntity_t* entity);
+
+/* Constant Pool */
+
+/**
+ * @memberof TestEntity
+ */
+uint16_t zen_TestEntity_addUtf8(zen_TestEntity_t* entity, const char* string);
+
+/**
+ * @memberof TestEntity
+ */
+uint16_t zen_TestEntity_addInteger(zen_TestEntity_t* entity, int32_t value);
+
+/**
+ * @memberof TestEntity
+ */
+uint16_t zen_TestEntity_addClass(zen_TestEntity_t* entity, const char* descriptor);
+
+/**
+ * @memberof TestEntity
+ */
+uint16_t zen_TestEntity_addFunctionReference(zen_TestEntity_t* entity,
+    uint16_t classIndex, const char* name, const char* descriptor);
+
+/**
+ * @memberof TestEntity
+ */
+uint16_t zen_TestEntity_addFieldReference(zen_TestEntity_t* entity,
+    uint16_t classIndex, const char* name, const char* descriptor);
+
+/**
+ * Returns the index of the class entry which describes the class built by
+ * the specified entity.
+ *
+ * @memberof TestEntity
+ */
+uint16_t zen_TestEntity_getClassIndex(zen_TestEntity_t* entity);
+
+/* Superclass */
+
+/**
+ * Adds a superclass to the class. The first superclass is the primary
+ * superclass. The superclasses should be loaded before the class.
+ *
+ * @memberof TestEntity
+ */
+void zen_TestEntity_addSuperclass(zen_TestEntity_t* entity, const char* descriptor);
+
+/* Field */
+
+/**
+ * @memberof TestEntity
+ */
+void zen_TestEntity_addField(zen_TestEntity_t* entity, uint16_t flags,
+    const char* name, const char* descriptor);
+
+/* Function */
+
+/**
+ * Adds a function, whose instruction attribute holds the specified
+ * instructions. The functions are loaded exactly as their instructions are
+ * specified, followed by a padding byte; the verifier, the superinstruction
+ * rewriter, and the instruction decoder run on them when the class is loaded.
+ *
+ * @memberof TestEntity
+ */
+void zen_TestEntity_addFunction(zen_TestEntity_t* entity, uint16_t flags,
+    const char* name, const char* descriptor, uint16_t maxStackSize,
+    uint16_t localVariableCount, const uint8_t* instructions, int32_t length);
+
+/* Load */
+
+/**
+ * Parses the binary entity, and registers the resulting class with the class
+ * loader of the specified virtual machine.
+ *
+ * @memberof TestEntity
+ */
+zen_Class_t* zen_TestEntity_load(zen_TestEntity_t* entity,
+    zen_VirtualMachine_t* virtualMachine);
+
+/* Invoke */
+
+/**
+ * Interprets the specified static function on the main thread of the
+ * specified virtual machine, and returns the value that it returns. Every
+ * argument occupies one slot.
+ *
+ * @memberof TestEntity
+ */
+zen_Slot_t zen_TestEntity_invoke(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, const char* name, const char* descriptor,
+    const zen_Slot_t* arguments, int32_t argumentCount);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_TEST_ENTITY_H */
@@ -0,0 +1,198 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/SegregatedFitsAllocator.h>
+
+/*******************************************************************************
+ * SegregatedFitsAllocatorTest                                                 *
+ *******************************************************************************/
+
+#define ZEN_SEGREGATED_FITS_ALLOCATOR_TEST_REGION_SIZE 4096
+
+/* The region is aligned to the granule. */
+static uint64_t zen_SegregatedFitsAllocatorTest_region[ZEN_SEGREGATED_FITS_ALLOCATOR_TEST_REGION_SIZE / 8]
+    __attribute__((aligned(ZEN_SEGREGATED_FITS_ALLOCATOR_GRANULE_SIZE)));
+
+static zen_Class_t zen_SegregatedFitsAllocatorTest_class;
+
+static inline uint8_t* zen_SegregatedFitsAllocatorTest_at(int32_t offset) {
+    return (uint8_t*)zen_SegregatedFitsAllocatorTest_region + offset;
+}
+
+/* Places an object, which is not a filler, at the specified offset. */
+static void zen_SegregatedFitsAllocatorTest_place(int32_t offset, int32_t size) {
+    zen_Object_t* object = (zen_Object_t*)zen_SegregatedFitsAllocatorTest_at(offset);
+    object->m_class = &zen_SegregatedFitsAllocatorTest_class;
+    object->m_size = size;
+    object->m_flags = 0;
+}
+
+/* Size Classes
+ *
+ * A small request is satisfied exactly by a cell of its own size class, or
+ * by splitting the smallest larger cell. The object is carved from the end of
+ * the cell, and the remainder is linked by its new size. A cell too small to
+ * hold the link remains an unlinked filler.
+ */
+static int32_t zen_SegregatedFitsAllocatorTest_testSizeClasses(void) {
+    int32_t failures = 0;
+
+    zen_SegregatedFitsAllocator_t* allocator = zen_SegregatedFitsAllocator_new();
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_isEmpty(allocator));
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 16) == NULL);
+
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(0), 32);
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(64), 48);
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(128), 128);
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(256), 16);
+    ZEN_TEST_CHECK(failures, zen_Object_isFiller((zen_Object_t*)zen_SegregatedFitsAllocatorTest_at(256)));
+    ZEN_TEST_CHECK(failures, allocator->m_freeSize == (32 + 48 + 128));
+    ZEN_TEST_CHECK(failures, allocator->m_sizeClassMap == ((1 << 2) | (1 << 3) | (1 << 8)));
+
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 48) ==
+        zen_SegregatedFitsAllocatorTest_at(64));
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 32) ==
+        zen_SegregatedFitsAllocatorTest_at(0));
+    ZEN_TEST_CHECK(failures, allocator->m_sizeClassMap == (1 << 8));
+
+    /* The cell of 128 bytes is split. */
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 16) ==
+        zen_SegregatedFitsAllocatorTest_at(128 + 112));
+    ZEN_TEST_CHECK(failures, ((zen_Object_t*)zen_SegregatedFitsAllocatorTest_at(128))->m_size == 112);
+    ZEN_TEST_CHECK(failures, allocator->m_sizeClassMap == (1 << 7));
+    ZEN_TEST_CHECK(failures, allocator->m_freeSize == 112);
+
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 128) == NULL);
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 112) ==
+        zen_SegregatedFitsAllocatorTest_at(128));
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_isEmpty(allocator));
+    ZEN_TEST_CHECK(failures, allocator->m_freeSize == 0);
+
+    zen_SegregatedFitsAllocator_delete(allocator);
+
+    return failures;
+}
+
+/* Large Bins
+ *
+ * A large request is satisfied from the first bin whose every cell fits.
+ * Only when no such bin has a cell is the bin of the request searched. A
+ * small request falls back to the large bins when the size classes are empty.
+ */
+static int32_t zen_SegregatedFitsAllocatorTest_testLargeBins(void) {
+    int32_t failures = 0;
+
+    zen_SegregatedFitsAllocator_t* allocator = zen_SegregatedFitsAllocator_new();
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(0), 208);
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(256), 304);
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(1024), 1024);
+    ZEN_TEST_CHECK(failures, allocator->m_largeBinMap == ((1 << 7) | (1 << 8) | (1 << 10)));
+
+    /* The size is a power of two, therefore, its own bin fits. */
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 256) ==
+        zen_SegregatedFitsAllocatorTest_at(256 + 48));
+    ZEN_TEST_CHECK(failures, allocator->m_sizeClassMap == (1 << 3));
+    ZEN_TEST_CHECK(failures, allocator->m_largeBinMap == ((1 << 7) | (1 << 10)));
+
+    /* The cell of the bin of the request is not searched, while a larger bin
+     * has a cell.
+     */
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 160) ==
+        zen_SegregatedFitsAllocatorTest_at(1024 + 864));
+    ZEN_TEST_CHECK(failures, allocator->m_largeBinMap == ((1 << 7) | (1 << 9)));
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 864) ==
+        zen_SegregatedFitsAllocatorTest_at(1024));
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 224) == NULL);
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 208) ==
+        zen_SegregatedFitsAllocatorTest_at(0));
+    ZEN_TEST_CHECK(failures, allocator->m_largeBinMap == 0);
+
+    /* The size classes are preferred over the large bins. */
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(2048), 512);
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 32) ==
+        zen_SegregatedFitsAllocatorTest_at(256 + 16));
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 32) ==
+        zen_SegregatedFitsAllocatorTest_at(2048 + 480));
+    ZEN_TEST_CHECK(failures, allocator->m_largeBinMap == (1 << 8));
+
+    /* The bin of the request is searched for the first cell that fits. The
+     * remainder is too small to be linked.
+     */
+    zen_SegregatedFitsAllocator_clear(allocator);
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(0), 240);
+    zen_SegregatedFitsAllocator_free(allocator, zen_SegregatedFitsAllocatorTest_at(256), 144);
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 224) ==
+        zen_SegregatedFitsAllocatorTest_at(16));
+    ZEN_TEST_CHECK(failures, zen_Object_isFiller((zen_Object_t*)zen_SegregatedFitsAllocatorTest_at(0)));
+    ZEN_TEST_CHECK(failures, allocator->m_largeBinMap == (1 << 7));
+    ZEN_TEST_CHECK(failures, allocator->m_freeSize == 144);
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 224) == NULL);
+
+    zen_SegregatedFitsAllocator_delete(allocator);
+
+    return failures;
+}
+
+/* Sweep
+ *
+ * The adjacent fillers between the objects are coalesced into cells. The run
+ * of fillers at the end of the swept memory is returned, instead of being
+ * linked.
+ */
+static int32_t zen_SegregatedFitsAllocatorTest_testSweep(void) {
+    int32_t failures = 0;
+
+    zen_SegregatedFitsAllocatorTest_place(0, 32);
+    zen_Object_fill(zen_SegregatedFitsAllocatorTest_at(32), 16);
+    zen_Object_fill(zen_SegregatedFitsAllocatorTest_at(48), 32);
+    zen_SegregatedFitsAllocatorTest_place(80, 48);
+    zen_Object_fill(zen_SegregatedFitsAllocatorTest_at(128), 64);
+    zen_SegregatedFitsAllocatorTest_place(192, 32);
+    zen_Object_fill(zen_SegregatedFitsAllocatorTest_at(224), 48);
+    zen_Object_fill(zen_SegregatedFitsAllocatorTest_at(272), 16);
+
+    zen_SegregatedFitsAllocator_t* allocator = zen_SegregatedFitsAllocator_new();
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_sweep(allocator,
+        zen_SegregatedFitsAllocatorTest_at(0), zen_SegregatedFitsAllocatorTest_at(288)) ==
+        zen_SegregatedFitsAllocatorTest_at(224));
+    ZEN_TEST_CHECK(failures, ((zen_Object_t*)zen_SegregatedFitsAllocatorTest_at(32))->m_size == 48);
+    ZEN_TEST_CHECK(failures, allocator->m_sizeClassMap == ((1 << 3) | (1 << 4)));
+    ZEN_TEST_CHECK(failures, allocator->m_freeSize == (48 + 64));
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_allocate(allocator, 48) ==
+        zen_SegregatedFitsAllocatorTest_at(32));
+
+    /* The memory which ends with an object is swept entirely. */
+    ZEN_TEST_CHECK(failures, zen_SegregatedFitsAllocator_sweep(allocator,
+        zen_SegregatedFitsAllocatorTest_at(0), zen_SegregatedFitsAllocatorTest_at(224)) ==
+        zen_SegregatedFitsAllocatorTest_at(224));
+
+    zen_SegregatedFitsAllocator_delete(allocator);
+
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    int32_t failures = 0;
+
+    failures += zen_SegregatedFitsAllocatorTest_testSizeClasses();
+    failures += zen_SegregatedFitsAllocatorTest_testLargeBins();
+    failures += zen_SegregatedFitsAllocatorTest_testSweep();
+
+    return (failures == 0)? 0 : 1;
+}
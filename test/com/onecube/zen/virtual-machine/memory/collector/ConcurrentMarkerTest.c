@@ -0,0 +1,290 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <stdlib.h>
+#include <time.h>
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/CardTable.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
+
+/*******************************************************************************
+ * ConcurrentMarkerTest                                                        *
+ *******************************************************************************/
+
+/* The references of an object precede its other fields. */
+struct zen_ConcurrentMarkerTest_Node_t {
+    zen_Object_t m_header;
+    zen_Reference_t m_next;
+    zen_Reference_t m_other;
+    int64_t m_value;
+};
+
+typedef struct zen_ConcurrentMarkerTest_Node_t zen_ConcurrentMarkerTest_Node_t;
+
+#define ZEN_CONCURRENT_MARKER_TEST_LIST_COUNT 2
+
+#define ZEN_CONCURRENT_MARKER_TEST_OTHER_VALUE 77
+
+static zen_Object_t* zen_ConcurrentMarkerTest_lists[ZEN_CONCURRENT_MARKER_TEST_LIST_COUNT];
+
+static zen_Class_t zen_ConcurrentMarkerTest_class;
+
+static void zen_ConcurrentMarkerTest_enumerateRoots(void* context,
+    zen_RootVisitor_t* visitor) {
+    int32_t i;
+    for (i = 0; i < ZEN_CONCURRENT_MARKER_TEST_LIST_COUNT; i++) {
+        visitor->m_visitRoot(visitor, &zen_ConcurrentMarkerTest_lists[i]);
+    }
+}
+
+static zen_ConcurrentMarkerTest_Node_t* zen_ConcurrentMarkerTest_allocate(
+    zen_MemoryManager_t* manager, zen_AllocationBuffer_t* buffer, int64_t value) {
+    int32_t size = sizeof (zen_ConcurrentMarkerTest_Node_t);
+    uint8_t* bytes = zen_AllocationBuffer_allocate(buffer, size);
+    if (bytes == NULL) {
+        bytes = zen_MemoryManager_allocateFromBuffer(manager, buffer, size);
+        if (bytes == NULL) {
+            fprintf(stderr, "The heap is exhausted.\n");
+            exit(1);
+        }
+    }
+
+    zen_ConcurrentMarkerTest_Node_t* node = (zen_ConcurrentMarkerTest_Node_t*)bytes;
+    node->m_header.m_class = &zen_ConcurrentMarkerTest_class;
+    node->m_header.m_size = size;
+    node->m_header.m_flags = 0;
+    zen_Reference_store(&node->m_next, NULL);
+    zen_Reference_store(&node->m_other, NULL);
+    node->m_value = value;
+
+    return node;
+}
+
+/* Builds a list of the specified length in the first root, whose tail refers
+ * to another object, and a single node in the second root. Both are promoted.
+ */
+static void zen_ConcurrentMarkerTest_promoteLists(zen_MemoryManager_t* manager,
+    int64_t length) {
+    zen_AllocationBuffer_t* buffer = zen_MemoryManager_makeAllocationBuffer(manager);
+    zen_Object_t* other = (zen_Object_t*)zen_ConcurrentMarkerTest_allocate(manager,
+        buffer, ZEN_CONCURRENT_MARKER_TEST_OTHER_VALUE);
+    zen_ConcurrentMarkerTest_lists[1] = other;
+    int64_t i;
+    for (i = 0; i < length; i++) {
+        zen_ConcurrentMarkerTest_Node_t* node = zen_ConcurrentMarkerTest_allocate(
+            manager, buffer, i);
+        zen_Reference_store(&node->m_next, zen_ConcurrentMarkerTest_lists[0]);
+        if (i == 0) {
+            zen_Reference_store(&node->m_other, zen_ConcurrentMarkerTest_lists[1]);
+        }
+        zen_ConcurrentMarkerTest_lists[0] = (zen_Object_t*)node;
+    }
+    zen_ConcurrentMarkerTest_lists[1] = (zen_Object_t*)zen_ConcurrentMarkerTest_allocate(
+        manager, buffer, -1);
+    zen_MemoryManager_mergeAllocationBuffer(manager, buffer);
+
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+}
+
+/* Returns the tail of the list in the first root. */
+static zen_ConcurrentMarkerTest_Node_t* zen_ConcurrentMarkerTest_getTail(void) {
+    zen_ConcurrentMarkerTest_Node_t* node =
+        (zen_ConcurrentMarkerTest_Node_t*)zen_ConcurrentMarkerTest_lists[0];
+    zen_ConcurrentMarkerTest_Node_t* next;
+    while ((next = (zen_ConcurrentMarkerTest_Node_t*)zen_Reference_load(&node->m_next)) != NULL) {
+        node = next;
+    }
+    return node;
+}
+
+/* Determines whether the specified object is yet to be scanned by the marker.
+ * It should be invoked only when the marker is paused.
+ */
+static bool zen_ConcurrentMarkerTest_isPending(zen_ConcurrentMarker_t* marker,
+    zen_Object_t* object) {
+    int32_t i;
+    for (i = 0; i < marker->m_markStackSize; i++) {
+        if (marker->m_markStack[i] == object) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Initiation
+ *
+ * A minor collection begins a marking cycle only when concurrent marking is
+ * enabled, and the white region is occupied beyond the initiating occupancy.
+ */
+static int32_t zen_ConcurrentMarkerTest_testInitiation(zen_MemoryManager_t* manager) {
+    int32_t failures = 0;
+
+    zen_ConcurrentMarker_t* marker = manager->m_concurrentMarker;
+    zen_ConcurrentMarkerTest_promoteLists(manager, 1000);
+    ZEN_TEST_CHECK(failures, marker->m_cycleCount == 0);
+
+    zen_MemoryManager_setConcurrentMarkingEnabled(manager, true);
+    zen_MemoryManager_setInitiatingOccupancy(manager, 100);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    ZEN_TEST_CHECK(failures, marker->m_cycleCount == 0);
+    ZEN_TEST_CHECK(failures, !zen_ConcurrentMarker_isMarking(marker));
+
+    zen_MemoryManager_setInitiatingOccupancy(manager, 0);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    ZEN_TEST_CHECK(failures, marker->m_cycleCount == 1);
+    ZEN_TEST_CHECK(failures, zen_ConcurrentMarker_isMarking(marker));
+    ZEN_TEST_CHECK(failures, marker->m_satbQueue->m_active);
+
+    /* A cycle in progress is not initiated again. */
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    ZEN_TEST_CHECK(failures, marker->m_cycleCount == 1);
+
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    ZEN_TEST_CHECK(failures, !zen_ConcurrentMarker_isMarking(marker));
+    ZEN_TEST_CHECK(failures, !marker->m_satbQueue->m_active);
+    ZEN_TEST_CHECK(failures, marker->m_initialMarkDuration > 0);
+    ZEN_TEST_CHECK(failures, marker->m_remarkDuration > 0);
+
+    return failures;
+}
+
+/* Snapshot
+ *
+ * Once the marker has scanned the node in the second root, the object at the
+ * tail of the long list is moved to it, before the marker reaches the tail.
+ * The object is reachable only through the scanned node afterwards. It
+ * survives because the pre-write barrier logs the overwritten reference, the
+ * way the interpreter does.
+ */
+static int32_t zen_ConcurrentMarkerTest_testSnapshot(zen_MemoryManager_t* manager) {
+    int32_t failures = 0;
+
+    zen_ConcurrentMarker_t* marker = manager->m_concurrentMarker;
+    zen_OldGeneration_t* oldGeneration = manager->m_oldGeneration;
+    int64_t length = 1000000;
+    zen_ConcurrentMarkerTest_promoteLists(manager, length);
+
+    zen_MemoryManager_setConcurrentMarkingEnabled(manager, true);
+    zen_MemoryManager_setInitiatingOccupancy(manager, 0);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    ZEN_TEST_CHECK(failures, zen_ConcurrentMarker_isMarking(marker));
+
+    zen_ConcurrentMarkerTest_Node_t* tail = zen_ConcurrentMarkerTest_getTail();
+    zen_ConcurrentMarkerTest_Node_t* target =
+        (zen_ConcurrentMarkerTest_Node_t*)zen_ConcurrentMarkerTest_lists[1];
+    zen_Object_t* other = zen_Reference_load(&tail->m_other);
+    zen_SatbQueue_t* satbQueue = marker->m_satbQueue;
+    zen_SatbBuffer_t* satbBuffer = zen_MemoryManager_makeSatbBuffer(manager);
+
+    /* The marker is given a little time between the pauses. */
+    struct timespec delay = { 0, 10000 };
+    bool moved = false;
+    while (!moved) {
+        zen_ConcurrentMarker_pause(marker);
+        if ((other->m_flags & ZEN_OBJECT_FLAG_MARKED) != 0) {
+            zen_ConcurrentMarker_resume(marker);
+            break;
+        }
+        if (!zen_ConcurrentMarkerTest_isPending(marker, (zen_Object_t*)target) &&
+            ((target->m_header.m_flags & ZEN_OBJECT_FLAG_MARKED) != 0)) {
+            if (satbQueue->m_active) {
+                zen_Object_t* previous = zen_Reference_load(&tail->m_other);
+                if (previous != NULL) {
+                    zen_SatbQueue_enqueue(satbQueue, satbBuffer, previous);
+                }
+            }
+            zen_Reference_store(&tail->m_other, NULL);
+            zen_Reference_store(&target->m_other, other);
+            zen_CardTable_markObject(oldGeneration->m_cardTable, target);
+            moved = true;
+        }
+        zen_ConcurrentMarker_resume(marker);
+        nanosleep(&delay, NULL);
+    }
+    ZEN_TEST_CHECK(failures, moved);
+    zen_MemoryManager_mergeSatbBuffer(manager, satbBuffer);
+
+    /* The marker runs out of objects without the help of the remark pause. */
+    while (!zen_ConcurrentMarker_isCompleted(marker)) {
+        nanosleep(&delay, NULL);
+    }
+    ZEN_TEST_CHECK(failures, (other->m_flags & ZEN_OBJECT_FLAG_MARKED) != 0);
+    ZEN_TEST_CHECK(failures, marker->m_concurrentDuration > 0);
+
+    /* Every survivor is moved, therefore, the extent of the white region is
+     * the size of the live objects.
+     */
+    zen_MemoryManager_collectEx(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+        ZEN_GARBAGE_COLLECTION_REASON_CONCURRENT_MARKING_COMPLETED, NULL,
+        ZEN_GARBAGE_COLLECTION_FLAG_SQUEEZE);
+    ZEN_TEST_CHECK(failures, !zen_ConcurrentMarker_isMarking(marker));
+    ZEN_TEST_CHECK(failures, (oldGeneration->m_free - oldGeneration->m_whiteRegion->m_start) ==
+        ((length + 2) * zen_OldGeneration_alignSize(sizeof (zen_ConcurrentMarkerTest_Node_t))));
+
+    target = (zen_ConcurrentMarkerTest_Node_t*)zen_ConcurrentMarkerTest_lists[1];
+    zen_ConcurrentMarkerTest_Node_t* survivor =
+        (zen_ConcurrentMarkerTest_Node_t*)zen_Reference_load(&target->m_other);
+    ZEN_TEST_CHECK(failures, (survivor != NULL) &&
+        (survivor->m_header.m_class == &zen_ConcurrentMarkerTest_class) &&
+        (survivor->m_value == ZEN_CONCURRENT_MARKER_TEST_OTHER_VALUE));
+
+    return failures;
+}
+
+static zen_MemoryManager_t* zen_ConcurrentMarkerTest_newManager() {
+    int32_t i;
+    for (i = 0; i < ZEN_CONCURRENT_MARKER_TEST_LIST_COUNT; i++) {
+        zen_ConcurrentMarkerTest_lists[i] = NULL;
+    }
+
+    zen_MemoryManager_t* manager = zen_MemoryManager_new();
+    zen_MemoryManager_setRootEnumerator(manager,
+        zen_ConcurrentMarkerTest_enumerateRoots, NULL);
+    zen_MemoryManager_setTenuringThreshold(manager, 1);
+    zen_MemoryManager_setConcurrentMarkingEnabled(manager, false);
+
+    return manager;
+}
+
+int main(int argc, char** argv) {
+    zen_ConcurrentMarkerTest_class.m_referenceFieldCount = 2;
+    zen_ConcurrentMarkerTest_class.m_instanceSize =
+        sizeof (zen_ConcurrentMarkerTest_Node_t);
+
+    int32_t failures = 0;
+
+    zen_MemoryManager_t* manager = zen_ConcurrentMarkerTest_newManager();
+    failures += zen_ConcurrentMarkerTest_testInitiation(manager);
+    zen_MemoryManager_delete(manager);
+
+    manager = zen_ConcurrentMarkerTest_newManager();
+    failures += zen_ConcurrentMarkerTest_testSnapshot(manager);
+    zen_MemoryManager_delete(manager);
+
+    return (failures == 0)? 0 : 1;
+}
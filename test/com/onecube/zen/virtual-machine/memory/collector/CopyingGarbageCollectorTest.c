@@ -0,0 +1,291 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <stdlib.h>
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/CardTable.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
+
+/*******************************************************************************
+ * CopyingGarbageCollectorTest                                                 *
+ *******************************************************************************/
+
+/* The references of an object precede its other fields. */
+struct zen_CopyingGarbageCollectorTest_Node_t {
+    zen_Object_t m_header;
+    zen_Reference_t m_next;
+    zen_Reference_t m_other;
+    int64_t m_value;
+};
+
+typedef struct zen_CopyingGarbageCollectorTest_Node_t zen_CopyingGarbageCollectorTest_Node_t;
+
+#define ZEN_COPYING_GARBAGE_COLLECTOR_TEST_LIST_COUNT 64
+
+#define ZEN_COPYING_GARBAGE_COLLECTOR_TEST_OTHER_VALUE 77
+
+static zen_Object_t* zen_CopyingGarbageCollectorTest_lists[ZEN_COPYING_GARBAGE_COLLECTOR_TEST_LIST_COUNT];
+
+static int64_t zen_CopyingGarbageCollectorTest_lengths[ZEN_COPYING_GARBAGE_COLLECTOR_TEST_LIST_COUNT];
+
+static zen_Class_t zen_CopyingGarbageCollectorTest_class;
+
+static uint32_t zen_CopyingGarbageCollectorTest_seed = 7;
+
+/* The sequence of the pseudo random numbers is the same on every platform. */
+static int32_t zen_CopyingGarbageCollectorTest_random(int32_t limit) {
+    zen_CopyingGarbageCollectorTest_seed = (zen_CopyingGarbageCollectorTest_seed * 1103515245) + 12345;
+    return (int32_t)((zen_CopyingGarbageCollectorTest_seed >> 16) % limit);
+}
+
+static void zen_CopyingGarbageCollectorTest_enumerateRoots(void* context,
+    zen_RootVisitor_t* visitor) {
+    int32_t i;
+    for (i = 0; i < ZEN_COPYING_GARBAGE_COLLECTOR_TEST_LIST_COUNT; i++) {
+        visitor->m_visitRoot(visitor, &zen_CopyingGarbageCollectorTest_lists[i]);
+    }
+}
+
+static zen_CopyingGarbageCollectorTest_Node_t* zen_CopyingGarbageCollectorTest_allocate(
+    zen_MemoryManager_t* manager, zen_AllocationBuffer_t* buffer, int64_t value) {
+    int32_t size = sizeof (zen_CopyingGarbageCollectorTest_Node_t);
+    uint8_t* bytes = zen_AllocationBuffer_allocate(buffer, size);
+    if (bytes == NULL) {
+        bytes = zen_MemoryManager_allocateFromBuffer(manager, buffer, size);
+        if (bytes == NULL) {
+            fprintf(stderr, "The heap is exhausted.\n");
+            exit(1);
+        }
+    }
+
+    zen_CopyingGarbageCollectorTest_Node_t* node = (zen_CopyingGarbageCollectorTest_Node_t*)bytes;
+    node->m_header.m_class = &zen_CopyingGarbageCollectorTest_class;
+    node->m_header.m_size = size;
+    node->m_header.m_flags = 0;
+    zen_Reference_store(&node->m_next, NULL);
+    zen_Reference_store(&node->m_other, NULL);
+    node->m_value = value;
+
+    return node;
+}
+
+/* Lists
+ *
+ * The nodes are prepended to lists, which are dropped once in a while. The
+ * heads of the lists, which survive and may be promoted, receive references
+ * to new objects through the write barrier. Every list is intact after the
+ * collections, and the promoted objects hold the surviving young objects.
+ */
+static int32_t zen_CopyingGarbageCollectorTest_testLists(zen_MemoryManager_t* manager) {
+    int32_t failures = 0;
+
+    zen_AllocationBuffer_t* buffer = zen_MemoryManager_makeAllocationBuffer(manager);
+    zen_CardTable_t* cardTable = manager->m_oldGeneration->m_cardTable;
+    zen_Object_t** lists = zen_CopyingGarbageCollectorTest_lists;
+    int64_t* lengths = zen_CopyingGarbageCollectorTest_lengths;
+
+    int32_t iteration;
+    for (iteration = 0; iteration < 1000000; iteration++) {
+        int32_t list = zen_CopyingGarbageCollectorTest_random(ZEN_COPYING_GARBAGE_COLLECTOR_TEST_LIST_COUNT);
+        zen_CopyingGarbageCollectorTest_Node_t* node = zen_CopyingGarbageCollectorTest_allocate(
+            manager, buffer, (list * 10000000LL) + lengths[list]);
+        zen_Reference_store(&node->m_next, lists[list]);
+        lists[list] = (zen_Object_t*)node;
+        lengths[list]++;
+
+        if (zen_CopyingGarbageCollectorTest_random(8) == 0) {
+            /* The head of the other list may be promoted by now. It is fetched
+             * after the allocation, which may move it.
+             */
+            zen_CopyingGarbageCollectorTest_Node_t* other = zen_CopyingGarbageCollectorTest_allocate(
+                manager, buffer, ZEN_COPYING_GARBAGE_COLLECTOR_TEST_OTHER_VALUE);
+            int32_t otherList = zen_CopyingGarbageCollectorTest_random(ZEN_COPYING_GARBAGE_COLLECTOR_TEST_LIST_COUNT);
+            zen_CopyingGarbageCollectorTest_Node_t* head =
+                (zen_CopyingGarbageCollectorTest_Node_t*)lists[otherList];
+            if (head != NULL) {
+                zen_Reference_store(&head->m_other, (zen_Object_t*)other);
+                zen_CardTable_markObject(cardTable, head);
+            }
+        }
+
+        if ((lengths[list] > 3000) && (zen_CopyingGarbageCollectorTest_random(3) == 0)) {
+            lists[list] = NULL;
+            lengths[list] = 0;
+        }
+    }
+    zen_MemoryManager_mergeAllocationBuffer(manager, buffer);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+
+    /* The allocations exceed the new generation several times over. */
+    ZEN_TEST_CHECK(failures, manager->m_copyingGarbageCollector->m_collectionCount > 2);
+
+    int32_t promotedCount = 0;
+    int32_t i;
+    for (i = 0; i < ZEN_COPYING_GARBAGE_COLLECTOR_TEST_LIST_COUNT; i++) {
+        int64_t length = lengths[i];
+        zen_CopyingGarbageCollectorTest_Node_t* node =
+            (zen_CopyingGarbageCollectorTest_Node_t*)lists[i];
+        while (node != NULL) {
+            length--;
+            if ((node->m_header.m_class != &zen_CopyingGarbageCollectorTest_class) ||
+                (node->m_value != ((i * 10000000LL) + length))) {
+                ZEN_TEST_CHECK(failures, node->m_value == ((i * 10000000LL) + length));
+                return failures;
+            }
+            if (zen_OldGeneration_contains(manager->m_oldGeneration, (uint8_t*)node)) {
+                promotedCount++;
+            }
+
+            zen_CopyingGarbageCollectorTest_Node_t* other =
+                (zen_CopyingGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_other);
+            if (other != NULL) {
+                ZEN_TEST_CHECK(failures, (other->m_header.m_class == &zen_CopyingGarbageCollectorTest_class) &&
+                    (other->m_value == ZEN_COPYING_GARBAGE_COLLECTOR_TEST_OTHER_VALUE));
+            }
+            node = (zen_CopyingGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_next);
+        }
+        ZEN_TEST_CHECK(failures, length == 0);
+    }
+    ZEN_TEST_CHECK(failures, promotedCount > 0);
+
+    return failures;
+}
+
+/* Tenuring
+ *
+ * Every minor collection which an object survives increments its age. The
+ * object stays in the new generation until its age reaches the tenuring
+ * threshold, and is promoted by the next collection.
+ */
+static int32_t zen_CopyingGarbageCollectorTest_testTenuring(zen_MemoryManager_t* manager) {
+    int32_t failures = 0;
+
+    zen_AllocationBuffer_t* buffer = zen_MemoryManager_makeAllocationBuffer(manager);
+    zen_CopyingGarbageCollectorTest_lists[0] = (zen_Object_t*)zen_CopyingGarbageCollectorTest_allocate(
+        manager, buffer, 5);
+    zen_MemoryManager_mergeAllocationBuffer(manager, buffer);
+
+    int32_t threshold = manager->m_copyingGarbageCollector->m_tenuringThreshold;
+    int32_t collection;
+    for (collection = 1; collection <= threshold + 1; collection++) {
+        zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+            ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+
+        zen_CopyingGarbageCollectorTest_Node_t* node =
+            (zen_CopyingGarbageCollectorTest_Node_t*)zen_CopyingGarbageCollectorTest_lists[0];
+        ZEN_TEST_CHECK(failures, node->m_value == 5);
+        bool promoted = zen_OldGeneration_contains(manager->m_oldGeneration, (uint8_t*)node);
+        ZEN_TEST_CHECK(failures, promoted == (collection > threshold));
+        ZEN_TEST_CHECK(failures, zen_Object_getAge((zen_Object_t*)node) == collection);
+    }
+    zen_CopyingGarbageCollectorTest_lists[0] = NULL;
+
+    return failures;
+}
+
+/* Live Data
+ *
+ * A minor collection copies the live objects, and nothing else. However much
+ * garbage surrounds them, the number of bytes copied stays the same.
+ */
+static int32_t zen_CopyingGarbageCollectorTest_testLiveData(zen_MemoryManager_t* manager) {
+    int32_t failures = 0;
+
+    int32_t liveCount = 1000;
+    int32_t size = sizeof (zen_CopyingGarbageCollectorTest_Node_t);
+    int32_t garbageCount;
+    for (garbageCount = 0; garbageCount <= 81; garbageCount += 9) {
+        zen_AllocationBuffer_t* buffer = zen_MemoryManager_makeAllocationBuffer(manager);
+        int32_t i;
+        for (i = 0; i < liveCount; i++) {
+            zen_CopyingGarbageCollectorTest_Node_t* node = zen_CopyingGarbageCollectorTest_allocate(
+                manager, buffer, i);
+            zen_Reference_store(&node->m_next, zen_CopyingGarbageCollectorTest_lists[0]);
+            zen_CopyingGarbageCollectorTest_lists[0] = (zen_Object_t*)node;
+
+            int32_t j;
+            for (j = 0; j < garbageCount; j++) {
+                zen_CopyingGarbageCollectorTest_allocate(manager, buffer, -1);
+            }
+        }
+        zen_MemoryManager_mergeAllocationBuffer(manager, buffer);
+
+        int64_t collectionCount = manager->m_copyingGarbageCollector->m_collectionCount;
+        zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+            ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+        ZEN_TEST_CHECK(failures, manager->m_copyingGarbageCollector->m_collectionCount ==
+            (collectionCount + 1));
+        ZEN_TEST_CHECK(failures, manager->m_copyingGarbageCollector->m_copiedBytes ==
+            ((int64_t)liveCount * size));
+        ZEN_TEST_CHECK(failures, manager->m_copyingGarbageCollector->m_promotedBytes == 0);
+
+        zen_CopyingGarbageCollectorTest_Node_t* node =
+            (zen_CopyingGarbageCollectorTest_Node_t*)zen_CopyingGarbageCollectorTest_lists[0];
+        for (i = liveCount - 1; (node != NULL) && (node->m_value == i); i--) {
+            node = (zen_CopyingGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_next);
+        }
+        ZEN_TEST_CHECK(failures, (node == NULL) && (i == -1));
+
+        /* The list dies before the next round. */
+        zen_CopyingGarbageCollectorTest_lists[0] = NULL;
+    }
+
+    return failures;
+}
+
+static zen_MemoryManager_t* zen_CopyingGarbageCollectorTest_newManager(int32_t tenuringThreshold) {
+    int32_t i;
+    for (i = 0; i < ZEN_COPYING_GARBAGE_COLLECTOR_TEST_LIST_COUNT; i++) {
+        zen_CopyingGarbageCollectorTest_lists[i] = NULL;
+        zen_CopyingGarbageCollectorTest_lengths[i] = 0;
+    }
+
+    zen_MemoryManager_t* manager = zen_MemoryManager_new();
+    zen_MemoryManager_setRootEnumerator(manager,
+        zen_CopyingGarbageCollectorTest_enumerateRoots, NULL);
+    zen_MemoryManager_setTenuringThreshold(manager, tenuringThreshold);
+    zen_MemoryManager_setConcurrentMarkingEnabled(manager, false);
+
+    return manager;
+}
+
+int main(int argc, char** argv) {
+    zen_CopyingGarbageCollectorTest_class.m_referenceFieldCount = 2;
+    zen_CopyingGarbageCollectorTest_class.m_instanceSize =
+        sizeof (zen_CopyingGarbageCollectorTest_Node_t);
+
+    int32_t failures = 0;
+
+    zen_MemoryManager_t* manager = zen_CopyingGarbageCollectorTest_newManager(2);
+    failures += zen_CopyingGarbageCollectorTest_testLists(manager);
+    zen_MemoryManager_delete(manager);
+
+    manager = zen_CopyingGarbageCollectorTest_newManager(3);
+    failures += zen_CopyingGarbageCollectorTest_testTenuring(manager);
+    zen_MemoryManager_delete(manager);
+
+    /* The objects are never old enough to be promoted. */
+    manager = zen_CopyingGarbageCollectorTest_newManager(ZEN_OBJECT_MAXIMUM_AGE);
+    failures += zen_CopyingGarbageCollectorTest_testLiveData(manager);
+    zen_MemoryManager_delete(manager);
+
+    return (failures == 0)? 0 : 1;
+}
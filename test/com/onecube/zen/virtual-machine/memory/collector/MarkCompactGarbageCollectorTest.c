@@ -0,0 +1,439 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <stdlib.h>
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/CardTable.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
+
+/*******************************************************************************
+ * MarkCompactGarbageCollectorTest                                             *
+ *******************************************************************************/
+
+/* The references of an object precede its other fields. */
+struct zen_MarkCompactGarbageCollectorTest_Node_t {
+    zen_Object_t m_header;
+    zen_Reference_t m_next;
+    zen_Reference_t m_other;
+    int64_t m_value;
+};
+
+typedef struct zen_MarkCompactGarbageCollectorTest_Node_t zen_MarkCompactGarbageCollectorTest_Node_t;
+
+#define ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT 64
+
+#define ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_OTHER_VALUE 77
+
+static zen_Object_t* zen_MarkCompactGarbageCollectorTest_lists[ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT];
+
+static int64_t zen_MarkCompactGarbageCollectorTest_lengths[ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT];
+
+static zen_Class_t zen_MarkCompactGarbageCollectorTest_class;
+
+static uint32_t zen_MarkCompactGarbageCollectorTest_seed = 11;
+
+/* The sequence of the pseudo random numbers is the same on every platform. */
+static int32_t zen_MarkCompactGarbageCollectorTest_random(int32_t limit) {
+    zen_MarkCompactGarbageCollectorTest_seed = (zen_MarkCompactGarbageCollectorTest_seed * 1103515245) + 12345;
+    return (int32_t)((zen_MarkCompactGarbageCollectorTest_seed >> 16) % limit);
+}
+
+static void zen_MarkCompactGarbageCollectorTest_enumerateRoots(void* context,
+    zen_RootVisitor_t* visitor) {
+    int32_t i;
+    for (i = 0; i < ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT; i++) {
+        visitor->m_visitRoot(visitor, &zen_MarkCompactGarbageCollectorTest_lists[i]);
+    }
+}
+
+static zen_MarkCompactGarbageCollectorTest_Node_t* zen_MarkCompactGarbageCollectorTest_allocate(
+    zen_MemoryManager_t* manager, zen_AllocationBuffer_t* buffer, int64_t value) {
+    int32_t size = sizeof (zen_MarkCompactGarbageCollectorTest_Node_t);
+    uint8_t* bytes = zen_AllocationBuffer_allocate(buffer, size);
+    if (bytes == NULL) {
+        bytes = zen_MemoryManager_allocateFromBuffer(manager, buffer, size);
+        if (bytes == NULL) {
+            fprintf(stderr, "The heap is exhausted.\n");
+            exit(1);
+        }
+    }
+
+    zen_MarkCompactGarbageCollectorTest_Node_t* node = (zen_MarkCompactGarbageCollectorTest_Node_t*)bytes;
+    node->m_header.m_class = &zen_MarkCompactGarbageCollectorTest_class;
+    node->m_header.m_size = size;
+    node->m_header.m_flags = 0;
+    zen_Reference_store(&node->m_next, NULL);
+    zen_Reference_store(&node->m_other, NULL);
+    node->m_value = value;
+
+    return node;
+}
+
+/* Returns the number of failures found in the lists. */
+static int32_t zen_MarkCompactGarbageCollectorTest_verify(void) {
+    int32_t failures = 0;
+    int32_t i;
+    for (i = 0; i < ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT; i++) {
+        int64_t length = zen_MarkCompactGarbageCollectorTest_lengths[i];
+        zen_MarkCompactGarbageCollectorTest_Node_t* node =
+            (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_MarkCompactGarbageCollectorTest_lists[i];
+        while (node != NULL) {
+            length--;
+            if ((node->m_header.m_class != &zen_MarkCompactGarbageCollectorTest_class) ||
+                (node->m_value != ((i * 10000000LL) + length))) {
+                ZEN_TEST_CHECK(failures, node->m_value == ((i * 10000000LL) + length));
+                return failures;
+            }
+
+            zen_MarkCompactGarbageCollectorTest_Node_t* other =
+                (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_other);
+            if (other != NULL) {
+                ZEN_TEST_CHECK(failures, (other->m_header.m_class == &zen_MarkCompactGarbageCollectorTest_class) &&
+                    (other->m_value == ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_OTHER_VALUE));
+            }
+            node = (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_next);
+        }
+        ZEN_TEST_CHECK(failures, length == 0);
+    }
+    return failures;
+}
+
+/* Compaction
+ *
+ * Every survivor is promoted at once, so that the old generation fills with
+ * lists which are dropped once in a while. The major collections in between
+ * move the surviving objects and update the references to them, including
+ * the references which were moved between old objects.
+ */
+static int32_t zen_MarkCompactGarbageCollectorTest_testCompaction(zen_MemoryManager_t* manager) {
+    int32_t failures = 0;
+
+    zen_AllocationBuffer_t* buffer = zen_MemoryManager_makeAllocationBuffer(manager);
+    zen_OldGeneration_t* oldGeneration = manager->m_oldGeneration;
+    zen_Object_t** lists = zen_MarkCompactGarbageCollectorTest_lists;
+    int64_t* lengths = zen_MarkCompactGarbageCollectorTest_lengths;
+
+    int32_t iteration;
+    for (iteration = 1; iteration <= 2000000; iteration++) {
+        int32_t list = zen_MarkCompactGarbageCollectorTest_random(ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT);
+        zen_MarkCompactGarbageCollectorTest_Node_t* node = zen_MarkCompactGarbageCollectorTest_allocate(
+            manager, buffer, (list * 10000000LL) + lengths[list]);
+        zen_Reference_store(&node->m_next, lists[list]);
+        lists[list] = (zen_Object_t*)node;
+        lengths[list]++;
+
+        /* Move a reference from the head of one list to the head of another
+         * list, or give the head a new object to refer to.
+         */
+        if (zen_MarkCompactGarbageCollectorTest_random(4) == 0) {
+            zen_MarkCompactGarbageCollectorTest_Node_t* source =
+                (zen_MarkCompactGarbageCollectorTest_Node_t*)lists[zen_MarkCompactGarbageCollectorTest_random(ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT)];
+            zen_MarkCompactGarbageCollectorTest_Node_t* target =
+                (zen_MarkCompactGarbageCollectorTest_Node_t*)lists[zen_MarkCompactGarbageCollectorTest_random(ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT)];
+            if ((source != NULL) && (target != NULL) && (source != target)) {
+                zen_Object_t* other = zen_Reference_load(&source->m_other);
+                if (other != NULL) {
+                    zen_Reference_store(&source->m_other, NULL);
+                    zen_Reference_store(&target->m_other, other);
+                    zen_CardTable_markObject(oldGeneration->m_cardTable, target);
+                }
+                else if (zen_Reference_load(&target->m_other) == NULL) {
+                    /* The allocation may move the target. */
+                    int32_t targetList = (int32_t)(target->m_value / 10000000LL);
+                    other = (zen_Object_t*)zen_MarkCompactGarbageCollectorTest_allocate(manager,
+                        buffer, ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_OTHER_VALUE);
+                    target = (zen_MarkCompactGarbageCollectorTest_Node_t*)lists[targetList];
+                    zen_Reference_store(&target->m_other, other);
+                    zen_CardTable_markObject(oldGeneration->m_cardTable, target);
+                }
+            }
+        }
+
+        if ((lengths[list] > 3000) && (zen_MarkCompactGarbageCollectorTest_random(3) == 0)) {
+            lists[list] = NULL;
+            lengths[list] = 0;
+        }
+
+        if ((iteration % 500000) == 0) {
+            zen_MemoryManager_mergeAllocationBuffer(manager, buffer);
+            zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+                ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+            buffer = zen_MemoryManager_makeAllocationBuffer(manager);
+            failures += zen_MarkCompactGarbageCollectorTest_verify();
+        }
+    }
+    zen_MemoryManager_mergeAllocationBuffer(manager, buffer);
+
+    ZEN_TEST_CHECK(failures, manager->m_markCompactGarbageCollector->m_collectionCount >= 4);
+
+    /* The old generation shrinks once the lists are dropped. Every object in
+     * the new generation is a root of a major collection, including the dead
+     * ones. Therefore, the new generation is collected first.
+     */
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    int64_t usedSize = zen_OldGeneration_getUsedSize(oldGeneration);
+    int32_t i;
+    for (i = 0; i < ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT; i += 2) {
+        lists[i] = NULL;
+        lengths[i] = 0;
+    }
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    ZEN_TEST_CHECK(failures, zen_OldGeneration_getUsedSize(oldGeneration) < usedSize);
+    failures += zen_MarkCompactGarbageCollectorTest_verify();
+
+    return failures;
+}
+
+/* Builds a single list of the specified length, and promotes it. Since the
+ * list is copied breadth first, its nodes are laid out one after another in
+ * the old generation.
+ */
+static void zen_MarkCompactGarbageCollectorTest_promoteList(zen_MemoryManager_t* manager,
+    int64_t length) {
+    zen_AllocationBuffer_t* buffer = zen_MemoryManager_makeAllocationBuffer(manager);
+    int64_t i;
+    for (i = 0; i < length; i++) {
+        zen_MarkCompactGarbageCollectorTest_Node_t* node = zen_MarkCompactGarbageCollectorTest_allocate(
+            manager, buffer, i);
+        zen_Reference_store(&node->m_next, zen_MarkCompactGarbageCollectorTest_lists[0]);
+        zen_MarkCompactGarbageCollectorTest_lists[0] = (zen_Object_t*)node;
+    }
+    zen_MarkCompactGarbageCollectorTest_lengths[0] = length;
+    zen_MemoryManager_mergeAllocationBuffer(manager, buffer);
+
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+}
+
+/* Deep List
+ *
+ * A list of a million nodes is marked without recursion, therefore, the
+ * native stack does not overflow. Every node survives. The promoted nodes
+ * occupy their aligned sizes.
+ */
+static int32_t zen_MarkCompactGarbageCollectorTest_testDeepList(zen_MemoryManager_t* manager) {
+    int32_t failures = 0;
+
+    int64_t length = 1000000;
+    zen_MarkCompactGarbageCollectorTest_promoteList(manager, length);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+
+    ZEN_TEST_CHECK(failures, manager->m_markCompactGarbageCollector->m_markedBytes ==
+        (length * zen_OldGeneration_alignSize(sizeof (zen_MarkCompactGarbageCollectorTest_Node_t))));
+    failures += zen_MarkCompactGarbageCollectorTest_verify();
+
+    return failures;
+}
+
+/* Squeeze
+ *
+ * Every thirty second node of a promoted list is unlinked. The dead nodes
+ * waste less than the permitted fraction of the white region, so that an
+ * ordinary major collection treats the whole region as the dense prefix and
+ * moves nothing. A collection requested with the squeeze flag moves every
+ * survivor, leaving no gaps.
+ */
+static int32_t zen_MarkCompactGarbageCollectorTest_testSqueeze(zen_MemoryManager_t* manager) {
+    int32_t failures = 0;
+
+    int64_t length = 32 * 1024;
+    zen_MarkCompactGarbageCollectorTest_promoteList(manager, length);
+
+    /* The values are renumbered, so that they remain consecutive. */
+    zen_MarkCompactGarbageCollectorTest_Node_t* node =
+        (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_MarkCompactGarbageCollectorTest_lists[0];
+    int64_t remaining = 0;
+    int64_t i;
+    for (i = 0; node != NULL; i++) {
+        zen_MarkCompactGarbageCollectorTest_Node_t* next =
+            (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_next);
+        if (((i % 32) == 31) && (next != NULL)) {
+            zen_Reference_store(&node->m_next, zen_Reference_load(&next->m_next));
+        }
+        remaining++;
+        node = (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_next);
+    }
+    node = (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_MarkCompactGarbageCollectorTest_lists[0];
+    for (i = remaining - 1; node != NULL; i--) {
+        node->m_value = i;
+        node = (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_next);
+    }
+    zen_MarkCompactGarbageCollectorTest_lengths[0] = remaining;
+
+    zen_OldGeneration_t* oldGeneration = manager->m_oldGeneration;
+    zen_MarkCompactGarbageCollector_t* collector = manager->m_markCompactGarbageCollector;
+    uint8_t* start = oldGeneration->m_whiteRegion->m_start;
+    int64_t extent = oldGeneration->m_free - start;
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    ZEN_TEST_CHECK(failures, (oldGeneration->m_free - start) == extent);
+    ZEN_TEST_CHECK(failures, collector->m_markedBytes < extent);
+    failures += zen_MarkCompactGarbageCollectorTest_verify();
+
+    zen_MemoryManager_collectEx(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE, NULL,
+        ZEN_GARBAGE_COLLECTION_FLAG_SQUEEZE);
+    ZEN_TEST_CHECK(failures, (oldGeneration->m_free - start) == collector->m_markedBytes);
+    ZEN_TEST_CHECK(failures, collector->m_markedBytes ==
+        (remaining * zen_OldGeneration_alignSize(sizeof (zen_MarkCompactGarbageCollectorTest_Node_t))));
+    failures += zen_MarkCompactGarbageCollectorTest_verify();
+
+    return failures;
+}
+
+/* Builds a complete binary tree of the specified depth, whose nodes hold the
+ * numbers in the order of a preorder traversal. The tree fits in the new
+ * generation, therefore, the nodes are not moved while it is built.
+ */
+static zen_MarkCompactGarbageCollectorTest_Node_t* zen_MarkCompactGarbageCollectorTest_makeTree(
+    zen_MemoryManager_t* manager, zen_AllocationBuffer_t* buffer, int32_t depth, int64_t* value) {
+    zen_MarkCompactGarbageCollectorTest_Node_t* node = zen_MarkCompactGarbageCollectorTest_allocate(
+        manager, buffer, (*value)++);
+    if (depth > 1) {
+        zen_Reference_store(&node->m_next, (zen_Object_t*)zen_MarkCompactGarbageCollectorTest_makeTree(
+            manager, buffer, depth - 1, value));
+        zen_Reference_store(&node->m_other, (zen_Object_t*)zen_MarkCompactGarbageCollectorTest_makeTree(
+            manager, buffer, depth - 1, value));
+    }
+    return node;
+}
+
+/* Returns the number of nodes of the tree which are numbered correctly. */
+static int64_t zen_MarkCompactGarbageCollectorTest_countTree(
+    zen_MarkCompactGarbageCollectorTest_Node_t* node, int64_t* value) {
+    if ((node == NULL) || (node->m_header.m_class != &zen_MarkCompactGarbageCollectorTest_class) ||
+        (node->m_value != (*value)++)) {
+        return 0;
+    }
+    return 1 +
+        zen_MarkCompactGarbageCollectorTest_countTree(
+            (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_next), value) +
+        zen_MarkCompactGarbageCollectorTest_countTree(
+            (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_Reference_load(&node->m_other), value);
+}
+
+static int32_t zen_MarkCompactGarbageCollectorTest_markingWorkerCount;
+
+static uint64_t zen_MarkCompactGarbageCollectorTest_markingDuration;
+
+static void zen_MarkCompactGarbageCollectorTest_onAfterGarbageCollection(
+    zen_GarbageCollectionListener_t* listener, zen_GarbageCollectionProfile_t* profile) {
+    zen_MarkCompactGarbageCollectorTest_markingWorkerCount = profile->m_markingWorkerCount;
+    zen_MarkCompactGarbageCollectorTest_markingDuration = 0;
+    int32_t i;
+    for (i = 0; i < profile->m_markingWorkerCount; i++) {
+        zen_MarkCompactGarbageCollectorTest_markingDuration += profile->m_markingDurations[i];
+    }
+}
+
+/* Workers
+ *
+ * The same tree is marked by different numbers of marking workers. Every
+ * number of workers marks exactly the nodes of the tree, and the profile of
+ * the collection reports the time that each worker spent marking.
+ */
+static int32_t zen_MarkCompactGarbageCollectorTest_testWorkers(zen_MemoryManager_t* manager) {
+    int32_t failures = 0;
+
+    int32_t depth = 16;
+    int64_t nodeCount = ((int64_t)1 << depth) - 1;
+    int64_t value = 0;
+    zen_AllocationBuffer_t* buffer = zen_MemoryManager_makeAllocationBuffer(manager);
+    zen_MarkCompactGarbageCollectorTest_lists[0] =
+        (zen_Object_t*)zen_MarkCompactGarbageCollectorTest_makeTree(manager, buffer, depth, &value);
+    zen_MemoryManager_mergeAllocationBuffer(manager, buffer);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+
+    zen_GarbageCollectionListener_t listener = { 0 };
+    listener.m_onAfterGarbageCollection = zen_MarkCompactGarbageCollectorTest_onAfterGarbageCollection;
+
+    int32_t workerCount;
+    for (workerCount = 1; workerCount <= 8; workerCount *= 2) {
+        zen_MemoryManager_setMarkingWorkerCount(manager, workerCount);
+        zen_MemoryManager_collectEx(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+            ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE, &listener, 0);
+
+        ZEN_TEST_CHECK(failures, manager->m_markCompactGarbageCollector->m_markedBytes ==
+            (nodeCount * zen_OldGeneration_alignSize(sizeof (zen_MarkCompactGarbageCollectorTest_Node_t))));
+        ZEN_TEST_CHECK(failures, zen_MarkCompactGarbageCollectorTest_markingWorkerCount == workerCount);
+        ZEN_TEST_CHECK(failures, zen_MarkCompactGarbageCollectorTest_markingDuration > 0);
+
+        value = 0;
+        ZEN_TEST_CHECK(failures, zen_MarkCompactGarbageCollectorTest_countTree(
+            (zen_MarkCompactGarbageCollectorTest_Node_t*)zen_MarkCompactGarbageCollectorTest_lists[0],
+            &value) == nodeCount);
+    }
+
+    return failures;
+}
+
+static zen_MemoryManager_t* zen_MarkCompactGarbageCollectorTest_newManager() {
+    int32_t i;
+    for (i = 0; i < ZEN_MARK_COMPACT_GARBAGE_COLLECTOR_TEST_LIST_COUNT; i++) {
+        zen_MarkCompactGarbageCollectorTest_lists[i] = NULL;
+        zen_MarkCompactGarbageCollectorTest_lengths[i] = 0;
+    }
+
+    zen_MemoryManager_t* manager = zen_MemoryManager_new();
+    zen_MemoryManager_setRootEnumerator(manager,
+        zen_MarkCompactGarbageCollectorTest_enumerateRoots, NULL);
+    zen_MemoryManager_setTenuringThreshold(manager, 1);
+    zen_MemoryManager_setConcurrentMarkingEnabled(manager, false);
+
+    return manager;
+}
+
+int main(int argc, char** argv) {
+    zen_MarkCompactGarbageCollectorTest_class.m_referenceFieldCount = 2;
+    zen_MarkCompactGarbageCollectorTest_class.m_instanceSize =
+        sizeof (zen_MarkCompactGarbageCollectorTest_Node_t);
+
+    int32_t failures = 0;
+
+    zen_MemoryManager_t* manager = zen_MarkCompactGarbageCollectorTest_newManager();
+    failures += zen_MarkCompactGarbageCollectorTest_testCompaction(manager);
+    zen_MemoryManager_delete(manager);
+
+    manager = zen_MarkCompactGarbageCollectorTest_newManager();
+    failures += zen_MarkCompactGarbageCollectorTest_testDeepList(manager);
+    zen_MemoryManager_delete(manager);
+
+    manager = zen_MarkCompactGarbageCollectorTest_newManager();
+    failures += zen_MarkCompactGarbageCollectorTest_testSqueeze(manager);
+    zen_MemoryManager_delete(manager);
+
+    manager = zen_MarkCompactGarbageCollectorTest_newManager();
+    failures += zen_MarkCompactGarbageCollectorTest_testWorkers(manager);
+    zen_MemoryManager_delete(manager);
+
+    return (failures == 0)? 0 : 1;
+}
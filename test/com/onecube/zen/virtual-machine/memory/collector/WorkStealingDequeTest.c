@@ -0,0 +1,172 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/WorkStealingDeque.h>
+
+/*******************************************************************************
+ * WorkStealingDequeTest                                                       *
+ *******************************************************************************/
+
+#define ZEN_WORK_STEALING_DEQUE_TEST_THIEF_COUNT 3
+
+/* The deque never dereferences the objects. Therefore, the objects are the
+ * addresses of the counters which record how many times each object was
+ * taken out of the deque.
+ */
+#define ZEN_WORK_STEALING_DEQUE_TEST_OBJECT_COUNT (256 * 1024)
+
+static int32_t zen_WorkStealingDequeTest_counters[ZEN_WORK_STEALING_DEQUE_TEST_OBJECT_COUNT];
+
+static zen_WorkStealingDeque_t* zen_WorkStealingDequeTest_deque;
+
+static int32_t zen_WorkStealingDequeTest_done;
+
+static inline zen_Object_t* zen_WorkStealingDequeTest_getObject(int32_t index) {
+    return (zen_Object_t*)&zen_WorkStealingDequeTest_counters[index];
+}
+
+static inline void zen_WorkStealingDequeTest_take(zen_Object_t* object) {
+    __atomic_fetch_add((int32_t*)object, 1, __ATOMIC_RELAXED);
+}
+
+/* Order
+ *
+ * The owner pops the objects in the reverse order of their pushes, while the
+ * thieves steal them in the order of their pushes. The deque grows beyond its
+ * initial capacity without losing any object.
+ */
+static int32_t zen_WorkStealingDequeTest_testOrder() {
+    int32_t failures = 0;
+
+    zen_WorkStealingDeque_t* deque = zen_WorkStealingDeque_new();
+    ZEN_TEST_CHECK(failures, zen_WorkStealingDeque_isEmpty(deque));
+    ZEN_TEST_CHECK(failures, zen_WorkStealingDeque_pop(deque) == NULL);
+    ZEN_TEST_CHECK(failures, zen_WorkStealingDeque_steal(deque) == NULL);
+
+    int32_t count = ZEN_WORK_STEALING_DEQUE_DEFAULT_CAPACITY * 4;
+    int32_t i;
+    for (i = 0; i < count; i++) {
+        zen_WorkStealingDeque_push(deque, zen_WorkStealingDequeTest_getObject(i));
+    }
+    ZEN_TEST_CHECK(failures, !zen_WorkStealingDeque_isEmpty(deque));
+
+    int32_t low = 0;
+    int32_t high = count - 1;
+    for (i = 0; i < count; i++) {
+        if ((i % 2) == 0) {
+            ZEN_TEST_CHECK(failures, zen_WorkStealingDeque_pop(deque) ==
+                zen_WorkStealingDequeTest_getObject(high--));
+        }
+        else {
+            ZEN_TEST_CHECK(failures, zen_WorkStealingDeque_steal(deque) ==
+                zen_WorkStealingDequeTest_getObject(low++));
+        }
+    }
+    ZEN_TEST_CHECK(failures, zen_WorkStealingDeque_isEmpty(deque));
+    ZEN_TEST_CHECK(failures, zen_WorkStealingDeque_pop(deque) == NULL);
+
+    zen_WorkStealingDeque_push(deque, zen_WorkStealingDequeTest_getObject(0));
+    zen_WorkStealingDeque_clear(deque);
+    ZEN_TEST_CHECK(failures, zen_WorkStealingDeque_isEmpty(deque));
+
+    zen_WorkStealingDeque_delete(deque);
+
+    return failures;
+}
+
+static void* zen_WorkStealingDequeTest_runThief(void* argument) {
+    while (true) {
+        zen_Object_t* object = zen_WorkStealingDeque_steal(zen_WorkStealingDequeTest_deque);
+        if (object != NULL) {
+            zen_WorkStealingDequeTest_take(object);
+        }
+        else if (__atomic_load_n(&zen_WorkStealingDequeTest_done, __ATOMIC_ACQUIRE) &&
+            zen_WorkStealingDeque_isEmpty(zen_WorkStealingDequeTest_deque)) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+/* Contention
+ *
+ * The owner pushes the objects in bursts and pops some of them, while the
+ * thieves steal from the other end. Every object is taken out of the deque
+ * exactly once, including the last objects, which the owner and the thieves
+ * contend for.
+ */
+static int32_t zen_WorkStealingDequeTest_testContention() {
+    int32_t failures = 0;
+
+    zen_WorkStealingDeque_t* deque = zen_WorkStealingDeque_new();
+    zen_WorkStealingDequeTest_deque = deque;
+    zen_WorkStealingDequeTest_done = 0;
+
+    pthread_t thieves[ZEN_WORK_STEALING_DEQUE_TEST_THIEF_COUNT];
+    int32_t i;
+    for (i = 0; i < ZEN_WORK_STEALING_DEQUE_TEST_THIEF_COUNT; i++) {
+        pthread_create(&thieves[i], NULL, zen_WorkStealingDequeTest_runThief, NULL);
+    }
+
+    int32_t next = 0;
+    while (next < ZEN_WORK_STEALING_DEQUE_TEST_OBJECT_COUNT) {
+        int32_t burst = 1 + (next % 37);
+        int32_t j;
+        for (j = 0; (j < burst) && (next < ZEN_WORK_STEALING_DEQUE_TEST_OBJECT_COUNT); j++) {
+            zen_WorkStealingDeque_push(deque, zen_WorkStealingDequeTest_getObject(next++));
+        }
+        for (j = 0; j < (burst / 2); j++) {
+            zen_Object_t* object = zen_WorkStealingDeque_pop(deque);
+            if (object != NULL) {
+                zen_WorkStealingDequeTest_take(object);
+            }
+        }
+    }
+    zen_Object_t* object;
+    while ((object = zen_WorkStealingDeque_pop(deque)) != NULL) {
+        zen_WorkStealingDequeTest_take(object);
+    }
+    __atomic_store_n(&zen_WorkStealingDequeTest_done, 1, __ATOMIC_RELEASE);
+
+    for (i = 0; i < ZEN_WORK_STEALING_DEQUE_TEST_THIEF_COUNT; i++) {
+        pthread_join(thieves[i], NULL);
+    }
+
+    for (i = 0; i < ZEN_WORK_STEALING_DEQUE_TEST_OBJECT_COUNT; i++) {
+        if (zen_WorkStealingDequeTest_counters[i] != 1) {
+            ZEN_TEST_CHECK(failures, zen_WorkStealingDequeTest_counters[i] == 1);
+            break;
+        }
+    }
+
+    zen_WorkStealingDeque_delete(deque);
+
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    int32_t failures = 0;
+    failures += zen_WorkStealingDequeTest_testOrder();
+    failures += zen_WorkStealingDequeTest_testContention();
+
+    return (failures == 0)? 0 : 1;
+}
@@ -0,0 +1,351 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/feb/EntityFlag.h>
+#include <com/onecube/zen/virtual-machine/object/Field.h>
+
+/*******************************************************************************
+ * ClassTest                                                                   *
+ *******************************************************************************/
+
+#define ZEN_CLASS_TEST_INDEX(index) (((index) & 0xFF00) >> 8), ((index) & 0x00FF)
+
+/* The instance fields of the class, in the order of their declaration. */
+static const char* zen_ClassTest_fieldNames[] = {
+    "flag", "count", "next", "total", "small", "ratio"
+};
+
+static const char* zen_ClassTest_fieldDescriptors[] = {
+    "b", "i", "(Point)", "l", "s", "d"
+};
+
+#define ZEN_CLASS_TEST_FIELD_COUNT 6
+
+static zen_Field_t* zen_ClassTest_getField(zen_Class_t* class0, const char* name) {
+    jtk_CString_t* string = jtk_CString_new((const uint8_t*)name);
+    zen_Field_t* field = zen_Class_getField(class0, string);
+    jtk_CString_delete(string);
+    return field;
+}
+
+static int32_t zen_ClassTest_getFieldSize(zen_Field_t* field) {
+    return zen_Field_isReference(field)? (int32_t)sizeof (zen_Reference_t) :
+        zen_Field_getSizeOfType(field->m_type);
+}
+
+static zen_Class_t* zen_ClassTest_loadPoint(zen_VirtualMachine_t* virtualMachine) {
+    zen_TestEntity_t* entity = zen_TestEntity_new("Point");
+    uint16_t classIndex = zen_TestEntity_getClassIndex(entity);
+    uint16_t fieldIndexes[ZEN_CLASS_TEST_FIELD_COUNT];
+    int32_t i;
+    for (i = 0; i < ZEN_CLASS_TEST_FIELD_COUNT; i++) {
+        zen_TestEntity_addField(entity, 0, zen_ClassTest_fieldNames[i],
+            zen_ClassTest_fieldDescriptors[i]);
+        fieldIndexes[i] = zen_TestEntity_addFieldReference(entity, classIndex,
+            zen_ClassTest_fieldNames[i], zen_ClassTest_fieldDescriptors[i]);
+    }
+    /* A static field does not occupy the instances. */
+    zen_TestEntity_addField(entity, ZEN_ENTITY_FLAG_STATIC, "instances", "i");
+    zen_TestEntity_addField(entity, ZEN_ENTITY_FLAG_STATIC, "head", "(Point)");
+    uint16_t instancesIndex = zen_TestEntity_addFieldReference(entity, classIndex,
+        "instances", "i");
+    uint16_t headIndex = zen_TestEntity_addFieldReference(entity, classIndex,
+        "head", "(Point)");
+
+    /* The local variables are the count, the total, the ratio, and the new
+     * object, in that order.
+     */
+    uint8_t make[] = {
+        ZEN_BYTE_CODE_NEW, ZEN_CLASS_TEST_INDEX(classIndex),
+        ZEN_BYTE_CODE_STORE_A, 3,
+        ZEN_BYTE_CODE_LOAD_A, 3,
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_STORE_INSTANCE_FIELD, ZEN_CLASS_TEST_INDEX(fieldIndexes[1]),
+        ZEN_BYTE_CODE_LOAD_A, 3,
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_STORE_INSTANCE_FIELD, ZEN_CLASS_TEST_INDEX(fieldIndexes[4]),
+        ZEN_BYTE_CODE_LOAD_A, 3,
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_STORE_INSTANCE_FIELD, ZEN_CLASS_TEST_INDEX(fieldIndexes[0]),
+        ZEN_BYTE_CODE_LOAD_A, 3,
+        ZEN_BYTE_CODE_LOAD_L, 1,
+        ZEN_BYTE_CODE_STORE_INSTANCE_FIELD, ZEN_CLASS_TEST_INDEX(fieldIndexes[3]),
+        ZEN_BYTE_CODE_LOAD_A, 3,
+        ZEN_BYTE_CODE_LOAD_D, 2,
+        ZEN_BYTE_CODE_STORE_INSTANCE_FIELD, ZEN_CLASS_TEST_INDEX(fieldIndexes[5]),
+        ZEN_BYTE_CODE_LOAD_A, 3,
+        ZEN_BYTE_CODE_LOAD_A, 3,
+        ZEN_BYTE_CODE_STORE_INSTANCE_FIELD, ZEN_CLASS_TEST_INDEX(fieldIndexes[2]),
+        ZEN_BYTE_CODE_LOAD_A, 3,
+        ZEN_BYTE_CODE_RETURN_A
+    };
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "make", "(Point):ild",
+        2, 4, make, sizeof (make));
+
+    /* The fields of different types are loaded one after another, so that
+     * each load must find the field named by its own operand.
+     */
+    uint8_t mix[] = {
+        ZEN_BYTE_CODE_LOAD_A, 0,
+        ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD, ZEN_CLASS_TEST_INDEX(fieldIndexes[3]),
+        ZEN_BYTE_CODE_LOAD_A, 0,
+        ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD, ZEN_CLASS_TEST_INDEX(fieldIndexes[1]),
+        ZEN_BYTE_CODE_CAST_ITL,
+        ZEN_BYTE_CODE_ADD_L,
+        ZEN_BYTE_CODE_LOAD_A, 0,
+        ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD, ZEN_CLASS_TEST_INDEX(fieldIndexes[0]),
+        ZEN_BYTE_CODE_CAST_ITL,
+        ZEN_BYTE_CODE_ADD_L,
+        ZEN_BYTE_CODE_RETURN_L
+    };
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "mix", "l:(Point)",
+        2, 1, mix, sizeof (mix));
+
+    /* The object is published through a static field, and the number of
+     * published objects is counted in another one.
+     */
+    uint8_t publish[] = {
+        ZEN_BYTE_CODE_LOAD_A, 0,
+        ZEN_BYTE_CODE_STORE_STATIC_FIELD, ZEN_CLASS_TEST_INDEX(headIndex),
+        ZEN_BYTE_CODE_LOAD_STATIC_FIELD, ZEN_CLASS_TEST_INDEX(instancesIndex),
+        ZEN_BYTE_CODE_PUSH_I1,
+        ZEN_BYTE_CODE_ADD_I,
+        ZEN_BYTE_CODE_STORE_STATIC_FIELD, ZEN_CLASS_TEST_INDEX(instancesIndex),
+        ZEN_BYTE_CODE_LOAD_STATIC_FIELD, ZEN_CLASS_TEST_INDEX(instancesIndex),
+        ZEN_BYTE_CODE_RETURN_I
+    };
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "publish", "i:(Point)",
+        2, 1, publish, sizeof (publish));
+
+    uint8_t head[] = {
+        ZEN_BYTE_CODE_LOAD_STATIC_FIELD, ZEN_CLASS_TEST_INDEX(headIndex),
+        ZEN_BYTE_CODE_RETURN_A
+    };
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "head", "(Point):v",
+        1, 0, head, sizeof (head));
+
+    zen_Class_t* class0 = zen_TestEntity_load(entity, virtualMachine);
+    zen_TestEntity_delete(entity);
+
+    return class0;
+}
+
+/* Layout
+ *
+ * The references precede the other fields. Every field is naturally aligned,
+ * the fields do not overlap, and the instance is not larger than the fields
+ * require.
+ */
+static int32_t zen_ClassTest_testLayout(zen_Class_t* class0) {
+    int32_t failures = 0;
+
+    ZEN_TEST_CHECK(failures, class0->m_referenceFieldCount == 1);
+    ZEN_TEST_CHECK(failures, (class0->m_instanceSize & 7) == 0);
+
+    int32_t required = sizeof (zen_Object_t);
+    int32_t i;
+    for (i = 0; i < ZEN_CLASS_TEST_FIELD_COUNT; i++) {
+        zen_Field_t* field = zen_ClassTest_getField(class0, zen_ClassTest_fieldNames[i]);
+        ZEN_TEST_CHECK(failures, field != NULL);
+        if (field == NULL) {
+            continue;
+        }
+
+        int32_t size = zen_ClassTest_getFieldSize(field);
+        required += size;
+        ZEN_TEST_CHECK(failures, field->m_offset >= (int32_t)sizeof (zen_Object_t));
+        ZEN_TEST_CHECK(failures, (field->m_offset % size) == 0);
+        ZEN_TEST_CHECK(failures, (field->m_offset + size) <= class0->m_instanceSize);
+
+        int32_t j;
+        for (j = 0; j < i; j++) {
+            zen_Field_t* other = zen_ClassTest_getField(class0, zen_ClassTest_fieldNames[j]);
+            int32_t otherSize = zen_ClassTest_getFieldSize(other);
+            ZEN_TEST_CHECK(failures, ((field->m_offset + size) <= other->m_offset) ||
+                ((other->m_offset + otherSize) <= field->m_offset));
+            if (zen_Field_isReference(field) != zen_Field_isReference(other)) {
+                ZEN_TEST_CHECK(failures, zen_Field_isReference(field) ==
+                    (field->m_offset < other->m_offset));
+            }
+        }
+    }
+    ZEN_TEST_CHECK(failures, class0->m_instanceSize == ((required + 7) & ~7));
+
+    /* The static fields occupy their own slots, with the references first. */
+    zen_Field_t* instances = zen_ClassTest_getField(class0, "instances");
+    zen_Field_t* head = zen_ClassTest_getField(class0, "head");
+    ZEN_TEST_CHECK(failures, (instances != NULL) && (instances->m_offset < 0));
+    ZEN_TEST_CHECK(failures, (head != NULL) && (head->m_offset < 0));
+    ZEN_TEST_CHECK(failures, class0->m_staticFieldCount == 2);
+    ZEN_TEST_CHECK(failures, class0->m_staticReferenceFieldCount == 1);
+    ZEN_TEST_CHECK(failures, (head != NULL) && (head->m_index == 0));
+    ZEN_TEST_CHECK(failures, (instances != NULL) && (instances->m_index == 1));
+
+    return failures;
+}
+
+/* Store
+ *
+ * The values stored by the interpreter are found at the offsets of the
+ * fields. The narrow fields are truncated.
+ */
+static int32_t zen_ClassTest_testStore(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0) {
+    int32_t failures = 0;
+
+    zen_Slot_t arguments[3];
+    arguments[0].m_integer = 0x12345;
+    arguments[1].m_long = (int64_t)1 << 40;
+    arguments[2].m_double = 0.5;
+    zen_Object_t* object = (zen_Object_t*)zen_TestEntity_invoke(virtualMachine, class0,
+        "make", "(Point):ild", arguments, 3).m_reference;
+    ZEN_TEST_CHECK(failures, object != NULL);
+    if (object == NULL) {
+        return failures;
+    }
+
+    uint8_t* bytes = (uint8_t*)object;
+    ZEN_TEST_CHECK(failures, object->m_class == class0);
+    ZEN_TEST_CHECK(failures, object->m_size == class0->m_instanceSize);
+    ZEN_TEST_CHECK(failures, *(int8_t*)(bytes + zen_ClassTest_getField(class0, "flag")->m_offset) == 0x45);
+    ZEN_TEST_CHECK(failures, *(int32_t*)(bytes + zen_ClassTest_getField(class0, "count")->m_offset) == 0x12345);
+    ZEN_TEST_CHECK(failures, zen_Reference_load((zen_Reference_t*)(bytes +
+        zen_ClassTest_getField(class0, "next")->m_offset)) == object);
+    ZEN_TEST_CHECK(failures, *(int64_t*)(bytes + zen_ClassTest_getField(class0, "total")->m_offset) == ((int64_t)1 << 40));
+    ZEN_TEST_CHECK(failures, *(int16_t*)(bytes + zen_ClassTest_getField(class0, "small")->m_offset) == 0x2345);
+    ZEN_TEST_CHECK(failures, *(double*)(bytes + zen_ClassTest_getField(class0, "ratio")->m_offset) == 0.5);
+
+    return failures;
+}
+
+/* Load
+ *
+ * The fields of different types are loaded by the same function, many times
+ * over. When the instructions are decoded, the operand of each load is read
+ * from its record.
+ */
+static int32_t zen_ClassTest_testLoad(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0) {
+    int32_t failures = 0;
+
+#ifdef ZEN_INTERPRETER_PREDECODE
+    jtk_CString_t* name = jtk_CString_new((const uint8_t*)"mix");
+    jtk_CString_t* descriptor = jtk_CString_new((const uint8_t*)"l:(Point)");
+    zen_Function_t* function = zen_Class_getStaticFunction(class0, name, descriptor);
+    ZEN_TEST_CHECK(failures, function->m_instructionAttribute->m_decodedInstructions != NULL);
+    jtk_CString_delete(name);
+    jtk_CString_delete(descriptor);
+#endif
+
+    int32_t i;
+    for (i = 0; i < 2000; i++) {
+        zen_Slot_t arguments[3];
+        arguments[0].m_integer = (i * 1000) + (i % 100);
+        arguments[1].m_long = (int64_t)i << 32;
+        arguments[2].m_double = i;
+        zen_Slot_t object = zen_TestEntity_invoke(virtualMachine, class0, "make",
+            "(Point):ild", arguments, 3);
+
+        int64_t expected = ((int64_t)i << 32) + ((i * 1000) + (i % 100)) +
+            (int8_t)((i * 1000) + (i % 100));
+        int64_t result = zen_TestEntity_invoke(virtualMachine, class0, "mix",
+            "l:(Point)", &object, 1).m_long;
+        if (result != expected) {
+            ZEN_TEST_CHECK(failures, result == expected);
+            break;
+        }
+    }
+
+    return failures;
+}
+
+/* Static
+ *
+ * The values stored into the static fields are loaded back. An object which
+ * is reachable only from a static field survives the collections, and the
+ * static field follows it when it is moved.
+ */
+static int32_t zen_ClassTest_testStatic(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0) {
+    int32_t failures = 0;
+
+    zen_Slot_t arguments[3];
+    arguments[0].m_integer = 777;
+    arguments[1].m_long = 0;
+    arguments[2].m_double = 0.0;
+    zen_Slot_t object = zen_TestEntity_invoke(virtualMachine, class0, "make",
+        "(Point):ild", arguments, 3);
+    int32_t count = zen_TestEntity_invoke(virtualMachine, class0, "publish",
+        "i:(Point)", &object, 1).m_integer;
+    ZEN_TEST_CHECK(failures, count == 1);
+    zen_Slot_t head = zen_TestEntity_invoke(virtualMachine, class0, "head",
+        "(Point):v", NULL, 0);
+    ZEN_TEST_CHECK(failures, head.m_reference == object.m_reference);
+
+    zen_MemoryManager_t* manager = virtualMachine->m_memoryManager;
+    zen_ProcessorThread_t* thread = virtualMachine->m_interpreter->m_processorThread;
+    zen_MemoryManager_mergeAllocationBuffer(manager, thread->m_allocationBuffer);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+        ZEN_GARBAGE_COLLECTION_REASON_ALLOCATION_FAILURE);
+    thread->m_allocationBuffer = zen_MemoryManager_makeAllocationBuffer(manager);
+
+    /* The new generation is filled again, so that a stale copy of the object
+     * would be overwritten.
+     */
+    int32_t i;
+    for (i = 0; i < 100000; i++) {
+        arguments[0].m_integer = i;
+        zen_TestEntity_invoke(virtualMachine, class0, "make", "(Point):ild", arguments, 3);
+    }
+
+    head = zen_TestEntity_invoke(virtualMachine, class0, "head", "(Point):v", NULL, 0);
+    ZEN_TEST_CHECK(failures, head.m_reference != 0);
+    if (head.m_reference == 0) {
+        return failures;
+    }
+    zen_Object_t* moved = (zen_Object_t*)head.m_reference;
+    ZEN_TEST_CHECK(failures, moved->m_class == class0);
+    ZEN_TEST_CHECK(failures, *(int32_t*)((uint8_t*)moved +
+        zen_ClassTest_getField(class0, "count")->m_offset) == 777);
+
+    count = zen_TestEntity_invoke(virtualMachine, class0, "publish", "i:(Point)",
+        &head, 1).m_integer;
+    ZEN_TEST_CHECK(failures, count == 2);
+
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    zen_VirtualMachineConfiguration_t* configuration = zen_VirtualMachineConfiguration_new();
+    zen_VirtualMachine_t* virtualMachine = zen_VirtualMachine_new(configuration);
+    zen_Class_t* class0 = zen_ClassTest_loadPoint(virtualMachine);
+
+    int32_t failures = 0;
+    failures += zen_ClassTest_testLayout(class0);
+    failures += zen_ClassTest_testStore(virtualMachine, class0);
+    failures += zen_ClassTest_testLoad(virtualMachine, class0);
+    failures += zen_ClassTest_testStatic(virtualMachine, class0);
+
+    zen_VirtualMachine_delete(virtualMachine);
+    zen_VirtualMachineConfiguration_delete(configuration);
+
+    return (failures == 0)? 0 : 1;
+}
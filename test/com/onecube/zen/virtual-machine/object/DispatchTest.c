@@ -0,0 +1,250 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/feb/EntityFlag.h>
+
+/*******************************************************************************
+ * DispatchTest                                                                *
+ *******************************************************************************/
+
+#define ZEN_DISPATCH_TEST_INDEX(index) (((index) & 0xFF00) >> 8), ((index) & 0x00FF)
+
+/* The hierarchy looks like this.
+ *
+ *     Shape          Named
+ *       |              |
+ *     Square           |
+ *       |              |
+ *       +---- Tile ----+
+ *
+ * Square overrides area. Tile overrides area, which it inherits through its
+ * primary superclass, and name, which it inherits through its secondary
+ * superclass. Every instance function returns a constant, which identifies
+ * the implementation.
+ */
+struct zen_DispatchTest_Implementation_t {
+    const char* m_name;
+    int8_t m_value;
+};
+
+typedef struct zen_DispatchTest_Implementation_t zen_DispatchTest_Implementation_t;
+
+static zen_Class_t* zen_DispatchTest_loadClass(zen_VirtualMachine_t* virtualMachine,
+    const char* descriptor, const char** superclasses, int32_t superclassCount,
+    const zen_DispatchTest_Implementation_t* implementations, int32_t implementationCount) {
+    zen_TestEntity_t* entity = zen_TestEntity_new(descriptor);
+    int32_t i;
+    for (i = 0; i < superclassCount; i++) {
+        zen_TestEntity_addSuperclass(entity, superclasses[i]);
+    }
+
+    for (i = 0; i < implementationCount; i++) {
+        uint8_t implementation[] = {
+            ZEN_BYTE_CODE_PUSH_B, (uint8_t)implementations[i].m_value,
+            ZEN_BYTE_CODE_RETURN_I
+        };
+        zen_TestEntity_addFunction(entity, 0, implementations[i].m_name, "i:v",
+            1, 1, implementation, sizeof (implementation));
+    }
+
+    uint16_t classIndex = zen_TestEntity_getClassIndex(entity);
+    uint8_t make[] = {
+        ZEN_BYTE_CODE_NEW, ZEN_DISPATCH_TEST_INDEX(classIndex),
+        ZEN_BYTE_CODE_RETURN_A
+    };
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "make", "(Object):v",
+        1, 0, make, sizeof (make));
+
+    zen_Class_t* class0 = zen_TestEntity_load(entity, virtualMachine);
+    zen_TestEntity_delete(entity);
+
+    return class0;
+}
+
+/* The caller invokes each virtual function through the class which declares
+ * it. Therefore, the functions of Shape are dispatched through the virtual
+ * function table, and the functions of Named are dispatched through the
+ * interface table of Tile.
+ */
+static zen_Class_t* zen_DispatchTest_loadCaller(zen_VirtualMachine_t* virtualMachine) {
+    const char* declaringClasses[] = { "Shape", "Shape", "Named", "Named" };
+    const char* names[] = { "area", "sides", "name", "tag" };
+    const char* descriptors[] = { "i:(Shape)", "i:(Shape)", "i:(Named)", "i:(Named)" };
+
+    zen_TestEntity_t* entity = zen_TestEntity_new("Caller");
+    int32_t i;
+    for (i = 0; i < 4; i++) {
+        uint16_t classIndex = zen_TestEntity_addClass(entity, declaringClasses[i]);
+        uint16_t functionIndex = zen_TestEntity_addFunctionReference(entity,
+            classIndex, names[i], "i:v");
+        uint8_t call[] = {
+            ZEN_BYTE_CODE_LOAD_A, 0,
+            ZEN_BYTE_CODE_INVOKE_VIRTUAL, ZEN_DISPATCH_TEST_INDEX(functionIndex),
+            ZEN_BYTE_CODE_RETURN_I
+        };
+        zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, names[i],
+            descriptors[i], 1, 1, call, sizeof (call));
+    }
+
+    zen_Class_t* class0 = zen_TestEntity_load(entity, virtualMachine);
+    zen_TestEntity_delete(entity);
+
+    return class0;
+}
+
+static zen_Function_t* zen_DispatchTest_getFunction(zen_Class_t* class0,
+    const char* name) {
+    jtk_CString_t* name0 = jtk_CString_new((const uint8_t*)name);
+    jtk_CString_t* descriptor = jtk_CString_new((const uint8_t*)"i:v");
+    zen_Function_t* function = zen_Class_getInstanceFunction(class0, name0, descriptor);
+    jtk_CString_delete(name0);
+    jtk_CString_delete(descriptor);
+
+    return function;
+}
+
+static zen_Slot_t zen_DispatchTest_make(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0) {
+    return zen_TestEntity_invoke(virtualMachine, class0, "make", "(Object):v",
+        NULL, 0);
+}
+
+static int32_t zen_DispatchTest_call(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* caller, const char* name, const char* descriptor, zen_Slot_t object) {
+    return zen_TestEntity_invoke(virtualMachine, caller, name, descriptor,
+        &object, 1).m_integer;
+}
+
+/* Virtual Function Table
+ *
+ * An override takes the slot of the function it overrides, and a function
+ * which is not overridden is inherited in its slot. A call site which sees
+ * both classes finds the implementation of each.
+ */
+static int32_t zen_DispatchTest_testVirtualFunctionTable(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* caller, zen_Class_t* shape, zen_Class_t* square) {
+    int32_t failures = 0;
+
+    zen_Function_t* shapeArea = zen_DispatchTest_getFunction(shape, "area");
+    zen_Function_t* shapeSides = zen_DispatchTest_getFunction(shape, "sides");
+    zen_Function_t* squareArea = zen_DispatchTest_getFunction(square, "area");
+    ZEN_TEST_CHECK(failures, shape->m_depth == 0);
+    ZEN_TEST_CHECK(failures, square->m_depth == 1);
+    ZEN_TEST_CHECK(failures, square->m_primarySuperclasses[0] == shape);
+    ZEN_TEST_CHECK(failures, square->m_vtableSize == shape->m_vtableSize);
+    ZEN_TEST_CHECK(failures, squareArea->m_vtableIndex == shapeArea->m_vtableIndex);
+    ZEN_TEST_CHECK(failures, square->m_vtable[shapeArea->m_vtableIndex] == squareArea);
+    ZEN_TEST_CHECK(failures, square->m_vtable[shapeSides->m_vtableIndex] == shapeSides);
+    ZEN_TEST_CHECK(failures, zen_Class_dispatch(square, shapeArea) == squareArea);
+
+    zen_Slot_t shapeObject = zen_DispatchTest_make(virtualMachine, shape);
+    zen_Slot_t squareObject = zen_DispatchTest_make(virtualMachine, square);
+    int32_t i;
+    for (i = 0; i < 3; i++) {
+        ZEN_TEST_CHECK(failures, zen_DispatchTest_call(virtualMachine, caller,
+            "area", "i:(Shape)", shapeObject) == 1);
+        ZEN_TEST_CHECK(failures, zen_DispatchTest_call(virtualMachine, caller,
+            "area", "i:(Shape)", squareObject) == 4);
+        ZEN_TEST_CHECK(failures, zen_DispatchTest_call(virtualMachine, caller,
+            "sides", "i:(Shape)", squareObject) == 0);
+    }
+
+    return failures;
+}
+
+/* Interface Table
+ *
+ * The functions of the secondary superclass are found in the interface table
+ * of the subclass. The override in the subclass replaces the implementation
+ * of the secondary superclass, while the function which is not overridden is
+ * inherited. The primary chain continues to use the virtual function table.
+ */
+static int32_t zen_DispatchTest_testInterfaceTable(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* caller, zen_Class_t* square, zen_Class_t* named, zen_Class_t* tile) {
+    int32_t failures = 0;
+
+    zen_Function_t* namedName = zen_DispatchTest_getFunction(named, "name");
+    zen_Function_t* namedTag = zen_DispatchTest_getFunction(named, "tag");
+    zen_Function_t* tileName = zen_DispatchTest_getFunction(tile, "name");
+    ZEN_TEST_CHECK(failures, tile->m_depth == 2);
+    ZEN_TEST_CHECK(failures, tile->m_primarySuperclasses[1] == square);
+    ZEN_TEST_CHECK(failures, tile->m_interfaceTableCount == 1);
+    ZEN_TEST_CHECK(failures, tile->m_interfaceTables[0].m_superclass == named);
+    ZEN_TEST_CHECK(failures, zen_Class_dispatch(tile, namedName) == tileName);
+    ZEN_TEST_CHECK(failures, zen_Class_dispatch(tile, namedTag) == namedTag);
+
+    zen_Slot_t namedObject = zen_DispatchTest_make(virtualMachine, named);
+    zen_Slot_t tileObject = zen_DispatchTest_make(virtualMachine, tile);
+    int32_t i;
+    for (i = 0; i < 3; i++) {
+        ZEN_TEST_CHECK(failures, zen_DispatchTest_call(virtualMachine, caller,
+            "name", "i:(Named)", namedObject) == 10);
+        ZEN_TEST_CHECK(failures, zen_DispatchTest_call(virtualMachine, caller,
+            "name", "i:(Named)", tileObject) == 30);
+        ZEN_TEST_CHECK(failures, zen_DispatchTest_call(virtualMachine, caller,
+            "tag", "i:(Named)", tileObject) == 20);
+        ZEN_TEST_CHECK(failures, zen_DispatchTest_call(virtualMachine, caller,
+            "area", "i:(Shape)", tileObject) == 9);
+        ZEN_TEST_CHECK(failures, zen_DispatchTest_call(virtualMachine, caller,
+            "sides", "i:(Shape)", tileObject) == 0);
+    }
+
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    zen_VirtualMachineConfiguration_t* configuration = zen_VirtualMachineConfiguration_new();
+    zen_VirtualMachine_t* virtualMachine = zen_VirtualMachine_new(configuration);
+
+    const zen_DispatchTest_Implementation_t shapeFunctions[] = {
+        { "area", 1 }, { "sides", 0 }
+    };
+    const zen_DispatchTest_Implementation_t squareFunctions[] = {
+        { "area", 4 }
+    };
+    const zen_DispatchTest_Implementation_t namedFunctions[] = {
+        { "name", 10 }, { "tag", 20 }
+    };
+    const zen_DispatchTest_Implementation_t tileFunctions[] = {
+        { "area", 9 }, { "name", 30 }
+    };
+    const char* squareSuperclasses[] = { "Shape" };
+    const char* tileSuperclasses[] = { "Square", "Named" };
+
+    zen_Class_t* shape = zen_DispatchTest_loadClass(virtualMachine, "Shape", NULL, 0,
+        shapeFunctions, 2);
+    zen_Class_t* square = zen_DispatchTest_loadClass(virtualMachine, "Square",
+        squareSuperclasses, 1, squareFunctions, 1);
+    zen_Class_t* named = zen_DispatchTest_loadClass(virtualMachine, "Named", NULL, 0,
+        namedFunctions, 2);
+    zen_Class_t* tile = zen_DispatchTest_loadClass(virtualMachine, "Tile",
+        tileSuperclasses, 2, tileFunctions, 2);
+    zen_Class_t* caller = zen_DispatchTest_loadCaller(virtualMachine);
+
+    int32_t failures = 0;
+    failures += zen_DispatchTest_testVirtualFunctionTable(virtualMachine, caller,
+        shape, square);
+    failures += zen_DispatchTest_testInterfaceTable(virtualMachine, caller,
+        square, named, tile);
+
+    zen_VirtualMachine_delete(virtualMachine);
+    zen_VirtualMachineConfiguration_delete(configuration);
+
+    return (failures == 0)? 0 : 1;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <pthread.h>
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/processor/InlineCache.h>
+
+/*******************************************************************************
+ * InlineCacheTest                                                             *
+ *******************************************************************************/
+
+#define ZEN_INLINE_CACHE_TEST_THREAD_COUNT 8
+#define ZEN_INLINE_CACHE_TEST_ROUND_COUNT 2000
+
+/* The classes and functions are never dereferenced by the inline cache.
+ * Therefore, distinct addresses stand in for them. The function of a class is
+ * the address right after it.
+ */
+static uint8_t zen_InlineCacheTest_classes[ZEN_INLINE_CACHE_TEST_THREAD_COUNT * 2];
+
+#define ZEN_INLINE_CACHE_TEST_CLASS(i) ((zen_Class_t*)&zen_InlineCacheTest_classes[(i) * 2])
+#define ZEN_INLINE_CACHE_TEST_FUNCTION(i) ((zen_Function_t*)&zen_InlineCacheTest_classes[(i) * 2 + 1])
+
+struct zen_InlineCacheTest_Worker_t {
+    pthread_barrier_t* m_barrier;
+    zen_InlineCache_t* volatile* m_inlineCache;
+    int32_t m_index;
+    int32_t m_failures;
+};
+
+typedef struct zen_InlineCacheTest_Worker_t zen_InlineCacheTest_Worker_t;
+
+/* Every worker misses on its own class, then looks it up again, as the
+ * interpreter does at a virtual call site.
+ */
+static void* zen_InlineCacheTest_run(void* argument) {
+    zen_InlineCacheTest_Worker_t* worker = (zen_InlineCacheTest_Worker_t*)argument;
+    zen_Class_t* class0 = ZEN_INLINE_CACHE_TEST_CLASS(worker->m_index);
+    zen_Function_t* function = ZEN_INLINE_CACHE_TEST_FUNCTION(worker->m_index);
+
+    int32_t round;
+    for (round = 0; round < ZEN_INLINE_CACHE_TEST_ROUND_COUNT; round++) {
+        pthread_barrier_wait(worker->m_barrier);
+
+        zen_InlineCache_t* inlineCache = *worker->m_inlineCache;
+        zen_Function_t* result = zen_InlineCache_lookup(inlineCache, class0);
+        if (result == NULL) {
+            zen_InlineCache_update(inlineCache, class0, function);
+        }
+        else if (result != function) {
+            worker->m_failures++;
+        }
+
+        /* Once published, an entry is found with its function. */
+        result = zen_InlineCache_lookup(inlineCache, class0);
+        if ((result != NULL) && (result != function)) {
+            worker->m_failures++;
+        }
+
+        pthread_barrier_wait(worker->m_barrier);
+    }
+    return NULL;
+}
+
+static int32_t zen_InlineCacheTest_testConcurrentUpdate() {
+    int32_t failures = 0;
+
+    pthread_barrier_t barrier;
+    /* The main thread replaces the inline cache between the rounds. */
+    pthread_barrier_init(&barrier, NULL, ZEN_INLINE_CACHE_TEST_THREAD_COUNT + 1);
+    zen_InlineCache_t* volatile inlineCache = zen_InlineCache_new();
+
+    pthread_t threads[ZEN_INLINE_CACHE_TEST_THREAD_COUNT];
+    zen_InlineCacheTest_Worker_t workers[ZEN_INLINE_CACHE_TEST_THREAD_COUNT];
+    int32_t i;
+    for (i = 0; i < ZEN_INLINE_CACHE_TEST_THREAD_COUNT; i++) {
+        workers[i].m_barrier = &barrier;
+        workers[i].m_inlineCache = &inlineCache;
+        workers[i].m_index = i;
+        workers[i].m_failures = 0;
+        pthread_create(&threads[i], NULL, zen_InlineCacheTest_run, &workers[i]);
+    }
+
+    int32_t round;
+    for (round = 0; round < ZEN_INLINE_CACHE_TEST_ROUND_COUNT; round++) {
+        pthread_barrier_wait(&barrier);
+        pthread_barrier_wait(&barrier);
+
+        /* Exactly as many entries as the capacity were published, each with
+         * the function of its class. The remaining workers turned the cache
+         * megamorphic.
+         */
+        int32_t published = 0;
+        for (i = 0; i < ZEN_INLINE_CACHE_CAPACITY; i++) {
+            zen_Class_t* class0 = inlineCache->m_classes[i];
+            if (class0 != NULL) {
+                published++;
+                ZEN_TEST_CHECK(failures, (uint8_t*)inlineCache->m_functions[i] ==
+                    (uint8_t*)class0 + 1);
+            }
+        }
+        ZEN_TEST_CHECK(failures, published == ZEN_INLINE_CACHE_CAPACITY);
+        ZEN_TEST_CHECK(failures, inlineCache->m_megamorphic);
+
+        zen_InlineCache_delete(inlineCache);
+        inlineCache = zen_InlineCache_new();
+    }
+
+    for (i = 0; i < ZEN_INLINE_CACHE_TEST_THREAD_COUNT; i++) {
+        pthread_join(threads[i], NULL);
+        failures += workers[i].m_failures;
+    }
+    zen_InlineCache_delete(inlineCache);
+    pthread_barrier_destroy(&barrier);
+
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    int32_t failures = 0;
+    failures += zen_InlineCacheTest_testConcurrentUpdate();
+
+    return (failures == 0)? 0 : 1;
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/feb/EntityFlag.h>
+#include <com/onecube/zen/virtual-machine/jit/TemplateCompiler.h>
+
+/*******************************************************************************
+ * InterpreterTest                                                             *
+ *******************************************************************************/
+
+/* The operands of the branches are relative to the byte code of the branch. */
+#define ZEN_INTERPRETER_TEST_OFFSET(offset) (((offset) & 0xFF00) >> 8), ((offset) & 0x00FF)
+
+static int32_t zen_InterpreterTest_invokeInteger(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, const char* name, const char* descriptor, int32_t argument) {
+    zen_Slot_t slot;
+    slot.m_integer = argument;
+    return zen_TestEntity_invoke(virtualMachine, class0, name, descriptor, &slot, 1).m_integer;
+}
+
+/* The sum of the integers from 1 to n. The local variables are n, the sum,
+ * and the counter, in that order.
+ */
+static const uint8_t zen_InterpreterTest_sum[] = {
+    /* 0 */ ZEN_BYTE_CODE_PUSH_I0,
+    /* 1 */ ZEN_BYTE_CODE_STORE_I, 1,
+    /* 3 */ ZEN_BYTE_CODE_PUSH_I1,
+    /* 4 */ ZEN_BYTE_CODE_STORE_I, 2,
+    /* 6 */ ZEN_BYTE_CODE_LOAD_I, 2,
+    /* 8 */ ZEN_BYTE_CODE_LOAD_I, 0,
+    /* 10 */ ZEN_BYTE_CODE_JUMP_GT_I, ZEN_INTERPRETER_TEST_OFFSET(29 - 10),
+    /* 13 */ ZEN_BYTE_CODE_LOAD_I, 1,
+    /* 15 */ ZEN_BYTE_CODE_LOAD_I, 2,
+    /* 17 */ ZEN_BYTE_CODE_ADD_I,
+    /* 18 */ ZEN_BYTE_CODE_STORE_I, 1,
+    /* 20 */ ZEN_BYTE_CODE_LOAD_I, 2,
+    /* 22 */ ZEN_BYTE_CODE_PUSH_I1,
+    /* 23 */ ZEN_BYTE_CODE_ADD_I,
+    /* 24 */ ZEN_BYTE_CODE_STORE_I, 2,
+    /* 26 */ ZEN_BYTE_CODE_JUMP, ZEN_INTERPRETER_TEST_OFFSET(6 - 26),
+    /* 29 */ ZEN_BYTE_CODE_LOAD_I, 1,
+    /* 31 */ ZEN_BYTE_CODE_RETURN_I
+};
+
+static zen_Class_t* zen_InterpreterTest_loadSum(zen_VirtualMachine_t* virtualMachine,
+    const char* className) {
+    zen_TestEntity_t* entity = zen_TestEntity_new(className);
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "sum", "i:i", 2, 3,
+        zen_InterpreterTest_sum, sizeof (zen_InterpreterTest_sum));
+    zen_Class_t* class0 = zen_TestEntity_load(entity, virtualMachine);
+    zen_TestEntity_delete(entity);
+
+    return class0;
+}
+
+/* Loop
+ *
+ * The sum of the integers from 1 to n exercises the loads and stores of local
+ * variables, arithmetic, and the forward and backward branches. The larger sum
+ * takes enough backward branches to compile the function.
+ */
+static int32_t zen_InterpreterTest_testLoop(zen_VirtualMachine_t* virtualMachine) {
+    int32_t failures = 0;
+
+    zen_Class_t* class0 = zen_InterpreterTest_loadSum(virtualMachine, "LoopTest");
+
+    jtk_CString_t* name = jtk_CString_new((const uint8_t*)"sum");
+    jtk_CString_t* descriptor = jtk_CString_new((const uint8_t*)"i:i");
+    zen_Function_t* function = zen_Class_getStaticFunction(class0, name, descriptor);
+    jtk_CString_delete(name);
+    jtk_CString_delete(descriptor);
+#ifdef ZEN_INTERPRETER_PREDECODE
+    ZEN_TEST_CHECK(failures, function->m_instructionAttribute->m_decodedInstructions != NULL);
+#endif
+
+    ZEN_TEST_CHECK(failures, zen_InterpreterTest_invokeInteger(virtualMachine, class0, "sum", "i:i", 0) == 0);
+    ZEN_TEST_CHECK(failures, zen_InterpreterTest_invokeInteger(virtualMachine, class0, "sum", "i:i", 1) == 1);
+    ZEN_TEST_CHECK(failures, zen_InterpreterTest_invokeInteger(virtualMachine, class0, "sum", "i:i", 100) == 5050);
+    ZEN_TEST_CHECK(failures, zen_InterpreterTest_invokeInteger(virtualMachine, class0, "sum", "i:i", 20000) == 200010000);
+#ifdef ZEN_JIT
+    /* The function runs compiled, hereafter. */
+    ZEN_TEST_CHECK(failures, function->m_compiledCode != NULL);
+#endif
+    ZEN_TEST_CHECK(failures, zen_InterpreterTest_invokeInteger(virtualMachine, class0, "sum", "i:i", 100) == 5050);
+
+    return failures;
+}
+
+#ifdef ZEN_INTERPRETER_PROFILE
+
+/* Dispatch Count
+ *
+ * Without superinstructions, every instruction of `sum` is dispatched: four
+ * to initialize the locals, twelve in each iteration, and five to exit. The
+ * superinstructions should remove at least 30% of these dispatches.
+ */
+static int32_t zen_InterpreterTest_testDispatchCount(zen_VirtualMachine_t* virtualMachine) {
+    int32_t failures = 0;
+
+    /* The loop runs interpreted, because it takes fewer backward branches
+     * than the compiler requires.
+     */
+    int32_t n = 1000;
+    zen_Class_t* class0 = zen_InterpreterTest_loadSum(virtualMachine, "DispatchTest");
+    zen_InstructionProfiler_t* profiler = virtualMachine->m_interpreter->m_processorThread->m_profiler;
+    uint64_t before = profiler->m_dispatchCount;
+    ZEN_TEST_CHECK(failures, zen_InterpreterTest_invokeInteger(virtualMachine, class0, "sum", "i:i", n) == 500500);
+    uint64_t dispatchCount = profiler->m_dispatchCount - before;
+    uint64_t instructionCount = 4 + (12 * (uint64_t)n) + 5;
+
+    printf("[dispatch count] sum(%d): %llu dispatches for %llu instructions (%llu%% fewer)\n",
+        n, (unsigned long long)dispatchCount, (unsigned long long)instructionCount,
+        (unsigned long long)(100 - ((dispatchCount * 100) / instructionCount)));
+#ifdef ZEN_INTERPRETER_SUPERINSTRUCTIONS
+    ZEN_TEST_CHECK(failures, (dispatchCount * 10) <= (instructionCount * 7));
+#else
+    ZEN_TEST_CHECK(failures, dispatchCount == instructionCount);
+#endif
+
+    return failures;
+}
+
+#endif
+
+/* Constant
+ *
+ * The integer in the constant pool is resolved when the instructions are
+ * decoded. The immediate operands are sign extended.
+ */
+static int32_t zen_InterpreterTest_testConstant(zen_VirtualMachine_t* virtualMachine) {
+    int32_t failures = 0;
+
+    zen_TestEntity_t* entity = zen_TestEntity_new("ConstantTest");
+    uint16_t constantIndex = zen_TestEntity_addInteger(entity, 123456789);
+    uint8_t compute[] = {
+        ZEN_BYTE_CODE_LOAD_CPR, constantIndex,
+        ZEN_BYTE_CODE_PUSH_S, ZEN_INTERPRETER_TEST_OFFSET(-300),
+        ZEN_BYTE_CODE_PUSH_B, (uint8_t)-5,
+        ZEN_BYTE_CODE_MULTIPLY_I,
+        ZEN_BYTE_CODE_ADD_I,
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_SUBTRACT_I,
+        ZEN_BYTE_CODE_RETURN_I
+    };
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "compute", "i:i", 3, 1,
+        compute, sizeof (compute));
+    zen_Class_t* class0 = zen_TestEntity_load(entity, virtualMachine);
+    zen_TestEntity_delete(entity);
+
+    ZEN_TEST_CHECK(failures, zen_InterpreterTest_invokeInteger(virtualMachine, class0, "compute", "i:i", 0) == 123458289);
+    ZEN_TEST_CHECK(failures, zen_InterpreterTest_invokeInteger(virtualMachine, class0, "compute", "i:i", 289) == 123458000);
+
+    return failures;
+}
+
+/* Invocation
+ *
+ * The arguments of a static function are passed on the operand stack of the
+ * caller. The callee is invoked often enough to compile it.
+ */
+static int32_t zen_InterpreterTest_testInvocation(zen_VirtualMachine_t* virtualMachine) {
+    int32_t failures = 0;
+
+    zen_TestEntity_t* entity = zen_TestEntity_new("InvocationTest");
+    uint16_t functionIndex = zen_TestEntity_addFunctionReference(entity,
+        zen_TestEntity_getClassIndex(entity), "multiply", "i:ii");
+    uint8_t multiply[] = {
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_LOAD_I, 1,
+        ZEN_BYTE_CODE_MULTIPLY_I,
+        ZEN_BYTE_CODE_RETURN_I
+    };
+    uint8_t multiplyAdd[] = {
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_LOAD_I, 1,
+        ZEN_BYTE_CODE_INVOKE_STATIC, ZEN_INTERPRETER_TEST_OFFSET(functionIndex),
+        ZEN_BYTE_CODE_LOAD_I, 2,
+        ZEN_BYTE_CODE_ADD_I,
+        ZEN_BYTE_CODE_RETURN_I
+    };
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "multiply", "i:ii", 2, 2,
+        multiply, sizeof (multiply));
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "multiplyAdd", "i:iii", 2, 3,
+        multiplyAdd, sizeof (multiplyAdd));
+    zen_Class_t* class0 = zen_TestEntity_load(entity, virtualMachine);
+    zen_TestEntity_delete(entity);
+
+    int32_t i;
+    for (i = -1500; i < 1500; i++) {
+        zen_Slot_t arguments[3];
+        arguments[0].m_integer = i;
+        arguments[1].m_integer = 7;
+        arguments[2].m_integer = -i;
+        int32_t result = zen_TestEntity_invoke(virtualMachine, class0, "multiplyAdd",
+            "i:iii", arguments, 3).m_integer;
+        if (result != (i * 6)) {
+            ZEN_TEST_CHECK(failures, result == (i * 6));
+            break;
+        }
+    }
+
+    return failures;
+}
+
+/* Exception
+ *
+ * An exception which no function handles unwinds the stack frames up to, and
+ * including, the stack frame on which the interpreter was entered. The stack
+ * frames below it belong to the caller of the interpreter.
+ */
+static int32_t zen_InterpreterTest_testException(zen_VirtualMachine_t* virtualMachine) {
+    int32_t failures = 0;
+
+    zen_TestEntity_t* entity = zen_TestEntity_new("ExceptionTest");
+    uint16_t functionIndex = zen_TestEntity_addFunctionReference(entity,
+        zen_TestEntity_getClassIndex(entity), "quotient", "i:ii");
+    uint8_t quotient[] = {
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_LOAD_I, 1,
+        ZEN_BYTE_CODE_DIVIDE_I,
+        ZEN_BYTE_CODE_RETURN_I
+    };
+    uint8_t increment[] = {
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_LOAD_I, 1,
+        ZEN_BYTE_CODE_INVOKE_STATIC, ZEN_INTERPRETER_TEST_OFFSET(functionIndex),
+        ZEN_BYTE_CODE_PUSH_I1,
+        ZEN_BYTE_CODE_ADD_I,
+        ZEN_BYTE_CODE_RETURN_I
+    };
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "quotient", "i:ii", 2, 2,
+        quotient, sizeof (quotient));
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "increment", "i:ii", 2, 2,
+        increment, sizeof (increment));
+    zen_Class_t* class0 = zen_TestEntity_load(entity, virtualMachine);
+    zen_TestEntity_delete(entity);
+
+    zen_InvocationStack_t* invocationStack =
+        virtualMachine->m_interpreter->m_processorThread->m_invocationStack;
+    int32_t depth = zen_InvocationStack_getDepth(invocationStack);
+
+    zen_Slot_t arguments[2];
+    arguments[0].m_integer = 7;
+    arguments[1].m_integer = 0;
+    zen_Slot_t result = zen_TestEntity_invoke(virtualMachine, class0, "increment",
+        "i:ii", arguments, 2);
+    ZEN_TEST_CHECK(failures, result.m_long == 0);
+    ZEN_TEST_CHECK(failures, zen_InvocationStack_getDepth(invocationStack) == depth);
+
+    /* The invocation stack is intact. */
+    arguments[0].m_integer = 12;
+    arguments[1].m_integer = 3;
+    result = zen_TestEntity_invoke(virtualMachine, class0, "increment", "i:ii", arguments, 2);
+    ZEN_TEST_CHECK(failures, result.m_integer == 5);
+    ZEN_TEST_CHECK(failures, zen_InvocationStack_getDepth(invocationStack) == depth);
+
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    zen_VirtualMachineConfiguration_t* configuration = zen_VirtualMachineConfiguration_new();
+    zen_VirtualMachine_t* virtualMachine = zen_VirtualMachine_new(configuration);
+
+    int32_t failures = 0;
+    failures += zen_InterpreterTest_testLoop(virtualMachine);
+    failures += zen_InterpreterTest_testConstant(virtualMachine);
+    failures += zen_InterpreterTest_testInvocation(virtualMachine);
+    failures += zen_InterpreterTest_testException(virtualMachine);
+#ifdef ZEN_INTERPRETER_PROFILE
+    failures += zen_InterpreterTest_testDispatchCount(virtualMachine);
+#endif
+
+    zen_VirtualMachine_delete(virtualMachine);
+    zen_VirtualMachineConfiguration_delete(configuration);
+
+    return (failures == 0)? 0 : 1;
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright 2018-2019 OneCube
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2026
+
+#include <limits.h>
+
+#include <com/onecube/zen/virtual-machine/TestEntity.h>
+#include <com/onecube/zen/virtual-machine/feb/EntityFlag.h>
+#include <com/onecube/zen/virtual-machine/feb/SwitchInstruction.h>
+
+/*******************************************************************************
+ * SwitchTest                                                                  *
+ *******************************************************************************/
+
+static void zen_SwitchTest_writeInteger(uint8_t* bytes, int32_t value) {
+    bytes[0] = ((uint32_t)value & 0xFF000000) >> 24;
+    bytes[1] = ((uint32_t)value & 0x00FF0000) >> 16;
+    bytes[2] = ((uint32_t)value & 0x0000FF00) >> 8;
+    bytes[3] = (uint32_t)value & 0x000000FF;
+}
+
+static int32_t zen_SwitchTest_invokeInteger(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, const char* name, const char* descriptor, int32_t argument) {
+    zen_Slot_t slot;
+    slot.m_integer = argument;
+    return zen_TestEntity_invoke(virtualMachine, class0, name, descriptor, &slot, 1).m_integer;
+}
+
+/* Length
+ *
+ * The arguments begin at the next multiple of four after the byte code,
+ * whatever the offset of the byte code. The arguments which extend beyond the
+ * instructions, an inverted range, and a negative count are malformed.
+ */
+static int32_t zen_SwitchTest_testLength() {
+    int32_t failures = 0;
+
+    uint8_t instructions[64] = { 0 };
+    int32_t ip;
+    for (ip = 0; ip < 4; ip++) {
+        int32_t index = zen_SwitchInstruction_getArgumentIndex(ip);
+        ZEN_TEST_CHECK(failures, (index > ip) && (index <= (ip + 4)) && ((index % 4) == 0));
+
+        /* default, low = 1, high = 3, and three offsets */
+        instructions[ip] = ZEN_BYTE_CODE_SWITCH_TABLE;
+        zen_SwitchTest_writeInteger(instructions + index + 4, 1);
+        zen_SwitchTest_writeInteger(instructions + index + 8, 3);
+        int32_t length = (index - ip) + 12 + 12;
+        ZEN_TEST_CHECK(failures, zen_SwitchInstruction_getLength(instructions, ip, 64) == length);
+        ZEN_TEST_CHECK(failures, zen_SwitchInstruction_getLength(instructions, ip, ip + length) == length);
+        ZEN_TEST_CHECK(failures, zen_SwitchInstruction_getLength(instructions, ip, ip + length - 1) == -1);
+        zen_SwitchTest_writeInteger(instructions + index + 4, 4);
+        ZEN_TEST_CHECK(failures, zen_SwitchInstruction_getLength(instructions, ip, 64) == -1);
+
+        /* default, count = 2, two keys, and two offsets */
+        instructions[ip] = ZEN_BYTE_CODE_SWITCH_SEARCH;
+        zen_SwitchTest_writeInteger(instructions + index + 4, 2);
+        length = (index - ip) + 8 + 16;
+        ZEN_TEST_CHECK(failures, zen_SwitchInstruction_getLength(instructions, ip, 64) == length);
+        ZEN_TEST_CHECK(failures, zen_SwitchInstruction_getLength(instructions, ip, ip + length - 1) == -1);
+        zen_SwitchTest_writeInteger(instructions + index + 4, -1);
+        ZEN_TEST_CHECK(failures, zen_SwitchInstruction_getLength(instructions, ip, 64) == -1);
+    }
+
+    /* A range which spans the integers does not overflow the length. */
+    instructions[0] = ZEN_BYTE_CODE_SWITCH_TABLE;
+    zen_SwitchTest_writeInteger(instructions + 8, INT_MIN);
+    zen_SwitchTest_writeInteger(instructions + 12, INT_MAX);
+    ZEN_TEST_CHECK(failures, zen_SwitchInstruction_getLength(instructions, 0, 64) == -1);
+
+    return failures;
+}
+
+/* Search
+ *
+ * For every number of keys, each key is found at its own index, and the
+ * integers around the keys are not found.
+ */
+static int32_t zen_SwitchTest_testSearch() {
+    int32_t failures = 0;
+
+    uint8_t keys[33 * 4];
+    int32_t count;
+    for (count = 0; count <= 33; count++) {
+        int32_t i;
+        for (i = 0; i < count; i++) {
+            zen_SwitchTest_writeInteger(keys + (i * 4), (i * 3) - 40);
+        }
+        for (i = 0; i < count; i++) {
+            int32_t key = (i * 3) - 40;
+            ZEN_TEST_CHECK(failures, zen_SwitchInstruction_search(keys, count, key) == i);
+            ZEN_TEST_CHECK(failures, zen_SwitchInstruction_search(keys, count, key - 1) == -1);
+            ZEN_TEST_CHECK(failures, zen_SwitchInstruction_search(keys, count, key + 1) == -1);
+        }
+        ZEN_TEST_CHECK(failures, zen_SwitchInstruction_search(keys, count, INT_MIN) == -1);
+        ZEN_TEST_CHECK(failures, zen_SwitchInstruction_search(keys, count, INT_MAX) == -1);
+    }
+
+    zen_SwitchTest_writeInteger(keys, INT_MIN);
+    zen_SwitchTest_writeInteger(keys + 4, INT_MAX);
+    ZEN_TEST_CHECK(failures, zen_SwitchInstruction_search(keys, 2, INT_MIN) == 0);
+    ZEN_TEST_CHECK(failures, zen_SwitchInstruction_search(keys, 2, INT_MAX) == 1);
+    ZEN_TEST_CHECK(failures, zen_SwitchInstruction_search(keys, 2, 0) == -1);
+
+    return failures;
+}
+
+/* Switch Table
+ *
+ * The keys below the lowest key of the table wrap around to large indexes,
+ * which fall out of the table, exactly like the keys above the highest key.
+ */
+static int32_t zen_SwitchTest_testSwitchTable(zen_VirtualMachine_t* virtualMachine) {
+    int32_t failures = 0;
+
+    /* The switch instruction is at offset 2, its arguments begin at offset 4. */
+    uint8_t classify[54] = {
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_SWITCH_TABLE
+    };
+    zen_SwitchTest_writeInteger(classify + 4, 51 - 2);
+    zen_SwitchTest_writeInteger(classify + 8, -2);
+    zen_SwitchTest_writeInteger(classify + 12, 2);
+    int32_t i;
+    for (i = 0; i < 6; i++) {
+        int32_t target = 36 + (i * 3);
+        if (i < 5) {
+            zen_SwitchTest_writeInteger(classify + 16 + (i * 4), target - 2);
+        }
+        classify[target] = ZEN_BYTE_CODE_PUSH_B;
+        classify[target + 1] = (i < 5)? ((i + 1) * 10) : (uint8_t)-1;
+        classify[target + 2] = ZEN_BYTE_CODE_RETURN_I;
+    }
+
+    zen_TestEntity_t* entity = zen_TestEntity_new("SwitchTableTest");
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "classify", "i:i", 1, 1,
+        classify, sizeof (classify));
+    zen_Class_t* class0 = zen_TestEntity_load(entity, virtualMachine);
+    zen_TestEntity_delete(entity);
+
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", -2) == 10);
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", -1) == 20);
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", 0) == 30);
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", 1) == 40);
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", 2) == 50);
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", -3) == -1);
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", 3) == -1);
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", INT_MIN) == -1);
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", INT_MAX) == -1);
+
+    return failures;
+}
+
+/* Switch Search
+ *
+ * Every key is found by the binary search, and the keys between them fall to
+ * the default target. The switch instruction is at offset 3, therefore, its
+ * arguments follow it without any padding.
+ */
+static int32_t zen_SwitchTest_testSwitchSearch(zen_VirtualMachine_t* virtualMachine) {
+    int32_t failures = 0;
+
+    int32_t keys[] = { -1000, -1, 7, 100000, INT_MAX };
+    int32_t count = 5;
+    uint8_t classify[4 + 8 + (5 * 8) + (6 * 3)] = {
+        ZEN_BYTE_CODE_NOP,
+        ZEN_BYTE_CODE_LOAD_I, 0,
+        ZEN_BYTE_CODE_SWITCH_SEARCH
+    };
+    int32_t targets = 4 + 8 + (count * 8);
+    zen_SwitchTest_writeInteger(classify + 4, (targets + (count * 3)) - 3);
+    zen_SwitchTest_writeInteger(classify + 8, count);
+    int32_t i;
+    for (i = 0; i <= count; i++) {
+        int32_t target = targets + (i * 3);
+        if (i < count) {
+            zen_SwitchTest_writeInteger(classify + 12 + (i * 4), keys[i]);
+            zen_SwitchTest_writeInteger(classify + 12 + ((count + i) * 4), target - 3);
+        }
+        classify[target] = ZEN_BYTE_CODE_PUSH_B;
+        classify[target + 1] = (i < count)? (i + 1) : 0;
+        classify[target + 2] = ZEN_BYTE_CODE_RETURN_I;
+    }
+
+    zen_TestEntity_t* entity = zen_TestEntity_new("SwitchSearchTest");
+    zen_TestEntity_addFunction(entity, ZEN_ENTITY_FLAG_STATIC, "classify", "i:i", 1, 1,
+        classify, sizeof (classify));
+    zen_Class_t* class0 = zen_TestEntity_load(entity, virtualMachine);
+    zen_TestEntity_delete(entity);
+
+    for (i = 0; i < count; i++) {
+        ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", keys[i]) == (i + 1));
+        ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", keys[i] - 1) == 0);
+    }
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", 0) == 0);
+    ZEN_TEST_CHECK(failures, zen_SwitchTest_invokeInteger(virtualMachine, class0, "classify", "i:i", INT_MIN) == 0);
+
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    zen_VirtualMachineConfiguration_t* configuration = zen_VirtualMachineConfiguration_new();
+    zen_VirtualMachine_t* virtualMachine = zen_VirtualMachine_new(configuration);
+
+    int32_t failures = 0;
+    failures += zen_SwitchTest_testLength();
+    failures += zen_SwitchTest_testSearch();
+    failures += zen_SwitchTest_testSwitchTable(virtualMachine);
+    failures += zen_SwitchTest_testSwitchSearch(virtualMachine);
+
+    zen_VirtualMachine_delete(virtualMachine);
+    zen_VirtualMachineConfiguration_delete(configuration);
+
+    return (failures == 0)? 0 : 1;
+}